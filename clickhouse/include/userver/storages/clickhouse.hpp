@@ -4,8 +4,10 @@
 /// This file is mainly for documentation purposes and inclusion of all headers
 /// that are required for working with ClickHouse µserver component.
 
+#include <userver/storages/clickhouse/batch_inserter.hpp>
 #include <userver/storages/clickhouse/cluster.hpp>
 #include <userver/storages/clickhouse/component.hpp>
+#include <userver/storages/clickhouse/cursor.hpp>
 #include <userver/storages/clickhouse/execution_result.hpp>
 #include <userver/storages/clickhouse/options.hpp>
 #include <userver/storages/clickhouse/query.hpp>
@@ -22,6 +24,10 @@
 /// - Connection pooling;
 /// - Variadic template query parameter passing;
 /// - Query result extraction to C++ types;
+/// - Block by block fetching of large results, see
+///   storages::clickhouse::Cursor;
+/// - Batching of inserts in background, see
+///   storages::clickhouse::BatchInserter;
 /// - Mapping C++ types to native ClickHouse types.
 ///
 /// @section clickhouse_info More information
@@ -0,0 +1,110 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/batch_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BatchInserter
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/fwd.hpp>
+#include <userver/storages/clickhouse/impl/batch_inserter_base.hpp>
+#include <userver/storages/clickhouse/io/impl/validate.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// @brief Inserter that accumulates the rows of a table and inserts them
+/// in background in large batches.
+///
+/// ClickHouse handles a few large inserts much better than a lot of small
+/// ones. The rows are split into columns as they are pushed, and the
+/// buffered rows are inserted once there are
+/// BatchInserterSettings::max_batch_rows of them or once the first of them
+/// is BatchInserterSettings::flush_interval old. The batches are inserted one
+/// at a time at some host of the cluster.
+///
+/// Push waits while BatchInserterSettings::max_pending_rows rows are
+/// buffered or being inserted. The rows of a failed insert are dropped,
+/// failures are logged and accounted in the statistics.
+///
+/// The rest of the rows is inserted when the inserter is destroyed.
+///
+/// `Row` is expected to be a clickhouse-mapped type, see @ref clickhouse_io.
+///
+/// ## Usage example:
+///
+/// @snippet storages/tests/batch_inserter_chtest.cpp  Sample BatchInserter usage
+template <typename Row>
+class BatchInserter final {
+public:
+    /// @param cluster cluster to insert into
+    /// @param table_name table to insert into
+    /// @param column_names names of columns of the table
+    /// @param settings batching settings
+    BatchInserter(
+        ClusterPtr cluster,
+        std::string table_name,
+        std::vector<std::string> column_names,
+        const BatchInserterSettings& settings = {}
+    );
+
+    /// @brief Buffers the row for an insert.
+    /// @throws engine::WaitInterruptedException if the task is cancelled while
+    /// waiting for the space in the buffers
+    void Push(Row row);
+
+    /// @brief Inserts the buffered rows and waits until all the rows pushed
+    /// before the call are inserted or dropped.
+    void Flush();
+
+    /// Writes the statistics of the inserts
+    friend void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const BatchInserter& inserter) {
+        inserter.impl_.WriteStatistics(writer);
+    }
+
+private:
+    static std::vector<std::string> ValidateColumns(std::vector<std::string>&& column_names);
+
+    impl::BatchInserterBase impl_;
+};
+
+template <typename Row>
+BatchInserter<Row>::BatchInserter(
+    ClusterPtr cluster,
+    std::string table_name,
+    std::vector<std::string> column_names,
+    const BatchInserterSettings& settings
+)
+    : impl_{
+          std::move(cluster),
+          std::move(table_name),
+          ValidateColumns(std::move(column_names)),
+          settings,
+          [] { return std::make_unique<impl::RowsBuffer<Row>>(); }} {}
+
+template <typename Row>
+void BatchInserter<Row>::Push(Row row) {
+    impl_.Push([&row](impl::InsertionBuffer& buffer) {
+        static_cast<impl::RowsBuffer<Row>&>(buffer).Append(std::move(row));
+    });
+}
+
+template <typename Row>
+void BatchInserter<Row>::Flush() {
+    impl_.Flush();
+}
+
+template <typename Row>
+std::vector<std::string> BatchInserter<Row>::ValidateColumns(std::vector<std::string>&& column_names) {
+    io::impl::ValidateRowsMapping<Row>();
+    io::impl::ValidateColumnsCount<Row>(column_names.size());
+    return std::move(column_names);
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
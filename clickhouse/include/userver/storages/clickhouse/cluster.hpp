@@ -11,6 +11,7 @@
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/components/component_fwd.hpp>
 
+#include <userver/storages/clickhouse/cursor.hpp>
 #include <userver/storages/clickhouse/fwd.hpp>
 #include <userver/storages/clickhouse/impl/insertion_request.hpp>
 #include <userver/storages/clickhouse/impl/pool.hpp>
@@ -27,7 +28,8 @@ class ParameterStore;
 
 namespace impl {
 struct ClickhouseSettings;
-}
+class BatchInserterBase;
+}  // namespace impl
 
 /// @ingroup userver_clients
 ///
@@ -77,6 +79,33 @@ public:
     /// @overload
     ExecutionResult Execute(OptionalCommandControl, const Query& query, const ParameterStore& params) const;
 
+    /// @brief Execute a statement at some host of the cluster
+    /// with args as query parameters and fetch its result block by block.
+    ///
+    /// Unlike Execute, the result is never held in memory as a whole, which
+    /// suits statements with large results.
+    /// @note The execute timeout of the command control limits the whole time
+    /// of the statement, including the time the consumer spends on the blocks.
+    template <typename... Args>
+    Cursor ExecuteCursor(const Query& query, const Args&... args) const;
+
+    /// @brief Execute a statement with specified command control settings
+    /// at some host of the cluster with args as query parameters and fetch its
+    /// result block by block.
+    ///
+    /// Unlike Execute, the result is never held in memory as a whole, which
+    /// suits statements with large results.
+    /// @note The execute timeout of the command control limits the whole time
+    /// of the statement, including the time the consumer spends on the blocks.
+    template <typename... Args>
+    Cursor ExecuteCursor(OptionalCommandControl, const Query& query, const Args&... args) const;
+
+    /// @overload
+    Cursor ExecuteCursor(const Query& query, const ParameterStore& params) const;
+
+    /// @overload
+    Cursor ExecuteCursor(OptionalCommandControl, const Query& query, const ParameterStore& params) const;
+
     /// @brief Insert data at some host of the cluster;
     /// `T` is expected to be a struct of vectors of same length.
     /// @param table_name table to insert into
@@ -150,10 +179,14 @@ public:
     };
 
 private:
+    friend class impl::BatchInserterBase;
+
     void DoInsert(OptionalCommandControl, const impl::InsertionRequest& request) const;
 
     ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+    Cursor DoExecuteCursor(OptionalCommandControl, const Query& query) const;
+
     const impl::Pool& GetPool() const;
 
     std::vector<impl::Pool> pools_;
@@ -212,6 +245,17 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc, const Query
     return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+Cursor Cluster::ExecuteCursor(const Query& query, const Args&... args) const {
+    return ExecuteCursor(OptionalCommandControl{}, query, args...);
+}
+
+template <typename... Args>
+Cursor Cluster::ExecuteCursor(OptionalCommandControl optional_cc, const Query& query, const Args&... args) const {
+    const auto formatted_query = impl::WithArgs(query, args...);
+    return DoExecuteCursor(optional_cc, formatted_query);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/cursor.hpp
+/// @brief @copybrief storages::clickhouse::Cursor
+
+#include <memory>
+#include <optional>
+
+#include <userver/storages/clickhouse/execution_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+namespace impl {
+class CursorImpl;
+}
+
+/// @brief Result of a statement that is fetched block by block, returned by
+/// storages::clickhouse::Cluster ExecuteCursor methods
+///
+/// The statement is executed in background on a connection that is owned by
+/// the cursor. Only a few blocks are fetched ahead of the consumer, so the
+/// whole result is never held in memory.
+///
+/// Destroying the cursor before the result is over cancels the statement and
+/// closes the connection.
+///
+/// ## Usage example:
+///
+/// @snippet storages/tests/cursor_chtest.cpp  Sample Cursor usage
+class Cursor final {
+public:
+    explicit Cursor(std::unique_ptr<impl::CursorImpl>&&);
+    Cursor(Cursor&&) noexcept;
+    Cursor& operator=(Cursor&&) noexcept;
+    ~Cursor();
+
+    /// @brief Returns the next block of the result, waits for it if needed.
+    /// @returns std::nullopt when the result is over
+    /// @throws the exception of the statement if it failed
+    std::optional<ExecutionResult> Next();
+
+private:
+    std::unique_ptr<impl::CursorImpl> impl_;
+};
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/clickhouse/fwd.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/storages/clickhouse/io/impl/validate.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+/// Rows of a single insert
+class InsertionBuffer {
+public:
+    virtual ~InsertionBuffer();
+
+    virtual std::size_t GetRowsCount() const = 0;
+
+    virtual InsertionRequest
+    MakeRequest(const std::string& table_name, const std::vector<std::string_view>& column_names) const = 0;
+};
+
+/// Splits the rows into the columns as they are appended, so that the insert
+/// does not copy the rows once again
+template <typename Row>
+class RowsBuffer final : public InsertionBuffer {
+public:
+    void Append(Row&& row) {
+        AppendFields(row, Indices{});
+        ++rows_count_;
+    }
+
+    std::size_t GetRowsCount() const override { return rows_count_; }
+
+    InsertionRequest
+    MakeRequest(const std::string& table_name, const std::vector<std::string_view>& column_names) const override {
+        return InsertionRequest::CreateFromColumns<io::impl::MappedType<Row>>(table_name, column_names, columns_);
+    }
+
+private:
+    using Indices = std::make_index_sequence<io::impl::kClickhouseTypeColumnsCount<Row>>;
+
+    template <std::size_t... I>
+    static auto MakeColumns(std::index_sequence<I...>) -> std::tuple<std::vector<io::impl::ClickhouseType<I, Row>>...>;
+
+    template <std::size_t... I>
+    void AppendFields(Row& row, std::index_sequence<I...>) {
+        (std::get<I>(columns_).push_back(std::move(boost::pfr::get<I>(row))), ...);
+    }
+
+    decltype(MakeColumns(Indices{})) columns_;
+    std::size_t rows_count_{0};
+};
+
+class BatchInserterBase final {
+public:
+    using BufferFactory = std::function<std::unique_ptr<InsertionBuffer>()>;
+
+    BatchInserterBase(
+        ClusterPtr cluster,
+        std::string table_name,
+        std::vector<std::string> column_names,
+        const BatchInserterSettings& settings,
+        BufferFactory buffer_factory
+    );
+    ~BatchInserterBase();
+
+    BatchInserterBase(const BatchInserterBase&) = delete;
+    BatchInserterBase& operator=(const BatchInserterBase&) = delete;
+
+    /// Waits for the space in the buffers and calls `append` with exactly one
+    /// row to append into the current buffer
+    void Push(USERVER_NAMESPACE::utils::function_ref<void(InsertionBuffer&)> append);
+
+    void Flush();
+
+    void WriteStatistics(USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void Run();
+    void SealBuffer();
+    void Insert(const InsertionBuffer& buffer);
+
+    const ClusterPtr cluster_;
+    const std::string table_name_;
+    const std::vector<std::string> column_names_;
+    const std::vector<std::string_view> column_names_views_;
+    const BatchInserterSettings settings_;
+    const BufferFactory buffer_factory_;
+
+    engine::Mutex mutex_;
+    engine::ConditionVariable cv_;
+    std::unique_ptr<InsertionBuffer> buffer_;
+    Clock::time_point buffer_start_;
+    // Full buffers that wait to be inserted
+    std::deque<std::unique_ptr<InsertionBuffer>> sealed_buffers_;
+    std::uint64_t pushed_rows_{0};
+    std::uint64_t done_rows_{0};
+    bool flush_requested_{false};
+    bool stopped_{false};
+
+    // Rows that are buffered or being inserted
+    std::atomic<std::size_t> pending_rows_{0};
+    USERVER_NAMESPACE::utils::statistics::RateCounter inserts_;
+    USERVER_NAMESPACE::utils::statistics::RateCounter insert_errors_;
+    USERVER_NAMESPACE::utils::statistics::RateCounter inserted_rows_;
+    USERVER_NAMESPACE::utils::statistics::RateCounter dropped_rows_;
+    USERVER_NAMESPACE::utils::statistics::RateCounter push_waits_;
+
+    engine::TaskWithResult<void> task_;
+};
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <userver/utils/assert.hpp>
@@ -36,6 +38,16 @@ public:
         const Container& data
     );
 
+    /// Creates the request from the columns that are already split out of the
+    /// rows, `Columns` is expected to be a tuple of vectors of the columns
+    /// `cpp_type`s of `MappedType`
+    template <typename MappedType, typename Columns>
+    static InsertionRequest CreateFromColumns(
+        const std::string& table_name,
+        const std::vector<std::string_view>& column_names,
+        const Columns& columns
+    );
+
     const std::string& GetTableName() const;
 
     const impl::BlockWrapper& GetBlock() const;
@@ -86,6 +98,9 @@ private:
         const Container& data_;
     };
 
+    template <typename MappedType, typename Columns, size_t... Indices>
+    void AppendColumns(const Columns& columns, std::index_sequence<Indices...>);
+
     const std::string& table_name_;
     const std::vector<std::string_view>& column_names_;
 
@@ -132,6 +147,32 @@ InsertionRequest InsertionRequest::CreateFromRows(
     return request;
 }
 
+template <typename MappedType, typename Columns>
+InsertionRequest InsertionRequest::CreateFromColumns(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    const Columns& columns
+) {
+    constexpr auto columns_count = std::tuple_size_v<Columns>;
+    static_assert(columns_count == std::tuple_size_v<MappedType>);
+    UINVARIANT(columns_count == column_names.size(), "Columns count mismatch.");
+
+    InsertionRequest request{table_name, column_names};
+    request.AppendColumns<MappedType>(columns, std::make_index_sequence<columns_count>{});
+    return request;
+}
+
+template <typename MappedType, typename Columns, size_t... Indices>
+void InsertionRequest::AppendColumns(const Columns& columns, std::index_sequence<Indices...>) {
+    (io::columns::AppendWrappedColumn(
+         *block_,
+         std::tuple_element_t<Indices, MappedType>::Serialize(std::get<Indices>(columns)),
+         column_names_[Indices],
+         Indices
+     ),
+     ...);
+}
+
 }  // namespace storages::clickhouse::impl
 
 USERVER_NAMESPACE_END
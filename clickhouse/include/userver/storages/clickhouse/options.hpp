@@ -4,6 +4,7 @@
 /// @brief Options
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +35,22 @@ struct CommandControl final {
 /// @brief storages::clickhouse::CommandControl that may not be set.
 using OptionalCommandControl = std::optional<CommandControl>;
 
+/// Settings of storages::clickhouse::BatchInserter
+struct BatchInserterSettings final {
+    /// Buffered rows are inserted once there are this many of them
+    std::size_t max_batch_rows{100000};
+
+    /// Buffered rows are inserted at most this long after the first of them
+    /// was pushed
+    std::chrono::milliseconds flush_interval{1000};
+
+    /// Push waits while this many rows are buffered or being inserted
+    std::size_t max_pending_rows{1000000};
+
+    /// Command control of the inserts
+    OptionalCommandControl command_control{};
+};
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -60,10 +60,23 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc, const Query
     return DoExecute(optional_cc, params.MakeQueryWithArgs(query));
 }
 
+Cursor Cluster::ExecuteCursor(const Query& query, const ParameterStore& params) const {
+    return DoExecuteCursor(OptionalCommandControl{}, params.MakeQueryWithArgs(query));
+}
+
+Cursor Cluster::ExecuteCursor(OptionalCommandControl optional_cc, const Query& query, const ParameterStore& params)
+    const {
+    return DoExecuteCursor(optional_cc, params.MakeQueryWithArgs(query));
+}
+
 ExecutionResult Cluster::DoExecute(OptionalCommandControl optional_cc, const Query& query) const {
     return GetPool().Execute(optional_cc, query);
 }
 
+Cursor Cluster::DoExecuteCursor(OptionalCommandControl optional_cc, const Query& query) const {
+    return GetPool().ExecuteCursor(optional_cc, query);
+}
+
 void Cluster::DoInsert(OptionalCommandControl optional_cc, const impl::InsertionRequest& request) const {
     GetPool().Insert(optional_cc, request);
 }
@@ -0,0 +1,24 @@
+#include <userver/storages/clickhouse/cursor.hpp>
+
+#include <storages/clickhouse/impl/cursor_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+Cursor::Cursor(std::unique_ptr<impl::CursorImpl>&& impl) : impl_{std::move(impl)} {}
+
+Cursor::Cursor(Cursor&&) noexcept = default;
+
+Cursor& Cursor::operator=(Cursor&&) noexcept = default;
+
+Cursor::~Cursor() = default;
+
+std::optional<ExecutionResult> Cursor::Next() {
+    UASSERT(impl_);
+    return impl_->Next();
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,159 @@
+#include <userver/storages/clickhouse/impl/batch_inserter_base.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+namespace {
+
+std::vector<std::string_view> MakeViews(const std::vector<std::string>& column_names) {
+    return {column_names.begin(), column_names.end()};
+}
+
+}  // namespace
+
+InsertionBuffer::~InsertionBuffer() = default;
+
+BatchInserterBase::BatchInserterBase(
+    ClusterPtr cluster,
+    std::string table_name,
+    std::vector<std::string> column_names,
+    const BatchInserterSettings& settings,
+    BufferFactory buffer_factory
+)
+    : cluster_{std::move(cluster)},
+      table_name_{std::move(table_name)},
+      column_names_{std::move(column_names)},
+      column_names_views_{MakeViews(column_names_)},
+      settings_{settings},
+      buffer_factory_{std::move(buffer_factory)},
+      buffer_{buffer_factory_()} {
+    UINVARIANT(cluster_, "Cluster must be set");
+    UINVARIANT(
+        settings_.max_batch_rows > 0 && settings_.max_batch_rows <= settings_.max_pending_rows,
+        "Max batch rows must be positive and must not exceed max pending rows"
+    );
+
+    task_ = engine::CriticalAsyncNoSpan([this] { Run(); });
+}
+
+BatchInserterBase::~BatchInserterBase() {
+    {
+        const std::lock_guard lock{mutex_};
+        stopped_ = true;
+    }
+    cv_.NotifyAll();
+    // The rest of the rows is inserted before the inserter is destroyed
+    const engine::TaskCancellationBlocker blocker;
+    task_.Wait();
+}
+
+void BatchInserterBase::Push(USERVER_NAMESPACE::utils::function_ref<void(InsertionBuffer&)> append) {
+    std::unique_lock lock{mutex_};
+    if (pending_rows_ >= settings_.max_pending_rows) {
+        ++push_waits_;
+        if (!cv_.Wait(lock, [this] { return pending_rows_ < settings_.max_pending_rows; })) {
+            throw engine::WaitInterruptedException(engine::current_task::CancellationReason());
+        }
+    }
+
+    const bool was_empty = buffer_->GetRowsCount() == 0;
+    append(*buffer_);
+    ++pending_rows_;
+    ++pushed_rows_;
+
+    if (buffer_->GetRowsCount() >= settings_.max_batch_rows) {
+        SealBuffer();
+    } else if (was_empty) {
+        // The inserter has to wake up once the buffer is old enough
+        buffer_start_ = Clock::now();
+    } else {
+        return;
+    }
+    lock.unlock();
+    cv_.NotifyAll();
+}
+
+void BatchInserterBase::Flush() {
+    std::unique_lock lock{mutex_};
+    const auto pushed_rows = pushed_rows_;
+    flush_requested_ = true;
+    cv_.NotifyAll();
+
+    if (!cv_.Wait(lock, [this, pushed_rows] { return done_rows_ >= pushed_rows; })) {
+        throw engine::WaitInterruptedException(engine::current_task::CancellationReason());
+    }
+}
+
+void BatchInserterBase::WriteStatistics(USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+    writer["inserts"] = inserts_;
+    writer["insert_errors"] = insert_errors_;
+    writer["inserted_rows"] = inserted_rows_;
+    writer["dropped_rows"] = dropped_rows_;
+    writer["push_waits"] = push_waits_;
+    writer["pending_rows"] = pending_rows_.load();
+}
+
+void BatchInserterBase::Run() {
+    std::unique_lock lock{mutex_};
+    while (!engine::current_task::ShouldCancel()) {
+        const bool has_rows = buffer_->GetRowsCount() != 0;
+        if (has_rows && (flush_requested_ || stopped_ || Clock::now() >= buffer_start_ + settings_.flush_interval)) {
+            SealBuffer();
+        }
+        flush_requested_ = false;
+
+        if (sealed_buffers_.empty()) {
+            if (stopped_) break;
+
+            const auto deadline = has_rows ? engine::Deadline::FromTimePoint(buffer_start_ + settings_.flush_interval)
+                                           : engine::Deadline{};
+            [[maybe_unused]] const auto woken_up = cv_.WaitUntil(lock, deadline, [this, has_rows] {
+                return stopped_ || flush_requested_ || !sealed_buffers_.empty() ||
+                       (buffer_->GetRowsCount() != 0) != has_rows;
+            });
+            continue;
+        }
+
+        auto buffer = std::move(sealed_buffers_.front());
+        sealed_buffers_.pop_front();
+
+        lock.unlock();
+        Insert(*buffer);
+        lock.lock();
+
+        const auto rows = buffer->GetRowsCount();
+        pending_rows_ -= rows;
+        done_rows_ += rows;
+        cv_.NotifyAll();
+    }
+}
+
+void BatchInserterBase::SealBuffer() {
+    sealed_buffers_.push_back(std::exchange(buffer_, buffer_factory_()));
+}
+
+void BatchInserterBase::Insert(const InsertionBuffer& buffer) {
+    const auto rows = buffer.GetRowsCount();
+    try {
+        const auto request = buffer.MakeRequest(table_name_, column_names_views_);
+        cluster_->DoInsert(settings_.command_control, request);
+        ++inserts_;
+        inserted_rows_ += USERVER_NAMESPACE::utils::statistics::Rate{rows};
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "Failed to insert " << rows << " rows into '" << table_name_ << "': " << ex;
+        ++insert_errors_;
+        dropped_rows_ += USERVER_NAMESPACE::utils::statistics::Rate{rows};
+    }
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -100,6 +100,25 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc, const Qu
     return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(
+    OptionalCommandControl optional_cc,
+    const Query& query,
+    USERVER_NAMESPACE::utils::function_ref<bool(BlockWrapperPtr&&)> on_block
+) {
+    clickhouse_cpp::Query native_query{query.GetStatementView().c_str()};
+    native_query.OnDataCancelable([&on_block](const NativeBlock& block) {
+        // we must return 'true' if we don't want to cancel query
+        if (engine::current_task::ShouldCancel()) return false;
+        // the header of the result and the progress come in empty blocks
+        if (block.GetRowCount() == 0) return true;
+
+        auto block_ptr = std::make_unique<BlockWrapper>(NativeBlock{block});
+        return on_block(BlockWrapperPtr{block_ptr.release()});
+    });
+
+    DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc, const InsertionRequest& request) {
     const auto& block = request.GetBlock();
 
@@ -4,7 +4,9 @@
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/storages/clickhouse/execution_result.hpp>
+#include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
 #include <userver/storages/clickhouse/options.hpp>
+#include <userver/utils/function_ref.hpp>
 
 #include <storages/clickhouse/impl/native_client_factory.hpp>
 
@@ -27,6 +29,14 @@ public:
 
     ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+    /// Passes the non-empty blocks of the result to the callback as they
+    /// arrive, the statement is cancelled once the callback returns false
+    void ExecuteStreaming(
+        OptionalCommandControl,
+        const Query&,
+        USERVER_NAMESPACE::utils::function_ref<bool(BlockWrapperPtr&&)> on_block
+    );
+
     void Insert(OptionalCommandControl, const InsertionRequest&);
 
     void Ping();
@@ -0,0 +1,23 @@
+#include "cursor_impl.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+CursorImpl::CursorImpl(engine::TaskWithResult<void>&& task, BlocksQueue::Consumer&& consumer)
+    : task_{std::move(task)}, consumer_{std::move(consumer)} {}
+
+CursorImpl::~CursorImpl() = default;
+
+std::optional<ExecutionResult> CursorImpl::Next() {
+    BlockWrapperPtr block;
+    if (consumer_.Pop(block)) return ExecutionResult{std::move(block)};
+
+    // The producer is gone, so the statement is either done or failed
+    if (task_.IsValid()) task_.Get();
+    return std::nullopt;
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
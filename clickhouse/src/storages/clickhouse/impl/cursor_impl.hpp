@@ -0,0 +1,35 @@
+#pragma once
+
+#include <optional>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/clickhouse/execution_result.hpp>
+#include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+class CursorImpl final {
+public:
+    using BlocksQueue = concurrent::SpscQueue<BlockWrapperPtr>;
+
+    /// Blocks that are fetched ahead of the consumer
+    static constexpr std::size_t kMaxPrefetchedBlocks = 4;
+
+    CursorImpl(engine::TaskWithResult<void>&& task, BlocksQueue::Consumer&& consumer);
+    ~CursorImpl();
+
+    std::optional<ExecutionResult> Next();
+
+private:
+    engine::TaskWithResult<void> task_;
+    // Destroyed before the task, so that the task stops waiting for the
+    // consumer and cancels the statement
+    BlocksQueue::Consumer consumer_;
+};
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
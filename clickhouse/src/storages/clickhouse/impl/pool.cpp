@@ -4,9 +4,11 @@
 
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
+#include <userver/utils/async.hpp>
 
 #include <storages/clickhouse/impl/connection.hpp>
 #include <storages/clickhouse/impl/connection_ptr.hpp>
+#include <storages/clickhouse/impl/cursor_impl.hpp>
 #include <storages/clickhouse/impl/pool_impl.hpp>
 #include <storages/clickhouse/impl/tracing_tags.hpp>
 #include <userver/formats/json/value_builder.hpp>
@@ -46,6 +48,35 @@ ExecutionResult Pool::Execute(OptionalCommandControl optional_cc, const Query& q
     return conn_ptr->Execute(optional_cc, query);
 }
 
+Cursor Pool::ExecuteCursor(OptionalCommandControl optional_cc, const Query& query) const {
+    UASSERT(query.GetLogMode() == Query::LogMode::kNameOnly || query.GetLogMode() == Query::LogMode::kFull);
+    auto conn_ptr = impl_->Acquire();
+
+    auto queue = CursorImpl::BlocksQueue::Create(CursorImpl::kMaxPrefetchedBlocks);
+    auto consumer = queue->GetConsumer();
+    auto task = USERVER_NAMESPACE::utils::Async(
+        impl::scopes::kQuery,
+        [impl = impl_, conn_ptr = std::move(conn_ptr), producer = queue->GetProducer(), optional_cc, query]() mutable {
+            // The consumer must see the end of the result as soon as the
+            // statement is done
+            const auto blocks_producer = std::move(producer);
+
+            auto& span = tracing::Span::CurrentSpan();
+            span.AddTag(tracing::kDatabaseInstance, impl->GetHostName());
+            if (query.GetOptionalNameView().has_value()) {
+                span.AddTag(tracing::kDatabaseStatementName, std::string{*query.GetOptionalNameView()});
+            }
+
+            const auto timer = impl->GetExecuteTimer();
+            conn_ptr->ExecuteStreaming(optional_cc, query, [&blocks_producer](BlockWrapperPtr&& block) {
+                return blocks_producer.Push(std::move(block));
+            });
+        }
+    );
+
+    return Cursor{std::make_unique<CursorImpl>(std::move(task), std::move(consumer))};
+}
+
 void Pool::Insert(OptionalCommandControl optional_cc, const InsertionRequest& request) const {
     auto conn_ptr = impl_->Acquire();
 
@@ -0,0 +1,172 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/storages/clickhouse/batch_inserter.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct EventRow final {
+    std::uint64_t id;
+    std::string name;
+};
+
+struct CountData final {
+    std::vector<std::uint64_t> count;
+};
+
+storages::clickhouse::ClusterPtr MakeClusterPtr(ClusterWrapper& cluster) {
+    // Non-owning, the wrapper outlives the inserters
+    return {std::shared_ptr<void>{}, &*cluster};
+}
+
+void RecreateTable(ClusterWrapper& cluster, const std::string& table_name) {
+    cluster->Execute(storages::Query{"DROP TABLE IF EXISTS " + table_name});
+    cluster->Execute(storages::Query{"CREATE TABLE " + table_name + " (id UInt64, name String) ENGINE = Memory"});
+}
+
+std::uint64_t CountRows(ClusterWrapper& cluster, const std::string& table_name) {
+    const auto result = cluster->Execute(storages::Query{"SELECT count() FROM " + table_name}).As<CountData>();
+    return result.count.at(0);
+}
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<EventRow> final {
+    using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<CountData> final {
+    using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(BatchInserter, InsertsBySize) {
+    ClusterWrapper cluster{};
+    RecreateTable(cluster, "batch_inserter_by_size");
+
+    /// [Sample BatchInserter usage]
+    storages::clickhouse::BatchInserterSettings settings;
+    settings.max_batch_rows = 10;
+    settings.flush_interval = std::chrono::hours{1};
+
+    storages::clickhouse::BatchInserter<EventRow> inserter{
+        MakeClusterPtr(cluster), "batch_inserter_by_size", {"id", "name"}, settings};
+    for (std::uint64_t id = 0; id < 25; ++id) {
+        inserter.Push({id, "event_" + std::to_string(id)});
+    }
+    inserter.Flush();
+    /// [Sample BatchInserter usage]
+
+    EXPECT_EQ(CountRows(cluster, "batch_inserter_by_size"), 25);
+
+    utils::statistics::Storage storage;
+    const auto holder = storage.RegisterWriter("inserter", [&inserter](utils::statistics::Writer& writer) {
+        writer = inserter;
+    });
+    const utils::statistics::Snapshot snapshot{storage, "inserter"};
+    EXPECT_EQ(snapshot.SingleMetric("inserts").AsRate(), 3);
+    EXPECT_EQ(snapshot.SingleMetric("inserted_rows").AsRate(), 25);
+    EXPECT_EQ(snapshot.SingleMetric("dropped_rows").AsRate(), 0);
+    EXPECT_EQ(snapshot.SingleMetric("pending_rows").AsInt(), 0);
+}
+
+UTEST(BatchInserter, InsertsByTime) {
+    ClusterWrapper cluster{};
+    RecreateTable(cluster, "batch_inserter_by_time");
+
+    storages::clickhouse::BatchInserterSettings settings;
+    settings.flush_interval = std::chrono::milliseconds{50};
+
+    storages::clickhouse::BatchInserter<EventRow> inserter{
+        MakeClusterPtr(cluster), "batch_inserter_by_time", {"id", "name"}, settings};
+    inserter.Push({1, "event"});
+
+    for (int attempts = 0; attempts < 100 && CountRows(cluster, "batch_inserter_by_time") == 0; ++attempts) {
+        engine::SleepFor(std::chrono::milliseconds{50});
+    }
+    EXPECT_EQ(CountRows(cluster, "batch_inserter_by_time"), 1);
+}
+
+UTEST(BatchInserter, InsertsOnDestruction) {
+    ClusterWrapper cluster{};
+    RecreateTable(cluster, "batch_inserter_on_destruction");
+
+    {
+        storages::clickhouse::BatchInserterSettings settings;
+        settings.flush_interval = std::chrono::hours{1};
+
+        storages::clickhouse::BatchInserter<EventRow> inserter{
+            MakeClusterPtr(cluster), "batch_inserter_on_destruction", {"id", "name"}, settings};
+        inserter.Push({1, "event"});
+        inserter.Push({2, "event"});
+    }
+
+    EXPECT_EQ(CountRows(cluster, "batch_inserter_on_destruction"), 2);
+}
+
+UTEST_MT(BatchInserter, InsertsOnDestructionMultithreaded, 4) {
+    constexpr std::uint64_t kTasks = 4;
+    constexpr std::uint64_t kRowsPerTask = 100;
+    ClusterWrapper cluster{};
+    RecreateTable(cluster, "batch_inserter_on_destruction_mt");
+
+    {
+        storages::clickhouse::BatchInserterSettings settings;
+        settings.max_batch_rows = 30;
+        settings.flush_interval = std::chrono::hours{1};
+
+        storages::clickhouse::BatchInserter<EventRow> inserter{
+            MakeClusterPtr(cluster), "batch_inserter_on_destruction_mt", {"id", "name"}, settings};
+
+        std::vector<engine::TaskWithResult<void>> tasks;
+        for (std::uint64_t task = 0; task < kTasks; ++task) {
+            tasks.push_back(engine::AsyncNoSpan([&inserter, task] {
+                for (std::uint64_t i = 0; i < kRowsPerTask; ++i) {
+                    const auto id = task * kRowsPerTask + i;
+                    inserter.Push({id, "event_" + std::to_string(id)});
+                }
+            }));
+        }
+        engine::WaitAllChecked(tasks);
+    }
+
+    EXPECT_EQ(CountRows(cluster, "batch_inserter_on_destruction_mt"), kTasks * kRowsPerTask);
+}
+
+UTEST(BatchInserter, DropsRowsOfFailedInserts) {
+    ClusterWrapper cluster{};
+
+    storages::clickhouse::BatchInserter<EventRow> inserter{MakeClusterPtr(cluster), "nonexistent", {"id", "name"}};
+    inserter.Push({1, "event"});
+    UEXPECT_NO_THROW(inserter.Flush());
+
+    utils::statistics::Storage storage;
+    const auto holder = storage.RegisterWriter("inserter", [&inserter](utils::statistics::Writer& writer) {
+        writer = inserter;
+    });
+    const utils::statistics::Snapshot snapshot{storage, "inserter"};
+    EXPECT_EQ(snapshot.SingleMetric("insert_errors").AsRate(), 1);
+    EXPECT_EQ(snapshot.SingleMetric("dropped_rows").AsRate(), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,84 @@
+#include <userver/utest/utest.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/cursor.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct NumberRow final {
+    std::uint64_t number;
+};
+
+const storages::clickhouse::Query kNumbersQuery{
+    "SELECT number FROM numbers(0, {0}) SETTINGS max_block_size = 1000"};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<NumberRow> final {
+    using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Cursor, ReadsBlockByBlock) {
+    ClusterWrapper cluster{};
+
+    /// [Sample Cursor usage]
+    auto cursor = cluster->ExecuteCursor(kNumbersQuery, 100000);
+
+    std::size_t blocks = 0;
+    std::uint64_t expected_number = 0;
+    while (auto block = cursor.Next()) {
+        ++blocks;
+        for (const auto& row : std::move(*block).AsRows<NumberRow>()) {
+            ASSERT_EQ(row.number, expected_number);
+            ++expected_number;
+        }
+    }
+    /// [Sample Cursor usage]
+
+    EXPECT_EQ(expected_number, 100000);
+    EXPECT_GT(blocks, 1);
+    EXPECT_FALSE(cursor.Next().has_value());
+}
+
+UTEST(Cursor, EmptyResult) {
+    ClusterWrapper cluster{};
+
+    auto cursor = cluster->ExecuteCursor(kNumbersQuery, 0);
+    EXPECT_FALSE(cursor.Next().has_value());
+}
+
+UTEST(Cursor, Error) {
+    ClusterWrapper cluster{};
+
+    auto cursor = cluster->ExecuteCursor(storages::clickhouse::Query{"invalid_query_format"});
+    UEXPECT_THROW(cursor.Next(), std::exception);
+}
+
+UTEST(Cursor, Abandoned) {
+    ClusterWrapper cluster{};
+
+    {
+        auto cursor = cluster->ExecuteCursor(kNumbersQuery, 10000000);
+        const auto block = cursor.Next();
+        ASSERT_TRUE(block.has_value());
+        EXPECT_EQ(block->GetRowsCount(), 1000);
+    }
+
+    const auto result = cluster->Execute(kNumbersQuery, 10).AsContainer<std::vector<NumberRow>>();
+    EXPECT_EQ(result.size(), 10);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,70 @@
+#include <fmt/format.h>
+
+#include <userver/clients/dns/component.hpp>
+#include <userver/clients/http/component.hpp>
+#include <userver/components/minimal_server_component_list.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/handlers/tests_control.hpp>
+#include <userver/server/http/http_response_body_stream.hpp>
+#include <userver/testsuite/testsuite_support.hpp>
+#include <userver/utest/using_namespace_userver.hpp>
+#include <userver/utils/daemon_run.hpp>
+
+namespace {
+
+constexpr std::string_view kETag = R"("v1")";
+constexpr int kChunksCount = 100;
+
+std::string MakeChunk(int index) { return fmt::format("{{\"index\": {}, \"value\": \"compressible\"}}\n", index); }
+
+}  // namespace
+
+class HandlerCompressible final : public server::handlers::HttpHandlerBase {
+public:
+    static constexpr std::string_view kName = "handler-compressible";
+
+    using HttpHandlerBase::HttpHandlerBase;
+
+    std::string HandleRequestThrow(const server::http::HttpRequest& request, server::request::RequestContext&)
+        const override {
+        auto& response = request.GetHttpResponse();
+        response.SetContentType(http::content_type::kApplicationJson);
+        response.SetHeader(http::headers::kETag, std::string{kETag});
+
+        std::string body;
+        for (int i = 0; i < kChunksCount; ++i) body += MakeChunk(i);
+        return body;
+    }
+};
+
+class HandlerCompressibleStream final : public server::handlers::HttpHandlerBase {
+public:
+    static constexpr std::string_view kName = "handler-compressible-stream";
+
+    using HttpHandlerBase::HttpHandlerBase;
+
+    void HandleStreamRequest(
+        server::http::HttpRequest&,
+        server::request::RequestContext&,
+        server::http::ResponseBodyStream& stream
+    ) const override {
+        stream.SetStatusCode(server::http::HttpStatus::kOk);
+        stream.SetHeader(http::headers::kContentType, "text/plain");
+        stream.SetHeader(http::headers::kETag, std::string{kETag});
+        stream.SetEndOfHeaders();
+        for (int i = 0; i < kChunksCount; ++i) stream.PushBodyChunk(MakeChunk(i), {});
+    }
+};
+
+int main(int argc, char* argv[]) {
+    const auto component_list = components::MinimalServerComponentList()
+                                    .Append<HandlerCompressible>()
+                                    .Append<HandlerCompressibleStream>()
+                                    .Append<clients::dns::Component>()
+                                    .Append<components::HttpClient>()
+                                    .Append<components::TestsuiteSupport>()
+                                    .Append<server::handlers::TestsControl>();
+    return utils::DaemonMain(argc, argv, component_list);
+}
@@ -0,0 +1,48 @@
+import gzip
+
+import pytest
+
+EXPECTED_BODY = ''.join(
+    f'{{"index": {i}, "value": "compressible"}}\n' for i in range(100)
+).encode()
+
+
+def _decoded_body(response):
+    # The client may decompress the body by itself
+    body = response.content
+    if body[:2] == b'\x1f\x8b':
+        body = gzip.decompress(body)
+    return body
+
+
+def _has_vary_accept_encoding(response):
+    vary = response.headers.get('Vary', '')
+    return 'accept-encoding' in [
+        field.strip().lower() for field in vary.split(',')
+    ]
+
+
+@pytest.mark.parametrize('path', ['/compressible', '/compressible-stream'])
+async def test_compressed(service_client, path):
+    response = await service_client.get(
+        path, headers={'Accept-Encoding': 'gzip'},
+    )
+    assert response.status == 200
+    assert response.headers['Content-Encoding'] == 'gzip'
+    assert _has_vary_accept_encoding(response)
+    # The strong validator of the identity body is weakened
+    assert response.headers['ETag'] == 'W/"v1"'
+    assert _decoded_body(response) == EXPECTED_BODY
+
+
+@pytest.mark.parametrize('path', ['/compressible', '/compressible-stream'])
+async def test_not_accepted(service_client, path):
+    response = await service_client.get(
+        path, headers={'Accept-Encoding': 'identity'},
+    )
+    assert response.status == 200
+    assert 'Content-Encoding' not in response.headers
+    # Caches must not serve this response to the clients accepting gzip
+    assert _has_vary_accept_encoding(response)
+    assert response.headers['ETag'] == '"v1"'
+    assert response.content == EXPECTED_BODY
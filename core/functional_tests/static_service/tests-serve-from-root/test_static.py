@@ -40,3 +40,60 @@ async def test_hidden_file(service_client, service_source_dir):
     assert response.status == 404
     file = service_source_dir.joinpath('public') / '404.html'
     assert response.content.decode() == file.open().read()
+
+
+async def test_not_modified(service_client):
+    response = await service_client.get('/index.html')
+    assert response.status == 200
+    etag = response.headers['ETag']
+    assert response.headers['Last-Modified']
+    assert response.headers['Accept-Ranges'] == 'bytes'
+
+    response = await service_client.get(
+        '/index.html', headers={'If-None-Match': etag},
+    )
+    assert response.status == 304
+    assert response.headers['ETag'] == etag
+    assert not response.content
+
+
+@pytest.mark.parametrize(
+    'path', ['/index.html', '/dir1/dir2/data.html'],
+)
+@pytest.mark.parametrize(
+    'range_header, begin, end',
+    [('bytes=0-4', 0, 5), ('bytes=6-', 6, None), ('bytes=-4', -4, None)],
+)
+async def test_range(
+        service_client, service_source_dir, path, range_header, begin, end,
+):
+    file = service_source_dir.joinpath('public') / path.lstrip('/')
+    data = file.read_bytes()
+    expected = data[begin:end]
+
+    response = await service_client.get(path, headers={'Range': range_header})
+    assert response.status == 206
+    assert response.content == expected
+    first = begin if begin >= 0 else len(data) + begin
+    assert response.headers['Content-Range'] == (
+        f'bytes {first}-{first + len(expected) - 1}/{len(data)}'
+    )
+
+
+async def test_range_not_satisfiable(service_client, service_source_dir):
+    size = (service_source_dir.joinpath('public') / 'index.html').stat().st_size
+    response = await service_client.get(
+        '/index.html', headers={'Range': f'bytes={size}-'},
+    )
+    assert response.status == 416
+    assert response.headers['Content-Range'] == f'bytes */{size}'
+
+
+async def test_if_range_mismatch(service_client, service_source_dir):
+    response = await service_client.get(
+        '/index.html',
+        headers={'Range': 'bytes=0-4', 'If-Range': '"outdated"'},
+    )
+    assert response.status == 200
+    file = service_source_dir.joinpath('public') / 'index.html'
+    assert response.content == file.read_bytes()
@@ -87,6 +87,9 @@ public:
      */
     void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+    /// Changes the eviction policy, see cache::NWayLRU::SetPolicy
+    void SetPolicy(CachePolicy policy);
+
     /**
      * @returns GetOptional("key", update_func) if it is not std::nullopt.
      * Otherwise the result of update_func(key) is returned, and additionally
@@ -198,6 +201,12 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(BackgroundU
     background_update_mode_ = background_update;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetPolicy(CachePolicy policy) {
+    lru_.SetPolicy(policy);
+    stats_.policy = policy;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     const Key& key,
@@ -60,6 +60,7 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// ways | number of ways for associative cache | --
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
 /// background-update | enables asynchronous updates for expiring values | false
+/// policy | eviction policy: `lru` or `tinylfu` (W-TinyLFU, better hit rate for skewed or scan-heavy workloads) | lru
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
 ///
 /// ## Example usage:
@@ -128,6 +129,8 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
       name_(components::GetCurrentComponentName(context)),
       static_config_(config),
       cache_(std::make_shared<Cache>(static_config_.ways, static_config_.GetWaySize())) {
+    cache_->SetPolicy(static_config_.config.policy);
+
     if (impl::IsDumpSupportEnabled(config)) {
         dumper_ = std::make_shared<dump::Dumper>(config, context, static_cast<dump::DumpableEntity&>(*this));
         cache_->SetDumper(dumper_);
@@ -200,6 +203,7 @@ void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(const LruCacheConf
     cache_->SetWaySize(config.GetWaySize(static_config_.ways));
     cache_->SetMaxLifetime(config.lifetime);
     cache_->SetBackgroundUpdate(config.background_update);
+    cache_->SetPolicy(config.policy);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
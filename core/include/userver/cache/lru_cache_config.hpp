@@ -3,8 +3,10 @@
 #include <chrono>
 #include <cstddef>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
 
+#include <userver/cache/policy.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -19,6 +21,12 @@ enum class BackgroundUpdateMode {
     kDisabled,
 };
 
+CachePolicy Parse(const yaml_config::YamlConfig& config, formats::parse::To<CachePolicy>);
+
+CachePolicy Parse(const formats::json::Value& value, formats::parse::To<CachePolicy>);
+
+std::string_view ToString(CachePolicy policy);
+
 struct LruCacheConfig final {
     explicit LruCacheConfig(const yaml_config::YamlConfig& config);
     explicit LruCacheConfig(const components::ComponentConfig& config);
@@ -30,6 +38,7 @@ struct LruCacheConfig final {
     std::size_t size;
     std::chrono::milliseconds lifetime;
     BackgroundUpdateMode background_update;
+    CachePolicy policy;
 };
 
 LruCacheConfig Parse(const formats::json::Value& value, formats::parse::To<LruCacheConfig>);
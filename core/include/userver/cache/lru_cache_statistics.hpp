@@ -1,5 +1,9 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+
+#include <userver/cache/policy.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
@@ -29,10 +33,19 @@ struct ExpirableLruCacheStatisticsBase final {
     void Reset();
 };
 
+/// Hits and misses that happened while a specific eviction policy was in use
+struct ExpirableLruCachePolicyStatistics final {
+    utils::statistics::RateCounter hits;
+    utils::statistics::RateCounter misses;
+};
+
 struct ExpirableLruCacheStatistics final {
     ExpirableLruCacheStatisticsBase total;
     utils::statistics::RecentPeriod<std::atomic<std::uint64_t>, std::uint64_t> recent_hits;
     utils::statistics::RecentPeriod<std::atomic<std::uint64_t>, std::uint64_t> recent_misses;
+
+    std::atomic<CachePolicy> policy{CachePolicy::kLRU};
+    std::array<ExpirableLruCachePolicyStatistics, kCachePoliciesCount> policies;
 };
 
 void CacheHit(ExpirableLruCacheStatistics& stats);
@@ -45,6 +58,8 @@ void CacheBackgroundUpdate(ExpirableLruCacheStatistics& stats);
 
 void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCacheStatisticsBase& stats);
 
+void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCachePolicyStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCacheStatistics& stats);
 
 }  // namespace cache::impl
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <optional>
+#include <variant>
 #include <vector>
 
 #include <boost/container_hash/hash.hpp>
 
 #include <userver/cache/lru_map.hpp>
+#include <userver/cache/policy.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/operations.hpp>
 #include <userver/engine/mutex.hpp>
@@ -29,7 +32,7 @@ public:
     ///
     /// @param way_size is the maximum allowed amount of elements per way. When
     /// the size of a way reaches this number, existing elements are deleted
-    /// according to the LRU policy.
+    /// according to the eviction policy, LRU by default.
     ///
     /// @param hash is the instance of `Hash` function to use, in case of a custom stateful `Hash`.
     /// @param equal is the instance of `Equal` function to use, in case of a custom stateful `Equal`.
@@ -62,6 +65,10 @@ public:
     /// see the cache::NWayLRU::NWayLRU constructor.
     void UpdateWaySize(size_t way_size);
 
+    /// Changes the eviction policy, the elements are moved into the new
+    /// storages and the collected usage history is lost.
+    void SetPolicy(CachePolicy policy);
+
     void Write(dump::Writer& writer) const;
     void Read(dump::Reader& reader);
 
@@ -70,14 +77,28 @@ public:
     void SetDumper(std::shared_ptr<dump::Dumper> dumper);
 
 private:
+    using LruCache = LruMap<T, U, Hash, Equal, CachePolicy::kLRU>;
+    using TinyLfuCache = LruMap<T, U, Hash, Equal, CachePolicy::kTinyLFU>;
+    using Cache = std::variant<LruCache, TinyLfuCache>;
+
     struct Way {
         Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
 
         // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
-        Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+        Way(const Hash& hash, const Equal& equal) : cache(std::in_place_type<LruCache>, 1, hash, equal) {}
+
+        template <typename Func>
+        decltype(auto) Visit(Func&& func) {
+            return std::visit(std::forward<Func>(func), cache);
+        }
+
+        template <typename Func>
+        decltype(auto) Visit(Func&& func) const {
+            return std::visit(std::forward<Func>(func), cache);
+        }
 
         mutable engine::Mutex mutex;
-        LruMap<T, U, Hash, Equal> cache;
+        Cache cache;
     };
 
     Way& GetWay(const T& key);
@@ -86,17 +107,21 @@ private:
 
     std::vector<Way> caches_;
     Hash hash_fn_;
+    Equal equal_fn_;
+    std::atomic<size_t> way_size_;
     std::shared_ptr<dump::Dumper> dumper_{nullptr};
 };
 
 template <typename T, typename U, typename Hash, typename Eq>
 NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash, const Eq& equal)
-    : caches_(), hash_fn_(hash) {
+    : caches_(), hash_fn_(hash), equal_fn_(equal), way_size_(way_size) {
     caches_.reserve(ways);
     for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
     if (ways == 0) throw std::logic_error("Ways must be positive");
 
-    for (auto& way : caches_) way.cache.SetMaxSize(way_size);
+    for (auto& way : caches_) {
+        way.Visit([way_size](auto& cache) { cache.SetMaxSize(way_size); });
+    }
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -104,7 +129,7 @@ void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
     auto& way = GetWay(key);
     {
         const std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Put(key, std::move(value));
+        way.Visit([&key, &value](auto& cache) { cache.Put(key, std::move(value)); });
     }
     NotifyDumper();
 }
@@ -114,14 +139,16 @@ template <typename Validator>
 std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key, Validator validator) {
     auto& way = GetWay(key);
     const std::unique_lock<engine::Mutex> lock(way.mutex);
-    auto* value = way.cache.Get(key);
+    return way.Visit([&key, &validator](auto& cache) -> std::optional<U> {
+        auto* value = cache.Get(key);
 
-    if (value) {
-        if (validator(*value)) return *value;
-        way.cache.Erase(key);
-    }
+        if (value) {
+            if (validator(*value)) return *value;
+            cache.Erase(key);
+        }
 
-    return std::nullopt;
+        return std::nullopt;
+    });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -129,7 +156,7 @@ void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
     auto& way = GetWay(key);
     {
         const std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Erase(key);
+        way.Visit([&key](auto& cache) { cache.Erase(key); });
     }
     NotifyDumper();
 }
@@ -138,14 +165,14 @@ template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
     auto& way = GetWay(key);
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    return way.cache.GetOr(key, default_value);
+    return way.Visit([&key, &default_value](auto& cache) { return cache.GetOr(key, default_value); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
     for (auto& way : caches_) {
         const std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Clear();
+        way.Visit([](auto& cache) { cache.Clear(); });
     }
     NotifyDumper();
 }
@@ -155,7 +182,7 @@ template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
     for (const auto& way : caches_) {
         std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.VisitAll(func);
+        way.Visit([&func](const auto& cache) { cache.VisitAll(func); });
     }
 }
 
@@ -164,16 +191,35 @@ size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
     size_t size{0};
     for (const auto& way : caches_) {
         const std::unique_lock<engine::Mutex> lock(way.mutex);
-        size += way.cache.GetSize();
+        size += way.Visit([](const auto& cache) { return cache.GetSize(); });
     }
     return size;
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
+    way_size_ = way_size;
+    for (auto& way : caches_) {
+        const std::unique_lock<engine::Mutex> lock(way.mutex);
+        way.Visit([way_size](auto& cache) { cache.SetMaxSize(way_size); });
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::SetPolicy(CachePolicy policy) {
     for (auto& way : caches_) {
         const std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.SetMaxSize(way_size);
+        const bool is_tiny_lfu = std::holds_alternative<TinyLfuCache>(way.cache);
+        if (is_tiny_lfu == (policy == CachePolicy::kTinyLFU)) continue;
+
+        auto new_cache = is_tiny_lfu ? Cache{std::in_place_type<LruCache>, way_size_.load(), hash_fn_, equal_fn_}
+                                     : Cache{std::in_place_type<TinyLfuCache>, way_size_.load(), hash_fn_, equal_fn_};
+        way.Visit([&new_cache](auto& old_cache) {
+            old_cache.VisitAll([&new_cache](const T& key, U& value) {
+                std::visit([&key, &value](auto& cache) { cache.Put(key, std::move(value)); }, new_cache);
+            });
+        });
+        way.cache = std::move(new_cache);
     }
 }
 
@@ -196,11 +242,13 @@ void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
     for (const Way& way : caches_) {
         const std::unique_lock<engine::Mutex> lock(way.mutex);
 
-        writer.Write(way.cache.GetSize());
+        way.Visit([&writer](const auto& cache) {
+            writer.Write(cache.GetSize());
 
-        way.cache.VisitAll([&writer](const T& key, const U& value) {
-            writer.Write(key);
-            writer.Write(value);
+            cache.VisitAll([&writer](const T& key, const U& value) {
+                writer.Write(key);
+                writer.Write(value);
+            });
         });
     }
 }
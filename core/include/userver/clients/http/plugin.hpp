@@ -4,10 +4,14 @@
 /// @brief @copybrief clients::http::Plugin
 
 #include <chrono>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <system_error>
 #include <vector>
 
+#include <userver/utils/any_storage.hpp>
 #include <userver/utils/not_null.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -20,6 +24,15 @@ namespace clients::http {
 
 class RequestState;
 class Response;
+class ConnectTo;
+class InterceptedRequest;
+enum class HttpMethod;
+
+/// @brief Tag of the per-request data of the plugins, see PluginRequest::GetPluginData()
+struct PluginDataTag;
+
+/// @brief Per-request data of the plugins
+using PluginData = utils::AnyStorage<PluginDataTag>;
 
 /// @brief Auxiliary entity that allows editing request to a client
 /// from plugins
@@ -35,12 +48,88 @@ public:
 
     void SetTimeout(std::chrono::milliseconds ms);
 
+    /// @brief Replaces the URL of the request. The URL is kept for the
+    /// following attempts and performs of the request.
+    void SetUrl(std::string url);
+
+    /// @brief Sets CURLOPT_CONNECT_TO of the request.
+    /// @warning `connect_to` must outlive the request, see ConnectTo
+    void SetConnectTo(const ConnectTo& connect_to);
+
     const std::string& GetOriginalUrl() const;
 
+    /// @brief Returns the method set by Request::method() and the like,
+    /// std::nullopt if it was not set or a custom method is set.
+    std::optional<HttpMethod> GetMethod() const;
+
+    /// @brief Returns the value of the request header, std::nullopt if there
+    /// is no such header
+    std::optional<std::string_view> GetHeader(std::string_view name) const;
+
+    /// @brief Returns whether the request has a body set by Request::data()
+    /// or Request::form(), whatever the method is
+    bool HasBody() const;
+
+    /// @brief Returns whether a plugin completes the request instead of
+    /// sending it, see Intercept()
+    bool IsIntercepted() const;
+
+    /// @brief Makes the plugin responsible for completing the request, the
+    /// request is not sent. May only be called from Plugin::HookInterceptRequest.
+    InterceptedRequest Intercept();
+
+    /// @brief Returns the data of the plugins, that lives as long as the
+    /// request and is kept between the attempts.
+    ///
+    /// The data tags are registered statically, e.g.:
+    /// @code
+    /// const utils::AnyStorageDataTag<clients::http::PluginDataTag, MyData> kMyDataTag;
+    /// @endcode
+    PluginData& GetPluginData();
+
 private:
     RequestState& state_;
 };
 
+/// @brief Request that is completed by a plugin instead of being sent, see
+/// PluginRequest::Intercept()
+///
+/// The request is completed with Plugin::HookOnCompleted or
+/// Plugin::HookOnError of the plugins called, as if the response or the error
+/// came from the network. A request that is not completed explicitly is
+/// completed with the operation_canceled error when the handle is destroyed.
+class InterceptedRequest final {
+public:
+    InterceptedRequest(InterceptedRequest&&) noexcept;
+    InterceptedRequest& operator=(InterceptedRequest&&) noexcept;
+    ~InterceptedRequest();
+
+    /// @brief Completes the request with the response
+    void SetResponse(Response response) &&;
+
+    /// @brief Completes the request with the error
+    void SetError(std::error_code ec) &&;
+
+    /// @brief Sends the request after all, e.g. if the plugin can not
+    /// complete it. Plugin::HookInterceptRequest of the following plugins is
+    /// not called. Must be called from a coroutine.
+    void Perform() &&;
+
+    /// @brief Returns whether the caller cancelled the request, e.g. stopped
+    /// waiting for the response
+    bool IsCancelled() const;
+
+    /// @brief Returns the data of the plugins, see PluginRequest::GetPluginData()
+    PluginData& GetPluginData();
+
+private:
+    friend class PluginRequest;
+
+    explicit InterceptedRequest(std::shared_ptr<RequestState> state);
+
+    std::shared_ptr<RequestState> state_;
+};
+
 /// @brief Base class for HTTP Client plugins
 class Plugin {
 public:
@@ -57,6 +146,16 @@ public:
     ///        The hook is executed in the context of the parent task which created the request.
     virtual void HookCreateSpan(PluginRequest& request, tracing::Span& span) = 0;
 
+    /// @brief The hook is called once per perform of the request after
+    ///        HookCreateSpan and before any network interaction. The plugin
+    ///        may complete the request by itself with PluginRequest::Intercept(),
+    ///        then the hook is not called for the following plugins and the
+    ///        request is not sent.
+    ///        The hook is executed in the context of the parent task which
+    ///        created the request. It is not called for the streamed requests.
+    ///        Does nothing by default.
+    virtual void HookInterceptRequest(PluginRequest& request);
+
     /// @brief The hook is called before actual HTTP request sending and before
     ///        DNS name resolution.
     ///        This hook is called on each retry.
@@ -97,6 +196,9 @@ public:
 
     void HookCreateSpan(RequestState& request, tracing::Span& span);
 
+    /// Returns whether one of the plugins intercepted the request
+    bool HookInterceptRequest(RequestState& request);
+
     void HookOnCompleted(RequestState& request, Response& response);
 
     void HookOnError(RequestState& request, std::error_code ec);
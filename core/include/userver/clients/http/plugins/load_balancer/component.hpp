@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file userver/clients/http/plugins/load_balancer/component.hpp
+/// @brief @copybrief clients::http::plugins::load_balancer::Component
+
+#include <memory>
+
+#include <userver/clients/http/plugin_component.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::load_balancer {
+
+class Plugin;
+
+/// @ingroup userver_components
+///
+/// @brief HTTP client plugin that balances the requests to the upstream hosts
+/// between their endpoints.
+///
+/// The requests whose URL host is the name of an upstream are sent to one of
+/// its endpoints. The endpoint is picked on each attempt with the power of
+/// two choices: the less loaded one of two random endpoints, where the load is
+/// the number of in-flight requests weighted by the EWMA of the latencies of
+/// the endpoint. A retry goes to another endpoint than the previous attempt.
+/// An endpoint that fails `failures-to-eject` times in a row (network error
+/// or HTTP 5xx) receives no requests for `ejection-time`, unless all the
+/// endpoints are ejected.
+///
+/// The endpoints of an upstream are either listed in the static config, then
+/// `host:port` of the URL is replaced with the endpoint, or are the addresses
+/// the upstream name resolves to with clients::dns::Resolver, then the URL is
+/// kept and the connection is made to the address, see CURLOPT_CONNECT_TO.
+/// The addresses are re-resolved every `resolve-interval`.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// upstreams | map of the upstream names (hosts of the URLs) to the upstreams options | {}
+/// upstreams.[name].endpoints | list of `host[:port]` of the upstream endpoints | []
+/// upstreams.[name].resolve | use the addresses of the upstream name as the endpoints | false
+/// failures-to-eject | consecutive failures of an endpoint that eject it | 5
+/// ejection-time | for how long an ejected endpoint receives no requests | 10s
+/// resolve-interval | how often the upstreams with `resolve: true` are re-resolved | 10s
+///
+/// The plugin is enabled with `load-balancer` in the `plugins` of
+/// components::HttpClient. The statistics are reported per upstream and
+/// endpoint in `httpclient.load-balancer`.
+///
+/// ## Static configuration example:
+///
+/// @code
+/// http-client-plugin-load-balancer:
+///     upstreams:
+///         my-service:
+///             endpoints: [my-service-1.net:8080, my-service-2.net:8080]
+///         other-service.net:
+///             resolve: true
+/// @endcode
+class Component final : public plugin::ComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of
+    /// clients::http::plugins::load_balancer::Component component
+    static constexpr std::string_view kName = "http-client-plugin-load-balancer";
+
+    Component(const components::ComponentConfig&, const components::ComponentContext&);
+
+    ~Component() override;
+
+    http::Plugin& GetPlugin() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    class Resolving;
+
+    std::unique_ptr<load_balancer::Plugin> plugin_;
+    std::unique_ptr<Resolving> resolving_;
+    utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace clients::http::plugins::load_balancer
+
+template <>
+inline constexpr bool components::kHasValidate<clients::http::plugins::load_balancer::Component> = true;
+
+USERVER_NAMESPACE_END
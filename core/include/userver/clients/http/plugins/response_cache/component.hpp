@@ -0,0 +1,83 @@
+#pragma once
+
+/// @file userver/clients/http/plugins/response_cache/component.hpp
+/// @brief @copybrief clients::http::plugins::response_cache::Component
+
+#include <memory>
+
+#include <userver/clients/http/plugin_component.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+class Plugin;
+
+/// @ingroup userver_components
+///
+/// @brief HTTP client plugin that caches the responses to GET requests
+/// in-process according to RFC 9111.
+///
+/// The responses are kept in a cache::ExpirableLruCache of `ways` x
+/// `way-size` entries keyed by the request URL, the request headers listed in
+/// `Vary` of the response must match as well. A fresh response, see
+/// `max-age`, `s-maxage` and `Expires`, is returned at once with the `Age`
+/// header. A stale response that has `ETag` or `Last-Modified` is revalidated
+/// with `If-None-Match` and `If-Modified-Since`, then a 304 response is
+/// replaced with the cached body and its headers are updated. Within
+/// `stale-while-revalidate` a single request revalidates the response, the
+/// others get the stale one at once.
+///
+/// The plugin acts as a shared cache: responses with `no-store`, `private` or
+/// `Set-Cookie` are not cached, neither are the responses to requests with
+/// `Authorization` unless allowed by `public`, `s-maxage` or
+/// `must-revalidate`. Requests with `Cache-Control: no-store`, `Range` or own
+/// conditional headers bypass the cache, the ones with `no-cache` are always
+/// revalidated. GET requests with a body set by Request::data() or
+/// Request::form() are not cached. Successful POST, PUT, PATCH and DELETE
+/// invalidate the URL.
+///
+/// The method must be set explicitly, e.g. with Request::get(). The plugin
+/// should be listed before `single-flight`, so that the hits are not coalesced.
+/// The coalesced requests are accounted and stored once.
+///
+/// @note The received responses are put into the cache by the next request
+/// through the plugin, as the completion hooks are run outside of coroutines.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// ways | number of the ways of the cache, see cache::NWayLRU | 16
+/// way-size | maximum number of the responses in a way | 64
+/// max-entry-size | responses with larger bodies in bytes are not cached | 16777216
+///
+/// The plugin is enabled with `response-cache` in the `plugins` of
+/// components::HttpClient. The hits, misses, hit ratio, saved bytes and
+/// revalidations are reported in `httpclient.response-cache`.
+class Component final : public plugin::ComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of
+    /// clients::http::plugins::response_cache::Component component
+    static constexpr std::string_view kName = "http-client-plugin-response-cache";
+
+    Component(const components::ComponentConfig&, const components::ComponentContext&);
+
+    ~Component() override;
+
+    http::Plugin& GetPlugin() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<response_cache::Plugin> plugin_;
+    utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace clients::http::plugins::response_cache
+
+template <>
+inline constexpr bool components::kHasValidate<clients::http::plugins::response_cache::Component> = true;
+
+USERVER_NAMESPACE_END
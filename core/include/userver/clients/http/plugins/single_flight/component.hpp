@@ -0,0 +1,72 @@
+#pragma once
+
+/// @file userver/clients/http/plugins/single_flight/component.hpp
+/// @brief @copybrief clients::http::plugins::single_flight::Component
+
+#include <memory>
+
+#include <userver/clients/http/plugin_component.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::single_flight {
+
+class Plugin;
+
+/// @ingroup userver_components
+///
+/// @brief HTTP client plugin that coalesces the identical in-flight GET and
+/// HEAD requests into a single network call.
+///
+/// The requests are identical if they have the same method, URL and values of
+/// the `key-headers`. While the first of the identical requests is in flight,
+/// the others are not sent and wait for it, then receive copies of its
+/// response or its error. If the first request is cancelled, one of the
+/// waiting requests is sent instead. Each of them still waits no longer than
+/// its own timeout.
+///
+/// The method must be set explicitly, e.g. with Request::get(). The requests
+/// with a body set by Request::data() or Request::form() are not coalesced. The plugin
+/// should be listed before the plugins that change the responses, so that the
+/// coalesced requests receive the changed responses. The streamed requests are
+/// not coalesced.
+///
+/// @warning Headers that make the response differ for the same URL, e.g. the
+/// credentials, must be listed in `key-headers`.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// key-headers | headers that are a part of the request identity | [Authorization, Cookie]
+///
+/// The plugin is enabled with `single-flight` in the `plugins` of
+/// components::HttpClient. The numbers of the sent, the coalesced and the
+/// promoted after the cancellation requests are reported in
+/// `httpclient.single-flight`.
+class Component final : public plugin::ComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of
+    /// clients::http::plugins::single_flight::Component component
+    static constexpr std::string_view kName = "http-client-plugin-single-flight";
+
+    Component(const components::ComponentConfig&, const components::ComponentContext&);
+
+    ~Component() override;
+
+    http::Plugin& GetPlugin() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<single_flight::Plugin> plugin_;
+    utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace clients::http::plugins::single_flight
+
+template <>
+inline constexpr bool components::kHasValidate<clients::http::plugins::single_flight::Component> = true;
+
+USERVER_NAMESPACE_END
@@ -18,11 +18,12 @@ namespace components {
 /// @brief Component for storing files in memory
 /// ## Static options:
 ///
-/// Name              | Description                                          | Default value
-/// ----------------- | ---------------------------------------------------- | -------------
-/// dir               | directory to cache files from                        | /var/www
-/// update-period     | Update period (0 - fill the cache only at startup)   | 0
-/// fs-task-processor | task processor to do filesystem operations           | engine::current_task::GetBlockingTaskProcessor()
+/// Name               | Description                                                                         | Default value
+/// ------------------ | ----------------------------------------------------------------------------------- | -------------
+/// dir                | directory to cache files from                                                       | /var/www
+/// update-period      | Update period (0 - fill the cache only at startup)                                  | 0
+/// fs-task-processor  | task processor to do filesystem operations                                          | engine::current_task::GetBlockingTaskProcessor()
+/// max-in-memory-size | files larger than that are kept open instead of being loaded into memory, in bytes  | unlimited
 
 // clang-format on
 
@@ -37,8 +37,12 @@ class Manager;
 /// coro_pool.stack_size | size of a single coroutine stack @ref scripts/docs/en/userver/stack.md | 256 * 1024
 /// coro_pool.local_cache_size | local coroutine cache size per thread | 32
 /// coro_pool.stack_usage_monitor_enabled | whether stack usage is accounted and warnings about too high stack usage are logged @ref scripts/docs/en/userver/stack.md | true
+/// coro_pool.idle_stacks_reclaim_interval | how often memory of idle coroutine stacks is returned to the OS and the pool is shrunk toward initial_size after a load spike, 0 disables | 0
+/// coro_pool.idle_stack_resident_size | bytes at the top of an idle coroutine stack that are never returned to the OS on reclaim, at least 4 pages | 16 * 1024
+/// coro_pool.reserve_stacks_region | whether to reserve address space for max_size stacks on startup to avoid mmap/munmap on coroutine creation | false
 /// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | 2
 /// event_thread_pool.thread_name | set OS thread name to this value | 'event-worker'
+/// event_thread_pool.io_backend | how socket I/O waits on ev threads: `libev` readiness notifications or completions of `io_uring` (falls back to `libev` if the kernel does not support it) | libev
 /// components | dictionary of "component name": "options" | -
 /// default_task_processor | name of the default task processor to use in components | main-task-processor
 /// fs_task_processor | name of the blocking task processor to use in components | fs-task-processor
@@ -59,7 +63,7 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 1000
-/// task-processor-queue | Task queue mode for the task processor. `global-task-queue` default task queue. `work-stealing-task-queue` experimental with potentially better scalability than `global-task-queue`. | global-task-queue
+/// task-processor-queue | Task queue mode for the task processor. `global-task-queue` default task queue. `work-stealing-task-queue` experimental with potentially better scalability than `global-task-queue`. `priority-task-queue` global task queue that dequeues tasks of a higher engine::TaskPriority first, per-priority queue wait times are reported in the task processor statistics. | global-task-queue
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
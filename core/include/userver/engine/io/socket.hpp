@@ -106,6 +106,10 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size, Deadline deadline);
 
+    [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size, Deadline deadline) override {
+        return SendAll(list, list_size, deadline);
+    }
+
     /// @brief Sends exactly list_size iovec to the socket.
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const struct iovec* list, std::size_t list_size, Deadline deadline);
@@ -114,6 +118,15 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+    /// @brief Sends exactly len bytes of the file `file_fd` starting at
+    /// `offset` to the socket. On Linux the data is not copied to the userspace,
+    /// see `man sendfile`.
+    /// @note Can return less than len if socket is closed by peer or if the file
+    /// is shorter than expected.
+    /// @note Reading the file blocks the current thread if the data is not in the
+    /// page cache.
+    [[nodiscard]] size_t SendFile(int file_fd, size_t offset, size_t len, Deadline deadline);
+
     /// @brief Accepts a connection from a listening socket.
     /// @see engine::io::Listen
     [[nodiscard]] Socket Accept(Deadline);
@@ -122,6 +122,8 @@ public:
 
     [[nodiscard]] size_t WriteAll(std::initializer_list<IoData> list, Deadline deadline) override;
 
+    [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size, Deadline deadline) override;
+
     int GetRawFd();
 
 private:
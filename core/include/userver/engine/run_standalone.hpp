@@ -21,6 +21,9 @@ struct TaskProcessorPoolsConfig final {
     std::string ev_thread_name = "ev";
     bool ev_default_loop_disabled = false;
     bool is_stack_usage_monitor_enabled = true;
+    /// Complete socket I/O with io_uring if the kernel supports it, same as
+    /// `io_backend: io_uring` of components_manager.event_thread_pool
+    bool ev_io_uring_enabled = false;
 };
 
 /// @brief Runs a payload in a temporary coroutine engine instance.
@@ -0,0 +1,78 @@
+#pragma once
+
+/// @file userver/engine/task/task_priority.hpp
+/// @brief @copybrief engine::TaskPriority
+
+#include <cstddef>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// @brief Scheduling class of a task.
+///
+/// Only task processors with `task-processor-queue: priority-task-queue`
+/// take it into account: ready tasks of a higher class are dequeued first,
+/// while lower classes are periodically served first to avoid starvation.
+/// Other task queues ignore the priority.
+///
+/// A new task inherits the priority of the task that starts it, tasks started
+/// outside of a coroutine get engine::TaskPriority::kNormal. The priority is
+/// not related to engine::Task::Importance, which only affects cancellation
+/// on overload.
+///
+/// @see engine::TaskPriorityScope
+enum class TaskPriority {
+    kCritical,    ///< Latency critical work, e.g. request handling
+    kNormal,      ///< Default
+    kBackground,  ///< Work that may be delayed, e.g. cache updates
+};
+
+/// @cond
+inline constexpr std::size_t kTaskPriorityCount = 3;
+/// @endcond
+
+std::string_view ToString(TaskPriority priority) noexcept;
+
+namespace current_task {
+
+/// Returns the scheduling class of the current task
+TaskPriority GetPriority() noexcept;
+
+}  // namespace current_task
+
+/// @brief Changes the scheduling class of the current task for the scope
+/// lifetime.
+///
+/// Tasks started from within the scope, e.g. by utils::Async or
+/// engine::AsyncNoSpan, inherit the new priority:
+/// @code
+/// {
+///     engine::TaskPriorityScope background{engine::TaskPriority::kBackground};
+///     auto task = utils::Async("update", [this] { DoUpdate(); });
+/// }
+/// @endcode
+///
+/// Must only be used from within a coroutine.
+class TaskPriorityScope final {
+public:
+    explicit TaskPriorityScope(TaskPriority priority);
+    ~TaskPriorityScope();
+
+    TaskPriorityScope(const TaskPriorityScope&) = delete;
+    TaskPriorityScope(TaskPriorityScope&&) = delete;
+    TaskPriorityScope& operator=(const TaskPriorityScope&) = delete;
+    TaskPriorityScope& operator=(TaskPriorityScope&&) = delete;
+
+private:
+    impl::TaskContext& context_;
+    const TaskPriority old_priority_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
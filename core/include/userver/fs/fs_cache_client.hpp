@@ -23,7 +23,14 @@ public:
     /// @param update_period time (0 - fill the cache only at startup), not used
     /// in Linux
     /// @param tp task processor to do filesystem operations
-    FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period, engine::TaskProcessor& tp);
+    /// @param max_in_memory_size files larger than that are not loaded into
+    /// memory, only their info is cached and the files are kept open
+    FsCacheClient(
+        std::string_view dir,
+        std::chrono::milliseconds update_period,
+        engine::TaskProcessor& tp,
+        std::size_t max_in_memory_size = kNoFileSizeLimit
+    );
 
     /// @brief get file from memory
     /// @param path to file
@@ -52,6 +59,7 @@ private:
     const std::string dir_;
     const std::chrono::milliseconds update_period_;
     engine::TaskProcessor& tp_;
+    const std::size_t max_in_memory_size_;
 #ifndef __linux__
     utils::PeriodicTask cache_updater_;
 #endif
@@ -3,11 +3,15 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <chrono>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/utils/flags.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,11 +23,28 @@ namespace fs {
 struct FileInfoWithData {
     std::string data;
     std::string extension;
+
+    /// Size of the file
+    std::size_t size{0};
+
+    /// Last modification time of the file
+    std::chrono::system_clock::time_point last_modified;
+
+    /// Strong entity tag of this version of the file, quoted as required by
+    /// the ETag HTTP header
+    std::string etag;
+
+    /// The file opened for reading. Set instead of `data` for the files that are
+    /// larger than the in-memory size limit.
+    std::shared_ptr<const blocking::FileDescriptor> file;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
 using FileInfoWithDataMap = std::unordered_map<std::string, FileInfoWithDataConstPtr>;
 
+/// No limit on the size of the files kept in memory
+inline constexpr std::size_t kNoFileSizeLimit = std::numeric_limits<std::size_t>::max();
+
 enum class SettingsReadFile {
     kNone = 0,
     /// Skip hidden files,
@@ -41,13 +62,29 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir);
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path to directory to traverse recursively
 /// @param flags settings read files
+/// @param max_in_memory_size files larger than that are kept open instead of
+/// being read, see fs::ReadFileInfoWithData
 /// @returns map with relative to `path` filepaths and file info
 /// @throws std::runtime_error if read fails for any reason (e.g. no such file,
 /// read error, etc.),
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp,
     const std::string& path,
-    utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden}
+    utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden},
+    std::size_t max_in_memory_size = kNoFileSizeLimit
+);
+
+/// @brief Reads file info and contents asynchronously
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to read
+/// @param max_in_memory_size if the file is larger, its contents are not read
+/// and the file is kept open in FileInfoWithData::file instead
+/// @throws std::runtime_error if read fails for any reason (e.g. no such file,
+/// read error, etc.),
+FileInfoWithData ReadFileInfoWithData(
+    engine::TaskProcessor& async_tp,
+    const std::string& path,
+    std::size_t max_in_memory_size = kNoFileSizeLimit
 );
 
 /// @brief Reads file contents asynchronously
@@ -15,6 +15,9 @@ struct ExclusiveRcuTraits;
 template <typename Key>
 struct DefaultRcuMapTraits;
 
+template <typename Key>
+struct HashTrieRcuMapTraits;
+
 template <typename T, typename RcuTraits = DefaultRcuTraits>
 class Variable;
 
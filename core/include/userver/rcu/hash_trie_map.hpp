@@ -0,0 +1,431 @@
+#pragma once
+
+/// @file userver/rcu/hash_trie_map.hpp
+/// @brief @copybrief rcu::HashTrieMap
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+namespace impl {
+
+inline constexpr std::size_t kHashTrieBits = 5;
+inline constexpr std::size_t kHashTrieMaxDepth = (sizeof(std::size_t) * 8 + kHashTrieBits - 1) / kHashTrieBits;
+
+inline std::uint32_t HashTrieBit(std::size_t hash, std::size_t depth) noexcept {
+    return std::uint32_t{1} << ((hash >> (depth * kHashTrieBits)) & ((std::size_t{1} << kHashTrieBits) - 1));
+}
+
+inline std::size_t HashTrieIndex(std::uint32_t bitmap, std::uint32_t bit) noexcept {
+    return __builtin_popcount(bitmap & (bit - 1));
+}
+
+}  // namespace impl
+
+/// @ingroup userver_containers
+///
+/// @brief Persistent hash map, a hash array mapped trie with structural
+/// sharing between the copies.
+///
+/// Copying the map is O(1): the copies share the trie nodes. A modification
+/// copies only the nodes on the path to the modified element, that is
+/// O(log n) nodes of at most 32 elements each, and never affects the other
+/// copies of the map. Nodes that are not shared with other copies are modified
+/// in place, so a series of modifications of the same copy is cheap.
+///
+/// Used as a storage of rcu::RcuMap with rcu::HashTrieRcuMapTraits.
+///
+/// Iterators are constant, they are invalidated by any modification of the
+/// map they were obtained from, but not by modifications of its copies.
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class HashTrieMap final {
+    struct Node;
+    using NodePtr = std::shared_ptr<Node>;
+
+public:
+    class const_iterator;
+
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using iterator = const_iterator;
+
+    HashTrieMap() = default;
+    explicit HashTrieMap(Hash hash, KeyEqual equal = KeyEqual{}) : hash_(std::move(hash)), equal_(std::move(equal)) {}
+
+    HashTrieMap(const HashTrieMap&) = default;
+    HashTrieMap(HashTrieMap&& other) noexcept
+        : root_(std::move(other.root_)),
+          size_(std::exchange(other.size_, 0)),
+          hash_(std::move(other.hash_)),
+          equal_(std::move(other.equal_)) {}
+    HashTrieMap& operator=(const HashTrieMap&) = default;
+    HashTrieMap& operator=(HashTrieMap&& other) noexcept {
+        root_ = std::move(other.root_);
+        size_ = std::exchange(other.size_, 0);
+        hash_ = std::move(other.hash_);
+        equal_ = std::move(other.equal_);
+        return *this;
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const_iterator begin() const;
+    const_iterator end() const noexcept { return {}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const noexcept { return {}; }
+
+    const_iterator find(const Key& key) const;
+    size_type count(const Key& key) const { return find(key) == end() ? 0 : 1; }
+    bool contains(const Key& key) const { return find(key) != end(); }
+
+    /// Same as `try_emplace`, the value is constructed from `args`
+    template <typename... Args>
+    std::pair<const_iterator, bool> emplace(const Key& key, Args&&... args) {
+        return DoInsert<false>(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<const_iterator, bool> emplace(Key&& key, Args&&... args) {
+        return DoInsert<false>(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<const_iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return DoInsert<false>(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<const_iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return DoInsert<false>(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename M>
+    std::pair<const_iterator, bool> insert_or_assign(const Key& key, M&& value) {
+        return DoInsert<true>(key, std::forward<M>(value));
+    }
+
+    template <typename M>
+    std::pair<const_iterator, bool> insert_or_assign(Key&& key, M&& value) {
+        return DoInsert<true>(std::move(key), std::forward<M>(value));
+    }
+
+    size_type erase(const Key& key);
+
+    void clear() noexcept {
+        root_.reset();
+        size_ = 0;
+    }
+
+private:
+    template <bool Assign, typename KeyRef, typename... Args>
+    std::pair<const_iterator, bool> DoInsert(KeyRef&& key, Args&&... args);
+
+    void DoErase(NodePtr& slot, std::size_t depth, std::size_t hash, const Key& key);
+
+    static Node& MakeMutable(NodePtr& node);
+
+    NodePtr root_;
+    size_type size_{0};
+    Hash hash_;
+    KeyEqual equal_;
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+struct HashTrieMap<Key, Value, Hash, KeyEqual>::Node {
+    // Collision nodes at impl::kHashTrieMaxDepth have no bitmaps and no children
+    std::uint32_t data_map{0};
+    std::uint32_t node_map{0};
+    std::vector<value_type> entries;
+    std::vector<NodePtr> children;
+};
+
+/// @brief Forward iterator for the rcu::HashTrieMap
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+class HashTrieMap<Key, Value, Hash, KeyEqual>::const_iterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename HashTrieMap::value_type;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    const_iterator() = default;
+
+    reference operator*() const {
+        UASSERT(depth_ != 0);
+        const auto& frame = frames_[depth_ - 1];
+        return frame.node->entries[frame.position];
+    }
+
+    pointer operator->() const { return &**this; }
+
+    const_iterator& operator++() {
+        UASSERT(depth_ != 0);
+        ++frames_[depth_ - 1].position;
+        Settle();
+        return *this;
+    }
+
+    const_iterator operator++(int) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    bool operator==(const const_iterator& other) const noexcept {
+        if (depth_ != other.depth_) return false;
+        if (depth_ == 0) return true;
+        const auto& lhs = frames_[depth_ - 1];
+        const auto& rhs = other.frames_[depth_ - 1];
+        return lhs.node == rhs.node && lhs.position == rhs.position;
+    }
+
+    bool operator!=(const const_iterator& other) const noexcept { return !(*this == other); }
+
+private:
+    friend class HashTrieMap;
+
+    // Positions [0, entries.size()) point to the entries of the node, the
+    // following ones point to the children. A parent frame is already advanced
+    // past the child being iterated.
+    struct Frame {
+        const Node* node;
+        std::size_t position;
+    };
+
+    void Push(const Node* node, std::size_t position) noexcept {
+        UASSERT(depth_ < frames_.size());
+        frames_[depth_++] = {node, position};
+    }
+
+    // Descends or ascends until the top frame points to an entry
+    void Settle() noexcept {
+        while (depth_ != 0) {
+            auto& frame = frames_[depth_ - 1];
+            const auto entries_count = frame.node->entries.size();
+            if (frame.position < entries_count) return;
+
+            const auto child_index = frame.position - entries_count;
+            if (child_index < frame.node->children.size()) {
+                ++frame.position;
+                Push(frame.node->children[child_index].get(), 0);
+            } else {
+                --depth_;
+            }
+        }
+    }
+
+    // Only the first depth_ frames are initialized
+    std::array<Frame, impl::kHashTrieMaxDepth + 1> frames_;
+    std::size_t depth_{0};
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+auto HashTrieMap<Key, Value, Hash, KeyEqual>::begin() const -> const_iterator {
+    const_iterator it;
+    if (root_) {
+        it.Push(root_.get(), 0);
+        it.Settle();
+    }
+    return it;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+auto HashTrieMap<Key, Value, Hash, KeyEqual>::find(const Key& key) const -> const_iterator {
+    const auto hash = hash_(key);
+    const_iterator it;
+    const Node* node = root_.get();
+    for (std::size_t depth = 0; node; ++depth) {
+        if (depth == impl::kHashTrieMaxDepth) {
+            for (std::size_t i = 0; i < node->entries.size(); ++i) {
+                if (equal_(node->entries[i].first, key)) {
+                    it.Push(node, i);
+                    return it;
+                }
+            }
+            return {};
+        }
+
+        const auto bit = impl::HashTrieBit(hash, depth);
+        if (node->data_map & bit) {
+            const auto index = impl::HashTrieIndex(node->data_map, bit);
+            if (!equal_(node->entries[index].first, key)) return {};
+            it.Push(node, index);
+            return it;
+        }
+        if (!(node->node_map & bit)) return {};
+
+        const auto child_index = impl::HashTrieIndex(node->node_map, bit);
+        it.Push(node, node->entries.size() + child_index + 1);
+        node = node->children[child_index].get();
+    }
+    return {};
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+template <bool Assign, typename KeyRef, typename... Args>
+auto HashTrieMap<Key, Value, Hash, KeyEqual>::DoInsert(KeyRef&& key, Args&&... args)
+    -> std::pair<const_iterator, bool> {
+    if constexpr (!Assign) {
+        // Avoid copying the path if there is nothing to insert
+        auto it = find(key);
+        if (it != end()) return {it, false};
+    }
+
+    const auto hash = hash_(key);
+    const_iterator it;
+    NodePtr* slot = &root_;
+    for (std::size_t depth = 0;; ++depth) {
+        Node& node = MakeMutable(*slot);
+
+        if (depth == impl::kHashTrieMaxDepth) {
+            for (std::size_t i = 0; i < node.entries.size(); ++i) {
+                if (equal_(node.entries[i].first, key)) {
+                    if constexpr (Assign) node.entries[i].second = Value(std::forward<Args>(args)...);
+                    it.Push(&node, i);
+                    return {it, false};
+                }
+            }
+            node.entries.emplace_back(
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<KeyRef>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+            );
+            ++size_;
+            it.Push(&node, node.entries.size() - 1);
+            return {it, true};
+        }
+
+        const auto bit = impl::HashTrieBit(hash, depth);
+        if (node.data_map & bit) {
+            const auto index = impl::HashTrieIndex(node.data_map, bit);
+            auto& entry = node.entries[index];
+            if (equal_(entry.first, key)) {
+                if constexpr (Assign) entry.second = Value(std::forward<Args>(args)...);
+                it.Push(&node, index);
+                return {it, false};
+            }
+
+            // Both keys have the same hash fragment at this level, push the stored
+            // entry one level down and continue the insertion from there
+            auto child = std::make_shared<Node>();
+            if (depth + 1 != impl::kHashTrieMaxDepth) {
+                child->data_map = impl::HashTrieBit(hash_(entry.first), depth + 1);
+            }
+            child->entries.push_back(std::move(entry));
+            node.entries.erase(node.entries.begin() + index);
+            node.data_map ^= bit;
+
+            node.children.insert(node.children.begin() + impl::HashTrieIndex(node.node_map, bit), std::move(child));
+            node.node_map |= bit;
+        }
+
+        if (node.node_map & bit) {
+            const auto child_index = impl::HashTrieIndex(node.node_map, bit);
+            it.Push(&node, node.entries.size() + child_index + 1);
+            slot = &node.children[child_index];
+            continue;
+        }
+
+        const auto index = impl::HashTrieIndex(node.data_map, bit);
+        node.entries.emplace(
+            node.entries.begin() + index,
+            std::piecewise_construct,
+            std::forward_as_tuple(std::forward<KeyRef>(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...)
+        );
+        node.data_map |= bit;
+        ++size_;
+        it.Push(&node, index);
+        return {it, true};
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+auto HashTrieMap<Key, Value, Hash, KeyEqual>::erase(const Key& key) -> size_type {
+    // Avoid copying the path if there is nothing to erase
+    if (find(key) == end()) return 0;
+
+    DoErase(root_, 0, hash_(key), key);
+    if (--size_ == 0) root_.reset();
+    return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTrieMap<Key, Value, Hash, KeyEqual>::DoErase(
+    NodePtr& slot,
+    std::size_t depth,
+    std::size_t hash,
+    const Key& key
+) {
+    Node& node = MakeMutable(slot);
+
+    if (depth == impl::kHashTrieMaxDepth) {
+        for (auto it = node.entries.begin(); it != node.entries.end(); ++it) {
+            if (equal_(it->first, key)) {
+                node.entries.erase(it);
+                return;
+            }
+        }
+        UASSERT_MSG(false, "Erased key is missing");
+        return;
+    }
+
+    const auto bit = impl::HashTrieBit(hash, depth);
+    if (node.data_map & bit) {
+        node.entries.erase(node.entries.begin() + impl::HashTrieIndex(node.data_map, bit));
+        node.data_map ^= bit;
+        return;
+    }
+
+    UASSERT(node.node_map & bit);
+    const auto child_index = impl::HashTrieIndex(node.node_map, bit);
+    DoErase(node.children[child_index], depth + 1, hash, key);
+
+    // Keep the trie canonical: a subtree of a single entry is stored inline
+    Node& child = *node.children[child_index];
+    if (child.children.empty() && child.entries.size() == 1) {
+        node.entries.insert(
+            node.entries.begin() + impl::HashTrieIndex(node.data_map, bit), std::move(child.entries.front())
+        );
+        node.data_map |= bit;
+        node.children.erase(node.children.begin() + child_index);
+        node.node_map ^= bit;
+    }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+auto HashTrieMap<Key, Value, Hash, KeyEqual>::MakeMutable(NodePtr& node) -> Node& {
+    if (!node) {
+        node = std::make_shared<Node>();
+    } else if (node.use_count() != 1) {
+        node = std::make_shared<Node>(*node);
+    } else {
+        // The node is reachable only through this map, but the last other owner
+        // might have been released just now: synchronize with its reads.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *node;
+}
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
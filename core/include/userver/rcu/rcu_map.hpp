@@ -10,6 +10,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include <userver/rcu/hash_trie_map.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/utils/traceful_exception.hpp>
 
@@ -42,12 +43,28 @@ public:
 /// type `Key`
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - `MapType` is a template of the underlying map, see
+/// rcu::HashTrieRcuMapTraits for an alternative to `std::unordered_map`
 template <typename Key>
 struct DefaultRcuMapTraits : public impl::ShouldInheritFromDefaultRcuMapTraits {
     using Hash = std::hash<Key>;
     using KeyEqual = std::equal_to<Key>;
     using MutexType = engine::Mutex;
     using DeleterType = AsyncDeleter;
+
+    template <typename K, typename V, typename H, typename E>
+    using MapType = std::unordered_map<K, V, H, E>;
+};
+
+/// @brief RcuMap traits that store the map in rcu::HashTrieMap.
+///
+/// A keyset change (e.g. insert or erase) copies O(log n) trie nodes instead of
+/// the whole map, at the cost of somewhat slower lookups and iteration.
+/// Prefer these traits for large maps with frequent keyset changes.
+template <typename Key>
+struct HashTrieRcuMapTraits : public DefaultRcuMapTraits<Key> {
+    template <typename K, typename V, typename H, typename E>
+    using MapType = HashTrieMap<K, V, H, E>;
 };
 
 /// @brief Forward iterator for the rcu::RcuMap
@@ -61,7 +78,7 @@ class RcuMapIterator final {
     );
     using Hash = typename RcuMapTraits::Hash;
     using KeyEqual = typename RcuMapTraits::KeyEqual;
-    using MapType = std::unordered_map<Key, std::shared_ptr<Value>, Hash, KeyEqual>;
+    using MapType = typename RcuMapTraits::template MapType<Key, std::shared_ptr<Value>, Hash, KeyEqual>;
     using BaseIterator = typename MapType::const_iterator;
     using RcuTraits = typename impl::RcuTraitsFromRcuMapTraits<RcuMapTraits>;
 
@@ -102,7 +119,9 @@ private:
 /// Only keyset changes are thread-safe in scope of this class.
 /// Values are stored in `shared_ptr`s and are not copied during keyset change.
 /// The map itself is implemented as rcu::Variable, so every keyset change
-/// (e.g. insert or erase) triggers the whole map copying.
+/// (e.g. insert or erase) triggers the whole map copying. Use
+/// rcu::HashTrieRcuMapTraits to copy only O(log n) nodes of a persistent
+/// hash trie instead.
 /// @note No synchronization is provided for value access, it must be
 /// implemented by Value when necessary.
 ///
@@ -130,7 +149,7 @@ public:
     using Iterator = RcuMapIterator<Key, Value, Value, RcuMapTraits>;
     using ConstValuePtr = std::shared_ptr<const Value>;
     using ConstIterator = RcuMapIterator<Key, Value, const Value, RcuMapTraits>;
-    using RawMap = std::unordered_map<Key, ValuePtr, Hash, KeyEqual>;
+    using RawMap = typename RcuMapTraits::template MapType<Key, ValuePtr, Hash, KeyEqual>;
     using Snapshot = std::unordered_map<Key, ConstValuePtr, Hash, KeyEqual>;
     using InsertReturnType = InsertReturnTypeImpl<ValuePtr>;
 
@@ -344,13 +363,14 @@ RcuMap<K, V, RcuMapTraits>::TryEmplace(const K& key, Args&&... args) {
     InsertReturnType result{Get(key), false};
     if (!result.value) {
         auto txn = rcu_.StartWrite();
-        auto insertion_result = txn->try_emplace(key, nullptr);
-        if (insertion_result.second) {
-            result.value = insertion_result.first->second = std::make_shared<V>(std::forward<Args>(args)...);
+        const auto it = txn->find(key);
+        if (it == txn->end()) {
+            result.value = std::make_shared<V>(std::forward<Args>(args)...);
+            txn->emplace(key, result.value);
             txn.Commit();
             result.inserted = true;
         } else {
-            result.value = insertion_result.first->second;
+            result.value = it->second;
         }
     }
     return result;
@@ -0,0 +1,73 @@
+#pragma once
+
+/// @file userver/server/handlers/http_handler_lazy_json_base.hpp
+/// @brief @copybrief server::handlers::HttpHandlerLazyJsonBase
+
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers userver_base_classes
+///
+/// @brief Base for handlers that accept requests with body in JSON format,
+/// read only a few fields of it and respond with body in JSON format.
+///
+/// The same as server::handlers::HttpHandlerJsonBase, but the request body is
+/// only validated before the handler is called and is passed as
+/// formats::json::LazyValue. Only the subtrees that the handler reads are
+/// parsed into formats::json::Value, which saves CPU and memory for large
+/// request bodies. If the handler reads most of the body, prefer
+/// server::handlers::HttpHandlerJsonBase.
+///
+/// ## Static options:
+/// The same as server::handlers::HttpHandlerBase.
+
+// clang-format on
+
+class HttpHandlerLazyJsonBase : public HttpHandlerBase {
+public:
+    using Value = formats::json::Value;
+    using LazyValue = formats::json::LazyValue;
+    using HttpRequest = server::http::HttpRequest;
+    using RequestContext = server::request::RequestContext;
+
+    HttpHandlerLazyJsonBase(
+        const components::ComponentConfig& config,
+        const components::ComponentContext& component_context,
+        bool is_monitor = false
+    );
+
+    std::string HandleRequestThrow(const http::HttpRequest& request, request::RequestContext& context) const final;
+
+    virtual Value
+    HandleRequestJsonThrow(const HttpRequest& request, const LazyValue& request_json, RequestContext& context)
+        const = 0;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+protected:
+    /// @returns A pointer to json request if it was validated successfully or
+    /// nullptr otherwise.
+    static const formats::json::LazyValue* GetRequestJson(const request::RequestContext& context);
+
+    /// @returns a pointer to json response if it was returned successfully by
+    /// `HandleRequestJsonThrow()` or nullptr otherwise.
+    static const formats::json::Value* GetResponseJson(const request::RequestContext& context);
+
+    void ParseRequestData(const http::HttpRequest& request, request::RequestContext& context) const override;
+
+private:
+    FormattedErrorData GetFormattedExternalErrorBody(const CustomHandlerException& exc) const final;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::HttpHandlerLazyJsonBase> = true;
+
+USERVER_NAMESPACE_END
@@ -27,6 +27,12 @@ namespace server::handlers {
 /// the `handler-static` with `path: /handler-static-path/*` on request to `/handler-static-path/some/file.html`
 /// would return file at path `/fs-cache-main-path/some/file.html`.
 ///
+/// Responses carry `ETag`, `Last-Modified` and `Accept-Ranges` headers. Requests
+/// with a matching `If-None-Match` get HTTP 304, a single byte range from the
+/// `Range` header (honoring `If-Range`) is returned with HTTP 206. Files larger
+/// than the `max-in-memory-size` of the components::FsCache are not kept in
+/// memory and are sent with `sendfile()` for plain HTTP/1.1 connections.
+///
 /// ## HttpHandlerStatic Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
@@ -64,6 +70,16 @@ public:
     static yaml_config::Schema GetStaticConfigSchema();
 
 private:
+    std::string HandleConditionalRequest(const http::HttpRequest& request, const fs::FileInfoWithDataConstPtr& file)
+        const;
+
+    static std::string MakeBody(
+        http::HttpResponse& response,
+        const fs::FileInfoWithDataConstPtr& file,
+        std::size_t offset,
+        std::size_t size
+    );
+
     dynamic_config::Source config_;
     const fs::FsCacheClient& storage_;
     const std::chrono::seconds cache_age_;
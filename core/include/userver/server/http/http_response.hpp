@@ -4,6 +4,9 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 
@@ -20,6 +23,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace fs {
+struct FileInfoWithData;
+}  // namespace fs
+
 namespace server::http {
 
 // RFC 9110 states that in case of missing Content-Type it may be assumed to be
@@ -34,8 +41,17 @@ class Http2ResponseWriter;
 
 namespace impl {
 
+class ResponseBodyEncoder;
+
 void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header, std::string_view key, std::string_view val);
 
+// A part of an opened file sent as the response body
+struct FileBody {
+    std::shared_ptr<const fs::FileInfoWithData> file;
+    std::size_t offset{0};
+    std::size_t size{0};
+};
+
 }  // namespace impl
 
 class HttpRequest;
@@ -127,6 +143,19 @@ public:
     /// @cond
     // TODO: server internals. remove from public interface
     void SendResponse(engine::io::RwBase& socket) override;
+
+    // Serializes the status line and headers of a fully constructed (not
+    // streamed) response into an empty `header`, returns the body that should be
+    // written right after it. Used to coalesce writes of pipelined responses.
+    std::string_view SerializeNotStreamed(USERVER_NAMESPACE::http::headers::HeadersString& header);
+
+    // Marks the response serialized via SerializeNotStreamed() as sent.
+    void SetSerializedSent(std::size_t bytes_sent, std::chrono::steady_clock::time_point sent_time);
+
+    // Sends the part of the file as the body, with sendfile(2) where possible.
+    // Ignored if the body data is set.
+    void SetFileBody(impl::FileBody body);
+    bool HasFileBody() const;
     /// @endcond
 
     void SetStatusServiceUnavailable() override { SetStatus(HttpStatus::kServiceUnavailable); }
@@ -144,15 +173,32 @@ public:
     // Can be called only once
     Producer GetBodyProducer();
 
+    /// @cond
+    // Encoder for the chunks of a streamed body, e.g. for compression
+    void SetStreamBodyEncoder(std::unique_ptr<impl::ResponseBodyEncoder> encoder);
+    std::unique_ptr<impl::ResponseBodyEncoder> ExtractStreamBodyEncoder();
+    /// @endcond
+
 private:
     friend class Http2ResponseWriter;
 
+    void OutputStatusLineAndHeaders(USERVER_NAMESPACE::http::headers::HeadersString& header);
+
+    // Finishes the headers of a not streamed response, returns the body to send
+    std::string_view OutputNotStreamedBodyHeaders(USERVER_NAMESPACE::http::headers::HeadersString& header) const;
+
     // Returns total size of the response
     std::size_t SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
 
     // Returns total size of the response
     std::size_t SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
 
+    // Returns total size of the response
+    std::size_t SetBodyFile(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
+
+    // Reads the file body into memory, for the transports that need a copy
+    std::string ReadFileBody() const;
+
     const HttpRequest& request_;
     HttpStatus status_ = HttpStatus::kOk;
     HeadersMap headers_;
@@ -161,6 +207,8 @@ private:
     engine::SingleConsumerEvent headers_end_{engine::SingleConsumerEvent::NoAutoReset()};
     std::optional<Queue::Consumer> body_stream_;
     Producer body_stream_producer_;
+    std::unique_ptr<impl::ResponseBodyEncoder> stream_body_encoder_;
+    std::optional<impl::FileBody> file_body_;
     bool is_stream_body_{false};
 };
 
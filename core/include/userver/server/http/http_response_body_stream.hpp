@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <userver/server/http/http_response.hpp>
@@ -15,7 +16,7 @@ namespace server::http {
 
 class ResponseBodyStream final {
 public:
-    ResponseBodyStream(ResponseBodyStream&&) = default;
+    ResponseBodyStream(ResponseBodyStream&&) noexcept;
     ~ResponseBodyStream();
 
     // Send a chunk of response data. It may NOT generate
@@ -37,9 +38,12 @@ private:
 
     ResponseBodyStream(HttpResponse::Producer&& queue_producer, HttpResponse& http_response);
 
+    bool PushEncodedChunk(std::string&& chunk, engine::Deadline deadline);
+
     bool headers_ended_{false};
     HttpResponse::Producer queue_producer_;
     HttpResponse& http_response_;
+    std::unique_ptr<impl::ResponseBodyEncoder> encoder_;
 };
 
 }  // namespace server::http
@@ -20,6 +20,7 @@ inline constexpr std::string_view kBaggage = "userver-baggage-middleware";
 inline constexpr std::string_view kAuth = "userver-auth-middleware";
 inline constexpr std::string_view kDecompression = "userver-decompression-middleware";
 inline constexpr std::string_view kExceptionsHandling = "userver-exceptions-handling-middleware";
+inline constexpr std::string_view kResponseCompression = "userver-response-compression-middleware";
 
 }  // namespace server::middlewares::builtin
 
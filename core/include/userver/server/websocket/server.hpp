@@ -5,6 +5,8 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -45,13 +47,70 @@ struct Message {
 
 class WebSocketConnectionImpl;
 
+/// @brief Settings of the permessage-deflate extension, see
+/// https://datatracker.ietf.org/doc/html/rfc7692
+struct PerMessageDeflateConfig final {
+    /// Accept the permessage-deflate offers of the clients
+    bool enabled = false;
+    /// Compress each message with a fresh context. Required to send the
+    /// compressed PreparedMessage frames, saves the memory of the compressor
+    /// between the messages at the cost of the compression ratio
+    bool server_no_context_takeover = false;
+    /// Ask the clients to compress each message with a fresh context,
+    /// saves the memory of the decompressor between the messages
+    bool client_no_context_takeover = false;
+    /// Base-2 logarithm of the compression window size, from 9 to 15
+    int server_max_window_bits = 15;
+    /// Base-2 logarithm of the window size the clients may use, from 9 to 15
+    int client_max_window_bits = 15;
+    /// Memory level of the compressor, from 1 to 9
+    int mem_level = 8;
+    /// Compression level, from 0 to 9, -1 for the zlib default
+    int compression_level = -1;
+    /// Smaller messages are sent uncompressed
+    unsigned min_compress_size = 64;
+};
+
+PerMessageDeflateConfig Parse(const yaml_config::YamlConfig&, formats::parse::To<PerMessageDeflateConfig>);
+
 struct Config final {
     unsigned max_remote_payload = 65536;
     unsigned fragment_size = 65536;  // 0 - do not fragment
+    PerMessageDeflateConfig deflate{};
+    bool validate_utf8 = true;  // close the connection on a text message that is not UTF-8
 };
 
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
 
+/// @brief A message that is framed once and then sent to any number of
+/// connections by WebSocketConnection::SendPrepared without copying or
+/// framing the payload for each of them.
+///
+/// If compression is enabled, the message is also compressed once. The
+/// compressed frame is sent to the connections that agreed on the
+/// permessage-deflate extension with `server_no_context_takeover` and a large
+/// enough window, the rest of the connections receive the uncompressed frame.
+///
+/// The message is never fragmented. It is cheap to copy.
+class PreparedMessage final {
+public:
+    /// @param data payload of the message
+    /// @param is_text send a text message if true, a binary one otherwise
+    /// @param deflate_config compression settings, the message is compressed
+    /// only if the compression is enabled
+    /// @throws compression::CompressionError
+    PreparedMessage(std::string_view data, bool is_text, const PerMessageDeflateConfig& deflate_config = {});
+
+    /// @returns the size of the uncompressed payload
+    std::size_t GetPayloadSize() const noexcept;
+
+private:
+    friend class WebSocketConnectionImpl;
+
+    struct Impl;
+    std::shared_ptr<const Impl> impl_;
+};
+
 struct Statistics final {
     std::atomic<int64_t> msg_sent{0};
     std::atomic<int64_t> msg_recv{0};
@@ -95,6 +154,11 @@ public:
     virtual void Send(const Message& message) = 0;
     virtual void SendText(std::string_view message) = 0;
 
+    /// @brief Send a message framed beforehand, see PreparedMessage.
+    /// @throws engine::io::IoException in case of socket errors
+    /// @note Has the same thread-safety guarantees as Send().
+    virtual void SendPrepared(const PreparedMessage& message) = 0;
+
     /// @brief Send a ping message to websocket.
     /// @throws engine::io::IoException in case of socket errors
     virtual void SendPing() = 0;
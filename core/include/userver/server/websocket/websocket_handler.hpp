@@ -28,6 +28,15 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// validate-utf8 | close the connection with status 1007 on a text message that is not a valid UTF-8 | true
+/// permessage-deflate.enabled | accept permessage-deflate (RFC 7692) offers of the clients | false
+/// permessage-deflate.server-no-context-takeover | fresh compression context per message, see PreparedMessage | false
+/// permessage-deflate.client-no-context-takeover | ask clients for a fresh context per message | false
+/// permessage-deflate.server-max-window-bits | base-2 logarithm of the compression window size, 9..15 | 15
+/// permessage-deflate.client-max-window-bits | base-2 logarithm of the window size the clients may use, 9..15 | 15
+/// permessage-deflate.mem-level | memory level of the compressor, 1..9 | 8
+/// permessage-deflate.compression-level | compression level, -1 for the zlib default | -1
+/// permessage-deflate.min-compress-size | smaller messages are sent uncompressed | 64
 ///
 /// ## Example usage:
 ///
@@ -49,6 +58,11 @@ public:
         return true;
     }
 
+    /// @brief Frames (and compresses, if permessage-deflate is enabled) the
+    /// message once to send it to many connections of the handler with
+    /// WebSocketConnection::SendPrepared.
+    PreparedMessage PrepareMessage(std::string_view data, bool is_text) const;
+
     /// @cond
     void WriteMetrics(utils::statistics::Writer& writer) const;
 
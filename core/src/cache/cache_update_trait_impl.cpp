@@ -7,6 +7,7 @@
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/cache_control.hpp>
 #include <userver/tracing/tracer.hpp>
@@ -317,6 +318,8 @@ UpdateType CacheUpdateTrait::Impl::NextUpdateType(const Config& config) {
 }
 
 void CacheUpdateTrait::Impl::DoPeriodicUpdate() {
+    // Let request handling go first on task processors with priority-task-queue
+    const engine::TaskPriorityScope background_priority{engine::TaskPriority::kBackground};
     const std::lock_guard lock(update_mutex_);
     const auto config = GetConfig();
 
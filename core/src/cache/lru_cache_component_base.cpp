@@ -63,6 +63,13 @@ properties:
         type: boolean
         description: enables asynchronous updates for expiring values
         defaultDescription: false
+    policy:
+        type: string
+        description: eviction policy
+        defaultDescription: lru
+        enum:
+          - lru
+          - tinylfu
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
@@ -6,6 +6,7 @@
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,17 +19,33 @@ constexpr std::string_view kSize = "size";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kPolicy = "policy";
+
+constexpr utils::TrivialBiMap kCachePolicyMap([](auto selector) {
+    return selector().Case(CachePolicy::kLRU, "lru").Case(CachePolicy::kTinyLFU, "tinylfu");
+});
 
 }  // namespace
 
 using dump::impl::ParseMs;
 
+CachePolicy Parse(const yaml_config::YamlConfig& config, formats::parse::To<CachePolicy>) {
+    return utils::ParseFromValueString(config, kCachePolicyMap);
+}
+
+CachePolicy Parse(const formats::json::Value& value, formats::parse::To<CachePolicy>) {
+    return utils::ParseFromValueString(value, kCachePolicyMap);
+}
+
+std::string_view ToString(CachePolicy policy) { return utils::impl::EnumToStringView(policy, kCachePolicyMap); }
+
 LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
     : size(config[kSize].As<std::size_t>()),
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(
           config[kBackgroundUpdate].As<bool>(false) ? BackgroundUpdateMode::kEnabled : BackgroundUpdateMode::kDisabled
-      ) {
+      ),
+      policy(config[kPolicy].As<CachePolicy>(CachePolicy::kLRU)) {
     if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -40,7 +57,8 @@ LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(
           value[kBackgroundUpdate].As<bool>(false) ? BackgroundUpdateMode::kEnabled : BackgroundUpdateMode::kDisabled
-      ) {
+      ),
+      policy(value[kPolicy].As<CachePolicy>(CachePolicy::kLRU)) {
     if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
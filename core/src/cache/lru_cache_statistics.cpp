@@ -1,5 +1,6 @@
 #include <userver/cache/lru_cache_statistics.hpp>
 
+#include <userver/cache/lru_cache_config.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
@@ -14,6 +15,10 @@ void WriteRateAndLegacyMetrics(utils::statistics::Writer&& writer, utils::statis
     writer["v2"] = metric;
 }
 
+ExpirableLruCachePolicyStatistics& GetPolicyStatistics(ExpirableLruCacheStatistics& stats) {
+    return stats.policies[static_cast<std::size_t>(stats.policy.load())];
+}
+
 }  // namespace
 
 ExpirableLruCacheStatisticsAggregator ExpirableLruCacheStatisticsBase::Load() const {
@@ -35,12 +40,14 @@ void ExpirableLruCacheStatisticsBase::Reset() {
 void CacheHit(ExpirableLruCacheStatistics& stats) {
     ++stats.total.hits;
     ++stats.recent_hits.GetCurrentCounter();
+    ++GetPolicyStatistics(stats).hits;
     LOG_TRACE() << "cache hit";
 }
 
 void CacheMiss(ExpirableLruCacheStatistics& stats) {
     ++stats.total.misses;
     ++stats.recent_misses.GetCurrentCounter();
+    ++GetPolicyStatistics(stats).misses;
     LOG_TRACE() << "cache miss";
 }
 
@@ -61,6 +68,15 @@ void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCacheStatis
     WriteRateAndLegacyMetrics(writer["background-updates"], stats.background_updates.Load());
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCachePolicyStatistics& stats) {
+    const auto hits = stats.hits.Load();
+    const auto misses = stats.misses.Load();
+    const auto total = hits.value + misses.value;
+    writer["hits"] = hits;
+    writer["misses"] = misses;
+    writer["hit_ratio"] = static_cast<double>(hits.value) / static_cast<double>(total ? total : 1);
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCacheStatistics& stats) {
     writer = stats.total;
 
@@ -68,6 +84,17 @@ void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCacheStatis
     const auto s1min_misses = stats.recent_misses.GetStatsForPeriod();
     const auto s1min_total = s1min_hits + s1min_misses;
     writer["hit_ratio"]["1min"] = static_cast<double>(s1min_hits) / static_cast<double>(s1min_total ? s1min_total : 1);
+
+    // Policies that were never used are skipped
+    const auto current_policy = stats.policy.load();
+    for (std::size_t i = 0; i < kCachePoliciesCount; ++i) {
+        const auto policy = static_cast<CachePolicy>(i);
+        const auto& policy_stats = stats.policies[i];
+        if (policy != current_policy && !policy_stats.hits.Load().value && !policy_stats.misses.Load().value) {
+            continue;
+        }
+        writer["policy"].ValueWithLabels(policy_stats, {"cache_policy", ToString(policy)});
+    }
 }
 
 }  // namespace cache::impl
@@ -54,6 +54,24 @@ UTEST(NWayLRU, SetMultipleWays) {
     EXPECT_EQ(1, cache.Get(1));
 }
 
+UTEST(NWayLRU, SetPolicy) {
+    Cache cache(2, 10);
+    for (int i = 0; i < 10; ++i) cache.Put(i, i);
+    EXPECT_EQ(10, cache.GetSize());
+
+    cache.SetPolicy(cache::CachePolicy::kTinyLFU);
+    EXPECT_EQ(10, cache.GetSize());
+    for (int i = 0; i < 10; ++i) EXPECT_EQ(i, cache.GetOr(i, -1));
+
+    for (int i = 10; i < 100; ++i) cache.Put(i, i);
+    EXPECT_LE(cache.GetSize(), 20);
+
+    cache.SetPolicy(cache::CachePolicy::kLRU);
+    EXPECT_LE(cache.GetSize(), 20);
+    cache.Invalidate();
+    EXPECT_EQ(0, cache.GetSize());
+}
+
 UTEST(NWayLRU, HashCombine) {
     for (const auto seed : std::vector<std::size_t>{0, 1, 7, 42, 100, 1000}) {
         /// @note: checking for seed used in way selection to not be equal after
@@ -4,7 +4,9 @@
 
 #include <clients/http/request_state.hpp>
 #include <userver/clients/http/request.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -32,12 +34,81 @@ void PluginRequest::SetTimeout(std::chrono::milliseconds ms) {
     state_.SetEasyTimeout(ms);
 }
 
+void PluginRequest::SetUrl(std::string url) { state_.easy().set_url(std::move(url)); }
+
+void PluginRequest::SetConnectTo(const ConnectTo& connect_to) { state_.connect_to(connect_to); }
+
 const std::string& PluginRequest::GetOriginalUrl() const { return state_.easy().get_original_url(); }
 
+std::optional<HttpMethod> PluginRequest::GetMethod() const { return state_.GetMethod(); }
+
+std::optional<std::string_view> PluginRequest::GetHeader(std::string_view name) const {
+    return state_.easy().FindHeaderByName(name);
+}
+
+bool PluginRequest::HasBody() const { return state_.easy().has_post_data(); }
+
+bool PluginRequest::IsIntercepted() const { return state_.IsIntercepted(); }
+
+InterceptedRequest PluginRequest::Intercept() { return InterceptedRequest{state_.Intercept()}; }
+
+PluginData& PluginRequest::GetPluginData() { return state_.GetPluginData(); }
+
+InterceptedRequest::InterceptedRequest(std::shared_ptr<RequestState> state) : state_(std::move(state)) {
+    UASSERT(state_);
+}
+
+InterceptedRequest::InterceptedRequest(InterceptedRequest&&) noexcept = default;
+
+InterceptedRequest& InterceptedRequest::operator=(InterceptedRequest&& other) noexcept {
+    if (this == &other) return *this;
+    // Completes the current request
+    InterceptedRequest{std::move(*this)};
+    state_ = std::move(other.state_);
+    return *this;
+}
+
+InterceptedRequest::~InterceptedRequest() {
+    if (!state_) return;
+    try {
+        std::move(*this).SetError(std::make_error_code(std::errc::operation_canceled));
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "Failed to complete the intercepted request: " << ex;
+    }
+}
+
+void InterceptedRequest::SetResponse(Response response) && {
+    UASSERT_MSG(state_, "The request is already completed");
+    RequestState::OnInterceptedCompleted(std::move(state_), std::make_shared<Response>(std::move(response)), {});
+}
+
+void InterceptedRequest::SetError(std::error_code ec) && {
+    UASSERT_MSG(state_, "The request is already completed");
+    UASSERT(ec);
+    RequestState::OnInterceptedCompleted(std::move(state_), {}, ec);
+}
+
+void InterceptedRequest::Perform() && {
+    UASSERT_MSG(state_, "The request is already completed");
+    RequestState::PerformIntercepted(std::move(state_));
+}
+
+bool InterceptedRequest::IsCancelled() const {
+    UASSERT_MSG(state_, "The request is already completed");
+    return state_->IsCancelled();
+}
+
+PluginData& InterceptedRequest::GetPluginData() {
+    UASSERT_MSG(state_, "The request is already completed");
+    return state_->GetPluginData();
+}
+
 Plugin::Plugin(std::string name) : name_(std::move(name)) {}
 
 const std::string& Plugin::GetName() const { return name_; }
 
+void Plugin::HookInterceptRequest(PluginRequest&) {}
+
 namespace impl {
 
 PluginPipeline::PluginPipeline(const std::vector<utils::NotNull<Plugin*>>& plugins) : plugins_(&plugins) {}
@@ -50,6 +121,16 @@ void PluginPipeline::HookCreateSpan(RequestState& request_state, tracing::Span&
     }
 }
 
+bool PluginPipeline::HookInterceptRequest(RequestState& request_state) {
+    PluginRequest req(request_state);
+
+    for (const auto& plugin : *plugins_) {
+        plugin->HookInterceptRequest(req);
+        if (request_state.IsIntercepted()) return true;
+    }
+    return false;
+}
+
 void PluginPipeline::HookOnCompleted(RequestState& request_state, Response& response) {
     PluginRequest req(request_state);
 
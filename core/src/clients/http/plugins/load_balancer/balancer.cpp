@@ -0,0 +1,171 @@
+#include <clients/http/plugins/load_balancer/balancer.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include <userver/http/url.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::load_balancer {
+
+namespace {
+
+// Weight of a new latency in the EWMA is 1/2^kEwmaShift
+constexpr int kEwmaShift = 3;
+
+constexpr std::size_t kNoIndex = std::numeric_limits<std::size_t>::max();
+
+template <typename Predicate>
+std::size_t FindRandom(const std::vector<EndpointPtr>& endpoints, std::size_t skip, Predicate predicate) {
+    const auto size = endpoints.size();
+    const auto start = utils::RandRange(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        const auto index = (start + i) % size;
+        if (index != skip && predicate(*endpoints[index])) return index;
+    }
+    return kNoIndex;
+}
+
+}  // namespace
+
+Endpoint::Endpoint(std::string address) : address_(std::move(address)) {}
+
+void Endpoint::StartRequest() noexcept { in_flight_.fetch_add(1, std::memory_order_relaxed); }
+
+void Endpoint::FinishRequest(
+    std::chrono::microseconds latency,
+    bool ok,
+    const BalancerSettings& settings,
+    Clock::time_point now
+) noexcept {
+    in_flight_.fetch_sub(1, std::memory_order_relaxed);
+    ++requests_;
+
+    const auto sample = std::max<std::int64_t>(latency.count(), 1);
+    auto ewma = latency_ewma_us_.load(std::memory_order_relaxed);
+    std::int64_t new_ewma = 0;
+    do {
+        new_ewma = (ewma == 0) ? sample : ewma + ((sample - ewma) >> kEwmaShift);
+    } while (!latency_ewma_us_.compare_exchange_weak(ewma, new_ewma, std::memory_order_relaxed));
+
+    if (ok) {
+        consecutive_failures_.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    ++failures_;
+    if (consecutive_failures_.fetch_add(1, std::memory_order_relaxed) + 1 >= settings.failures_to_eject) {
+        consecutive_failures_.store(0, std::memory_order_relaxed);
+        ejected_until_.store((now + settings.ejection_time).time_since_epoch().count(), std::memory_order_relaxed);
+        ++ejections_;
+    }
+}
+
+double Endpoint::GetLoad() const noexcept {
+    // An endpoint without requests yet is considered the fastest one, so that
+    // it starts to receive requests at once
+    const auto latency = std::max<std::int64_t>(latency_ewma_us_.load(std::memory_order_relaxed), 1);
+    const auto in_flight = std::max<std::int64_t>(in_flight_.load(std::memory_order_relaxed), 0);
+    return static_cast<double>(latency) * static_cast<double>(in_flight + 1);
+}
+
+bool Endpoint::IsEjected(Clock::time_point now) const noexcept {
+    return ejected_until_.load(std::memory_order_relaxed) > now.time_since_epoch().count();
+}
+
+std::chrono::microseconds Endpoint::GetLatency() const noexcept {
+    return std::chrono::microseconds{latency_ewma_us_.load(std::memory_order_relaxed)};
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Endpoint& endpoint) {
+    writer["in_flight"] = endpoint.GetInFlight();
+    writer["latency_ewma_us"] = endpoint.GetLatency().count();
+    writer["ejected"] = endpoint.IsEjected(Clock::now()) ? 1 : 0;
+    writer["requests"] = endpoint.requests_;
+    writer["failures"] = endpoint.failures_;
+    writer["ejections"] = endpoint.ejections_;
+}
+
+Upstream::Upstream(const BalancerSettings& settings) : settings_(settings) {}
+
+void Upstream::SetEndpoints(const std::vector<std::string>& addresses) {
+    auto endpoints = endpoints_.StartWrite();
+
+    std::unordered_map<std::string_view, EndpointPtr> old_endpoints;
+    for (const auto& endpoint : *endpoints) {
+        old_endpoints.emplace(endpoint->GetAddress(), endpoint);
+    }
+
+    std::vector<EndpointPtr> new_endpoints;
+    new_endpoints.reserve(addresses.size());
+    for (const auto& address : addresses) {
+        const auto it = old_endpoints.find(address);
+        new_endpoints.push_back(it != old_endpoints.end() ? it->second : std::make_shared<Endpoint>(address));
+    }
+
+    *endpoints = std::move(new_endpoints);
+    endpoints.Commit();
+}
+
+EndpointPtr Upstream::Pick(const Endpoint* previous) const {
+    const auto endpoints = endpoints_.Read();
+    if (endpoints->empty()) return {};
+
+    const auto now = Clock::now();
+    const auto is_healthy = [previous, now](const Endpoint& endpoint) {
+        return &endpoint != previous && !endpoint.IsEjected(now);
+    };
+
+    auto first = FindRandom(*endpoints, kNoIndex, is_healthy);
+    if (first == kNoIndex) {
+        // All the other endpoints are ejected, the ejection is ignored rather
+        // than failing the request
+        first = FindRandom(*endpoints, kNoIndex, [previous](const Endpoint& endpoint) {
+            return &endpoint != previous;
+        });
+        if (first == kNoIndex) return (*endpoints)[0];
+        return (*endpoints)[first];
+    }
+
+    const auto second = FindRandom(*endpoints, first, is_healthy);
+    if (second == kNoIndex) return (*endpoints)[first];
+
+    const auto& a = (*endpoints)[first];
+    const auto& b = (*endpoints)[second];
+    return a->GetLoad() <= b->GetLoad() ? a : b;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Upstream& upstream) {
+    const auto endpoints = upstream.endpoints_.Read();
+    for (const auto& endpoint : *endpoints) {
+        writer.ValueWithLabels(*endpoint, utils::statistics::LabelView{"http_endpoint", endpoint->GetAddress()});
+    }
+}
+
+std::string ReplaceHostAndPort(std::string_view url, std::string_view address) {
+    const auto host = USERVER_NAMESPACE::http::ExtractHostnameView(url);
+    UASSERT(host.data() >= url.data() && host.data() + host.size() <= url.data() + url.size());
+
+    const auto begin = static_cast<std::size_t>(host.data() - url.data());
+    auto end = begin + host.size();
+    if (end < url.size() && url[end] == ':') {
+        ++end;
+        while (end < url.size() && url[end] >= '0' && url[end] <= '9') ++end;
+    }
+
+    std::string result;
+    result.reserve(url.size() - (end - begin) + address.size());
+    result.append(url.substr(0, begin));
+    result.append(address);
+    result.append(url.substr(end));
+    return result;
+}
+
+}  // namespace clients::http::plugins::load_balancer
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::load_balancer {
+
+using Clock = std::chrono::steady_clock;
+
+struct BalancerSettings {
+    /// Consecutive failures of an endpoint that eject it from the balancing
+    std::uint32_t failures_to_eject{5};
+    /// For how long an ejected endpoint receives no requests
+    std::chrono::milliseconds ejection_time{10000};
+};
+
+/// @brief Load of a single upstream endpoint.
+///
+/// The load is the number of the in-flight requests weighted by the EWMA of
+/// the latencies of the endpoint.
+class Endpoint final {
+public:
+    explicit Endpoint(std::string address);
+
+    /// `host[:port]` of the endpoint
+    const std::string& GetAddress() const noexcept { return address_; }
+
+    void StartRequest() noexcept;
+    void FinishRequest(
+        std::chrono::microseconds latency,
+        bool ok,
+        const BalancerSettings& settings,
+        Clock::time_point now
+    ) noexcept;
+
+    /// Cost of sending one more request to the endpoint, the lower the better
+    double GetLoad() const noexcept;
+
+    bool IsEjected(Clock::time_point now) const noexcept;
+
+    std::int64_t GetInFlight() const noexcept { return in_flight_.load(std::memory_order_relaxed); }
+    std::chrono::microseconds GetLatency() const noexcept;
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const Endpoint& endpoint);
+
+private:
+    const std::string address_;
+
+    std::atomic<std::int64_t> in_flight_{0};
+    // 0 until the first request is finished
+    std::atomic<std::int64_t> latency_ewma_us_{0};
+    std::atomic<std::uint32_t> consecutive_failures_{0};
+    std::atomic<Clock::rep> ejected_until_{0};
+
+    utils::statistics::RateCounter requests_;
+    utils::statistics::RateCounter failures_;
+    utils::statistics::RateCounter ejections_;
+};
+
+using EndpointPtr = std::shared_ptr<Endpoint>;
+
+/// @brief Set of the endpoints of an upstream that picks an endpoint per
+/// request with the power of two choices.
+class Upstream final {
+public:
+    explicit Upstream(const BalancerSettings& settings);
+
+    /// Replaces the endpoints, keeps the load of the ones that remain
+    void SetEndpoints(const std::vector<std::string>& addresses);
+
+    /// @brief Picks the less loaded one of two random endpoints that are not
+    /// ejected and differ from `previous`.
+    ///
+    /// Falls back to the ejected endpoints and then to `previous` if there are
+    /// no others. Returns nullptr if there are no endpoints at all.
+    EndpointPtr Pick(const Endpoint* previous) const;
+
+    const BalancerSettings& GetSettings() const noexcept { return settings_; }
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const Upstream& upstream);
+
+private:
+    const BalancerSettings settings_;
+    rcu::Variable<std::vector<EndpointPtr>, rcu::SyncRcuTraits> endpoints_;
+};
+
+/// Replaces `host[:port]` of the URL with the address
+std::string ReplaceHostAndPort(std::string_view url, std::string_view address);
+
+}  // namespace clients::http::plugins::load_balancer
+
+USERVER_NAMESPACE_END
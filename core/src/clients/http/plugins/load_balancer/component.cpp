@@ -0,0 +1,154 @@
+#include <userver/clients/http/plugins/load_balancer/component.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <clients/http/plugins/load_balancer/plugin.hpp>
+
+#include <userver/clients/dns/component.hpp>
+#include <userver/clients/dns/exception.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/formats/common/items.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::load_balancer {
+
+namespace {
+
+constexpr std::chrono::seconds kResolveTimeout{5};
+
+std::string ToEndpointAddress(const engine::io::Sockaddr& addr) {
+    if (addr.Domain() == engine::io::AddrDomain::kInet6) {
+        return fmt::format("[{}]", addr.PrimaryAddressString());
+    }
+    return addr.PrimaryAddressString();
+}
+
+}  // namespace
+
+/// Keeps the endpoints of the upstreams with `resolve: true` up to date
+class Component::Resolving final {
+public:
+    Resolving(clients::dns::Resolver& resolver, std::vector<std::pair<std::string, Upstream*>> upstreams)
+        : resolver_(resolver), upstreams_(std::move(upstreams)) {}
+
+    void Start(std::chrono::milliseconds interval) {
+        Resolve();
+        task_.Start("http-client-load-balancer-resolve", interval, [this] { Resolve(); });
+    }
+
+private:
+    void Resolve() {
+        for (const auto& [name, upstream] : upstreams_) {
+            try {
+                const auto addrs = resolver_.Resolve(name, engine::Deadline::FromDuration(kResolveTimeout));
+
+                std::vector<std::string> addresses;
+                addresses.reserve(addrs.size());
+                for (const auto& addr : addrs) addresses.push_back(ToEndpointAddress(addr));
+                upstream->SetEndpoints(addresses);
+            } catch (const clients::dns::ResolverException& ex) {
+                // The previous endpoints are kept
+                LOG_WARNING() << "Failed to resolve the endpoints of upstream '" << name << "': " << ex;
+            }
+        }
+    }
+
+    clients::dns::Resolver& resolver_;
+    const std::vector<std::pair<std::string, Upstream*>> upstreams_;
+    utils::PeriodicTask task_;
+};
+
+Component::Component(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : ComponentBase(config, context), plugin_(std::make_unique<load_balancer::Plugin>()) {
+    BalancerSettings settings;
+    settings.failures_to_eject = config["failures-to-eject"].As<std::uint32_t>(settings.failures_to_eject);
+    settings.ejection_time = config["ejection-time"].As<std::chrono::milliseconds>(settings.ejection_time);
+
+    std::vector<std::pair<std::string, Upstream*>> resolved_upstreams;
+    for (const auto& [name, upstream_config] : Items(config["upstreams"])) {
+        if (upstream_config["resolve"].As<bool>(false)) {
+            auto& upstream = plugin_->AddUpstream(name, Routing::kConnectTo, settings);
+            resolved_upstreams.emplace_back(name, &upstream);
+        } else {
+            auto& upstream = plugin_->AddUpstream(name, Routing::kRewriteUrl, settings);
+            upstream.SetEndpoints(upstream_config["endpoints"].As<std::vector<std::string>>({}));
+        }
+    }
+
+    if (!resolved_upstreams.empty()) {
+        auto& resolver = context.FindComponent<clients::dns::Component>().GetResolver();
+        resolving_ = std::make_unique<Resolving>(resolver, std::move(resolved_upstreams));
+        resolving_->Start(config["resolve-interval"].As<std::chrono::milliseconds>(std::chrono::seconds{10}));
+    }
+
+    auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
+    statistics_holder_ = storage.RegisterWriter("httpclient.load-balancer", [this](utils::statistics::Writer& writer) {
+        writer = *plugin_;
+    });
+}
+
+Component::~Component() {
+    statistics_holder_.Unregister();
+    resolving_.reset();
+}
+
+http::Plugin& Component::GetPlugin() { return *plugin_; }
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: HTTP client plugin that balances the requests between the endpoints of the upstreams
+additionalProperties: false
+properties:
+    upstreams:
+        type: object
+        description: upstreams by the hosts of the URLs
+        defaultDescription: '{}'
+        properties: {}
+        additionalProperties:
+            type: object
+            description: upstream options
+            additionalProperties: false
+            properties:
+                endpoints:
+                    type: array
+                    description: list of `host[:port]` of the upstream endpoints
+                    defaultDescription: '[]'
+                    items:
+                        type: string
+                        description: endpoint `host[:port]`
+                resolve:
+                    type: boolean
+                    description: use the addresses of the upstream name as the endpoints
+                    defaultDescription: false
+    failures-to-eject:
+        type: integer
+        description: consecutive failures of an endpoint that eject it
+        defaultDescription: 5
+        minimum: 1
+    ejection-time:
+        type: string
+        description: for how long an ejected endpoint receives no requests
+        defaultDescription: 10s
+    resolve-interval:
+        type: string
+        description: how often the upstreams with `resolve` are re-resolved
+        defaultDescription: 10s
+)");
+}
+
+}  // namespace clients::http::plugins::load_balancer
+
+USERVER_NAMESPACE_END
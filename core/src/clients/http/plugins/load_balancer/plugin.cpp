@@ -0,0 +1,160 @@
+#include <clients/http/plugins/load_balancer/plugin.hpp>
+
+#include <optional>
+
+#include <fmt/format.h>
+
+#include <userver/clients/http/connect_to.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/http/url.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::load_balancer {
+
+struct Plugin::Target final {
+    Target(Routing routing, const BalancerSettings& settings) : upstream(settings), routing(routing) {}
+
+    Upstream upstream;
+    const Routing routing;
+};
+
+namespace {
+
+constexpr Status kLeastFailedStatus{500};
+
+// Balancing state of a request, kept between its attempts
+struct RequestData {
+    RequestData() = default;
+    RequestData(const RequestData&) = delete;
+    RequestData& operator=(const RequestData&) = delete;
+    // The request may be destroyed with an attempt that ended without any
+    // hook, e.g. on an exception in the request state
+    ~RequestData();
+
+    const Plugin::Target* target{nullptr};
+    // URL of the request before balancing
+    std::string logical_url;
+    // URL of the last attempt
+    std::string url;
+    EndpointPtr endpoint;
+    std::optional<ConnectTo> connect_to;
+    Clock::time_point start;
+    bool in_flight{false};
+};
+
+const utils::AnyStorageDataTag<PluginDataTag, RequestData> kRequestDataTag;
+
+void FinishAttempt(RequestData& data, bool ok) {
+    if (!data.in_flight) return;
+    data.in_flight = false;
+
+    const auto now = Clock::now();
+    data.endpoint->FinishRequest(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - data.start),
+        ok,
+        data.target->upstream.GetSettings(),
+        now
+    );
+}
+
+void FinishAttempt(PluginRequest& request, bool ok) {
+    auto* data = request.GetPluginData().GetOptional(kRequestDataTag);
+    if (data) FinishAttempt(*data, ok);
+}
+
+RequestData::~RequestData() { FinishAttempt(*this, false); }
+
+}  // namespace
+
+Plugin::Plugin() : http::Plugin("load-balancer") {}
+
+Plugin::~Plugin() = default;
+
+Upstream& Plugin::AddUpstream(std::string host, Routing routing, const BalancerSettings& settings) {
+    auto& target = targets_[std::move(host)];
+    UINVARIANT(!target, "Upstream is added twice");
+    target = std::make_unique<Target>(routing, settings);
+    return target->upstream;
+}
+
+void Plugin::HookPerformRequest(PluginRequest& request) {
+    auto* data = request.GetPluginData().GetOptional(kRequestDataTag);
+    const auto& url = request.GetOriginalUrl();
+
+    // The previous attempt may end without any hook, e.g. on DNS resolution
+    // error or on an exception
+    if (data) FinishAttempt(*data, false);
+
+    const Target* target = nullptr;
+    const Endpoint* previous = nullptr;
+    if (data && data->target && url == data->url) {
+        // A retry or a new perform of a balanced request
+        target = data->target;
+        previous = data->endpoint.get();
+    } else {
+        const auto it = targets_.find(std::string{USERVER_NAMESPACE::http::ExtractHostnameView(url)});
+        if (it == targets_.end()) {
+            if (data) data->target = nullptr;
+            return;
+        }
+        target = it->second.get();
+        if (!data) data = &request.GetPluginData().Emplace(kRequestDataTag);
+        data->logical_url = url;
+    }
+
+    auto endpoint = target->upstream.Pick(previous);
+    if (!endpoint) {
+        LOG_LIMITED_WARNING() << "No endpoints to balance the request to " << data->logical_url;
+        data->target = nullptr;
+        return;
+    }
+
+    switch (target->routing) {
+        case Routing::kRewriteUrl:
+            data->url = ReplaceHostAndPort(data->logical_url, endpoint->GetAddress());
+            request.SetUrl(data->url);
+            break;
+        case Routing::kConnectTo: {
+            // Any host and port of the URL, the port of the URL is kept
+            ConnectTo connect_to{fmt::format("::{}:", endpoint->GetAddress())};
+            request.SetConnectTo(connect_to);
+            data->connect_to = std::move(connect_to);
+            data->url = url;
+            break;
+        }
+    }
+
+    data->target = target;
+    data->endpoint = std::move(endpoint);
+    data->start = Clock::now();
+    data->in_flight = true;
+    data->endpoint->StartRequest();
+}
+
+void Plugin::HookCreateSpan(PluginRequest&, tracing::Span&) {}
+
+void Plugin::HookOnCompleted(PluginRequest& request, Response& response) {
+    FinishAttempt(request, response.status_code() < kLeastFailedStatus);
+}
+
+void Plugin::HookOnError(PluginRequest& request, std::error_code) { FinishAttempt(request, false); }
+
+bool Plugin::HookOnRetry(PluginRequest& request) {
+    // Only failed attempts are retried
+    FinishAttempt(request, false);
+    return true;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Plugin& plugin) {
+    for (const auto& [host, target] : plugin.targets_) {
+        writer.ValueWithLabels(target->upstream, utils::statistics::LabelView{"http_upstream", host});
+    }
+}
+
+}  // namespace clients::http::plugins::load_balancer
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/clients/http/plugin.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+#include <clients/http/plugins/load_balancer/balancer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::load_balancer {
+
+/// How the requests are directed to the picked endpoint
+enum class Routing {
+    /// `host[:port]` of the request URL is replaced with the endpoint address
+    kRewriteUrl,
+    /// The URL is kept, the connection is made to the endpoint address, see
+    /// CURLOPT_CONNECT_TO
+    kConnectTo,
+};
+
+/// @brief Balances the requests to the hosts of the upstreams between their
+/// endpoints.
+///
+/// The endpoint is picked on each attempt of a request, a retry goes to an
+/// endpoint that differs from the one of the previous attempt.
+class Plugin final : public http::Plugin {
+public:
+    struct Target;
+
+    Plugin();
+    ~Plugin() override;
+
+    /// Must be called before the plugin is used by the clients
+    Upstream& AddUpstream(std::string host, Routing routing, const BalancerSettings& settings);
+
+    void HookPerformRequest(PluginRequest& request) override;
+
+    void HookCreateSpan(PluginRequest& request, tracing::Span& span) override;
+
+    void HookOnCompleted(PluginRequest& request, Response& response) override;
+
+    void HookOnError(PluginRequest& request, std::error_code ec) override;
+
+    bool HookOnRetry(PluginRequest& request) override;
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const Plugin& plugin);
+
+private:
+    std::unordered_map<std::string, std::unique_ptr<Target>> targets_;
+};
+
+}  // namespace clients::http::plugins::load_balancer
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,155 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/http_server_mock.hpp>
+
+#include <clients/http/plugins/load_balancer/plugin.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::load_balancer {
+
+namespace {
+
+constexpr std::string_view kScheme = "http://";
+
+std::string GetAddress(const utest::HttpServerMock& server) { return server.GetBaseUrl().substr(kScheme.size()); }
+
+utest::HttpServerMock MakeServer(std::atomic<int>& requests, int status) {
+    return utest::HttpServerMock(
+        [&requests, status](const utest::HttpServerMock::HttpRequest&) -> utest::HttpServerMock::HttpResponse {
+            ++requests;
+            utest::HttpServerMock::HttpResponse response{};
+            response.response_status = status;
+            return response;
+        }
+    );
+}
+
+}  // namespace
+
+TEST(LoadBalancer, ReplaceHostAndPort) {
+    EXPECT_EQ(ReplaceHostAndPort("http://upstream/path?a=b", "host:80"), "http://host:80/path?a=b");
+    EXPECT_EQ(ReplaceHostAndPort("http://upstream:8080/path", "host:80"), "http://host:80/path");
+    EXPECT_EQ(ReplaceHostAndPort("https://user@upstream:8080", "[::1]:80"), "https://user@[::1]:80");
+    EXPECT_EQ(ReplaceHostAndPort("http://[::2]:8080/", "host"), "http://host/");
+}
+
+UTEST(LoadBalancer, PicksLessLoaded) {
+    Upstream upstream{BalancerSettings{}};
+    upstream.SetEndpoints({"a", "b"});
+
+    const auto busy = upstream.Pick(nullptr);
+    ASSERT_TRUE(busy);
+    busy->StartRequest();
+    busy->StartRequest();
+
+    for (int i = 0; i < 10; ++i) {
+        const auto endpoint = upstream.Pick(nullptr);
+        ASSERT_TRUE(endpoint);
+        EXPECT_NE(endpoint, busy);
+    }
+}
+
+UTEST(LoadBalancer, PicksOtherThanPrevious) {
+    Upstream upstream{BalancerSettings{}};
+    upstream.SetEndpoints({"a", "b", "c"});
+
+    for (int i = 0; i < 10; ++i) {
+        const auto previous = upstream.Pick(nullptr);
+        EXPECT_NE(upstream.Pick(previous.get()), previous);
+    }
+
+    upstream.SetEndpoints({"a"});
+    const auto single = upstream.Pick(nullptr);
+    EXPECT_EQ(upstream.Pick(single.get()), single);
+
+    upstream.SetEndpoints({});
+    EXPECT_FALSE(upstream.Pick(nullptr));
+}
+
+UTEST(LoadBalancer, Ejection) {
+    BalancerSettings settings;
+    settings.failures_to_eject = 2;
+    Upstream upstream{settings};
+    upstream.SetEndpoints({"a", "b"});
+
+    const auto failing = upstream.Pick(nullptr);
+    const auto now = Clock::now();
+    for (int i = 0; i < 2; ++i) {
+        failing->StartRequest();
+        failing->FinishRequest(std::chrono::milliseconds{1}, false, settings, now);
+    }
+    EXPECT_TRUE(failing->IsEjected(now));
+    EXPECT_FALSE(failing->IsEjected(now + settings.ejection_time));
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_NE(upstream.Pick(nullptr), failing);
+    }
+    // All the other endpoints are ejected
+    EXPECT_EQ(upstream.Pick(upstream.Pick(nullptr).get()), failing);
+}
+
+UTEST(LoadBalancer, SetEndpointsKeepsLoad) {
+    Upstream upstream{BalancerSettings{}};
+    upstream.SetEndpoints({"a"});
+    upstream.Pick(nullptr)->StartRequest();
+
+    upstream.SetEndpoints({"b", "a"});
+    for (int i = 0; i < 10; ++i) {
+        const auto endpoint = upstream.Pick(nullptr);
+        EXPECT_EQ(endpoint->GetInFlight(), endpoint->GetAddress() == "a" ? 1 : 0);
+    }
+}
+
+UTEST(LoadBalancer, RetryGoesToOtherEndpoint) {
+    std::atomic<int> ok_requests{0};
+    std::atomic<int> failed_requests{0};
+    const auto ok_server = MakeServer(ok_requests, 200);
+    const auto failing_server = MakeServer(failed_requests, 500);
+
+    Plugin plugin;
+    plugin.AddUpstream("upstream", Routing::kRewriteUrl, BalancerSettings{})
+        .SetEndpoints({GetAddress(ok_server), GetAddress(failing_server)});
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    constexpr int kRequests = 20;
+    for (int i = 0; i < kRequests; ++i) {
+        auto response = http_client->CreateRequest()
+                            .get()
+                            .url("http://upstream/test")
+                            .timeout(utest::kMaxTestWaitTime)
+                            .retry(2)
+                            .perform();
+        EXPECT_TRUE(response->IsOk());
+    }
+    EXPECT_EQ(ok_requests, kRequests);
+    EXPECT_GT(failed_requests, 0);
+    EXPECT_LT(failed_requests, kRequests);
+}
+
+UTEST(LoadBalancer, NotBalancedHost) {
+    std::atomic<int> requests{0};
+    const auto server = MakeServer(requests, 200);
+
+    Plugin plugin;
+    plugin.AddUpstream("upstream", Routing::kRewriteUrl, BalancerSettings{}).SetEndpoints({"unused:80"});
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    auto response = http_client->CreateRequest()
+                        .get()
+                        .url(server.GetBaseUrl() + "/test")
+                        .timeout(utest::kMaxTestWaitTime)
+                        .perform();
+    EXPECT_TRUE(response->IsOk());
+    EXPECT_EQ(requests, 1);
+}
+
+}  // namespace clients::http::plugins::load_balancer
+
+USERVER_NAMESPACE_END
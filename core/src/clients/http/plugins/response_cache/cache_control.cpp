@@ -0,0 +1,95 @@
+#include <clients/http/plugins/response_cache/cache_control.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+namespace {
+
+// RFC 9111 section 1.2.2
+constexpr std::int64_t kMaxDeltaSeconds = std::int64_t{1} << 31;
+
+std::string_view Trim(std::string_view value) {
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.remove_suffix(1);
+    return value;
+}
+
+std::string_view Unquote(std::string_view value) {
+    if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+        return value.substr(1, value.size() - 2);
+    }
+    return value;
+}
+
+// Quoted values may contain commas, e.g. no-cache="Set-Cookie, Set-Cookie2"
+std::size_t FindDirectiveEnd(std::string_view value, std::size_t pos) {
+    bool in_quotes = false;
+    for (; pos < value.size(); ++pos) {
+        if (value[pos] == '"') {
+            in_quotes = !in_quotes;
+        } else if (value[pos] == ',' && !in_quotes) {
+            break;
+        }
+    }
+    return pos;
+}
+
+}  // namespace
+
+std::chrono::seconds ParseDeltaSeconds(std::string_view value) {
+    if (value.empty()) return std::chrono::seconds{0};
+
+    std::int64_t result = 0;
+    for (const char c : value) {
+        if (c < '0' || c > '9') return std::chrono::seconds{0};
+        result = std::min(result * 10 + (c - '0'), kMaxDeltaSeconds);
+    }
+    return std::chrono::seconds{result};
+}
+
+CacheControl ParseCacheControl(std::string_view value) {
+    CacheControl result;
+
+    std::size_t pos = 0;
+    while (pos < value.size()) {
+        const auto end = FindDirectiveEnd(value, pos);
+        const auto directive = Trim(value.substr(pos, end - pos));
+        pos = end + 1;
+
+        const auto eq = directive.find('=');
+        const auto name = Trim(directive.substr(0, eq));
+        const auto argument =
+            eq == std::string_view::npos ? std::string_view{} : Unquote(Trim(directive.substr(eq + 1)));
+
+        const utils::StrIcaseEqual equal;
+        if (equal(name, "no-store")) {
+            result.no_store = true;
+        } else if (equal(name, "no-cache")) {
+            result.no_cache = true;
+        } else if (equal(name, "private")) {
+            result.is_private = true;
+        } else if (equal(name, "public")) {
+            result.is_public = true;
+        } else if (equal(name, "must-revalidate") || equal(name, "proxy-revalidate")) {
+            result.must_revalidate = true;
+        } else if (equal(name, "max-age")) {
+            result.max_age = ParseDeltaSeconds(argument);
+        } else if (equal(name, "s-maxage")) {
+            result.s_maxage = ParseDeltaSeconds(argument);
+        } else if (equal(name, "stale-while-revalidate")) {
+            result.stale_while_revalidate = ParseDeltaSeconds(argument);
+        }
+    }
+
+    return result;
+}
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
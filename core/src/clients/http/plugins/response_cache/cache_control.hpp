@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+/// Directives of the `Cache-Control` header that the cache honors, see
+/// RFC 9111 section 5.2
+struct CacheControl {
+    bool no_store{false};
+    bool no_cache{false};
+    bool is_private{false};
+    bool is_public{false};
+    /// must-revalidate or proxy-revalidate
+    bool must_revalidate{false};
+    std::optional<std::chrono::seconds> max_age;
+    std::optional<std::chrono::seconds> s_maxage;
+    std::optional<std::chrono::seconds> stale_while_revalidate;
+};
+
+/// @brief Parses delta-seconds of the `Age` header and of the directives.
+///
+/// An invalid value is parsed as 0, a too large one is capped at 2^31.
+std::chrono::seconds ParseDeltaSeconds(std::string_view value);
+
+/// @brief Parses the value of the `Cache-Control` header.
+///
+/// Unknown directives are ignored, an invalid number of seconds is parsed as
+/// 0, so that the response is considered stale.
+CacheControl ParseCacheControl(std::string_view value);
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <userver/clients/http/plugins/response_cache/component.hpp>
+
+#include <clients/http/plugins/response_cache/plugin.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+namespace {
+
+Settings ParseSettings(const components::ComponentConfig& config) {
+    Settings settings;
+    settings.ways = config["ways"].As<std::size_t>(settings.ways);
+    settings.way_size = config["way-size"].As<std::size_t>(settings.way_size);
+    settings.max_entry_size = config["max-entry-size"].As<std::size_t>(settings.max_entry_size);
+    return settings;
+}
+
+}  // namespace
+
+Component::Component(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : ComponentBase(config, context), plugin_(std::make_unique<response_cache::Plugin>(ParseSettings(config))) {
+    auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
+    statistics_holder_ = storage.RegisterWriter("httpclient.response-cache", [this](utils::statistics::Writer& writer) {
+        writer = *plugin_;
+    });
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
+
+http::Plugin& Component::GetPlugin() { return *plugin_; }
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: HTTP client plugin that caches the responses to GET requests according to RFC 9111
+additionalProperties: false
+properties:
+    ways:
+        type: integer
+        description: number of the ways of the cache
+        defaultDescription: 16
+        minimum: 1
+    way-size:
+        type: integer
+        description: maximum number of the responses in a way
+        defaultDescription: 64
+        minimum: 1
+    max-entry-size:
+        type: integer
+        description: responses with larger bodies in bytes are not cached
+        defaultDescription: 16777216
+        minimum: 0
+)");
+}
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,450 @@
+#include <clients/http/plugins/response_cache/plugin.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <utility>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text.hpp>
+
+#include <clients/http/plugins/response_cache/cache_control.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+namespace headers = USERVER_NAMESPACE::http::headers;
+
+using Clock = std::chrono::steady_clock;
+
+// Request headers named by the Vary response header and their values
+using VaryValues = std::vector<std::pair<std::string, std::optional<std::string>>>;
+
+struct Entry final {
+    Status status{Status::kInvalid};
+    Headers headers;
+    // Shared with the revalidated entries
+    std::shared_ptr<const std::string> body;
+    VaryValues vary;
+
+    Clock::time_point response_time;
+    // The time the origin server generated the response, Age is accounted
+    Clock::time_point generated_at;
+    std::chrono::seconds lifetime{0};
+    std::chrono::seconds stale_while_revalidate{0};
+
+    // Whether a request revalidates the entry within stale-while-revalidate
+    mutable std::atomic<bool> revalidating{false};
+};
+
+namespace {
+
+constexpr std::string_view kHttpDateFormat = "%a, %d %b %Y %H:%M:%S GMT";
+
+/// Resets Entry::revalidating when the revalidation is finished or abandoned
+class RevalidationGuard final {
+public:
+    RevalidationGuard() = default;
+    explicit RevalidationGuard(EntryPtr entry) : entry_(std::move(entry)) {}
+
+    RevalidationGuard(RevalidationGuard&&) noexcept = default;
+
+    RevalidationGuard& operator=(RevalidationGuard&& other) noexcept {
+        Release();
+        entry_ = std::move(other.entry_);
+        return *this;
+    }
+
+    ~RevalidationGuard() { Release(); }
+
+private:
+    void Release() noexcept {
+        if (entry_) std::exchange(entry_, nullptr)->revalidating = false;
+    }
+
+    EntryPtr entry_;
+};
+
+struct RequestData final {
+    // The response is cached under the key, empty if it is not cached
+    std::string key;
+    // The response invalidates the key
+    bool invalidates{false};
+    bool has_authorization{false};
+    // The stale entry that the request revalidates and a copy of its body.
+    // The copy is made by the task of the request, so that a 304 response is
+    // replaced on the event loop thread without copying the body
+    EntryPtr revalidated;
+    std::string revalidated_body;
+    RevalidationGuard revalidation_guard;
+    // If-None-Match and If-Modified-Since are set by the plugin
+    bool has_conditional_headers{false};
+};
+
+const utils::AnyStorageDataTag<PluginDataTag, RequestData> kRequestDataTag;
+
+// Missing and cleared with an empty value headers are the same
+bool HasHeader(const PluginRequest& request, std::string_view name) {
+    const auto value = request.GetHeader(name);
+    return value && !value->empty();
+}
+
+std::optional<std::string_view> FindHeader(const Headers& headers, std::string_view name) {
+    const auto it = headers.find(name);
+    if (it == headers.end()) return std::nullopt;
+    return it->second;
+}
+
+std::optional<std::chrono::system_clock::time_point> ParseHttpDate(const Headers& headers, std::string_view name) {
+    const auto it = headers.find(name);
+    if (it == headers.end()) return std::nullopt;
+    return utils::datetime::OptionalStringtime(it->second, "UTC", std::string{kHttpDateFormat});
+}
+
+bool IsUnsafe(HttpMethod method) {
+    return method == HttpMethod::kPost || method == HttpMethod::kPut || method == HttpMethod::kDelete ||
+           method == HttpMethod::kPatch;
+}
+
+// Statuses that are cacheable by default, RFC 9110 section 15.1
+bool IsCacheableStatus(Status status) {
+    switch (status) {
+        case Status::kOk:
+        case Status::kNonAuthoritativeInformation:
+        case Status::kNoContent:
+        case Status::kMultipleChoices:
+        case Status::kMovedPermanently:
+        case Status::kPermanentRedirect:
+        case Status::kNotFound:
+        case Status::kMethodNotAllowed:
+        case Status::kGone:
+        case Status::kUriTooLong:
+        case Status::kNotImplemented:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::optional<std::vector<std::string>> ParseVary(const Headers& headers) {
+    std::vector<std::string> names;
+    const auto vary = FindHeader(headers, headers::kVary);
+    if (!vary) return names;
+
+    for (auto& name : utils::text::Split(*vary, ",")) {
+        name = utils::text::Trim(std::move(name));
+        if (name == "*") return std::nullopt;
+        if (!name.empty()) names.push_back(std::move(name));
+    }
+    return names;
+}
+
+bool MatchesVary(const Entry& entry, const PluginRequest& request) {
+    for (const auto& [name, value] : entry.vary) {
+        if (request.GetHeader(name) != value) return false;
+    }
+    return true;
+}
+
+bool HasValidators(const Headers& headers) {
+    return headers.contains(headers::kETag) || headers.contains(headers::kLastModified);
+}
+
+// Fills the freshness of the entry from its headers, RFC 9111 section 4.2
+void SetFreshness(Entry& entry, const CacheControl& cache_control, Clock::time_point now) {
+    entry.response_time = now;
+    const auto age = FindHeader(entry.headers, headers::kAge);
+    entry.generated_at = now - (age ? ParseDeltaSeconds(*age) : std::chrono::seconds{0});
+
+    if (cache_control.no_cache) {
+        entry.lifetime = std::chrono::seconds{0};
+    } else if (cache_control.s_maxage) {
+        entry.lifetime = *cache_control.s_maxage;
+    } else if (cache_control.max_age) {
+        entry.lifetime = *cache_control.max_age;
+    } else {
+        const auto expires = ParseHttpDate(entry.headers, headers::kExpires);
+        const auto date = ParseHttpDate(entry.headers, headers::kDate);
+        entry.lifetime = (expires && date && *expires > *date)
+                             ? std::chrono::duration_cast<std::chrono::seconds>(*expires - *date)
+                             : std::chrono::seconds{0};
+    }
+
+    entry.stale_while_revalidate = (cache_control.no_cache || cache_control.must_revalidate)
+                                       ? std::chrono::seconds{0}
+                                       : cache_control.stale_while_revalidate.value_or(std::chrono::seconds{0});
+}
+
+CacheControl GetCacheControl(const Headers& headers) {
+    const auto value = FindHeader(headers, headers::kCacheControl);
+    return value ? ParseCacheControl(*value) : CacheControl{};
+}
+
+// RFC 9111 section 3
+EntryPtr
+MakeEntry(const PluginRequest& request, const Response& response, const RequestData& data, std::size_t max_size) {
+    const auto status = response.status_code();
+    const auto& headers = response.headers();
+    if (!IsCacheableStatus(status) || response.body_view().size() > max_size) return {};
+    // Cookies are personal, the responses that set them are not shared
+    if (headers.contains(headers::kSetCookie)) return {};
+
+    const auto cache_control = GetCacheControl(headers);
+    if (cache_control.no_store || cache_control.is_private) return {};
+    if (data.has_authorization && !cache_control.is_public && !cache_control.must_revalidate &&
+        !cache_control.s_maxage) {
+        return {};
+    }
+
+    const auto vary = ParseVary(headers);
+    if (!vary) return {};
+
+    auto entry = std::make_shared<Entry>();
+    entry->status = status;
+    entry->headers = headers;
+    entry->body = std::make_shared<const std::string>(response.body_view());
+    for (const auto& name : *vary) {
+        const auto value = request.GetHeader(name);
+        entry->vary.emplace_back(name, value ? std::optional<std::string>{*value} : std::nullopt);
+    }
+    SetFreshness(*entry, cache_control, utils::datetime::SteadyNow());
+
+    // The entry could neither be served nor be revalidated
+    if (entry->lifetime.count() == 0 && !HasValidators(entry->headers)) return {};
+    return entry;
+}
+
+// Updates the stored headers with the ones of the 304 response, RFC 9111
+// section 3.2
+Headers MakeRevalidatedHeaders(const Headers& stored, const Headers& not_modified_headers) {
+    auto headers = stored;
+    headers.erase(headers::kAge);
+    for (const auto& [name, value] : not_modified_headers) {
+        if (utils::StrIcaseEqual{}(name, headers::kContentLength)) continue;
+        headers.insert_or_assign(name, value);
+    }
+    return headers;
+}
+
+EntryPtr MakeRevalidatedEntry(const Entry& stale, const Headers& not_modified_headers) {
+    auto entry = std::make_shared<Entry>();
+    entry->status = stale.status;
+    entry->headers = MakeRevalidatedHeaders(stale.headers, not_modified_headers);
+    entry->body = stale.body;
+    entry->vary = stale.vary;
+    SetFreshness(*entry, GetCacheControl(entry->headers), utils::datetime::SteadyNow());
+    return entry;
+}
+
+// Keeps only the headers set by the plugin, so that the following performs of
+// the request start anew
+RequestData& ResetRequestData(PluginRequest& request) {
+    auto& storage = request.GetPluginData();
+    auto* data = storage.GetOptional(kRequestDataTag);
+    if (!data) return storage.Emplace(kRequestDataTag);
+
+    const bool has_conditional_headers = data->has_conditional_headers;
+    *data = RequestData{};
+    data->has_conditional_headers = has_conditional_headers;
+    return *data;
+}
+
+}  // namespace
+
+Plugin::Plugin(Settings settings)
+    : http::Plugin("response-cache"), settings_(std::move(settings)), entries_(settings_.ways, settings_.way_size) {}
+
+Plugin::~Plugin() = default;
+
+void Plugin::HookPerformRequest(PluginRequest&) {}
+
+void Plugin::HookCreateSpan(PluginRequest&, tracing::Span&) {}
+
+void Plugin::HookInterceptRequest(PluginRequest& request) {
+    ApplyUpdates();
+
+    auto& data = ResetRequestData(request);
+    if (std::exchange(data.has_conditional_headers, false)) {
+        request.SetHeader(headers::kIfNoneMatch, {});
+        request.SetHeader(headers::kIfModifiedSince, {});
+    }
+
+    const auto method = request.GetMethod();
+    if (!method) return;
+    if (IsUnsafe(*method)) {
+        data.key = request.GetOriginalUrl();
+        data.invalidates = true;
+        return;
+    }
+    // The body is not a part of the key
+    if (*method != HttpMethod::kGet || request.HasBody()) return;
+
+    const auto request_cache_control = ParseCacheControl(request.GetHeader(headers::kCacheControl).value_or(""));
+    // The caller asked for the response of the server
+    if (request_cache_control.no_store || HasHeader(request, headers::kRange) ||
+        HasHeader(request, headers::kIfNoneMatch) || HasHeader(request, headers::kIfModifiedSince)) {
+        return;
+    }
+    const bool no_cache =
+        request_cache_control.no_cache || request.GetHeader(headers::kPragma).value_or("") == "no-cache";
+
+    auto key = request.GetOriginalUrl();
+    const auto entry = entries_.GetOptionalNoUpdate(key).value_or(nullptr);
+    data.has_authorization = HasHeader(request, headers::kAuthorization);
+    if (!entry || !MatchesVary(*entry, request)) {
+        ++misses_;
+        data.key = std::move(key);
+        return;
+    }
+
+    const auto age = utils::datetime::SteadyNow() - entry->generated_at;
+    const bool acceptable_age = !request_cache_control.max_age || age <= *request_cache_control.max_age;
+    if (!no_cache && acceptable_age && age < entry->lifetime) {
+        ++hits_;
+        Serve(request, *entry);
+        return;
+    }
+
+    if (!no_cache && acceptable_age && age < entry->lifetime + entry->stale_while_revalidate) {
+        if (entry->revalidating.exchange(true)) {
+            ++stale_hits_;
+            Serve(request, *entry);
+            return;
+        }
+        data.revalidation_guard = RevalidationGuard{entry};
+    }
+
+    data.key = std::move(key);
+    if (!HasValidators(entry->headers)) {
+        ++misses_;
+        return;
+    }
+
+    if (const auto etag = FindHeader(entry->headers, headers::kETag)) {
+        request.SetHeader(headers::kIfNoneMatch, *etag);
+    }
+    if (const auto last_modified = FindHeader(entry->headers, headers::kLastModified)) {
+        request.SetHeader(headers::kIfModifiedSince, *last_modified);
+    }
+    data.has_conditional_headers = true;
+    data.revalidated = entry;
+    data.revalidated_body = *entry->body;
+}
+
+void Plugin::HookOnCompleted(PluginRequest& request, Response& response) {
+    auto* data = request.GetPluginData().GetOptional(kRequestDataTag);
+    if (!data || data->key.empty()) return;
+
+    // The response of another request, e.g. coalesced by a single-flight
+    // plugin, is already accounted and stored by that request
+    if (request.IsIntercepted()) {
+        if (data->revalidated && response.status_code() == Status::kNotModified) {
+            response.SetStatusCode(data->revalidated->status);
+            response.headers() = MakeRevalidatedHeaders(data->revalidated->headers, response.headers());
+            response.sink_string() = std::move(data->revalidated_body);
+        }
+        ResetRequestData(request);
+        return;
+    }
+
+    if (data->invalidates) {
+        if (!response.IsError()) QueueUpdate(std::move(data->key), {});
+    } else if (data->revalidated && response.status_code() == Status::kNotModified) {
+        ++not_modified_;
+        auto entry = MakeRevalidatedEntry(*data->revalidated, response.headers());
+        response.SetStatusCode(entry->status);
+        response.headers() = entry->headers;
+        response.sink_string() = std::move(data->revalidated_body);
+        bytes_saved_ += utils::statistics::Rate{entry->body->size()};
+        QueueUpdate(std::move(data->key), std::move(entry));
+    } else {
+        if (data->revalidated) ++modified_;
+        if (auto entry = MakeEntry(request, response, *data, settings_.max_entry_size)) {
+            ++stores_;
+            QueueUpdate(std::move(data->key), std::move(entry));
+        }
+    }
+
+    ResetRequestData(request);
+}
+
+void Plugin::HookOnError(PluginRequest& request, std::error_code) {
+    auto* data = request.GetPluginData().GetOptional(kRequestDataTag);
+    if (!data) return;
+
+    if (data->revalidated && !request.IsIntercepted()) ++revalidation_errors_;
+    ResetRequestData(request);
+}
+
+bool Plugin::HookOnRetry(PluginRequest&) { return true; }
+
+void Plugin::ApplyUpdates() {
+    std::vector<Update> updates;
+    {
+        auto queued = updates_.Lock();
+        if (queued->empty()) return;
+        updates.swap(*queued);
+    }
+
+    for (auto& update : updates) {
+        if (!update.entry) {
+            entries_.InvalidateByKey(update.key);
+            continue;
+        }
+
+        // Concurrent requests may complete out of order, the latest response
+        // is kept
+        const auto current = entries_.GetOptionalUnexpirable(update.key);
+        if (current && *current && (*current)->response_time > update.entry->response_time) continue;
+        entries_.Put(update.key, std::move(update.entry));
+    }
+}
+
+void Plugin::QueueUpdate(std::string key, EntryPtr entry) {
+    auto queued = updates_.Lock();
+    queued->push_back(Update{std::move(key), std::move(entry)});
+}
+
+void Plugin::Serve(PluginRequest& request, const Entry& entry) {
+    const auto age =
+        std::chrono::duration_cast<std::chrono::seconds>(utils::datetime::SteadyNow() - entry.generated_at);
+
+    Response response;
+    response.SetStatusCode(entry.status);
+    response.headers() = entry.headers;
+    response.headers().insert_or_assign(headers::kAge, std::to_string(age.count()));
+    response.sink_string() = *entry.body;
+    bytes_saved_ += utils::statistics::Rate{entry.body->size()};
+
+    request.Intercept().SetResponse(std::move(response));
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Plugin& plugin) {
+    const auto served =
+        (plugin.hits_.Load() + plugin.stale_hits_.Load() + plugin.not_modified_.Load()).value;
+    const auto total =
+        served + (plugin.misses_.Load() + plugin.modified_.Load() + plugin.revalidation_errors_.Load()).value;
+
+    writer["hits"] = plugin.hits_;
+    writer["stale_hits"] = plugin.stale_hits_;
+    writer["misses"] = plugin.misses_;
+    writer["hit_ratio"] = total ? static_cast<double>(served) / static_cast<double>(total) : 0.0;
+    writer["bytes_saved"] = plugin.bytes_saved_;
+    writer["stores"] = plugin.stores_;
+    writer["entries"] = plugin.entries_.GetSizeApproximate();
+
+    auto revalidations = writer["revalidations"];
+    revalidations["not_modified"] = plugin.not_modified_;
+    revalidations["modified"] = plugin.modified_;
+    revalidations["errors"] = plugin.revalidation_errors_;
+}
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
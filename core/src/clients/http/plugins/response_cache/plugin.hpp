@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/clients/http/plugin.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+struct Settings {
+    /// Number of the ways of the cache, see cache::NWayLRU
+    std::size_t ways{16};
+    /// Maximum number of the cached responses in a way
+    std::size_t way_size{64};
+    /// Responses with larger bodies are not cached
+    std::size_t max_entry_size{16 * 1024 * 1024};
+};
+
+/// Cached response
+struct Entry;
+
+using EntryPtr = std::shared_ptr<const Entry>;
+
+/// @brief Caches the responses to GET requests according to RFC 9111.
+///
+/// Fresh responses are returned without sending the request. Stale ones are
+/// revalidated with `If-None-Match` and `If-Modified-Since`, and a 304
+/// response is replaced with the cached one. Within stale-while-revalidate
+/// a single request revalidates the response while the others get the stale
+/// one.
+class Plugin final : public http::Plugin {
+public:
+    explicit Plugin(Settings settings = {});
+    ~Plugin() override;
+
+    void HookPerformRequest(PluginRequest& request) override;
+
+    void HookCreateSpan(PluginRequest& request, tracing::Span& span) override;
+
+    void HookInterceptRequest(PluginRequest& request) override;
+
+    void HookOnCompleted(PluginRequest& request, Response& response) override;
+
+    void HookOnError(PluginRequest& request, std::error_code ec) override;
+
+    bool HookOnRetry(PluginRequest& request) override;
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const Plugin& plugin);
+
+private:
+    // Empty entry invalidates the key
+    struct Update {
+        std::string key;
+        EntryPtr entry;
+    };
+
+    // The cache uses engine::Mutex that may not be locked from the libev
+    // threads of the completion hooks, so the hooks queue the updates and
+    // the next request applies them
+    void ApplyUpdates();
+    void QueueUpdate(std::string key, EntryPtr entry);
+
+    void Serve(PluginRequest& request, const Entry& entry);
+
+    const Settings settings_;
+    USERVER_NAMESPACE::cache::ExpirableLruCache<std::string, EntryPtr> entries_;
+    concurrent::Variable<std::vector<Update>, std::mutex> updates_;
+
+    utils::statistics::RateCounter hits_;
+    utils::statistics::RateCounter stale_hits_;
+    utils::statistics::RateCounter misses_;
+    utils::statistics::RateCounter not_modified_;
+    utils::statistics::RateCounter modified_;
+    utils::statistics::RateCounter revalidation_errors_;
+    utils::statistics::RateCounter stores_;
+    utils::statistics::RateCounter bytes_saved_;
+};
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,188 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <string>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/http_server_mock.hpp>
+#include <userver/utils/mock_now.hpp>
+
+#include <clients/http/plugins/response_cache/cache_control.hpp>
+#include <clients/http/plugins/response_cache/plugin.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+namespace {
+
+namespace headers = USERVER_NAMESPACE::http::headers;
+
+constexpr std::string_view kETag = R"("v1")";
+
+// Responds with 304 to the requests that have the current ETag
+utest::HttpServerMock MakeServer(std::atomic<int>& requests, std::string cache_control) {
+    return utest::HttpServerMock(
+        [&requests, cache_control = std::move(cache_control)](const utest::HttpServerMock::HttpRequest& request
+        ) -> utest::HttpServerMock::HttpResponse {
+            ++requests;
+            if (request.method != HttpMethod::kGet) return {200, {}, {}};
+
+            const auto if_none_match = request.headers.find(headers::kIfNoneMatch);
+            if (if_none_match != request.headers.end() && if_none_match->second == kETag) {
+                return {304, {{headers::kCacheControl, cache_control}, {headers::kETag, std::string{kETag}}}, {}};
+            }
+            return {200, {{headers::kCacheControl, cache_control}, {headers::kETag, std::string{kETag}}}, "body"};
+        }
+    );
+}
+
+std::shared_ptr<Response> Get(Client& client, const std::string& url) {
+    return client.CreateRequest().get().url(url).timeout(utest::kMaxTestWaitTime).perform();
+}
+
+}  // namespace
+
+TEST(ResponseCache, ParseCacheControl) {
+    auto cache_control = ParseCacheControl("max-age=60, stale-while-revalidate=\"30\", Public");
+    EXPECT_EQ(cache_control.max_age, std::chrono::seconds{60});
+    EXPECT_EQ(cache_control.stale_while_revalidate, std::chrono::seconds{30});
+    EXPECT_TRUE(cache_control.is_public);
+    EXPECT_FALSE(cache_control.no_cache);
+    EXPECT_FALSE(cache_control.s_maxage);
+
+    cache_control = ParseCacheControl(R"(no-cache="Set-Cookie, Set-Cookie2", s-maxage=x,must-revalidate)");
+    EXPECT_TRUE(cache_control.no_cache);
+    EXPECT_TRUE(cache_control.must_revalidate);
+    EXPECT_EQ(cache_control.s_maxage, std::chrono::seconds{0});
+
+    EXPECT_EQ(ParseDeltaSeconds("99999999999999999999"), std::chrono::seconds{std::int64_t{1} << 31});
+    EXPECT_EQ(ParseDeltaSeconds("-1"), std::chrono::seconds{0});
+}
+
+UTEST(ResponseCache, FreshHit) {
+    std::atomic<int> requests{0};
+    const auto server = MakeServer(requests, "max-age=60");
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    for (int i = 0; i < 3; ++i) {
+        const auto response = Get(*http_client, server.GetBaseUrl() + "/test");
+        EXPECT_EQ(response->status_code(), 200);
+        EXPECT_EQ(response->body_view(), "body");
+        EXPECT_EQ(response->headers().contains(headers::kAge), i > 0);
+    }
+    EXPECT_EQ(requests, 1);
+
+    EXPECT_EQ(Get(*http_client, server.GetBaseUrl() + "/other")->body_view(), "body");
+    EXPECT_EQ(requests, 2);
+}
+
+UTEST(ResponseCache, Revalidation) {
+    std::atomic<int> requests{0};
+    const auto server = MakeServer(requests, "no-cache");
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    for (int i = 0; i < 3; ++i) {
+        const auto response = Get(*http_client, server.GetBaseUrl() + "/test");
+        EXPECT_EQ(response->status_code(), 200);
+        EXPECT_EQ(response->body_view(), "body");
+    }
+    EXPECT_EQ(requests, 3);
+}
+
+UTEST_MT(ResponseCache, StaleWhileRevalidate, 2) {
+    utils::datetime::MockNowSet(std::chrono::system_clock::now());
+
+    std::atomic<int> requests{0};
+    engine::SingleConsumerEvent release;
+    const utest::HttpServerMock server(
+        [&requests, &release](const utest::HttpServerMock::HttpRequest& request
+        ) -> utest::HttpServerMock::HttpResponse {
+            const Headers response_headers{
+                {headers::kCacheControl, "max-age=1, stale-while-revalidate=60"},
+                {headers::kETag, std::string{kETag}}};
+            if (++requests == 1) return {200, response_headers, "body"};
+
+            EXPECT_EQ(request.headers.at(headers::kIfNoneMatch), kETag);
+            EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+            return {304, response_headers, {}};
+        }
+    );
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+    const auto url = server.GetBaseUrl() + "/test";
+
+    // The second request puts the first response into the cache
+    EXPECT_EQ(Get(*http_client, url)->body_view(), "body");
+    EXPECT_EQ(Get(*http_client, url)->body_view(), "body");
+    EXPECT_EQ(requests, 1);
+    utils::datetime::MockSleep(std::chrono::seconds{2});
+
+    auto revalidation = http_client->CreateRequest().get().url(url).timeout(utest::kMaxTestWaitTime).async_perform();
+    EXPECT_EQ(Get(*http_client, url)->body_view(), "body");
+    release.Send();
+    EXPECT_EQ(revalidation.Get()->body_view(), "body");
+    EXPECT_EQ(requests, 2);
+}
+
+UTEST(ResponseCache, NotCached) {
+    std::atomic<int> requests{0};
+    const auto server = MakeServer(requests, "no-store");
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(Get(*http_client, server.GetBaseUrl() + "/test")->body_view(), "body");
+    }
+    EXPECT_EQ(requests, 3);
+}
+
+UTEST(ResponseCache, RequestsWithBodyNotCached) {
+    std::atomic<int> requests{0};
+    const auto server = MakeServer(requests, "max-age=60");
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    for (int i = 0; i < 2; ++i) {
+        http_client->CreateRequest()
+            .get()
+            .url(server.GetBaseUrl() + "/test")
+            .data("data")
+            .timeout(utest::kMaxTestWaitTime)
+            .perform();
+    }
+    EXPECT_EQ(requests, 2);
+}
+
+UTEST(ResponseCache, Invalidation) {
+    std::atomic<int> requests{0};
+    const auto server = MakeServer(requests, "max-age=60");
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+    const auto url = server.GetBaseUrl() + "/test";
+
+    Get(*http_client, url);
+    Get(*http_client, url);
+    EXPECT_EQ(requests, 1);
+
+    http_client->CreateRequest().post(url, "data").timeout(utest::kMaxTestWaitTime).perform();
+    EXPECT_EQ(requests, 2);
+
+    Get(*http_client, url);
+    EXPECT_EQ(requests, 3);
+}
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,55 @@
+#include <userver/clients/http/plugins/single_flight/component.hpp>
+
+#include <clients/http/plugins/single_flight/plugin.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::single_flight {
+
+namespace {
+
+Settings ParseSettings(const components::ComponentConfig& config) {
+    Settings settings;
+    settings.key_headers = config["key-headers"].As<std::vector<std::string>>(settings.key_headers);
+    return settings;
+}
+
+}  // namespace
+
+Component::Component(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : ComponentBase(config, context), plugin_(std::make_unique<single_flight::Plugin>(ParseSettings(config))) {
+    auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
+    statistics_holder_ = storage.RegisterWriter("httpclient.single-flight", [this](utils::statistics::Writer& writer) {
+        writer = *plugin_;
+    });
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
+
+http::Plugin& Component::GetPlugin() { return *plugin_; }
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: HTTP client plugin that coalesces the identical in-flight GET and HEAD requests
+additionalProperties: false
+properties:
+    key-headers:
+        type: array
+        description: headers that are a part of the request identity along with the method and the URL
+        defaultDescription: '[Authorization, Cookie]'
+        items:
+            type: string
+            description: header name
+)");
+}
+
+}  // namespace clients::http::plugins::single_flight
+
+USERVER_NAMESPACE_END
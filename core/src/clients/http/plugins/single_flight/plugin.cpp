@@ -0,0 +1,213 @@
+#include <clients/http/plugins/single_flight/plugin.hpp>
+
+#include <iterator>
+#include <utility>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::single_flight {
+
+/// Flight of the request that is sent. If the request is cancelled or is
+/// destroyed without the completion hooks called, one of the followers is sent
+/// instead rather than all of them waiting forever or failing.
+class Plugin::Leader final {
+public:
+    Leader(Plugin& plugin, std::string key, engine::TaskProcessor& task_processor)
+        : plugin_(&plugin), key_(std::move(key)), task_processor_(&task_processor) {}
+
+    Leader(Leader&& other) noexcept
+        : plugin_(std::exchange(other.plugin_, nullptr)),
+          key_(std::move(other.key_)),
+          task_processor_(other.task_processor_) {}
+
+    Leader& operator=(Leader&&) = delete;
+
+    ~Leader() {
+        if (!plugin_) return;
+        std::exchange(plugin_, nullptr)->PromoteFollowerAsync(std::move(key_), *task_processor_);
+    }
+
+    Followers TakeFollowers() { return std::exchange(plugin_, nullptr)->TakeFollowers(key_); }
+
+private:
+    Plugin* plugin_;
+    std::string key_;
+    engine::TaskProcessor* task_processor_;
+};
+
+namespace {
+
+const utils::AnyStorageDataTag<PluginDataTag, std::optional<Plugin::Leader>> kLeaderTag;
+
+bool IsCoalescible(const PluginRequest& request) {
+    // The body is not a part of the key, the GET requests with different
+    // bodies may get different responses
+    if (request.HasBody()) return false;
+
+    const auto method = request.GetMethod();
+    return method == HttpMethod::kGet || method == HttpMethod::kHead;
+}
+
+}  // namespace
+
+Plugin::Plugin(Settings settings) : http::Plugin("single-flight"), settings_(std::move(settings)) {}
+
+Plugin::~Plugin() { wait_token_storage_.WaitForAllTokens(); }
+
+void Plugin::HookPerformRequest(PluginRequest&) {}
+
+void Plugin::HookCreateSpan(PluginRequest&, tracing::Span&) {}
+
+void Plugin::HookInterceptRequest(PluginRequest& request) {
+    if (!IsCoalescible(request)) return;
+
+    // The previous perform of the request completed without the hooks called
+    if (auto* leader = request.GetPluginData().GetOptional(kLeaderTag)) leader->reset();
+
+    auto key = MakeKey(request);
+    {
+        auto flights = flights_.Lock();
+        const auto it = flights->find(key);
+        if (it != flights->end()) {
+            it->second.push_back(request.Intercept());
+            ++coalesced_;
+            return;
+        }
+        flights->emplace(key, Followers{});
+    }
+
+    ++issued_;
+    auto& task_processor = engine::current_task::GetTaskProcessor();
+    request.GetPluginData().Emplace(kLeaderTag).emplace(*this, std::move(key), task_processor);
+}
+
+void Plugin::HookOnCompleted(PluginRequest& request, Response& response) {
+    for (auto& follower : TakeFollowers(request)) {
+        std::move(follower).SetResponse(response);
+    }
+}
+
+void Plugin::HookOnError(PluginRequest& request, std::error_code ec) {
+    if (ec == std::errc::operation_canceled) {
+        // Only the leader is cancelled, the followers still wait for a response
+        if (auto* leader = request.GetPluginData().GetOptional(kLeaderTag)) leader->reset();
+        return;
+    }
+
+    for (auto& follower : TakeFollowers(request)) {
+        std::move(follower).SetError(ec);
+    }
+}
+
+bool Plugin::HookOnRetry(PluginRequest&) { return true; }
+
+std::string Plugin::MakeKey(const PluginRequest& request) const {
+    const auto method = request.GetMethod();
+    UASSERT(method);
+
+    std::string key{ToStringView(*method)};
+    key += ' ';
+    key += request.GetOriginalUrl();
+    const auto append_header = [&key, &request](std::string_view name) {
+        key += '\n';
+        // A missing header differs from an empty one
+        if (const auto value = request.GetHeader(name)) {
+            key += ':';
+            key += *value;
+        }
+    };
+    for (const auto& name : settings_.key_headers) {
+        append_header(name);
+    }
+    // The validators are set by the caller or by a response cache plugin, the
+    // requests with different ones may get different responses, e.g. 304
+    append_header(USERVER_NAMESPACE::http::headers::kIfNoneMatch);
+    append_header(USERVER_NAMESPACE::http::headers::kIfModifiedSince);
+    return key;
+}
+
+Plugin::Followers Plugin::TakeFollowers(const std::string& key) {
+    Followers followers;
+    auto flights = flights_.Lock();
+    const auto it = flights->find(key);
+    UASSERT(it != flights->end());
+    if (it != flights->end()) {
+        followers = std::move(it->second);
+        flights->erase(it);
+    }
+    return followers;
+}
+
+Plugin::Followers Plugin::TakeFollowers(PluginRequest& request) {
+    auto* leader = request.GetPluginData().GetOptional(kLeaderTag);
+    if (!leader || !*leader) return {};
+
+    auto followers = (*leader)->TakeFollowers();
+    leader->reset();
+    return followers;
+}
+
+void Plugin::PromoteFollowerAsync(std::string key, engine::TaskProcessor& task_processor) {
+    auto followers = TakeFollowers(key);
+    if (followers.empty()) return;
+
+    // May be called from the event loop thread, while the request must be sent
+    // from a coroutine
+    engine::DetachUnscopedUnsafe(engine::CriticalAsyncNoSpan(
+        task_processor,
+        [this,
+         token = wait_token_storage_.GetToken(),
+         key = std::move(key),
+         followers = std::move(followers),
+         &task_processor]() mutable { PromoteFollower(std::move(key), std::move(followers), task_processor); }
+    ));
+}
+
+void Plugin::PromoteFollower(std::string key, Followers followers, engine::TaskProcessor& task_processor) {
+    Followers waiting;
+    for (auto& follower : followers) {
+        if (follower.IsCancelled()) {
+            std::move(follower).SetError(std::make_error_code(std::errc::operation_canceled));
+        } else {
+            waiting.push_back(std::move(follower));
+        }
+    }
+    if (waiting.empty()) return;
+
+    {
+        auto flights = flights_.Lock();
+        auto [it, inserted] = flights->try_emplace(key);
+        // An identical request was sent while the flight had no leader
+        const auto first_follower = inserted ? std::next(waiting.begin()) : waiting.begin();
+        it->second.insert(
+            it->second.end(), std::make_move_iterator(first_follower), std::make_move_iterator(waiting.end())
+        );
+        if (!inserted) return;
+    }
+
+    ++promoted_;
+    auto& leader = waiting.front();
+    leader.GetPluginData().Emplace(kLeaderTag).emplace(*this, std::move(key), task_processor);
+    std::move(leader).Perform();
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Plugin& plugin) {
+    writer["issued"] = plugin.issued_;
+    writer["coalesced"] = plugin.coalesced_;
+    writer["promoted"] = plugin.promoted_;
+
+    const auto flights = plugin.flights_.Lock();
+    writer["in_flight"] = flights->size();
+}
+
+}  // namespace clients::http::plugins::single_flight
+
+USERVER_NAMESPACE_END
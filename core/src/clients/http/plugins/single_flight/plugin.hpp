@@ -0,0 +1,75 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/clients/http/plugin.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::single_flight {
+
+struct Settings {
+    /// Headers that are a part of the request identity along with the method
+    /// and the URL
+    std::vector<std::string> key_headers{"Authorization", "Cookie"};
+};
+
+/// @brief Coalesces the identical in-flight GET and HEAD requests without a body.
+///
+/// The first of the identical requests is sent, the ones that start before it
+/// completes are intercepted and completed with copies of its response or
+/// with its error. If the sent request is cancelled, one of the waiting
+/// requests is sent instead.
+class Plugin final : public http::Plugin {
+public:
+    class Leader;
+
+    explicit Plugin(Settings settings = {});
+    ~Plugin() override;
+
+    void HookPerformRequest(PluginRequest& request) override;
+
+    void HookCreateSpan(PluginRequest& request, tracing::Span& span) override;
+
+    void HookInterceptRequest(PluginRequest& request) override;
+
+    void HookOnCompleted(PluginRequest& request, Response& response) override;
+
+    void HookOnError(PluginRequest& request, std::error_code ec) override;
+
+    bool HookOnRetry(PluginRequest& request) override;
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const Plugin& plugin);
+
+private:
+    // Requests that wait for the sent one
+    using Followers = std::vector<InterceptedRequest>;
+
+    std::string MakeKey(const PluginRequest& request) const;
+    Followers TakeFollowers(const std::string& key);
+    Followers TakeFollowers(PluginRequest& request);
+    void PromoteFollowerAsync(std::string key, engine::TaskProcessor& task_processor);
+    void PromoteFollower(std::string key, Followers followers, engine::TaskProcessor& task_processor);
+
+    const Settings settings_;
+    mutable concurrent::Variable<std::unordered_map<std::string, Followers>, std::mutex> flights_;
+
+    utils::statistics::RateCounter issued_;
+    utils::statistics::RateCounter coalesced_;
+    utils::statistics::RateCounter promoted_;
+
+    // Must be the last member, the promotion tasks use the other ones
+    utils::impl::WaitTokenStorage wait_token_storage_;
+};
+
+}  // namespace clients::http::plugins::single_flight
+
+USERVER_NAMESPACE_END
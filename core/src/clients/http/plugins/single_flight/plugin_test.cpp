@@ -0,0 +1,202 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/http_server_mock.hpp>
+
+#include <clients/http/plugins/single_flight/plugin.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::single_flight {
+
+namespace {
+
+constexpr int kRequests = 5;
+
+// Responds once `release` is sent, so that the requests overlap. The event
+// allows a single waiter, so a single request is expected at a time.
+utest::HttpServerMock MakeServer(std::atomic<int>& requests, engine::SingleConsumerEvent& release) {
+    return utest::HttpServerMock(
+        [&requests, &release](const utest::HttpServerMock::HttpRequest&) -> utest::HttpServerMock::HttpResponse {
+            ++requests;
+            EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+            utest::HttpServerMock::HttpResponse response{};
+            response.response_status = 200;
+            response.body = "body";
+            return response;
+        }
+    );
+}
+
+}  // namespace
+
+UTEST_MT(SingleFlight, CoalescesIdenticalRequests, 2) {
+    std::atomic<int> requests{0};
+    engine::SingleConsumerEvent release;
+    const auto server = MakeServer(requests, release);
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    std::vector<ResponseFuture> futures;
+    for (int i = 0; i < kRequests; ++i) {
+        futures.push_back(http_client->CreateRequest()
+                              .get()
+                              .url(server.GetBaseUrl() + "/test")
+                              .timeout(utest::kMaxTestWaitTime)
+                              .async_perform());
+    }
+    release.Send();
+
+    for (auto& future : futures) {
+        const auto response = future.Get();
+        EXPECT_EQ(response->status_code(), 200);
+        EXPECT_EQ(response->body_view(), "body");
+    }
+    EXPECT_EQ(requests, 1);
+
+    // The next request is sent once the previous ones are completed
+    release.Send();
+    const auto response = http_client->CreateRequest()
+                              .get()
+                              .url(server.GetBaseUrl() + "/test")
+                              .timeout(utest::kMaxTestWaitTime)
+                              .perform();
+    EXPECT_EQ(response->status_code(), 200);
+    EXPECT_EQ(requests, 2);
+}
+
+UTEST_MT(SingleFlight, DifferentRequestsNotCoalesced, 2) {
+    std::atomic<int> requests{0};
+    const utest::HttpServerMock server(
+        [&requests](const utest::HttpServerMock::HttpRequest&) -> utest::HttpServerMock::HttpResponse {
+            ++requests;
+            engine::SleepFor(std::chrono::milliseconds{50});
+            return {200, {}, "body"};
+        }
+    );
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    const auto url = server.GetBaseUrl() + "/test";
+    std::vector<ResponseFuture> futures;
+    futures.push_back(http_client->CreateRequest().get().url(url).timeout(utest::kMaxTestWaitTime).async_perform());
+    futures.push_back(
+        http_client->CreateRequest().get().url(url + "?a=b").timeout(utest::kMaxTestWaitTime).async_perform()
+    );
+    futures.push_back(http_client->CreateRequest()
+                          .get()
+                          .url(url)
+                          .headers({{"Authorization", "token"}})
+                          .timeout(utest::kMaxTestWaitTime)
+                          .async_perform());
+    futures.push_back(
+        http_client->CreateRequest().post(url, "data").timeout(utest::kMaxTestWaitTime).async_perform()
+    );
+
+    for (auto& future : futures) {
+        EXPECT_EQ(future.Get()->status_code(), 200);
+    }
+    EXPECT_EQ(requests, 4);
+}
+
+UTEST_MT(SingleFlight, RequestsWithBodyNotCoalesced, 2) {
+    std::atomic<int> requests{0};
+    const utest::HttpServerMock server(
+        [&requests](const utest::HttpServerMock::HttpRequest& request) -> utest::HttpServerMock::HttpResponse {
+            ++requests;
+            engine::SleepFor(std::chrono::milliseconds{50});
+            return {200, {}, request.body};
+        }
+    );
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    const auto url = server.GetBaseUrl() + "/test";
+    auto first =
+        http_client->CreateRequest().get().url(url).data("first").timeout(utest::kMaxTestWaitTime).async_perform();
+    auto second =
+        http_client->CreateRequest().get().url(url).data("second").timeout(utest::kMaxTestWaitTime).async_perform();
+
+    EXPECT_EQ(first.Get()->body_view(), "first");
+    EXPECT_EQ(second.Get()->body_view(), "second");
+    EXPECT_EQ(requests, 2);
+}
+
+UTEST_MT(SingleFlight, CancelledLeaderPromotesFollower, 2) {
+    std::atomic<int> requests{0};
+    engine::SingleConsumerEvent release;
+    const utest::HttpServerMock server(
+        [&requests, &release](const utest::HttpServerMock::HttpRequest&) -> utest::HttpServerMock::HttpResponse {
+            if (++requests == 1) {
+                EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+            }
+            return {200, {}, "body"};
+        }
+    );
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    auto leader = http_client->CreateRequest()
+                      .get()
+                      .url(server.GetBaseUrl() + "/test")
+                      .timeout(utest::kMaxTestWaitTime)
+                      .async_perform();
+    auto follower = http_client->CreateRequest()
+                        .get()
+                        .url(server.GetBaseUrl() + "/test")
+                        .timeout(utest::kMaxTestWaitTime)
+                        .async_perform();
+
+    while (requests == 0) {
+        engine::SleepFor(std::chrono::milliseconds{1});
+    }
+    leader.Cancel();
+
+    const auto response = follower.Get();
+    EXPECT_EQ(response->status_code(), 200);
+    EXPECT_EQ(response->body_view(), "body");
+    EXPECT_EQ(requests, 2);
+
+    release.Send();
+}
+
+UTEST_MT(SingleFlight, FollowerTimeout, 2) {
+    std::atomic<int> requests{0};
+    engine::SingleConsumerEvent release;
+    const auto server = MakeServer(requests, release);
+
+    Plugin plugin;
+    auto http_client = utest::CreateHttpClientWithPlugin(plugin);
+
+    auto leader = http_client->CreateRequest()
+                      .get()
+                      .url(server.GetBaseUrl() + "/test")
+                      .timeout(utest::kMaxTestWaitTime)
+                      .async_perform();
+    auto follower = http_client->CreateRequest()
+                        .get()
+                        .url(server.GetBaseUrl() + "/test")
+                        .timeout(std::chrono::milliseconds{100})
+                        .async_perform();
+
+    UEXPECT_THROW(follower.Get(), TimeoutException);
+
+    release.Send();
+    EXPECT_EQ(leader.Get()->status_code(), 200);
+    EXPECT_EQ(requests, 1);
+}
+
+}  // namespace clients::http::plugins::single_flight
+
+USERVER_NAMESPACE_END
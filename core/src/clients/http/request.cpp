@@ -427,6 +427,7 @@ Request Request::cookies(const std::unordered_map<std::string, std::string>& coo
 }
 
 Request& Request::method(HttpMethod method) & {
+    pimpl_->SetMethod(method);
     switch (method) {
         case HttpMethod::kDelete:
         case HttpMethod::kOptions:
@@ -476,6 +477,7 @@ Request& Request::set_custom_http_request_method(std::string method) & {
     LOG_LIMITED_WARNING() << "This method can cause unexpected effects in libcurl, i.e., timeouts, "
                              "changing of request type. Use it only if you need to make "
                              "GET-request with body.";
+    pimpl_->SetMethod(std::nullopt);
     pimpl_->easy().set_custom_request(method);
     return *this;
 }
@@ -530,6 +530,67 @@ void RequestState::OnCompleted(std::shared_ptr<RequestState> holder, std::error_
     // it is unsafe to touch any content of holder after this point!
 }
 
+std::shared_ptr<RequestState> RequestState::Intercept() {
+    UINVARIANT(!intercepted_, "The request is already intercepted");
+    UINVARIANT(std::holds_alternative<FullBufferedData>(data_), "Only the buffered requests may be intercepted");
+    intercepted_ = true;
+    return shared_from_this();
+}
+
+void RequestState::PerformIntercepted(std::shared_ptr<RequestState> holder) {
+    UASSERT(holder);
+    UASSERT(holder->intercepted_);
+    holder->intercepted_ = false;
+
+    if (holder->UpdateTimeoutFromDeadlineAndCheck()) {
+        auto& holder_ref = *holder;
+        holder_ref.PerformRequest([holder = std::move(holder)](std::error_code err) mutable {
+            RequestState::OnRetry(std::move(holder), err);
+        });
+    }
+}
+
+void RequestState::OnInterceptedCompleted(
+    std::shared_ptr<RequestState> holder,
+    std::shared_ptr<Response> response,
+    std::error_code err
+) {
+    UASSERT(holder);
+    UASSERT(holder->span_storage_);
+    auto& span = holder->span_storage_->Get();
+    span.AddTag("intercepted", 1);
+
+    auto* buffered_data = std::get_if<FullBufferedData>(&holder->data_);
+    UASSERT(buffered_data);
+    auto promise = std::move(buffered_data->promise);
+
+    if (err) {
+        holder->plugin_pipeline_.HookOnError(*holder, err);
+
+        span.AddTag(tracing::kErrorFlag, true);
+        span.AddTag(tracing::kErrorMessage, err.message());
+        span.AddTag(tracing::kHttpStatusCode, kFakeHttpErrorCode);
+        holder->span_storage_.reset();
+
+        // The request was not performed, so there is no effective URL and stats
+        auto exception = http::PrepareException(err, holder->GetLoggedOriginalUrl(), LocalStats{});
+        // The task will wake up and may reuse RequestState.
+        promise.set_exception(std::move(exception));
+    } else {
+        UASSERT(response);
+        holder->response_ = std::move(response);
+        span.AddTag(tracing::kHttpStatusCode, holder->response_->status_code());
+        if (holder->response_->IsError()) span.AddTag(tracing::kErrorFlag, true);
+
+        holder->plugin_pipeline_.HookOnCompleted(*holder, *holder->response_);
+        holder->span_storage_.reset();
+
+        // The task will wake up and may reuse RequestState.
+        promise.set_value(holder->response_move());
+    }
+    // it is unsafe to touch any content of holder after this point!
+}
+
 void RequestState::OnRetry(std::shared_ptr<RequestState> holder, std::error_code err) {
     UASSERT(holder);
     UASSERT(holder->span_storage_);
@@ -675,7 +736,7 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::imp
 
     auto future = std::get_if<FullBufferedData>(&data_)->promise.get_future();
 
-    if (UpdateTimeoutFromDeadlineAndCheck()) {
+    if (UpdateTimeoutFromDeadlineAndCheck() && !plugin_pipeline_.HookInterceptRequest(*this)) {
         PerformRequest([holder = shared_from_this()](std::error_code err) mutable {
             RequestState::OnRetry(std::move(holder), err);
         });
@@ -729,6 +790,10 @@ void RequestState::PerformRequest(curl::easy::handler_type handler) {
                     easy().async_perform(std::move(handler));
                 } catch (const clients::dns::ResolverException& ex) {
                     // TODO: should retry - TAXICOMMON-4932
+                    // The plugins may wait for the request completion
+                    plugin_pipeline_.HookOnError(
+                        *this, std::error_code{curl::errc::EasyErrorCode::kCouldNotResolveHost}
+                    );
                     auto* buffered_data = std::get_if<FullBufferedData>(&data_);
                     if (buffered_data) {
                         buffered_data->promise.set_exception(std::current_exception());
@@ -906,6 +971,7 @@ void RequestState::ResetDataForNewRequest() {
     response_->SetStatusCode(Status::InternalServerError);
 
     is_cancelled_ = false;
+    intercepted_ = false;
     retry_.current = 1;
     remote_timeout_ = original_timeout_;
     deadline_ = server::request::GetTaskInheritedDeadline();
@@ -1041,6 +1107,11 @@ void RequestState::SetTracingManager(const tracing::TracingManagerBase& m) { tra
 
 PluginRequest RequestState::GetEditableRequestInstance() { return PluginRequest(*this); }
 
+PluginData& RequestState::GetPluginData() {
+    if (!plugin_data_) plugin_data_.emplace();
+    return *plugin_data_;
+}
+
 }  // namespace clients::http
 
 USERVER_NAMESPACE_END
@@ -142,6 +142,26 @@ public:
 
     PluginRequest GetEditableRequestInstance();
 
+    PluginData& GetPluginData();
+
+    void SetMethod(std::optional<HttpMethod> method) { method_ = method; }
+    std::optional<HttpMethod> GetMethod() const { return method_; }
+
+    /// Marks the request as completed by a plugin, see PluginRequest::Intercept()
+    std::shared_ptr<RequestState> Intercept();
+    bool IsIntercepted() const { return intercepted_; }
+    bool IsCancelled() const { return is_cancelled_.load(); }
+
+    /// Sends the intercepted request after all
+    static void PerformIntercepted(std::shared_ptr<RequestState> holder);
+
+    /// Completes the intercepted request with the response or the error
+    static void OnInterceptedCompleted(
+        std::shared_ptr<RequestState> holder,
+        std::shared_ptr<Response> response,
+        std::error_code err
+    );
+
 private:
     /// final callback that calls user callback and set value in promise
     static void OnCompleted(std::shared_ptr<RequestState>, std::error_code err);
@@ -239,6 +259,11 @@ private:
     clients::dns::Resolver* resolver_{nullptr};
     std::string proxy_url_;
     impl::PluginPipeline plugin_pipeline_;
+    // Created on the first use, most of the requests are not touched by the plugins
+    std::optional<PluginData> plugin_data_;
+    // Explicitly set method of the request
+    std::optional<HttpMethod> method_;
+    bool intercepted_{false};
 
     struct StreamData {
         StreamData(Queue::Producer&& queue_producer) : queue_producer(std::move(queue_producer)) {}
@@ -14,7 +14,8 @@ FsCache::FsCache(const components::ComponentConfig& config, const components::Co
       client_(
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
-          GetFsTaskProcessor(config, context)
+          GetFsTaskProcessor(config, context),
+          config["max-in-memory-size"].As<std::size_t>(fs::kNoFileSizeLimit)
       ) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
@@ -36,6 +37,13 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: engine::current_task::GetBlockingTaskProcessor()
+    max-in-memory-size:
+        type: integer
+        description: |
+            files larger than that are kept open instead of being loaded into
+            memory, in bytes
+        defaultDescription: unlimited
+        minimum: 0
 )");
 }
 
@@ -115,6 +115,28 @@ properties:
                 type: boolean
                 description: stack usage monitor status
                 defaultDescription: true
+            idle_stacks_reclaim_interval:
+                type: string
+                description: |
+                    How often memory of idle coroutine stacks is returned to
+                    the OS and the pool is shrunk toward initial_size after
+                    a load spike. 0 disables reclaiming.
+                defaultDescription: 0
+            idle_stack_resident_size:
+                type: integer
+                description: |
+                    bytes at the top of an idle coroutine stack that are never
+                    returned to the OS on reclaim, rounded up to the page
+                    size, at least 4 pages
+                defaultDescription: 16 * 1024
+                minimum: 16384
+            reserve_stacks_region:
+                type: boolean
+                description: |
+                    Reserve address space for max_size stacks on startup, so
+                    that creating and destroying coroutines does not require
+                    mmap/munmap syscalls.
+                defaultDescription: false
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -125,6 +147,16 @@ properties:
                 description: >
                     number of threads to process low level IO system calls
                     (number of ev loops to start in libev)
+            io_backend:
+                type: string
+                description: >
+                    how socket I/O waits on ev threads: libev readiness
+                    notifications or completions of io_uring; io_uring falls
+                    back to libev if not supported by the kernel
+                defaultDescription: libev
+                enum:
+                  - libev
+                  - io_uring
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -173,10 +205,13 @@ properties:
                         `global-task-queue` default task queue.
                         `work-stealing-task-queue` experimental with
                         potentially better scalability than `global-task-queue`.
+                        `priority-task-queue` global task queue that runs
+                        tasks according to their engine::TaskPriority.
                     defaultDescription: global-task-queue
                     enum:
                       - global-task-queue
                       - work-stealing-task-queue
+                      - priority-task-queue
                 task-trace:
                     type: object
                     description: .
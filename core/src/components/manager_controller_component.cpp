@@ -52,6 +52,10 @@ void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor&
         WriteRateAndLegacyMetrics(context_switch["no_overloaded"], counter.GetTasksNoOverloadSensor());
     }
 
+    if (const auto* priority_queue = task_processor.GetPriorityTaskQueue()) {
+        writer["priority-queue"] = *priority_queue;
+    }
+
     writer["worker-threads"] = task_processor.GetWorkerCount();
 }
 
@@ -109,6 +113,10 @@ void ManagerControllerComponent::WriteStatistics(utils::statistics::Writer& writ
             stack_usage_stats["max-usage-percent"] = stats.max_stack_usage_pct;
             stack_usage_stats["is-monitor-active"] = stats.is_stack_usage_monitor_active;
         }
+        if (auto reclaim_stats = coro_pool["reclaim"]) {
+            reclaim_stats["destroyed-coroutines"] = utils::statistics::Rate{stats.reclaimed_coroutines};
+            reclaim_stats["released-stack-bytes"] = utils::statistics::Rate{stats.reclaimed_stack_bytes};
+        }
     }
 
     // misc
@@ -3,13 +3,22 @@
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <zlib.h>
+
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
 namespace {
 constexpr auto kDecompressBufferSize = 1024;
-}
+constexpr auto kCompressBufferSize = 16 * 1024;
+
+// 15 is the max window size, +16 makes zlib write a gzip header and trailer
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kMemLevel = 8;
+}  // namespace
 
 std::string Decompress(std::string_view compressed, size_t max_size) {
     std::string decompressed;
@@ -41,6 +50,74 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+namespace {
+
+class Deflater final {
+public:
+    Deflater() {
+        const auto ret =
+            deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, kGzipWindowBits, kMemLevel, Z_DEFAULT_STRATEGY);
+        if (ret != Z_OK) {
+            throw CompressionError(stream_.msg ? stream_.msg : "failed to initialize gzip compressor");
+        }
+    }
+
+    Deflater(const Deflater&) = delete;
+    Deflater& operator=(const Deflater&) = delete;
+
+    ~Deflater() { deflateEnd(&stream_); }
+
+    std::string Process(std::string_view input, int flush) {
+        UINVARIANT(!finished_, "gzip::StreamCompressor is used after Finish()");
+
+        std::string result;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        stream_.avail_in = static_cast<uInt>(input.size());
+        do {
+            const auto old_size = result.size();
+            result.resize(old_size + kCompressBufferSize);
+            stream_.next_out = reinterpret_cast<Bytef*>(result.data() + old_size);
+            stream_.avail_out = kCompressBufferSize;
+
+            const auto ret = deflate(&stream_, flush);
+            if (ret == Z_STREAM_ERROR) {
+                throw CompressionError(stream_.msg ? stream_.msg : "deflate failed");
+            }
+            result.resize(result.size() - stream_.avail_out);
+            finished_ = ret == Z_STREAM_END;
+        } while (stream_.avail_out == 0 || stream_.avail_in != 0);
+
+        return result;
+    }
+
+private:
+    z_stream stream_{};
+    bool finished_{false};
+};
+
+}  // namespace
+
+struct StreamCompressor::Impl {
+    Deflater deflater;
+};
+
+StreamCompressor::StreamCompressor() : impl_(std::make_unique<Impl>()) {}
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&&) noexcept = default;
+
+StreamCompressor::~StreamCompressor() = default;
+
+std::string StreamCompressor::CompressChunk(std::string_view chunk) {
+    return impl_->deflater.Process(chunk, Z_SYNC_FLUSH);
+}
+
+std::string StreamCompressor::Finish() { return impl_->deflater.Process({}, Z_FINISH); }
+
+std::string Compress(std::string_view data) { return Deflater{}.Process(data, Z_FINISH); }
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
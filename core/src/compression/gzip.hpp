@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -12,6 +14,33 @@ namespace compression::gzip {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a single gzip member.
+/// @throws CompressionError
+std::string Compress(std::string_view data);
+
+/// @brief Compresses a sequence of chunks into a single gzip member, every
+/// chunk is flushed so that the peer could decompress it without waiting for
+/// the next one.
+class StreamCompressor final {
+public:
+    StreamCompressor();
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// Compresses and flushes the chunk.
+    /// @throws CompressionError
+    std::string CompressChunk(std::string_view chunk);
+
+    /// Writes the gzip trailer, the compressor may not be used afterwards.
+    /// @throws CompressionError
+    std::string Finish();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -28,4 +28,30 @@ TEST(Gzip, TestOverflow) {
     EXPECT_THROW(compression::gzip::Decompress(compressed, big_msg.size() / 2), compression::TooBigError);
 }
 
+TEST(Gzip, CompressRoundtrip) {
+    const std::string msg(16'000, 'a');
+
+    const auto compressed = compression::gzip::Compress(msg);
+    EXPECT_LT(compressed.size(), msg.size());
+    EXPECT_EQ(compression::gzip::Decompress(compressed, msg.size()), msg);
+}
+
+TEST(Gzip, StreamCompressorRoundtrip) {
+    compression::gzip::StreamCompressor compressor;
+
+    std::string compressed;
+    std::string expected;
+    for (int i = 0; i < 10; ++i) {
+        const auto chunk = "chunk #" + std::to_string(i) + ";";
+        expected += chunk;
+        // each chunk is flushed, so the output is never empty
+        const auto compressed_chunk = compressor.CompressChunk(chunk);
+        EXPECT_FALSE(compressed_chunk.empty());
+        compressed += compressed_chunk;
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::gzip::Decompress(compressed, expected.size()), expected);
+}
+
 USERVER_NAMESPACE_END
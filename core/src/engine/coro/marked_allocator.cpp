@@ -1,5 +1,7 @@
 #include <engine/coro/marked_allocator.hpp>
 
+#include <engine/coro/stack_region.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro::debug {
@@ -7,11 +9,24 @@ namespace engine::coro::debug {
 static volatile const std::size_t page_size = MarkedAllocator::traits_type::page_size();
 static volatile std::size_t allocator_stack_size = MarkedAllocator::traits_type::default_size();
 
-MarkedAllocator::MarkedAllocator(std::size_t size) : boost::coroutines2::protected_fixedsize_stack(size) {
+MarkedAllocator::MarkedAllocator(std::size_t size, StackRegion* region)
+    : boost::coroutines2::protected_fixedsize_stack(size), region(region) {
     auto alignment = page_size;
     allocator_stack_size = (size + alignment - 1) / alignment * alignment;
 }
 
+boost::context::stack_context MarkedAllocator::allocate() {
+    if (region) {
+        if (auto stack = region->TryAllocate()) return *stack;
+    }
+    return boost::coroutines2::protected_fixedsize_stack::allocate();
+}
+
+void MarkedAllocator::deallocate(boost::context::stack_context& stack) noexcept {
+    if (region && region->TryDeallocate(stack)) return;
+    boost::coroutines2::protected_fixedsize_stack::deallocate(stack);
+}
+
 }  // namespace engine::coro::debug
 
 USERVER_NAMESPACE_END
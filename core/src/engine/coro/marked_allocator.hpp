@@ -4,12 +4,22 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::coro {
+class StackRegion;
+}  // namespace engine::coro
+
 namespace engine::coro::debug {
 
 struct MarkedAllocator : boost::coroutines2::protected_fixedsize_stack {
-    MarkedAllocator(std::size_t size = traits_type::default_size());
+    MarkedAllocator(std::size_t size = traits_type::default_size(), StackRegion* region = nullptr);
+
+    // Take stacks from the region while it has free ones, then fall back to
+    // a separate mmap for each stack
+    boost::context::stack_context allocate();
+    void deallocate(boost::context::stack_context& stack) noexcept;
 
     const char coroutine_mark[16] = "ThisIsCoroAlloc";
+    StackRegion* region{nullptr};
 };
 
 }  // namespace engine::coro::debug
@@ -1,5 +1,7 @@
 #include <engine/coro/pool.hpp>
 
+#include <sys/mman.h>
+
 #include <algorithm>  // for std::max/std::min
 #include <iterator>
 #include <optional>
@@ -14,6 +16,17 @@ USERVER_NAMESPACE_BEGIN
 namespace engine::coro {
 
 namespace {
+
+// Frequency of TryReclaimIdleStacks calls that check the clock
+constexpr std::size_t kReclaimCheckFrequency = 1024;
+
+// Bounds the time a worker thread spends in madvise/munmap per reclaim
+constexpr std::size_t kMaxReclaimedCoroutinesPerPass = 256;
+
+// Idle coroutine is suspended with a few frames at the top of the stack, they
+// and the boost.context control block must never be released
+constexpr std::size_t kMinIdleStackResidentPages = 4;
+
 bool IsStackUsageMonitorEnabled() {
     // NOLINTNEXTLINE(concurrency-mt-unsafe)
     auto* enable = std::getenv("USERVER_ENABLE_STACK_USAGE_MONITOR");
@@ -21,18 +34,29 @@ bool IsStackUsageMonitorEnabled() {
     if (std::string_view(enable) == "0") return false;
     return true;
 }
+
+std::uintptr_t GetStackBegin(const void* cb_ptr, std::size_t page_size) noexcept {
+    // cb_ptr points to the control block at the top of the stack, the stack
+    // grows downwards from the end of the page, see StackUsageMonitor.
+    return (reinterpret_cast<std::uintptr_t>(cb_ptr) + page_size - 1) & ~(page_size - 1);
+}
+
 }  // namespace
 
 Pool::Pool(PoolConfig config, Executor executor)
     : config_(FixupConfig(std::move(config))),
       executor_(executor),
       local_coroutine_move_size_((config_.local_cache_size + 1) / 2),
-      stack_allocator_(config_.stack_size),
+      stack_region_(
+          config_.reserve_stacks_region ? std::make_unique<StackRegion>(config_.stack_size, config_.max_size) : nullptr
+      ),
+      stack_allocator_(config_.stack_size, stack_region_.get()),
       stack_usage_monitor_(config_.stack_size),
       initial_coroutines_(config_.initial_size),
       used_coroutines_(config_.max_size),
       idle_coroutines_num_(config_.initial_size),
-      total_coroutines_num_(0) {
+      total_coroutines_num_(0),
+      next_reclaim_time_(std::chrono::steady_clock::now() + config_.idle_stacks_reclaim_interval) {
     UASSERT(local_coroutine_move_size_ <= config_.local_cache_size);
     const moodycamel::ProducerToken token(initial_coroutines_);
 
@@ -102,6 +126,8 @@ PoolStats Pool::GetStats() const {
     stats.total_coroutines = std::max(total_coroutines_num_.load(), stats.active_coroutines);
     stats.max_stack_usage_pct = stack_usage_monitor_.GetMaxStackUsagePct();
     stats.is_stack_usage_monitor_active = stack_usage_monitor_.IsActive();
+    stats.reclaimed_coroutines = reclaimed_coroutines_.load();
+    stats.reclaimed_stack_bytes = reclaimed_stack_bytes_.load();
     return stats;
 }
 
@@ -205,6 +231,9 @@ std::size_t Pool::GetStackSize() const { return config_.stack_size; }
 PoolConfig Pool::FixupConfig(PoolConfig&& config) {
     const auto page_size = utils::sys_info::GetPageSize();
     config.stack_size = (config.stack_size + page_size - 1) & ~(page_size - 1);
+    config.idle_stack_resident_size = std::max(
+        (config.idle_stack_resident_size + page_size - 1) & ~(page_size - 1), kMinIdleStackResidentPages * page_size
+    );
 
     return std::move(config);
 }
@@ -217,6 +246,89 @@ void Pool::RegisterThread() {
 
 void Pool::AccountStackUsage() { stack_usage_monitor_.AccountStackUsage(); }
 
+void Pool::TryReclaimIdleStacks() {
+    if (config_.idle_stacks_reclaim_interval.count() == 0) return;
+
+    // Don't call clock_gettime() too often
+    thread_local std::size_t calls_count = 0;
+    if (++calls_count % kReclaimCheckFrequency != 0) return;
+
+    const auto now = std::chrono::steady_clock::now();
+    auto next_reclaim_time = next_reclaim_time_.load();
+    if (now < next_reclaim_time) return;
+    if (!next_reclaim_time_.compare_exchange_strong(next_reclaim_time, now + config_.idle_stacks_reclaim_interval)) {
+        // Another thread is reclaiming right now
+        return;
+    }
+
+    ReclaimIdleStacks();
+}
+
+void Pool::ReclaimIdleStacks() {
+    // The pool has been idle if there were few active coroutines both now and
+    // at the previous reclaim
+    const auto active_coroutines = GetStats().active_coroutines;
+    const auto peak_active_coroutines =
+        std::max(active_coroutines, last_reclaim_active_coroutines_.exchange(active_coroutines));
+
+    std::vector<Coroutine> idle_coroutines;
+    idle_coroutines.reserve(kMaxReclaimedCoroutinesPerPass);
+    const std::size_t dequeued_num = used_coroutines_.try_dequeue_bulk(
+        GetUsedPoolToken<moodycamel::ConsumerToken>(),
+        std::back_inserter(idle_coroutines),
+        kMaxReclaimedCoroutinesPerPass
+    );
+    if (dequeued_num == 0) return;
+    idle_coroutines_num_.fetch_sub(dequeued_num);
+
+    // Shrink the pool toward initial_size, munmap-ing the excess stacks
+    const auto total_coroutines = total_coroutines_num_.load();
+    const auto target_total_coroutines = std::max(config_.initial_size, peak_active_coroutines);
+    const auto destroy_num = total_coroutines > target_total_coroutines
+                                 ? std::min(total_coroutines - target_total_coroutines, dequeued_num)
+                                 : std::size_t{0};
+    idle_coroutines.erase(idle_coroutines.end() - destroy_num, idle_coroutines.end());
+    total_coroutines_num_ -= destroy_num;
+    reclaimed_coroutines_ += destroy_num;
+
+    // Keep enough warm stacks for the recent load, release the memory of the
+    // rest and put them along with the never used stacks, so that they are
+    // reused last
+    const auto warm_num = std::min(idle_coroutines.size(), peak_active_coroutines);
+    std::size_t reclaimed_bytes = 0;
+    for (auto it = idle_coroutines.begin() + warm_num; it != idle_coroutines.end(); ++it) {
+        reclaimed_bytes += ReleaseStackMemory(*it);
+    }
+    reclaimed_stack_bytes_ += reclaimed_bytes;
+
+    const bool warm_ok = used_coroutines_.enqueue_bulk(
+        GetUsedPoolToken<moodycamel::ProducerToken>(), std::make_move_iterator(idle_coroutines.begin()), warm_num
+    );
+    const bool cold_ok = initial_coroutines_.enqueue_bulk(
+        std::make_move_iterator(idle_coroutines.begin() + warm_num), idle_coroutines.size() - warm_num
+    );
+    // On a failure the coroutines are destroyed along with idle_coroutines
+    const auto returned_num = (warm_ok ? warm_num : 0) + (cold_ok ? idle_coroutines.size() - warm_num : 0);
+    idle_coroutines_num_.fetch_add(returned_num);
+    total_coroutines_num_ -= idle_coroutines.size() - returned_num;
+
+    LOG_DEBUG() << "Reclaimed idle coroutine stacks: destroyed=" << destroy_num
+                << " released_bytes=" << reclaimed_bytes << " active=" << active_coroutines;
+}
+
+std::size_t Pool::ReleaseStackMemory(const Coroutine& coroutine) noexcept {
+    const auto page_size = utils::sys_info::GetPageSize();
+    if (config_.idle_stack_resident_size >= config_.stack_size) return 0;
+
+    // Idle coroutine is suspended in TaskContext::CoroFunc with a few frames at
+    // the top of the stack, everything below them is garbage
+    const auto stack_begin = GetStackBegin(GetCoroCbPtr(coroutine), page_size);
+    const auto release_size = config_.stack_size - config_.idle_stack_resident_size;
+    auto* const stack_end = reinterpret_cast<void*>(stack_begin - config_.stack_size);
+    if (::madvise(stack_end, release_size, MADV_DONTNEED) != 0) return 0;
+    return release_size;
+}
+
 template <typename Token>
 Token& Pool::GetUsedPoolToken() {
     thread_local Token token(used_coroutines_);
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <memory>
 #include <vector>
 
 #include <moodycamel/concurrentqueue.h>
@@ -8,6 +10,7 @@
 #include <engine/coro/marked_allocator.hpp>
 #include <engine/coro/pool_config.hpp>
 #include <engine/coro/pool_stats.hpp>
+#include <engine/coro/stack_region.hpp>
 #include <engine/coro/stack_usage_monitor.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -36,9 +39,19 @@ public:
     void RegisterThread();
     void AccountStackUsage();
 
+    // Returns memory of idle coroutine stacks to the OS and shrinks the pool
+    // once in PoolConfig::idle_stacks_reclaim_interval. Must be called outside
+    // of any coroutine.
+    void TryReclaimIdleStacks();
+
+    // Same as TryReclaimIdleStacks, but without the interval check
+    void ReclaimIdleStacks();
+
 private:
     static PoolConfig FixupConfig(PoolConfig&& config);
 
+    std::size_t ReleaseStackMemory(const Coroutine& coroutine) noexcept;
+
     Coroutine CreateCoroutine(bool quiet = false);
     void OnCoroutineDestruction() noexcept;
 
@@ -61,6 +74,8 @@ private:
     // outside of any coroutine.
     static inline thread_local std::vector<Coroutine> local_coro_buffer_;
 
+    // Must outlive all the coroutines, including the ones in the queues below
+    std::unique_ptr<StackRegion> stack_region_;
     debug::MarkedAllocator stack_allocator_;
     // Some pointers arithmetic in StackUsageMonitor depends on this.
     // If you change the allocator, adjust the math there accordingly.
@@ -78,6 +93,11 @@ private:
 
     std::atomic<std::size_t> idle_coroutines_num_;
     std::atomic<std::size_t> total_coroutines_num_;
+
+    std::atomic<std::chrono::steady_clock::time_point> next_reclaim_time_;
+    std::atomic<std::size_t> last_reclaim_active_coroutines_{0};
+    std::atomic<std::size_t> reclaimed_coroutines_{0};
+    std::atomic<std::size_t> reclaimed_stack_bytes_{0};
 };
 
 class Pool::CoroutinePtr final {
@@ -12,6 +12,11 @@ PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolCo
     config.local_cache_size = value["local_cache_size"].As<size_t>(config.local_cache_size);
     config.is_stack_usage_monitor_enabled =
         value["stack_usage_monitor_enabled"].As<bool>(config.is_stack_usage_monitor_enabled);
+    config.idle_stacks_reclaim_interval =
+        value["idle_stacks_reclaim_interval"].As<std::chrono::milliseconds>(config.idle_stacks_reclaim_interval);
+    config.idle_stack_resident_size =
+        value["idle_stack_resident_size"].As<size_t>(config.idle_stack_resident_size);
+    config.reserve_stacks_region = value["reserve_stacks_region"].As<bool>(config.reserve_stacks_region);
 
     return config;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
@@ -15,6 +16,11 @@ struct PoolConfig {
     std::size_t stack_size = 256 * 1024ULL;
     std::size_t local_cache_size = 8;
     bool is_stack_usage_monitor_enabled = true;
+    // 0 disables returning memory of idle coroutine stacks to the OS
+    std::chrono::milliseconds idle_stacks_reclaim_interval{0};
+    // Bytes at the top of an idle stack that are never returned to the OS
+    std::size_t idle_stack_resident_size = 16 * 1024ULL;
+    bool reserve_stacks_region = false;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolConfig>);
@@ -12,6 +12,9 @@ struct PoolStats {
     size_t total_coroutines = 0;
     std::uint16_t max_stack_usage_pct = 0;
     bool is_stack_usage_monitor_active = false;
+    // Cumulative, see PoolConfig::idle_stacks_reclaim_interval
+    size_t reclaimed_coroutines = 0;
+    size_t reclaimed_stack_bytes = 0;
 };
 
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
@@ -21,6 +24,8 @@ inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
         lhs.max_stack_usage_pct = rhs.max_stack_usage_pct;
     }
     lhs.is_stack_usage_monitor_active |= rhs.is_stack_usage_monitor_active;
+    lhs.reclaimed_coroutines += rhs.reclaimed_coroutines;
+    lhs.reclaimed_stack_bytes += rhs.reclaimed_stack_bytes;
     return lhs;
 }
 
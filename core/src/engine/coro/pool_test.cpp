@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <engine/coro/pool.hpp>
+#include <utils/sys_info.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kStackSize = 256 * 1024;
+constexpr std::size_t kUsedStackSize = 128 * 1024;
+constexpr std::size_t kInitialSize = 2;
+constexpr std::size_t kPeakSize = 6;
+
+std::atomic<std::size_t> executed_count{0};
+
+void UseStack() {
+    volatile char buffer[kUsedStackSize];
+    for (std::size_t i = 0; i < kUsedStackSize; ++i) {
+        buffer[i] = static_cast<char>(i);
+    }
+    for (std::size_t i = 0; i < kUsedStackSize; ++i) {
+        ASSERT_EQ(buffer[i], static_cast<char>(i));
+    }
+}
+
+void Executor(engine::coro::Pool::TaskPipe& task_pipe) {
+    for ([[maybe_unused]] auto* task : task_pipe) {
+        UseStack();
+        ++executed_count;
+    }
+}
+
+engine::coro::PoolConfig MakeConfig() {
+    engine::coro::PoolConfig config;
+    config.initial_size = kInitialSize;
+    config.max_size = kPeakSize;
+    config.stack_size = kStackSize;
+    config.local_cache_size = 0;
+    config.is_stack_usage_monitor_enabled = false;
+    config.idle_stacks_reclaim_interval = std::chrono::milliseconds{1};
+    config.idle_stack_resident_size = 0;
+    return config;
+}
+
+void RunCoroutines(engine::coro::Pool& pool, std::size_t count) {
+    std::vector<engine::coro::Pool::CoroutinePtr> coroutines;
+    for (std::size_t i = 0; i < count; ++i) {
+        coroutines.push_back(pool.GetCoroutine());
+    }
+
+    const auto executed_before = executed_count.load();
+    for (auto& coroutine : coroutines) {
+        coroutine.Get()(nullptr);
+    }
+    EXPECT_EQ(executed_count.load(), executed_before + count);
+
+    for (auto& coroutine : coroutines) {
+        pool.PutCoroutine(std::move(coroutine));
+    }
+}
+
+}  // namespace
+
+TEST(CoroPool, ReclaimIdleStacks) {
+    engine::coro::Pool pool{MakeConfig(), &Executor};
+    RunCoroutines(pool, kPeakSize);
+    EXPECT_EQ(pool.GetStats().total_coroutines, kPeakSize);
+    EXPECT_EQ(pool.GetStats().active_coroutines, 0);
+
+    pool.ReclaimIdleStacks();
+
+    // Idle stacks above initial_size are destroyed, the memory of the rest is
+    // released except for the minimal resident size
+    const auto stats = pool.GetStats();
+    EXPECT_EQ(stats.total_coroutines, kInitialSize);
+    EXPECT_EQ(stats.active_coroutines, 0);
+    EXPECT_EQ(stats.reclaimed_coroutines, kPeakSize - kInitialSize);
+    const auto min_resident_size = std::min(4 * utils::sys_info::GetPageSize(), pool.GetStackSize());
+    EXPECT_EQ(stats.reclaimed_stack_bytes, kInitialSize * (pool.GetStackSize() - min_resident_size));
+
+    // Stacks with released memory are reused and still work
+    RunCoroutines(pool, kInitialSize);
+    EXPECT_EQ(pool.GetStats().total_coroutines, kInitialSize);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,95 @@
+#include <engine/coro/stack_region.hpp>
+
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <new>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/strerror.hpp>
+
+#include <utils/sys_info.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+#if defined(MAP_NORESERVE)
+constexpr int kRegionMapFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#else
+constexpr int kRegionMapFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+#endif
+
+}  // namespace
+
+StackRegion::StackRegion(std::size_t stack_size, std::size_t capacity)
+    : page_size_(utils::sys_info::GetPageSize()),
+      stack_size_(stack_size),
+      slot_size_(stack_size + page_size_),
+      capacity_(capacity),
+      released_slots_(capacity) {
+    UASSERT(stack_size_ % page_size_ == 0);
+    if (capacity_ == 0) return;
+
+    // Reserves the address space only, nothing is accessible until TryAllocate
+    void* region = ::mmap(nullptr, slot_size_ * capacity_, PROT_NONE, kRegionMapFlags, -1, 0);
+    if (region == MAP_FAILED) {
+        const auto saved_errno = errno;
+        LOG_ERROR() << "Failed to reserve " << slot_size_ * capacity_
+                    << " bytes for coroutine stacks: " << utils::strerror(saved_errno);
+        throw std::bad_alloc();
+    }
+    region_ = static_cast<char*>(region);
+}
+
+StackRegion::~StackRegion() {
+    if (region_) ::munmap(region_, slot_size_ * capacity_);
+}
+
+std::optional<boost::context::stack_context> StackRegion::TryAllocate() noexcept {
+    std::size_t index{};
+    if (!released_slots_.try_dequeue(index)) {
+        index = never_used_slot_.load(std::memory_order_relaxed);
+        do {
+            if (index >= capacity_) return std::nullopt;
+        } while (!never_used_slot_.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+
+        // Everything except for the guard page at the bottom
+        if (::mprotect(GetSlot(index) + page_size_, stack_size_, PROT_READ | PROT_WRITE) != 0) {
+            const auto saved_errno = errno;
+            LOG_LIMITED_ERROR() << "Failed to make a coroutine stack accessible: " << utils::strerror(saved_errno)
+                                << "; are you hitting the vm.max_map_count limit?";
+            return std::nullopt;
+        }
+    }
+
+    boost::context::stack_context stack;
+    stack.size = slot_size_;
+    stack.sp = GetSlot(index) + slot_size_;
+    return stack;
+}
+
+bool StackRegion::TryDeallocate(const boost::context::stack_context& stack) noexcept {
+    auto* const slot = static_cast<char*>(stack.sp) - stack.size;
+    if (!region_ || slot < region_ || slot >= region_ + slot_size_ * capacity_) return false;
+
+    UASSERT(stack.size == slot_size_);
+    UASSERT((slot - region_) % slot_size_ == 0);
+
+    // The pages are zero-filled on the next access, no need to mprotect them
+    ::madvise(slot + page_size_, stack_size_, MADV_DONTNEED);
+    released_slots_.enqueue(static_cast<std::size_t>(slot - region_) / slot_size_);
+    return true;
+}
+
+char* StackRegion::GetSlot(std::size_t index) const noexcept {
+    UASSERT(index < capacity_);
+    return region_ + index * slot_size_;
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+#include <moodycamel/concurrentqueue.h>
+#include <boost/context/stack_context.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+// A virtual memory region reserved at once for a fixed number of coroutine
+// stacks. The layout of each stack matches the one of
+// boost::coroutines2::protected_fixedsize_stack: a PROT_NONE guard page
+// followed by `stack_size` bytes of the stack itself.
+//
+// A stack is made accessible with a single mprotect on its first use. Released
+// stacks have their memory returned to the OS with madvise and are reused
+// without any further syscalls.
+class StackRegion final {
+public:
+    // `stack_size` must be a multiple of the page size
+    StackRegion(std::size_t stack_size, std::size_t capacity);
+    ~StackRegion();
+
+    StackRegion(const StackRegion&) = delete;
+    StackRegion& operator=(const StackRegion&) = delete;
+
+    // Returns std::nullopt if the region is exhausted
+    std::optional<boost::context::stack_context> TryAllocate() noexcept;
+
+    // Returns false if the stack does not belong to the region
+    bool TryDeallocate(const boost::context::stack_context& stack) noexcept;
+
+    std::size_t GetCapacity() const noexcept { return capacity_; }
+
+private:
+    char* GetSlot(std::size_t index) const noexcept;
+
+    const std::size_t page_size_;
+    const std::size_t stack_size_;
+    const std::size_t slot_size_;
+    const std::size_t capacity_;
+    char* region_{nullptr};
+
+    std::atomic<std::size_t> never_used_slot_{0};
+    moodycamel::ConcurrentQueue<std::size_t> released_slots_;
+};
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
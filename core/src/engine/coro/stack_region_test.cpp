@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <engine/coro/stack_region.hpp>
+#include <utils/sys_info.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kStackPages = 4;
+
+std::size_t GetStackSize() { return kStackPages * utils::sys_info::GetPageSize(); }
+
+}  // namespace
+
+TEST(StackRegion, AllocateUntilExhausted) {
+    engine::coro::StackRegion region{GetStackSize(), 3};
+    EXPECT_EQ(region.GetCapacity(), 3);
+
+    std::vector<boost::context::stack_context> stacks;
+    for (std::size_t i = 0; i < region.GetCapacity(); ++i) {
+        auto stack = region.TryAllocate();
+        ASSERT_TRUE(stack);
+        EXPECT_EQ(stack->size, GetStackSize() + utils::sys_info::GetPageSize());
+
+        // The whole stack is writable
+        auto* const stack_end = static_cast<char*>(stack->sp) - GetStackSize();
+        std::memset(stack_end, 'x', GetStackSize());
+        stacks.push_back(*stack);
+    }
+    EXPECT_FALSE(region.TryAllocate());
+
+    for (auto& stack : stacks) {
+        EXPECT_TRUE(region.TryDeallocate(stack));
+    }
+}
+
+TEST(StackRegion, ReleasedStacksAreReusedZeroed) {
+    engine::coro::StackRegion region{GetStackSize(), 1};
+
+    auto stack = region.TryAllocate();
+    ASSERT_TRUE(stack);
+    auto* const top_byte = static_cast<char*>(stack->sp) - 1;
+    *top_byte = 'x';
+    EXPECT_TRUE(region.TryDeallocate(*stack));
+
+    auto reused_stack = region.TryAllocate();
+    ASSERT_TRUE(reused_stack);
+    EXPECT_EQ(reused_stack->sp, stack->sp);
+    EXPECT_EQ(*top_byte, '\0');
+    EXPECT_TRUE(region.TryDeallocate(*reused_stack));
+}
+
+TEST(StackRegion, ForeignStack) {
+    engine::coro::StackRegion region{GetStackSize(), 1};
+    engine::coro::StackRegion other_region{GetStackSize(), 1};
+
+    auto stack = other_region.TryAllocate();
+    ASSERT_TRUE(stack);
+    EXPECT_FALSE(region.TryDeallocate(*stack));
+    EXPECT_TRUE(other_region.TryDeallocate(*stack));
+}
+
+USERVER_NAMESPACE_END
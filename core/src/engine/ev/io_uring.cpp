@@ -0,0 +1,472 @@
+#include <engine/ev/io_uring.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#include <userver/engine/single_use_event.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/strerror.hpp>
+
+#include <utils/check_syscall.hpp>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define USERVER_IMPL_IO_URING_SUPPORTED
+#endif
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+// Completions with this key belong to internal requests and are skipped
+constexpr std::uint64_t kIgnoredKey = 0;
+
+// Marks the poll that precedes the operation in the same link
+constexpr std::uint64_t kPollTag = 1;
+
+// Keys of the operations are sequential, with the tag bit free
+constexpr std::uint64_t kKeyStep = 2;
+
+}  // namespace
+
+class IoUring::Operation final {
+public:
+    std::uint64_t GetKey() const noexcept { return key_; }
+
+    void SetKey(std::uint64_t key) noexcept { key_ = key; }
+
+    void Complete(int result) noexcept {
+        result_ = result;
+        event_.Send();
+    }
+
+    [[nodiscard]] FutureStatus WaitUntil(Deadline deadline) { return event_.WaitUntil(deadline); }
+
+    void WaitNonCancellable() noexcept { event_.WaitNonCancellable(); }
+
+    int GetResult() const noexcept { return result_; }
+
+    // Must stay alive until the completion
+    struct msghdr msg {};
+
+private:
+    std::uint64_t key_{kIgnoredKey};
+    int result_{0};
+    engine::SingleUseEvent event_;
+};
+
+#ifdef USERVER_IMPL_IO_URING_SUPPORTED
+
+namespace {
+
+// Each Perform() submits at most 2 entries and Cancel() at most 2 more, the
+// submission queue is always flushed under the lock
+constexpr unsigned kSubmissionQueueSize = 64;
+
+// Pending operations are limited by the number of sockets, completions that
+// do not fit are kept by the kernel (IORING_FEAT_NODROP)
+constexpr unsigned kCompletionQueueSize = 4096;
+
+// Completions are handed to the waiting tasks outside of the lock in batches
+constexpr std::size_t kCompletionsBatchSize = 64;
+
+constexpr std::uint8_t kRequiredOpcodes[] = {
+    IORING_OP_POLL_ADD,
+    IORING_OP_RECV,
+    IORING_OP_SEND,
+    IORING_OP_SENDMSG,
+    IORING_OP_ACCEPT,
+    IORING_OP_ASYNC_CANCEL,
+};
+
+int IoUringSetup(unsigned entries, io_uring_params& params) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned flags) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit, 0, flags, nullptr, 0));
+}
+
+int IoUringRegister(int ring_fd, unsigned opcode, void* arg, unsigned nr_args) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+template <typename T>
+T* AtOffset(void* base, std::uint32_t offset) noexcept {
+    return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+bool AreOpcodesSupported(int ring_fd) {
+    constexpr std::size_t kProbeOps = 256;
+    std::unique_ptr<char[]> storage{new char[sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op)]{}};
+    auto* probe = reinterpret_cast<io_uring_probe*>(storage.get());
+    if (IoUringRegister(ring_fd, IORING_REGISTER_PROBE, probe, kProbeOps) != 0) return false;
+
+    for (const auto opcode : kRequiredOpcodes) {
+        if (opcode > probe->last_op || !(probe->ops[opcode].flags & IO_URING_OP_SUPPORTED)) return false;
+    }
+    return true;
+}
+
+std::uint32_t GetPollEvents(const IoUringRequest& request) noexcept {
+    std::uint32_t events = request.wait_writable ? POLLOUT : POLLIN;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    events = (events << 16) | (events >> 16);
+#endif
+    return events;
+}
+
+std::uint32_t ClampLength(std::size_t len) noexcept {
+    return static_cast<std::uint32_t>(std::min<std::size_t>(len, std::numeric_limits<std::uint32_t>::max()));
+}
+
+}  // namespace
+
+struct IoUring::Impl final {
+    ~Impl() {
+        if (sqes != MAP_FAILED) ::munmap(sqes, sqes_size);
+        if (ring != MAP_FAILED) ::munmap(ring, ring_size);
+        if (ring_fd != -1) ::close(ring_fd);
+    }
+
+    io_uring_sqe& AcquireSqe() {
+        const auto tail = sq_local_tail;
+        const auto head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+        UINVARIANT(tail - head < sq_entries, "io_uring submission queue overflow");
+
+        const auto index = tail & *sq_mask;
+        sq_array[index] = index;
+        ++pending_sqes;
+        sq_local_tail = tail + 1;
+
+        auto& sqe = sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        return sqe;
+    }
+
+    void SubmitPending() {
+        __atomic_store_n(sq_tail, sq_local_tail, __ATOMIC_RELEASE);
+        while (pending_sqes != 0) {
+            const int submitted = IoUringEnter(ring_fd, pending_sqes, 0);
+            if (submitted >= 0) {
+                pending_sqes -= submitted;
+                continue;
+            }
+            if (errno == EAGAIN || errno == EBUSY) {
+                // Too many completions are not reaped yet, flush the kernel backlog
+                IoUringEnter(ring_fd, 0, IORING_ENTER_GETEVENTS);
+                continue;
+            }
+            if (errno != EINTR) {
+                pending_sqes = 0;
+                utils::CheckSyscall(-1, "submitting io_uring requests");
+            }
+        }
+    }
+
+    int ring_fd{-1};
+    unsigned sq_entries{0};
+    unsigned sq_local_tail{0};
+    unsigned pending_sqes{0};
+
+    void* ring{MAP_FAILED};
+    std::size_t ring_size{0};
+    io_uring_sqe* sqes{static_cast<io_uring_sqe*>(MAP_FAILED)};
+    std::size_t sqes_size{0};
+
+    unsigned* sq_head{nullptr};
+    unsigned* sq_tail{nullptr};
+    unsigned* sq_mask{nullptr};
+    unsigned* sq_flags{nullptr};
+    unsigned* sq_array{nullptr};
+
+    unsigned* cq_head{nullptr};
+    unsigned* cq_tail{nullptr};
+    unsigned* cq_mask{nullptr};
+    io_uring_cqe* cqes{nullptr};
+};
+
+std::unique_ptr<IoUring> IoUring::TryCreate(const std::string& thread_name) {
+    auto impl = std::make_unique<Impl>();
+
+    io_uring_params params{};
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = kCompletionQueueSize;
+    impl->ring_fd = IoUringSetup(kSubmissionQueueSize, params);
+    if (impl->ring_fd == -1) {
+        const auto saved_errno = errno;
+        LOG_WARNING() << "io_uring is not available for " << thread_name << ", falling back to libev: "
+                      << utils::strerror(saved_errno);
+        return nullptr;
+    }
+
+    constexpr auto kRequiredFeatures = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP;
+    if ((params.features & kRequiredFeatures) != kRequiredFeatures || !AreOpcodesSupported(impl->ring_fd)) {
+        LOG_WARNING() << "io_uring of the running kernel is too old for " << thread_name << ", falling back to libev";
+        return nullptr;
+    }
+
+    impl->sq_entries = params.sq_entries;
+    impl->ring_size = std::max(
+        params.sq_off.array + params.sq_entries * sizeof(unsigned),
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe)
+    );
+    impl->ring = ::mmap(
+        nullptr, impl->ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, impl->ring_fd, IORING_OFF_SQ_RING
+    );
+    impl->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    impl->sqes = static_cast<io_uring_sqe*>(::mmap(
+        nullptr, impl->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, impl->ring_fd, IORING_OFF_SQES
+    ));
+    if (impl->ring == MAP_FAILED || impl->sqes == MAP_FAILED) {
+        const auto saved_errno = errno;
+        LOG_WARNING() << "Failed to map io_uring queues for " << thread_name << ", falling back to libev: "
+                      << utils::strerror(saved_errno);
+        return nullptr;
+    }
+
+    impl->sq_head = AtOffset<unsigned>(impl->ring, params.sq_off.head);
+    impl->sq_tail = AtOffset<unsigned>(impl->ring, params.sq_off.tail);
+    impl->sq_mask = AtOffset<unsigned>(impl->ring, params.sq_off.ring_mask);
+    impl->sq_flags = AtOffset<unsigned>(impl->ring, params.sq_off.flags);
+    impl->sq_array = AtOffset<unsigned>(impl->ring, params.sq_off.array);
+    impl->cq_head = AtOffset<unsigned>(impl->ring, params.cq_off.head);
+    impl->cq_tail = AtOffset<unsigned>(impl->ring, params.cq_off.tail);
+    impl->cq_mask = AtOffset<unsigned>(impl->ring, params.cq_off.ring_mask);
+    impl->cqes = AtOffset<io_uring_cqe>(impl->ring, params.cq_off.cqes);
+    impl->sq_local_tail = *impl->sq_tail;
+
+    int event_fd = utils::CheckSyscall(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC), "creating an eventfd");
+    // Only completions that were not posted inline during submission need
+    // the ev thread, the submitter reaps the inline ones by itself
+    if (IoUringRegister(impl->ring_fd, IORING_REGISTER_EVENTFD_ASYNC, &event_fd, 1) != 0 &&
+        IoUringRegister(impl->ring_fd, IORING_REGISTER_EVENTFD, &event_fd, 1) != 0) {
+        const auto saved_errno = errno;
+        ::close(event_fd);
+        LOG_WARNING() << "Failed to register an eventfd in io_uring for " << thread_name
+                      << ", falling back to libev: " << utils::strerror(saved_errno);
+        return nullptr;
+    }
+
+    LOG_INFO() << "Using io_uring for socket I/O in " << thread_name;
+    return std::unique_ptr<IoUring>(new IoUring(std::move(impl), event_fd));
+}
+
+IoUring::IoUring(std::unique_ptr<Impl>&& impl, int event_fd) noexcept
+    : impl_(std::move(impl)), event_fd_(event_fd), next_key_(kKeyStep) {}
+
+IoUring::~IoUring() {
+    impl_.reset();
+    ::close(event_fd_);
+}
+
+std::optional<int>
+IoUring::Perform(const IoUringRequest& request, Deadline deadline, std::atomic<std::uint64_t>& in_flight) {
+    Operation operation;
+    const utils::FastScopeGuard reset_in_flight([&in_flight]() noexcept {
+        in_flight.store(kIgnoredKey, std::memory_order_release);
+    });
+
+    Submit(request, operation, in_flight);
+
+    const auto status = operation.WaitUntil(deadline);
+    if (status != FutureStatus::kReady) {
+        Cancel(operation.GetKey());
+        // The kernel may still write into the buffers until the completion
+        operation.WaitNonCancellable();
+    }
+
+    const int result = operation.GetResult();
+    if (status != FutureStatus::kReady && result == -ECANCELED) return std::nullopt;
+    return result;
+}
+
+void IoUring::Cancel(std::uint64_t key) noexcept {
+    if (key == kIgnoredKey) return;
+    try {
+        SubmitCancel(key);
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "Failed to cancel an io_uring operation: " << ex;
+    }
+    ProcessCompletions();
+}
+
+void IoUring::ReapCompletions() noexcept {
+    std::uint64_t counter{0};
+    while (::read(event_fd_, &counter, sizeof(counter)) == -1 && errno == EINTR) {
+    }
+    ProcessCompletions();
+}
+
+void IoUring::Submit(const IoUringRequest& request, Operation& operation, std::atomic<std::uint64_t>& in_flight) {
+    {
+        const std::lock_guard lock(mutex_);
+
+        const auto key = next_key_;
+        next_key_ += kKeyStep;
+        operation.SetKey(key);
+        operations_.emplace(key, &operation);
+        // Published before the submission under the lock, so that a
+        // concurrent Cancel() either finds the submitted operation or does
+        // not see its key at all
+        in_flight.store(key, std::memory_order_release);
+        utils::FastScopeGuard unregister([this, key]() noexcept { operations_.erase(key); });
+
+        auto& poll = impl_->AcquireSqe();
+        poll.opcode = IORING_OP_POLL_ADD;
+        poll.fd = request.fd;
+        poll.poll32_events = GetPollEvents(request);
+        poll.user_data = key;
+
+        if (request.opcode != IoUringOpcode::kPoll) {
+            // The operation is started by the kernel right after the poll fires
+            poll.flags = IOSQE_IO_LINK;
+            poll.user_data = key | kPollTag;
+
+            auto& sqe = impl_->AcquireSqe();
+            sqe.fd = request.fd;
+            sqe.user_data = key;
+            switch (request.opcode) {
+                case IoUringOpcode::kRecv:
+                    sqe.opcode = IORING_OP_RECV;
+                    sqe.addr = reinterpret_cast<std::uintptr_t>(request.buf);
+                    sqe.len = ClampLength(request.len);
+                    break;
+                case IoUringOpcode::kSend:
+                    sqe.opcode = IORING_OP_SEND;
+                    sqe.addr = reinterpret_cast<std::uintptr_t>(request.buf);
+                    sqe.len = ClampLength(request.len);
+                    sqe.msg_flags = MSG_NOSIGNAL;
+                    break;
+                case IoUringOpcode::kSendMsg:
+                    operation.msg.msg_iov = request.iov;
+                    operation.msg.msg_iovlen = request.iov_count;
+                    sqe.opcode = IORING_OP_SENDMSG;
+                    sqe.addr = reinterpret_cast<std::uintptr_t>(&operation.msg);
+                    sqe.len = 1;
+                    sqe.msg_flags = MSG_NOSIGNAL;
+                    break;
+                case IoUringOpcode::kAccept:
+                    sqe.opcode = IORING_OP_ACCEPT;
+                    sqe.addr = reinterpret_cast<std::uintptr_t>(request.addr);
+                    sqe.addr2 = reinterpret_cast<std::uintptr_t>(request.addr_len);
+                    sqe.accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+                    break;
+                case IoUringOpcode::kPoll:
+                    UINVARIANT(false, "Unexpected io_uring opcode");
+            }
+        }
+
+        impl_->SubmitPending();
+        unregister.Release();
+    }
+
+    // The socket might have been ready already
+    ProcessCompletions();
+}
+
+void IoUring::SubmitCancel(std::uint64_t key) {
+    const std::lock_guard lock(mutex_);
+    // The operation is completed, its key is never reused
+    if (operations_.find(key) == operations_.end()) return;
+
+    // Cancelling the poll cancels the whole link, the operation itself is
+    // cancelled in case the poll has already fired
+    for (const auto target : {key | kPollTag, key}) {
+        auto& sqe = impl_->AcquireSqe();
+        sqe.opcode = IORING_OP_ASYNC_CANCEL;
+        sqe.fd = -1;
+        sqe.addr = target;
+        sqe.user_data = kIgnoredKey;
+    }
+
+    impl_->SubmitPending();
+}
+
+void IoUring::ProcessCompletions() noexcept {
+    struct Completion {
+        Operation* operation;
+        int result;
+    };
+    std::array<Completion, kCompletionsBatchSize> completions{};
+
+    while (true) {
+        std::size_t count = 0;
+        {
+            const std::lock_guard lock(mutex_);
+
+            auto head = *impl_->cq_head;
+            const auto tail = __atomic_load_n(impl_->cq_tail, __ATOMIC_ACQUIRE);
+            for (; head != tail && count < completions.size(); ++head) {
+                const auto& cqe = impl_->cqes[head & *impl_->cq_mask];
+                if (cqe.user_data == kIgnoredKey || (cqe.user_data & kPollTag)) continue;
+                const auto it = operations_.find(cqe.user_data);
+                if (it == operations_.end()) continue;
+                completions[count++] = {it->second, cqe.res};
+                operations_.erase(it);
+            }
+            __atomic_store_n(impl_->cq_head, head, __ATOMIC_RELEASE);
+
+            if (count == 0) {
+                if (!(__atomic_load_n(impl_->sq_flags, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW)) return;
+                // Move the completions kept by the kernel into the queue
+                IoUringEnter(impl_->ring_fd, 0, IORING_ENTER_GETEVENTS);
+                continue;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            completions[i].operation->Complete(completions[i].result);
+        }
+    }
+}
+
+#else  // USERVER_IMPL_IO_URING_SUPPORTED
+
+struct IoUring::Impl final {};
+
+std::unique_ptr<IoUring> IoUring::TryCreate(const std::string& thread_name) {
+    LOG_WARNING() << "io_uring is not supported on this platform, " << thread_name << " falls back to libev";
+    return nullptr;
+}
+
+IoUring::IoUring(std::unique_ptr<Impl>&& impl, int event_fd) noexcept
+    : impl_(std::move(impl)), event_fd_(event_fd), next_key_(kKeyStep) {}
+
+IoUring::~IoUring() = default;
+
+std::optional<int> IoUring::Perform(const IoUringRequest&, Deadline, std::atomic<std::uint64_t>&) {
+    UINVARIANT(false, "io_uring is not supported on this platform");
+    return std::nullopt;
+}
+
+void IoUring::Cancel(std::uint64_t) noexcept {}
+
+void IoUring::ReapCompletions() noexcept {}
+
+void IoUring::Submit(const IoUringRequest&, Operation&, std::atomic<std::uint64_t>&) {}
+
+void IoUring::SubmitCancel(std::uint64_t) {}
+
+void IoUring::ProcessCompletions() noexcept {}
+
+#endif  // USERVER_IMPL_IO_URING_SUPPORTED
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+/// Backend that waits for socket I/O on ev threads
+enum class IoBackend {
+    kLibev,    ///< readiness notifications from the libev loop
+    kIoUring,  ///< completion-based io_uring, falls back to libev if unsupported
+};
+
+enum class IoUringOpcode {
+    kPoll,     ///< wait for readiness only, e.g. for connect()
+    kRecv,     ///< recv(2) into `buf`
+    kSend,     ///< send(2) from `buf` with MSG_NOSIGNAL
+    kSendMsg,  ///< sendmsg(2) of `iov` with MSG_NOSIGNAL
+    kAccept,   ///< accept4(2) with SOCK_NONBLOCK | SOCK_CLOEXEC into `addr`
+};
+
+/// Description of an operation on a nonblocking socket. The referenced
+/// buffers must outlive the IoUring::Perform call.
+struct IoUringRequest final {
+    IoUringOpcode opcode{IoUringOpcode::kPoll};
+    int fd{-1};
+    bool wait_writable{false};
+
+    void* buf{nullptr};
+    std::size_t len{0};
+
+    struct iovec* iov{nullptr};
+    std::size_t iov_count{0};
+
+    struct sockaddr* addr{nullptr};
+    socklen_t* addr_len{nullptr};
+};
+
+/// @brief An io_uring instance owned by an ev thread.
+///
+/// Each operation is submitted as a poll of the socket linked with the
+/// operation itself, so the kernel performs the syscall as soon as the socket
+/// becomes ready and the waiting task gets the result with a single wakeup.
+/// Completions are reaped by the submitting thread right after submission and
+/// by the ev thread, that is notified through an eventfd.
+///
+/// Uses the raw kernel interface, liburing is not required.
+class IoUring final {
+public:
+    /// Returns nullptr if io_uring is not available, e.g. the kernel is too
+    /// old or the syscalls are forbidden by seccomp
+    static std::unique_ptr<IoUring> TryCreate(const std::string& thread_name);
+
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    /// eventfd that becomes readable when there are completions to reap
+    int GetEventFd() const noexcept { return event_fd_; }
+
+    /// @brief Submits the request and waits for its completion.
+    ///
+    /// Returns the operation result (>= 0) or a negated errno value. Returns
+    /// std::nullopt if the deadline expired or the task was cancelled before
+    /// the operation could be performed; the request is cancelled in the
+    /// kernel and is guaranteed not to touch the buffers afterwards.
+    ///
+    /// `in_flight` holds the key of the submitted operation while it is
+    /// pending, it may be passed to Cancel from other threads. The keys are
+    /// never reused, so a stale key does not cancel a newer operation.
+    std::optional<int> Perform(const IoUringRequest& request, Deadline deadline, std::atomic<std::uint64_t>& in_flight);
+
+    /// Requests cancellation of a pending operation, does not wait for it.
+    /// Does nothing if the operation is already completed.
+    void Cancel(std::uint64_t key) noexcept;
+
+    /// Drains the eventfd and processes all the available completions
+    void ReapCompletions() noexcept;
+
+private:
+    struct Impl;
+    class Operation;
+
+    IoUring(std::unique_ptr<Impl>&& impl, int event_fd) noexcept;
+
+    void Submit(const IoUringRequest& request, Operation& operation, std::atomic<std::uint64_t>& in_flight);
+    void SubmitCancel(std::uint64_t key);
+    void ProcessCompletions() noexcept;
+
+    std::unique_ptr<Impl> impl_;
+    const int event_fd_;
+    std::mutex mutex_;
+    // Protected by mutex_
+    std::uint64_t next_key_;
+    std::unordered_map<std::uint64_t, Operation*> operations_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
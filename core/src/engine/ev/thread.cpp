@@ -27,13 +27,17 @@ const auto kCpuStatsThrottle = static_cast<std::size_t>(kCpuStatsCollectInterval
 
 }  // namespace
 
-Thread::Thread(const std::string& thread_name) : Thread(thread_name, EventLoop::EvLoopType::kNewLoop) {}
+Thread::Thread(const std::string& thread_name, IoBackend io_backend)
+    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop, io_backend) {}
 
-Thread::Thread(const std::string& thread_name, UseDefaultEvLoop)
-    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop) {}
+Thread::Thread(const std::string& thread_name, UseDefaultEvLoop, IoBackend io_backend)
+    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop, io_backend) {}
 
-Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type)
-    : event_loop_(ev_loop_type), name_{thread_name}, cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
+Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, IoBackend io_backend)
+    : event_loop_(ev_loop_type),
+      io_uring_(io_backend == IoBackend::kIoUring ? IoUring::TryCreate(thread_name) : nullptr),
+      name_{thread_name},
+      cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
     UASSERT_MSG(kDeferredInterval > std::chrono::milliseconds{4}, "Timer events would happen too often");
     Start();
 }
@@ -109,6 +113,12 @@ void Thread::Start() {
     ev_timer_init(&defer_timer_, UpdateTimersWatcher, 0.0, defer_duration.count());
     ev_timer_start(loop, &defer_timer_);
 
+    if (io_uring_) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+        ev_io_init(&watch_io_uring_, IoUringWatcher, io_uring_->GetEventFd(), EV_READ);
+        ev_io_start(loop, &watch_io_uring_);
+    }
+
     is_running_ = true;
     thread_ = std::thread([this] {
         utils::SetCurrentThreadName(name_);
@@ -137,6 +147,7 @@ void Thread::RunEvLoop() {
     ev_async_stop(GetEvLoop(), &watch_update_);
     ev_async_stop(GetEvLoop(), &watch_break_);
     ev_timer_stop(GetEvLoop(), &defer_timer_);
+    if (io_uring_) ev_io_stop(GetEvLoop(), &watch_io_uring_);
 }
 
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -174,6 +185,12 @@ void Thread::BreakLoopWatcherImpl() {
     ev_break(GetEvLoop(), EVBREAK_ALL);
 }
 
+void Thread::IoUringWatcher(struct ev_loop* loop, ev_io*, int) noexcept {
+    auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+    UASSERT(ev_thread != nullptr && ev_thread->io_uring_);
+    ev_thread->io_uring_->ReapCompletions();
+}
+
 void Thread::Acquire(struct ev_loop* loop) noexcept {
     auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
     UASSERT(ev_thread != nullptr);
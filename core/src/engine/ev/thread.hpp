@@ -12,6 +12,7 @@
 
 #include <engine/ev/async_payload_base.hpp>
 #include <engine/ev/event_loop.hpp>
+#include <engine/ev/io_uring.hpp>
 #include <userver/concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
@@ -27,8 +28,8 @@ public:
     struct UseDefaultEvLoop {};
     static constexpr UseDefaultEvLoop kUseDefaultEvLoop{};
 
-    explicit Thread(const std::string& thread_name);
-    Thread(const std::string& thread_name, UseDefaultEvLoop);
+    explicit Thread(const std::string& thread_name, IoBackend io_backend = IoBackend::kLibev);
+    Thread(const std::string& thread_name, UseDefaultEvLoop, IoBackend io_backend = IoBackend::kLibev);
 
     ~Thread();
 
@@ -45,11 +46,14 @@ public:
 
     bool IsInEvThread() const;
 
+    // nullptr unless the io_uring backend is enabled and supported
+    IoUring* GetIoUring() const noexcept { return io_uring_.get(); }
+
     std::uint8_t GetCurrentLoadPercent() const;
     const std::string& GetName() const;
 
 private:
-    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type);
+    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, IoBackend io_backend);
 
     void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -63,6 +67,7 @@ private:
     void UpdateLoopWatcherImpl();
     static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
     void BreakLoopWatcherImpl();
+    static void IoUringWatcher(struct ev_loop*, ev_io* w, int) noexcept;
 
     static void Acquire(struct ev_loop* loop) noexcept;
     static void Release(struct ev_loop* loop) noexcept;
@@ -80,6 +85,9 @@ private:
     ev_timer defer_timer_{};
     ev_async watch_update_{};
     ev_async watch_break_{};
+    ev_io watch_io_uring_{};
+
+    std::unique_ptr<IoUring> io_uring_;
 
     const std::string name_;
     utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
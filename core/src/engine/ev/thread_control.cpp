@@ -11,6 +11,8 @@ ThreadControlBase::ThreadControlBase(Thread& thread) noexcept : thread_{thread}
 
 struct ev_loop* ThreadControlBase::GetEvLoop() const noexcept { return thread_.GetEvLoop(); }
 
+IoUring* ThreadControlBase::GetIoUring() const noexcept { return thread_.GetIoUring(); }
+
 void ThreadControlBase::RunPayloadInEvLoopAsync(AsyncPayloadBase& payload) noexcept {
     thread_.RunInEvLoopAsync(payload);
 }
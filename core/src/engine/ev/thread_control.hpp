@@ -112,11 +112,15 @@ private:
 }  // namespace impl
 
 class Thread;
+class IoUring;
 
 class ThreadControlBase {
 public:
     struct ev_loop* GetEvLoop() const noexcept;
 
+    /// Returns nullptr unless the ev thread uses the io_uring backend
+    IoUring* GetIoUring() const noexcept;
+
     /// Fast non allocating function to execute a `func(*data)` in EvLoop.
     void RunPayloadInEvLoopAsync(AsyncPayloadBase& payload) noexcept;
 
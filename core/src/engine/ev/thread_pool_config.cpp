@@ -1,13 +1,24 @@
 #include "thread_pool_config.hpp"
 
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+IoBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<IoBackend>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector().Case(IoBackend::kLibev, "libev").Case(IoBackend::kIoUring, "io_uring");
+    });
+
+    return utils::ParseFromValueString(value, kMap);
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>) {
     ThreadPoolConfig config;
     config.threads = value["threads"].As<std::size_t>(config.threads);
     config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
+    config.io_backend = value["io_backend"].As<IoBackend>(config.io_backend);
     return config;
 }
 
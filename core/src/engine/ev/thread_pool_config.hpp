@@ -5,6 +5,8 @@
 #include <userver/formats/yaml.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include <engine/ev/io_uring.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
@@ -13,8 +15,11 @@ struct ThreadPoolConfig {
     std::size_t threads = 2;
     std::string thread_name = "event-worker";
     bool ev_default_loop_disabled = false;
+    IoBackend io_backend = IoBackend::kLibev;
 };
 
+IoBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<IoBackend>);
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>);
 
 }  // namespace engine::ev
@@ -26,6 +26,7 @@ std::shared_ptr<TaskProcessorPools> MakeTaskProcessorPools(const TaskProcessorPo
     ev_config.threads = pools_config.ev_threads_num;
     ev_config.thread_name = pools_config.ev_thread_name;
     ev_config.ev_default_loop_disabled = pools_config.ev_default_loop_disabled;
+    ev_config.io_backend = pools_config.ev_io_uring_enabled ? ev::IoBackend::kIoUring : ev::IoBackend::kLibev;
 
     return std::make_shared<TaskProcessorPools>(std::move(coro_config), std::move(ev_config));
 }
@@ -11,6 +11,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <engine/ev/thread_control.hpp>
 #include <engine/task/task_context.hpp>
 #include <utils/check_syscall.hpp>
 
@@ -59,6 +60,32 @@ Direction::SingleUserGuard::SingleUserGuard(Direction& dir) : dir_(dir) { dir_.p
 Direction::SingleUserGuard::~SingleUserGuard() { dir_.poller_.SwitchStateToReadyToUse(); }
 #endif  // #ifndef NDEBUG
 
+Direction::Direction(const ev::ThreadControl& control) : poller_(control), io_uring_(control.GetIoUring()) {}
+
+bool Direction::Wait(Deadline deadline) {
+    if (io_uring_) {
+        ev::IoUringRequest request;
+        request.fd = Fd();
+        request.wait_writable = (kind_ == Kind::kWrite);
+        return PerformOnIoUring(request, deadline).has_value();
+    }
+    return poller_.Wait(deadline).has_value();
+}
+
+void Direction::WakeupWaiters() {
+    poller_.WakeupWaiters();
+    if (io_uring_) io_uring_->Cancel(io_uring_operation_.load(std::memory_order_acquire));
+}
+
+ssize_t Direction::TakeCompletedResult(std::optional<int>& completed) noexcept {
+    UASSERT(completed);
+    const auto result = *std::exchange(completed, std::nullopt);
+    if (result >= 0) return result;
+
+    errno = -result;
+    return -1;
+}
+
 // Write operations on socket usually do not block, so it makes sense to reuse
 // the same ThreadControl for the sake of better balancing of ev threads.
 FdControl::FdControl(const ev::ThreadControl& control) : read_(control), write_(control) {}
@@ -3,6 +3,9 @@
 #include <sys/uio.h>
 #include <atomic>
 #include <cerrno>
+#include <cstdint>
+#include <optional>
+#include <utility>
 
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/fd_control_holder.hpp>
@@ -11,7 +14,9 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/meta_light.hpp>
 
+#include <engine/ev/io_uring.hpp>
 #include <engine/task/task_context.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 
@@ -43,6 +48,18 @@ enum class ErrorMode {
 
 class FdControl;
 
+template <typename IoFunc, typename... Args>
+using IoUringRequestFactory = decltype(std::declval<const IoFunc&>().MakeIoUringRequest(std::declval<Args>()...));
+
+/// IoFunc passed to Direction::PerformIo may provide a
+/// `ev::IoUringRequest MakeIoUringRequest(int fd, void* buf, size_t len) const`
+/// member (`(int fd, struct iovec* list, size_t list_size)` for PerformIoV).
+/// When the ev thread uses the io_uring backend such operations are completed
+/// by the kernel instead of being retried on readiness.
+template <typename IoFunc, typename... Args>
+inline constexpr bool kHasIoUringRequest =
+    meta::IsDetected<IoUringRequestFactory, std::decay_t<IoFunc>, int, Args...>;
+
 class Direction final {
 public:
     using Kind = FdPoller::Kind;
@@ -72,7 +89,7 @@ public:
 
     int Fd() const noexcept { return poller_.GetFd(); }
 
-    [[nodiscard]] bool Wait(Deadline deadline) { return poller_.Wait(deadline).has_value(); }
+    [[nodiscard]] bool Wait(Deadline deadline);
 
     void ResetReady() noexcept { poller_.ResetReady(); }
 
@@ -101,22 +118,47 @@ public:
 
     engine::impl::ContextAccessor* TryGetContextAccessor() noexcept { return poller_.TryGetContextAccessor(); }
 
+    /// Whether the operations may be completed by io_uring
+    bool HasIoUring() const noexcept { return io_uring_ != nullptr; }
+
+    /// Completes the request with io_uring, see ev::IoUring::Perform
+    std::optional<int> PerformOnIoUring(const ev::IoUringRequest& request, Deadline deadline) {
+        UASSERT(io_uring_);
+        return io_uring_->Perform(request, deadline, io_uring_operation_);
+    }
+
 private:
     friend class FdControl;
-    explicit Direction(const ev::ThreadControl& control) : poller_(control) {}
+    explicit Direction(const ev::ThreadControl& control);
 
-    void Reset(int fd, Kind kind) { poller_.Reset(fd, kind); }
+    void Reset(int fd, Kind kind) {
+        poller_.Reset(fd, kind);
+        kind_ = kind;
+    }
 
-    void WakeupWaiters() { poller_.WakeupWaiters(); }
+    void WakeupWaiters();
 
     // does not notify
     void Invalidate() { poller_.Invalidate(); }
 
-    template <typename... Context>
-    ErrorMode
-    TryHandleError(int error_code, size_t processed_bytes, TransferMode mode, Deadline deadline, Context&... context);
+    template <typename WaitFunc, typename... Context>
+    ErrorMode TryHandleError(
+        int error_code,
+        size_t processed_bytes,
+        TransferMode mode,
+        Deadline deadline,
+        WaitFunc& wait,
+        Context&... context
+    );
+
+    // Result of an operation completed by io_uring is reported the same way
+    // as IoFunc does: -1 and errno
+    static ssize_t TakeCompletedResult(std::optional<int>& completed) noexcept;
 
     FdPoller poller_;
+    ev::IoUring* const io_uring_;
+    std::atomic<std::uint64_t> io_uring_operation_{0};
+    Kind kind_{Kind::kRead};
 };
 
 class FdControl final {
@@ -151,12 +193,13 @@ private:
     Direction write_;
 };
 
-template <typename... Context>
+template <typename WaitFunc, typename... Context>
 ErrorMode Direction::TryHandleError(
     int error_code,
     size_t processed_bytes,
     TransferMode mode,
     Deadline deadline,
+    WaitFunc& wait,
     Context&... context
 ) {
     if (error_code == EINTR) {
@@ -173,7 +216,7 @@ ErrorMode Direction::TryHandleError(
         if (current_task::ShouldCancel()) {
             throw(IoCancelled(/*bytes_transferred =*/processed_bytes) << ... << context);
         }
-        if (!poller_.Wait(deadline)) {
+        if (!wait(deadline)) {
             if (current_task::ShouldCancel()) {
                 throw(IoCancelled(/*bytes_transferred =*/processed_bytes) << ... << context);
             } else {
@@ -214,8 +257,18 @@ size_t Direction::PerformIoV(
     UASSERT(list_size > 0);
     UASSERT(list_size <= IOV_MAX);
     std::size_t processed_bytes = 0;
+    std::optional<int> completed;
+    const auto wait = [&](Deadline wait_deadline) {
+        if constexpr (kHasIoUringRequest<IoFunc, struct iovec*, std::size_t>) {
+            if (io_uring_) {
+                completed = PerformOnIoUring(io_func.MakeIoUringRequest(Fd(), list, list_size), wait_deadline);
+                return completed.has_value();
+            }
+        }
+        return poller_.Wait(wait_deadline).has_value();
+    };
     do {
-        auto chunk_size = io_func(Fd(), list, list_size);
+        auto chunk_size = completed ? TakeCompletedResult(completed) : io_func(Fd(), list, list_size);
 
         if (chunk_size > 0) {
             processed_bytes += chunk_size;
@@ -236,7 +289,8 @@ size_t Direction::PerformIoV(
                     break;
                 }
             }
-        } else if (!chunk_size || TryHandleError(errno, processed_bytes, mode, deadline, context...) == ErrorMode::kFatal) {
+        } else if (!chunk_size ||
+                   TryHandleError(errno, processed_bytes, mode, deadline, wait, context...) == ErrorMode::kFatal) {
             break;
         }
     } while (list_size != 0);
@@ -258,15 +312,27 @@ size_t Direction::PerformIo(
 
     char* pos = begin;
 
+    std::optional<int> completed;
+    const auto wait = [&](Deadline wait_deadline) {
+        if constexpr (kHasIoUringRequest<IoFunc, void*, size_t>) {
+            if (io_uring_) {
+                completed = PerformOnIoUring(io_func.MakeIoUringRequest(Fd(), pos, end - pos), wait_deadline);
+                return completed.has_value();
+            }
+        }
+        return poller_.Wait(wait_deadline).has_value();
+    };
+
     while (pos < end) {
-        auto chunk_size = io_func(Fd(), pos, end - pos);
+        auto chunk_size = completed ? TakeCompletedResult(completed) : io_func(Fd(), pos, end - pos);
 
         if (chunk_size > 0) {
             pos += chunk_size;
             if (mode == TransferMode::kOnce) {
                 break;
             }
-        } else if (!chunk_size || TryHandleError(errno, pos - begin, mode, deadline, context...) == ErrorMode::kFatal) {
+        } else if (!chunk_size ||
+                   TryHandleError(errno, pos - begin, mode, deadline, wait, context...) == ErrorMode::kFatal) {
             break;
         }
     }
@@ -3,6 +3,7 @@
 #include <unistd.h>
 
 #include <userver/engine/run_standalone.hpp>
+#include <userver/utils/function_ref.hpp>
 #include <utils/check_syscall.hpp>
 
 #include "fd_control.hpp"
@@ -30,10 +31,17 @@ namespace io = engine::io;
 using Deadline = engine::Deadline;
 using FdControl = io::impl::FdControl;
 
+// state.range(0) selects the I/O backend: 0 - libev, 1 - io_uring
+void RunStandaloneWithBackend(benchmark::State& state, utils::function_ref<void()> payload) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_io_uring_enabled = state.range(0) != 0;
+    engine::RunStandalone(1, config, payload);
+}
+
 }  // namespace
 
 void fd_control_destroy(benchmark::State& state) {
-    engine::RunStandalone([&]() {
+    RunStandaloneWithBackend(state, [&] {
         for ([[maybe_unused]] auto _ : state) {
             state.PauseTiming();
             Pipe pipe;
@@ -45,10 +53,10 @@ void fd_control_destroy(benchmark::State& state) {
         }
     });
 }
-BENCHMARK(fd_control_destroy);
+BENCHMARK(fd_control_destroy)->Arg(0)->Arg(1)->ArgName("io_uring");
 
 void fd_control_close_destroy(benchmark::State& state) {
-    engine::RunStandalone([&] {
+    RunStandaloneWithBackend(state, [&] {
         for ([[maybe_unused]] auto _ : state) {
             state.PauseTiming();
             Pipe pipe;
@@ -61,10 +69,10 @@ void fd_control_close_destroy(benchmark::State& state) {
         }
     });
 }
-BENCHMARK(fd_control_close_destroy);
+BENCHMARK(fd_control_close_destroy)->Arg(0)->Arg(1)->ArgName("io_uring");
 
 void fd_control_wait_destroy(benchmark::State& state) {
-    engine::RunStandalone([&] {
+    RunStandaloneWithBackend(state, [&] {
         for ([[maybe_unused]] auto _ : state) {
             state.PauseTiming();
             Pipe pipe;
@@ -77,10 +85,10 @@ void fd_control_wait_destroy(benchmark::State& state) {
         }
     });
 }
-BENCHMARK(fd_control_wait_destroy);
+BENCHMARK(fd_control_wait_destroy)->Arg(0)->Arg(1)->ArgName("io_uring");
 
 void fd_control_construct_wait_destroy(benchmark::State& state) {
-    engine::RunStandalone([&] {
+    RunStandaloneWithBackend(state, [&] {
         for ([[maybe_unused]] auto _ : state) {
             state.PauseTiming();
             Pipe pipe;
@@ -92,6 +100,6 @@ void fd_control_construct_wait_destroy(benchmark::State& state) {
         }
     });
 }
-BENCHMARK(fd_control_construct_wait_destroy);
+BENCHMARK(fd_control_construct_wait_destroy)->Arg(0)->Arg(1)->ArgName("io_uring");
 
 USERVER_NAMESPACE_END
@@ -4,7 +4,12 @@
 #include <sys/socket.h>
 #include <sys/uio.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <string>
 #include <vector>
@@ -61,20 +66,59 @@ Sockaddr& MemoizeAddr(
 
 // IoFunc wrappers for Direction::PerformIo
 
-[[nodiscard]] ssize_t RecvWrapper(int fd, void* buf, size_t len) { return ::recv(fd, buf, len, 0); }
+struct RecvWrapper {
+    [[nodiscard]] ssize_t operator()(int fd, void* buf, size_t len) const { return ::recv(fd, buf, len, 0); }
 
-[[nodiscard]] ssize_t SendWrapper(int fd, const void* buf, size_t len) {
-    return ::send(
-        fd,
-        buf,
-        len,
+    ev::IoUringRequest MakeIoUringRequest(int fd, void* buf, size_t len) const {
+        ev::IoUringRequest request;
+        request.opcode = ev::IoUringOpcode::kRecv;
+        request.fd = fd;
+        request.buf = buf;
+        request.len = len;
+        return request;
+    }
+};
+
+struct SendWrapper {
+    [[nodiscard]] ssize_t operator()(int fd, const void* buf, size_t len) const {
+        return ::send(
+            fd,
+            buf,
+            len,
 // MAC_COMPAT: does not support MSG_NOSIGNAL
 #ifdef MSG_NOSIGNAL
-        MSG_NOSIGNAL |
+            MSG_NOSIGNAL |
 #endif
-            0
-    );
-}
+                0
+        );
+    }
+
+    ev::IoUringRequest MakeIoUringRequest(int fd, void* buf, size_t len) const {
+        ev::IoUringRequest request;
+        request.opcode = ev::IoUringOpcode::kSend;
+        request.fd = fd;
+        request.wait_writable = true;
+        request.buf = buf;
+        request.len = len;
+        return request;
+    }
+};
+
+struct WritevWrapper {
+    [[nodiscard]] ssize_t operator()(int fd, const struct iovec* list, std::size_t list_size) const {
+        return ::writev(fd, list, static_cast<int>(list_size));
+    }
+
+    ev::IoUringRequest MakeIoUringRequest(int fd, struct iovec* list, std::size_t list_size) const {
+        ev::IoUringRequest request;
+        request.opcode = ev::IoUringOpcode::kSendMsg;
+        request.fd = fd;
+        request.wait_writable = true;
+        request.iov = list;
+        request.iov_count = list_size;
+        return request;
+    }
+};
 
 class RecvFromWrapper {
 public:
@@ -243,7 +287,7 @@ size_t Socket::RecvSome(void* buf, size_t len, Deadline deadline) {
     dir.ResetReady();
     impl::Direction::SingleUserGuard guard(dir);
     return dir.PerformIo(
-        guard, &RecvWrapper, buf, len, impl::TransferMode::kOnce, deadline, "RecvSome from ", peername_
+        guard, RecvWrapper{}, buf, len, impl::TransferMode::kOnce, deadline, "RecvSome from ", peername_
     );
 }
 
@@ -255,7 +299,7 @@ size_t Socket::RecvAll(void* buf, size_t len, Deadline deadline) {
     dir.ResetReady();
     impl::Direction::SingleUserGuard guard(dir);
     return dir.PerformIo(
-        guard, &RecvWrapper, buf, len, impl::TransferMode::kWhole, deadline, "RecvAll from ", peername_
+        guard, RecvWrapper{}, buf, len, impl::TransferMode::kWhole, deadline, "RecvAll from ", peername_
     );
 }
 
@@ -266,7 +310,7 @@ std::optional<size_t> Socket::RecvNoblock(void* buf, size_t len) {
     auto& dir = fd_control_->Read();
     dir.ResetReady();
     const impl::Direction::SingleUserGuard guard(dir);
-    const auto bytesRead = RecvWrapper(fd_control_->Fd(), buf, len);
+    const auto bytesRead = RecvWrapper{}(fd_control_->Fd(), buf, len);
     if (bytesRead >= 0)
         return {bytesRead};
     else if (
@@ -311,7 +355,7 @@ size_t Socket::SendAll(const struct iovec* list, std::size_t list_size, Deadline
     impl::Direction::SingleUserGuard guard(dir);
     return dir.PerformIoV(
         guard,
-        &writev,
+        WritevWrapper{},
         const_cast<struct iovec*>(list),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
         list_size,
         impl::TransferMode::kWhole,
@@ -330,7 +374,7 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
     impl::Direction::SingleUserGuard guard(dir);
     return dir.PerformIo(
         guard,
-        &SendWrapper,
+        SendWrapper{},
         const_cast<void*>(buf),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
         len,
         impl::TransferMode::kWhole,
@@ -340,6 +384,61 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
     );
 }
 
+size_t Socket::SendFile(int file_fd, size_t offset, size_t len, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendFile to closed socket");
+    }
+#ifdef __linux__
+    auto& dir = fd_control_->Write();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+
+    size_t sent = 0;
+    while (sent < len) {
+        auto file_offset = static_cast<off_t>(offset + sent);
+        const auto result = ::sendfile(Fd(), file_fd, &file_offset, len - sent);
+        if (result > 0) {
+            sent += result;
+            continue;
+        }
+        if (result == 0) break;  // the file is shorter than expected
+
+        const auto error_code = errno;
+        if (error_code == EINTR) continue;
+        if (error_code != EAGAIN && error_code != EWOULDBLOCK) {
+            throw IoSystemError(error_code, "Socket::SendFile")
+                << "Error while SendFile to " << peername_ << ", fd=" << Fd();
+        }
+        if (current_task::ShouldCancel()) {
+            throw IoCancelled(sent) << "SendFile to " << peername_;
+        }
+        if (!dir.Wait(deadline)) {
+            if (current_task::ShouldCancel()) {
+                throw IoCancelled(sent) << "SendFile to " << peername_;
+            }
+            throw IoTimeout(sent) << "SendFile to " << peername_;
+        }
+    }
+    return sent;
+#else
+    // MAC_COMPAT: sendfile has a different signature, copy via the userspace
+    std::array<char, 64 * 1024> buffer{};
+    size_t sent = 0;
+    while (sent < len) {
+        const auto read = ::pread(file_fd, buffer.data(), std::min(buffer.size(), len - sent), offset + sent);
+        if (read == 0) break;
+        if (read < 0) {
+            if (errno == EINTR) continue;
+            throw IoSystemError(errno, "Socket::SendFile") << "Error while reading the file, fd=" << file_fd;
+        }
+        const auto chunk_sent = SendAll(buffer.data(), read, deadline);
+        sent += chunk_sent;
+        if (chunk_sent != static_cast<size_t>(read)) break;
+    }
+    return sent;
+#endif
+}
+
 Socket::RecvFromResult Socket::RecvSomeFrom(void* buf, size_t len, Deadline deadline) {
     if (!IsValid()) {
         throw IoException("Attempt to RecvSomeFrom via closed socket");
@@ -391,16 +490,27 @@ Socket Socket::Accept(Deadline deadline) {
     auto& dir = fd_control_->Read();
     dir.ResetReady();
     const impl::Direction::SingleUserGuard guard(dir);
+    // Connection accepted by io_uring while waiting
+    std::optional<int> accepted;
+    Sockaddr buf;
     for (;;) {
-        Sockaddr buf;
+        int fd = -1;
         auto len = buf.Capacity();
-
+        if (accepted) {
+            fd = *std::exchange(accepted, std::nullopt);
+            if (fd < 0) {
+                errno = -fd;
+                fd = -1;
+            }
+        } else {
+            buf = Sockaddr{};
 // MAC_COMPAT: no accept4
 #ifdef HAVE_ACCEPT4
-        const int fd = ::accept4(dir.Fd(), buf.Data(), &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            fd = ::accept4(dir.Fd(), buf.Data(), &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
 #else
-        const int fd = ::accept(dir.Fd(), buf.Data(), &len);
+            fd = ::accept(dir.Fd(), buf.Data(), &len);
 #endif
+        }
 
         UASSERT(len <= buf.Capacity());
         if (fd != -1) {
@@ -414,13 +524,26 @@ Socket Socket::Accept(Deadline deadline) {
 #if EAGAIN != EWOULDBLOCK
             case EWOULDBLOCK:
 #endif
-                if (!WaitReadable(deadline)) {
-                    if (current_task::ShouldCancel()) {
-                        throw IoCancelled() << "Accept";
+                if (dir.HasIoUring()) {
+                    buf = Sockaddr{};
+                    ev::IoUringRequest request;
+                    request.opcode = ev::IoUringOpcode::kAccept;
+                    request.fd = dir.Fd();
+                    request.addr = buf.Data();
+                    request.addr_len = &len;
+                    accepted = dir.PerformOnIoUring(request, deadline);
+                    if (accepted) {
+                        UASSERT(len <= buf.Capacity());
+                        break;
                     }
-                    throw IoTimeout() << "Accept";
+                } else if (WaitReadable(deadline)) {
+                    break;
                 }
-                break;
+
+                if (current_task::ShouldCancel()) {
+                    throw IoCancelled() << "Accept";
+                }
+                throw IoTimeout() << "Accept";
 
             case ECONNABORTED:  // DOA connection
             case EINTR:         // signal interrupt
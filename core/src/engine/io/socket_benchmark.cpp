@@ -14,6 +14,7 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/internal/net/net_listener.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,10 +24,17 @@ namespace {
 
 constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
 
+// state.range(0) selects the I/O backend: 0 - libev, 1 - io_uring
+void RunStandaloneWithBackend(benchmark::State& state, utils::function_ref<void()> payload) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_io_uring_enabled = state.range(0) != 0;
+    engine::RunStandalone(1, config, payload);
+}
+
 }  // namespace
 
 void socket_send_all(benchmark::State& state) {
-    engine::RunStandalone([&]() {
+    RunStandaloneWithBackend(state, [&] {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
         internal::net::TcpListener listener;
         auto [server, client] = listener.MakeSocketPair(test_deadline);
@@ -49,10 +57,10 @@ void socket_send_all(benchmark::State& state) {
         task_reader.Get();
     });
 }
-BENCHMARK(socket_send_all);
+BENCHMARK(socket_send_all)->Arg(0)->Arg(1)->ArgName("io_uring");
 
 void socket_send_all_v(benchmark::State& state) {
-    engine::RunStandalone([&]() {
+    RunStandaloneWithBackend(state, [&] {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
         internal::net::TcpListener listener;
         auto [server, client] = listener.MakeSocketPair(test_deadline);
@@ -73,7 +81,35 @@ void socket_send_all_v(benchmark::State& state) {
         task_reader.Get();
     });
 }
-BENCHMARK(socket_send_all_v);
+BENCHMARK(socket_send_all_v)->Arg(0)->Arg(1)->ArgName("io_uring");
+
+// Every RecvAll has to wait for the peer, so the I/O backend is on the hot path
+void socket_ping_pong(benchmark::State& state) {
+    RunStandaloneWithBackend(state, [&] {
+        const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+        internal::net::TcpListener listener;
+        auto [server, client] = listener.MakeSocketPair(test_deadline);
+        auto task_echo = engine::AsyncNoSpan(
+            [test_deadline](auto&& server) {
+                std::array<char, 8> buf = {};
+                while (server.RecvAll(buf.data(), buf.size(), test_deadline) == buf.size()) {
+                    server.SendAll(buf.data(), buf.size(), test_deadline);
+                }
+            },
+            std::move(server)
+        );
+
+        std::array<char, 8> buf = {};
+        for ([[maybe_unused]] auto _ : state) {
+            client.SendAll("pingping", buf.size(), test_deadline);
+            const auto received = client.RecvAll(buf.data(), buf.size(), test_deadline);
+            benchmark::DoNotOptimize(received);
+        }
+        client.Close();
+        task_echo.Get();
+    });
+}
+BENCHMARK(socket_ping_pong)->Arg(0)->Arg(1)->ArgName("io_uring");
 
 [[maybe_unused]] void socket_send_all_v_range(benchmark::State& state) {
     engine::RunStandalone(2, [&]() {
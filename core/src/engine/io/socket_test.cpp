@@ -15,9 +15,13 @@
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/run_standalone.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/internal/net/net_listener.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -193,6 +197,39 @@ UTEST(Socket, SendAllVector) {
     EXPECT_EQ(bytes_sent, bytes_read);
 }
 
+UTEST(Socket, SendFile) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    // Large enough to fill the socket buffers
+    std::string content(8 * 1024 * 1024, '\0');
+    for (std::size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>('a' + i % 26);
+    }
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), content);
+    const auto fd = fs::blocking::FileDescriptor::Open(file.GetPath(), fs::blocking::OpenFlag::kRead);
+
+    TcpListener listener;
+    auto sockets = listener.MakeSocketPair(deadline);
+
+    constexpr std::size_t kOffset = 13;
+    const std::size_t size = content.size() - kOffset - 1;
+    auto read_task = engine::AsyncNoSpan([&sockets, &deadline, size] {
+        std::string received(size, '\0');
+        EXPECT_EQ(size, sockets.first.RecvAll(received.data(), received.size(), deadline));
+        return received;
+    });
+
+    EXPECT_EQ(size, sockets.second.SendFile(fd.GetNative(), kOffset, size, deadline));
+    EXPECT_EQ(content.substr(kOffset, size), read_task.Get());
+
+    // The file is shorter than requested
+    EXPECT_EQ(1, sockets.second.SendFile(fd.GetNative(), content.size() - 1, 10, deadline));
+    char last = 0;
+    EXPECT_EQ(1, sockets.first.RecvAll(&last, 1, deadline));
+    EXPECT_EQ(content.back(), last);
+}
+
 UTEST(Socket, WaitAnyRead) {
     const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
     TcpListener listener;
@@ -483,4 +520,47 @@ UTEST(Socket, WriteALot) {
     }
 }
 
+// Falls back to libev if io_uring is not available, the behavior is the same
+TEST(Socket, IoUringBackend) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_io_uring_enabled = true;
+    engine::RunStandalone(2, config, [] {
+        const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+        TcpListener listener;
+        auto accept_task = engine::AsyncNoSpan([&] { return listener.socket.Accept(test_deadline); });
+        engine::Yield();
+
+        io::Socket client{listener.addr.Domain(), TcpListener::kType};
+        client.Connect(listener.addr, test_deadline);
+        auto server = accept_task.Get();
+        EXPECT_EQ(client.Getsockname().Port(), server.Getpeername().Port());
+
+        // The reader waits for the data, so the operation is completed by io_uring
+        auto recv_task = engine::AsyncNoSpan([&] {
+            std::array<char, 6> buf{};
+            EXPECT_EQ(buf.size(), server.RecvAll(buf.data(), buf.size(), test_deadline));
+            return std::string(buf.data(), buf.size());
+        });
+        engine::SleepFor(std::chrono::milliseconds{10});
+        EXPECT_EQ(6, client.SendAll({{"ab", 2}, {"cdef", 4}}, test_deadline));
+        EXPECT_EQ("abcdef", recv_task.Get());
+
+        char c = 0;
+        UEXPECT_THROW(
+            [[maybe_unused]] auto received =
+                server.RecvSome(&c, 1, Deadline::FromDuration(std::chrono::milliseconds{10})),
+            io::IoTimeout
+        );
+
+        // Data that arrives after a timeout is not lost
+        EXPECT_EQ(1, client.SendAll("x", 1, test_deadline));
+        EXPECT_EQ(1, server.RecvSome(&c, 1, test_deadline));
+        EXPECT_EQ('x', c);
+
+        client.Close();
+        EXPECT_EQ(0, server.RecvSome(&c, 1, test_deadline));
+    });
+}
+
 USERVER_NAMESPACE_END
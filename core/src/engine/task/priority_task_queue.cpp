@@ -0,0 +1,165 @@
+#include <engine/task/priority_task_queue.hpp>
+
+#include <chrono>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <engine/task/task_context.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+// Frequency of pops that start from a lower priority class to guarantee
+// its progress while higher classes are busy
+constexpr std::size_t kFrequencyNormalFirstPop = 8;
+constexpr std::size_t kFrequencyBackgroundFirstPop = 61;
+
+constexpr double kWaitTimeBoundsUs[] = {
+    10, 50, 100, 500, 1'000, 5'000, 10'000, 50'000, 100'000, 500'000, 1'000'000,
+};
+
+constexpr std::size_t ToIndex(TaskPriority priority) noexcept { return static_cast<std::size_t>(priority); }
+
+constexpr TaskPriority kPriorities[] = {TaskPriority::kCritical, TaskPriority::kNormal, TaskPriority::kBackground};
+static_assert(std::size(kPriorities) == kTaskPriorityCount);
+
+TaskPriority GetQueuePriority(const impl::TaskContext& context) noexcept {
+    // Yielding tasks let everyone else run first
+    return context.IsBackground() ? TaskPriority::kBackground : context.GetPriority();
+}
+
+}  // namespace
+
+struct PriorityTaskQueue::ConsumerTokens final {
+    explicit ConsumerTokens(PriorityTaskQueue& owner)
+        : tokens{
+              moodycamel::ConsumerToken{owner.GetClass(TaskPriority::kCritical).queue},
+              moodycamel::ConsumerToken{owner.GetClass(TaskPriority::kNormal).queue},
+              moodycamel::ConsumerToken{owner.GetClass(TaskPriority::kBackground).queue},
+          } {}
+
+    std::array<moodycamel::ConsumerToken, kTaskPriorityCount> tokens;
+    std::size_t pops_count{0};
+};
+
+PriorityTaskQueue::PriorityClass::PriorityClass() : wait_time_us(kWaitTimeBoundsUs) {}
+
+PriorityTaskQueue::PriorityTaskQueue(const TaskProcessorConfig& config)
+    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+
+void PriorityTaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
+    UASSERT(context);
+    DoPush(GetQueuePriority(*context), context.get());
+    context.detach();
+}
+
+boost::intrusive_ptr<impl::TaskContext> PriorityTaskQueue::PopBlocking() {
+    // Current thread handles only a single TaskProcessor, so it's safe to store
+    // tokens for the task processor in a thread-local variable.
+    thread_local ConsumerTokens tokens{*this};
+
+    boost::intrusive_ptr<impl::TaskContext> context{
+        DoPopBlocking(tokens),
+        /* add_ref= */ false};
+
+    if (!context) {
+        // return "stop" token back
+        DoPush(TaskPriority::kCritical, nullptr);
+    }
+
+    return context;
+}
+
+void PriorityTaskQueue::StopProcessing() { DoPush(TaskPriority::kCritical, nullptr); }
+
+std::size_t PriorityTaskQueue::GetSizeApproximate() const noexcept {
+    std::size_t size{0};
+    for (const auto& priority_class : classes_) {
+        size += priority_class.queue.size_approx();
+    }
+    return size;
+}
+
+std::size_t PriorityTaskQueue::GetSizeApproximate(TaskPriority priority) const noexcept {
+    return GetClass(priority).queue.size_approx();
+}
+
+utils::statistics::HistogramView PriorityTaskQueue::GetQueueWaitTimes(TaskPriority priority) const noexcept {
+    return GetClass(priority).wait_time_us.GetView();
+}
+
+void PriorityTaskQueue::PrepareWorker(std::size_t) {}
+
+void PriorityTaskQueue::DoPush(TaskPriority priority, impl::TaskContext* context) {
+    GetClass(priority).queue.enqueue(context);
+    queue_semaphore_.signal();
+}
+
+impl::TaskContext* PriorityTaskQueue::DoPopBlocking(ConsumerTokens& tokens) {
+    impl::TaskContext* context{};
+
+    // The semaphore guarantees that one of the queues has an item for us
+    queue_semaphore_.wait();
+
+    const auto pops_count = ++tokens.pops_count;
+    TaskPriority first_priority = TaskPriority::kCritical;
+    if (pops_count % kFrequencyBackgroundFirstPop == 0) {
+        first_priority = TaskPriority::kBackground;
+    } else if (pops_count % kFrequencyNormalFirstPop == 0) {
+        first_priority = TaskPriority::kNormal;
+    }
+
+    while (true) {
+        if (TryPop(first_priority, tokens, context)) return context;
+
+        for (const auto priority : kPriorities) {
+            if (priority != first_priority && TryPop(priority, tokens, context)) return context;
+        }
+        // Can happen when another consumer steals our item in exchange for another
+        // item in a Moodycamel sub-queue that we have already passed.
+    }
+}
+
+bool PriorityTaskQueue::TryPop(TaskPriority priority, ConsumerTokens& tokens, impl::TaskContext*& context) {
+    if (!GetClass(priority).queue.try_dequeue(tokens.tokens[ToIndex(priority)], context)) return false;
+
+    if (context) AccountWaitTime(priority, *context);
+    return true;
+}
+
+void PriorityTaskQueue::AccountWaitTime(TaskPriority priority, impl::TaskContext& context) noexcept {
+    // Only every few tasks get a timepoint, not to call clock_gettime() too often
+    const auto wait_timepoint = context.GetQueueWaitTimepoint();
+    if (wait_timepoint == std::chrono::steady_clock::time_point()) return;
+
+    const auto wait_time = std::chrono::steady_clock::now() - wait_timepoint;
+    GetClass(priority).wait_time_us.Account(std::chrono::duration<double, std::micro>(wait_time).count());
+}
+
+PriorityTaskQueue::PriorityClass& PriorityTaskQueue::GetClass(TaskPriority priority) noexcept {
+    UASSERT(ToIndex(priority) < classes_.size());
+    return classes_[ToIndex(priority)];
+}
+
+const PriorityTaskQueue::PriorityClass& PriorityTaskQueue::GetClass(TaskPriority priority) const noexcept {
+    UASSERT(ToIndex(priority) < classes_.size());
+    return classes_[ToIndex(priority)];
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const PriorityTaskQueue& queue) {
+    for (const auto priority : kPriorities) {
+        const utils::statistics::LabelView label{"task_priority", ToString(priority)};
+        writer["queued"].ValueWithLabels(queue.GetSizeApproximate(priority), label);
+        writer["wait-time-us"].ValueWithLabels(queue.GetQueueWaitTimes(priority), label);
+    }
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/task/task_priority.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+// A global task queue with a separate FIFO for each engine::TaskPriority.
+// Higher classes are dequeued first, but every worker periodically starts
+// from a lower class to guarantee its progress.
+class PriorityTaskQueue final {
+public:
+    explicit PriorityTaskQueue(const TaskProcessorConfig& config);
+
+    void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+    // Returns nullptr as a stop signal
+    boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+    void StopProcessing();
+
+    std::size_t GetSizeApproximate() const noexcept;
+
+    std::size_t GetSizeApproximate(TaskPriority priority) const noexcept;
+
+    // Queue wait times in microseconds of the tasks with known enqueue
+    // timepoint, see TaskContext::GetQueueWaitTimepoint
+    utils::statistics::HistogramView GetQueueWaitTimes(TaskPriority priority) const noexcept;
+
+    void PrepareWorker(std::size_t index);
+
+private:
+    struct ConsumerTokens;
+
+    struct PriorityClass final {
+        PriorityClass();
+
+        moodycamel::ConcurrentQueue<impl::TaskContext*> queue;
+        utils::statistics::Histogram wait_time_us;
+    };
+
+    void DoPush(TaskPriority priority, impl::TaskContext* context);
+
+    impl::TaskContext* DoPopBlocking(ConsumerTokens& tokens);
+
+    bool TryPop(TaskPriority priority, ConsumerTokens& tokens, impl::TaskContext*& context);
+
+    void AccountWaitTime(TaskPriority priority, impl::TaskContext& context) noexcept;
+
+    PriorityClass& GetClass(TaskPriority priority) noexcept;
+    const PriorityClass& GetClass(TaskPriority priority) const noexcept;
+
+    std::array<PriorityClass, kTaskPriorityCount> classes_;
+    moodycamel::LightweightSemaphore queue_semaphore_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const PriorityTaskQueue& queue);
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
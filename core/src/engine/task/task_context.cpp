@@ -100,6 +100,11 @@ constexpr SleepState MakeNextEpochSleepState(SleepState::Epoch current) {
 
 auto* const kFinishedDetachedToken = reinterpret_cast<DetachedTasksSyncBlock::Token*>(1);
 
+TaskPriority GetInheritedPriority() noexcept {
+    const auto* const parent = current_task::GetCurrentTaskContextUnchecked();
+    return parent ? parent->GetPriority() : TaskPriority::kNormal;
+}
+
 }  // namespace
 
 TaskContext::TaskContext(
@@ -113,6 +118,7 @@ TaskContext::TaskContext(
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
       payload_(&payload),
+      priority_(GetInheritedPriority()),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
       trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
@@ -24,6 +24,7 @@
 #include <userver/engine/impl/wait_list_fwd.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/flags.hpp>
 #include <userver/utils/impl/wrapped_call_base.hpp>
@@ -134,6 +135,13 @@ public:
     void SetBackground(bool);
     bool IsBackground() const noexcept { return is_background_; };
 
+    // scheduling class, may be changed by the task itself while it is running
+    TaskPriority GetPriority() const noexcept { return priority_.load(std::memory_order_relaxed); }
+    // returns previous value
+    TaskPriority SetPriority(TaskPriority priority) noexcept {
+        return priority_.exchange(priority, std::memory_order_relaxed);
+    }
+
     // causes this to yield and wait for wakeup
     // must only be called from this context
     // "spurious wakeups" may be caused by wakeup queueing
@@ -219,6 +227,7 @@ private:
     std::atomic<Task::State> state_{Task::State::kNew};
     std::atomic<DetachedTasksSyncBlock::Token*> detached_token_{nullptr};
     std::atomic<TaskCancellationReason> cancellation_reason_{TaskCancellationReason::kNone};
+    std::atomic<TaskPriority> priority_;
     FastPimplGenericWaitList finish_waiters_;
 
     ContextTimer deadline_timer_;
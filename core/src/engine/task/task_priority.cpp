@@ -0,0 +1,40 @@
+#include <userver/engine/task/task_priority.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+std::string_view ToString(TaskPriority priority) noexcept {
+    switch (priority) {
+        case TaskPriority::kCritical:
+            return "critical";
+        case TaskPriority::kNormal:
+            return "normal";
+        case TaskPriority::kBackground:
+            return "background";
+    }
+
+    UASSERT_MSG(false, "Unexpected value of TaskPriority enum");
+    return "unknown";
+}
+
+namespace current_task {
+
+TaskPriority GetPriority() noexcept { return GetCurrentTaskContext().GetPriority(); }
+
+}  // namespace current_task
+
+TaskPriorityScope::TaskPriorityScope(TaskPriority priority)
+    : context_(current_task::GetCurrentTaskContext()), old_priority_(context_.SetPriority(priority)) {}
+
+TaskPriorityScope::~TaskPriorityScope() {
+    UASSERT(context_.IsCurrent());
+    context_.SetPriority(old_priority_);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
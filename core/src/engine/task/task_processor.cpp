@@ -107,12 +107,14 @@ void TaskProcessorThreadStartedHook() {
 }
 
 auto MakeTaskQueue(TaskProcessorConfig config) {
-    using ResultType = std::variant<TaskQueue, WorkStealingTaskQueue>;
+    using ResultType = std::variant<TaskQueue, WorkStealingTaskQueue, PriorityTaskQueue>;
     switch (config.task_processor_queue) {
         case TaskQueueType::kGlobalTaskQueue:
             return ResultType{std::in_place_index<0>, std::move(config)};
         case TaskQueueType::kWorkStealingTaskQueue:
             return ResultType{std::in_place_index<1>, std::move(config)};
+        case TaskQueueType::kPriorityTaskQueue:
+            return ResultType{std::in_place_index<2>, std::move(config)};
     }
     UINVARIANT(false, "Unexpected value of TaskQueueType enum");
 }
@@ -202,6 +204,10 @@ std::size_t TaskProcessor::GetTaskQueueSize() const {
     return std::visit([](auto&& arg) { return arg.GetSizeApproximate(); }, task_queue_);
 }
 
+const PriorityTaskQueue* TaskProcessor::GetPriorityTaskQueue() const noexcept {
+    return std::get_if<PriorityTaskQueue>(&task_queue_);
+}
+
 void TaskProcessor::SetSettings(
     const TaskProcessorSettings& settings,
     const TaskProcessorProfilerSettings& profiler_settings
@@ -356,6 +362,7 @@ void TaskProcessor::ProcessTasks() noexcept {
         }
 
         pools_->GetCoroPool().AccountStackUsage();
+        pools_->GetCoroPool().TryReclaimIdleStacks();
 
         if (has_failed || context->IsFinished()) {
             context->FinishDetached();
@@ -10,6 +10,7 @@
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <engine/task/priority_task_queue.hpp>
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_queue.hpp>
@@ -60,6 +61,9 @@ public:
 
     std::size_t GetTaskQueueSize() const;
 
+    // nullptr unless the task processor uses TaskQueueType::kPriorityTaskQueue
+    const PriorityTaskQueue* GetPriorityTaskQueue() const noexcept;
+
     std::size_t GetWorkerCount() const { return workers_.size(); }
 
     void SetSettings(const TaskProcessorSettings& settings, const TaskProcessorProfilerSettings& profiler_settings);
@@ -113,7 +117,7 @@ private:
     concurrent::impl::InterferenceShield<impl::DetachedTasksSyncBlock> detached_contexts_{
         impl::DetachedTasksSyncBlock::StopMode::kCancel};
     concurrent::impl::InterferenceShield<OverloadedCache> overloaded_cache_;
-    std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
+    std::variant<TaskQueue, WorkStealingTaskQueue, PriorityTaskQueue> task_queue_;
     impl::TaskCounter task_counter_;
 
     const TaskProcessorConfig config_;
@@ -49,7 +49,8 @@ TaskQueueType Parse(const yaml_config::YamlConfig& value, formats::parse::To<Tas
     static constexpr utils::TrivialBiMap kMap([](auto selector) {
         return selector()
             .Case(TaskQueueType::kGlobalTaskQueue, "global-task-queue")
-            .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing-task-queue");
+            .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing-task-queue")
+            .Case(TaskQueueType::kPriorityTaskQueue, "priority-task-queue");
     });
 
     return utils::ParseFromValueString(value, kMap);
@@ -21,7 +21,7 @@ enum class OsScheduling {
     kIdle,
 };
 
-enum class TaskQueueType { kGlobalTaskQueue, kWorkStealingTaskQueue };
+enum class TaskQueueType { kGlobalTaskQueue, kWorkStealingTaskQueue, kPriorityTaskQueue };
 
 OsScheduling Parse(const yaml_config::YamlConfig& value, formats::parse::To<OsScheduling>);
 
@@ -1,10 +1,14 @@
 #include <engine/task/task_processor.hpp>
 
+#include <thread>
+
 #include <engine/task/task_processor_config.hpp>
+#include <engine/task/task_processor_pools.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_base.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utest/utest.hpp>
 
@@ -79,4 +83,114 @@ UTEST_MT(TaskProcessor, MetricsAliveAndRunning, 2) {
     EXPECT_EQ(task_counter.GetRunningTasks(), 1);
 }
 
+namespace {
+
+engine::TaskProcessor MakeSingleThreadedPriorityTaskProcessor() {
+    engine::TaskProcessorConfig config;
+    config.name = "priority";
+    config.thread_name = "priority";
+    config.worker_threads = 1;
+    config.task_processor_queue = engine::TaskQueueType::kPriorityTaskQueue;
+    return engine::TaskProcessor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+}
+
+// Occupies the only worker of the task processor until `release` is set,
+// so that the tasks scheduled meanwhile pile up in the queue
+engine::TaskWithResult<void> BlockWorker(engine::TaskProcessor& task_processor, std::atomic<bool>& release) {
+    std::atomic<bool> started{false};
+    auto task = engine::AsyncNoSpan(task_processor, [&release, &started] {
+        started = true;
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    while (!started) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return task;
+}
+
+}  // namespace
+
+UTEST(TaskProcessor, PriorityInheritance) {
+    EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kNormal);
+
+    {
+        const engine::TaskPriorityScope background{engine::TaskPriority::kBackground};
+        EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kBackground);
+
+        auto task = engine::AsyncNoSpan([] { return engine::current_task::GetPriority(); });
+        EXPECT_EQ(task.Get(), engine::TaskPriority::kBackground);
+
+        auto critical_task = engine::CriticalAsyncNoSpan([] { return engine::current_task::GetPriority(); });
+        EXPECT_EQ(critical_task.Get(), engine::TaskPriority::kBackground);
+    }
+
+    EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kNormal);
+    auto task = engine::AsyncNoSpan([] { return engine::current_task::GetPriority(); });
+    EXPECT_EQ(task.Get(), engine::TaskPriority::kNormal);
+}
+
+UTEST_MT(TaskProcessor, PriorityQueueOrder, 2) {
+    auto task_processor = MakeSingleThreadedPriorityTaskProcessor();
+
+    std::atomic<bool> release{false};
+    auto blocker = BlockWorker(task_processor, release);
+
+    // Only the worker of `task_processor` writes there
+    std::vector<engine::TaskPriority> order;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (const auto priority :
+         {engine::TaskPriority::kBackground, engine::TaskPriority::kNormal, engine::TaskPriority::kCritical}) {
+        const engine::TaskPriorityScope scope{priority};
+        for (int i = 0; i < 2; ++i) {
+            tasks.push_back(engine::AsyncNoSpan(task_processor, [&order, priority] { order.push_back(priority); }));
+        }
+    }
+
+    release = true;
+    blocker.Get();
+    for (auto& task : tasks) task.Get();
+
+    // Less than kFrequencyNormalFirstPop pops, so no anti-starvation reordering
+    const std::vector<engine::TaskPriority> expected{
+        engine::TaskPriority::kCritical,
+        engine::TaskPriority::kCritical,
+        engine::TaskPriority::kNormal,
+        engine::TaskPriority::kNormal,
+        engine::TaskPriority::kBackground,
+        engine::TaskPriority::kBackground,
+    };
+    EXPECT_EQ(order, expected);
+
+    const auto* queue = task_processor.GetPriorityTaskQueue();
+    ASSERT_TRUE(queue);
+    EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+UTEST_MT(TaskProcessor, PriorityQueueNoStarvation, 2) {
+    constexpr std::size_t kCriticalTasksCount = 100;
+    auto task_processor = MakeSingleThreadedPriorityTaskProcessor();
+
+    std::atomic<bool> release{false};
+    auto blocker = BlockWorker(task_processor, release);
+
+    std::size_t executed = 0;
+    std::size_t normal_task_position = 0;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.push_back(engine::AsyncNoSpan(task_processor, [&] { normal_task_position = executed++; }));
+    {
+        const engine::TaskPriorityScope critical{engine::TaskPriority::kCritical};
+        for (std::size_t i = 0; i < kCriticalTasksCount; ++i) {
+            tasks.push_back(engine::AsyncNoSpan(task_processor, [&executed] { ++executed; }));
+        }
+    }
+
+    release = true;
+    blocker.Get();
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_LT(normal_task_position, kCriticalTasksCount / 2);
+}
+
 USERVER_NAMESPACE_END
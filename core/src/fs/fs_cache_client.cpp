@@ -41,8 +41,16 @@ bool IsFilepathHidden(const std::string& path) {
 }  // namespace
 #endif  // __linux__
 
-FsCacheClient::FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period, engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
+FsCacheClient::FsCacheClient(
+    std::string_view dir,
+    std::chrono::milliseconds update_period,
+    engine::TaskProcessor& tp,
+    std::size_t max_in_memory_size
+)
+    : dir_(GetNormalizeDirectory(dir)),
+      update_period_(update_period),
+      tp_(tp),
+      max_in_memory_size_(max_in_memory_size) {
     UpdateCache();
 
     if (update_period_ == std::chrono::milliseconds(0)) {
@@ -57,7 +65,7 @@ FsCacheClient::FsCacheClient(std::string_view dir, std::chrono::milliseconds upd
 }
 
 void FsCacheClient::UpdateCache() {
-    auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+    auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, {fs::SettingsReadFile::kSkipHidden}, max_in_memory_size_);
     data_.Assign(std::move(map));
 }
 
@@ -102,10 +110,10 @@ void FsCacheClient::HandleDeleteDirectory(engine::io::sys_linux::Inotify& inotif
 void FsCacheClient::HandleCreate(const std::string& path) {
     if (IsFilepathHidden(path)) return;
 
-    FileInfoWithData info{};
-    info.extension = boost::filesystem::path(path).extension().string();
-    info.data = ReadFileContents(tp_, path);
-    data_.InsertOrAssign(GetLexicallyRelative(path, dir_), std::make_shared<const FileInfoWithData>(std::move(info)));
+    data_.InsertOrAssign(
+        GetLexicallyRelative(path, dir_),
+        std::make_shared<const FileInfoWithData>(ReadFileInfoWithData(tp_, path, max_in_memory_size_))
+    );
 }
 
 void FsCacheClient::HandleCreateDirectory(engine::io::sys_linux::Inotify& inotify, const std::string& path) {
@@ -138,9 +146,7 @@ void FsCacheClient::HandleCreateDirectoryBlocking(engine::io::sys_linux::Inotify
 
 FileInfoWithDataConstPtr FsCacheClient::TryGetFile(std::string_view path) const {
     LOG_DEBUG() << "Find file " << path;
-    auto snap = data_.GetSnapshot();
-    if (auto it = snap.find(std::string{path}); it != snap.end()) return it->second;
-    return nullptr;
+    return data_.Get(std::string{path});
 }
 
 }  // namespace fs
@@ -1,11 +1,18 @@
 #include <userver/fs/read.hpp>
 
+#include <sys/stat.h>
+
+#include <cstdint>
+
 #include <boost/filesystem.hpp>
+#include <fmt/format.h>
 
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
 
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
@@ -18,6 +25,44 @@ bool IsHiddenFile(const boost::filesystem::path& path) {
     return name != ".." && name != "." && name[0] == '.';
 }
 
+std::chrono::nanoseconds GetLastWriteTime(const struct ::stat& stats) {
+#ifdef __APPLE__
+    const auto& mtime = stats.st_mtimespec;
+#else
+    const auto& mtime = stats.st_mtim;
+#endif
+    return std::chrono::seconds{mtime.tv_sec} + std::chrono::nanoseconds{mtime.tv_nsec};
+}
+
+FileInfoWithData ReadFileInfoWithDataBlocking(const std::string& path, std::size_t max_in_memory_size) {
+    FileInfoWithData info{};
+    info.extension = boost::filesystem::path(path).extension().string();
+
+    auto file = blocking::FileDescriptor::Open(path, blocking::OpenFlag::kRead);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    struct ::stat stats;
+    utils::CheckSyscall(::fstat(file.GetNative(), &stats), "calling ::fstat for '{}'", path);
+    const auto last_write_time = GetLastWriteTime(stats);
+    info.last_modified = std::chrono::system_clock::time_point{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(last_write_time)};
+    info.size = stats.st_size;
+
+    if (info.size <= max_in_memory_size) {
+        info.data.resize(info.size);
+        info.data.resize(file.Read(info.data.data(), info.data.size()));
+        info.size = info.data.size();
+    } else {
+        info.file = std::make_shared<const blocking::FileDescriptor>(std::move(file));
+    }
+
+    // A file replaced within the same second, or with the same size and the
+    // modification time kept, still gets another tag
+    info.etag = fmt::format(
+        "\"{:x}-{:x}-{:x}\"", static_cast<std::uint64_t>(stats.st_ino), last_write_time.count(), info.size
+    );
+    return info;
+}
+
 }  // namespace
 
 std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
@@ -34,7 +79,8 @@ std::string ReadFileContents(engine::TaskProcessor& async_tp, const std::string&
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp,
     const std::string& path,
-    utils::Flags<SettingsReadFile> flags
+    utils::Flags<SettingsReadFile> flags,
+    std::size_t max_in_memory_size
 ) {
     FileInfoWithDataMap data{};
     for (auto it = utils::Async(
@@ -45,15 +91,18 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
         // only files
         if (it->status().type() != boost::filesystem::regular_file) continue;
         if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path())) continue;
-        FileInfoWithData info{};
-        info.extension = it->path().extension().string();
-        info.data = ReadFileContents(async_tp, it->path().string());
-        data[GetLexicallyRelative(it->path().string(), path)] =
-            std::make_shared<const FileInfoWithData>(std::move(info));
+        data[GetLexicallyRelative(it->path().string(), path)] = std::make_shared<const FileInfoWithData>(
+            ReadFileInfoWithData(async_tp, it->path().string(), max_in_memory_size)
+        );
     }
     return data;
 }
 
+FileInfoWithData
+ReadFileInfoWithData(engine::TaskProcessor& async_tp, const std::string& path, std::size_t max_in_memory_size) {
+    return engine::AsyncNoSpan(async_tp, &ReadFileInfoWithDataBlocking, path, max_in_memory_size).Get();
+}
+
 bool FileExists(engine::TaskProcessor& async_tp, const std::string& path) {
     return engine::AsyncNoSpan(async_tp, &fs::blocking::FileExists, path).Get();
 }
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <userver/engine/task/current_task.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/fs/read.hpp>
+#include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -9,4 +13,22 @@ TEST(Fs, GetLexicallyRelative) {
     EXPECT_EQ(fs::GetLexicallyRelative("/path/to/file", "/path"), "/to/file");
 }
 
+UTEST(Fs, ETagChangesForReplacedFile) {
+    auto& tp = engine::current_task::GetTaskProcessor();
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file.txt";
+    const auto perms = boost::filesystem::perms::owner_read | boost::filesystem::perms::owner_write;
+
+    fs::blocking::RewriteFileContentsAtomically(path, "first", perms);
+    const auto first = fs::ReadFileInfoWithData(tp, path);
+
+    // Same size, likely within the same second
+    fs::blocking::RewriteFileContentsAtomically(path, "other", perms);
+    const auto second = fs::ReadFileInfoWithData(tp, path);
+
+    EXPECT_EQ(first.size, second.size);
+    EXPECT_NE(first.etag, second.etag);
+    EXPECT_EQ(second.data, "other");
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,172 @@
+#include <userver/rcu/hash_trie_map.hpp>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Forces collisions of the whole hash values
+struct BadHash {
+    std::size_t operator()(int value) const noexcept { return static_cast<std::size_t>(value % 7); }
+};
+
+template <typename Map, typename Reference>
+void ExpectSame(const Map& map, const Reference& reference) {
+    ASSERT_EQ(map.size(), reference.size());
+
+    std::size_t iterated = 0;
+    for (const auto& [key, value] : map) {
+        ++iterated;
+        const auto it = reference.find(key);
+        ASSERT_NE(it, reference.end()) << key;
+        EXPECT_EQ(it->second, value);
+    }
+    EXPECT_EQ(iterated, reference.size());
+
+    for (const auto& [key, value] : reference) {
+        const auto it = map.find(key);
+        ASSERT_NE(it, map.end()) << key;
+        EXPECT_EQ(it->first, key);
+        EXPECT_EQ(it->second, value);
+    }
+}
+
+template <typename Map>
+void CheckRandomOperations() {
+    std::unordered_map<int, int> reference;
+    Map map;
+
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<int> keys{0, 2000};
+    for (int i = 0; i < 20000; ++i) {
+        const auto key = keys(engine);
+        switch (engine() % 3) {
+            case 0:
+                EXPECT_EQ(map.try_emplace(key, i).second, reference.try_emplace(key, i).second);
+                break;
+            case 1:
+                EXPECT_EQ(map.insert_or_assign(key, i).second, reference.insert_or_assign(key, i).second);
+                break;
+            default:
+                EXPECT_EQ(map.erase(key), reference.erase(key));
+        }
+        ASSERT_EQ(map.size(), reference.size());
+    }
+    ExpectSame(map, reference);
+
+    for (const auto& [key, value] : reference) {
+        EXPECT_EQ(1, map.erase(key));
+    }
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+}  // namespace
+
+TEST(HashTrieMap, Empty) {
+    rcu::HashTrieMap<std::string, int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(0, map.size());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find("a"), map.end());
+    EXPECT_EQ(0, map.erase("a"));
+}
+
+TEST(HashTrieMap, Basic) {
+    rcu::HashTrieMap<std::string, int> map;
+
+    const auto [it, inserted] = map.emplace("a", 1);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ("a", it->first);
+    EXPECT_EQ(1, it->second);
+
+    EXPECT_FALSE(map.try_emplace("a", 2).second);
+    EXPECT_EQ(1, map.find("a")->second);
+
+    EXPECT_FALSE(map.insert_or_assign("a", 3).second);
+    EXPECT_EQ(3, map.find("a")->second);
+    EXPECT_TRUE(map.contains("a"));
+    EXPECT_EQ(1, map.count("a"));
+    EXPECT_EQ(1, map.size());
+
+    EXPECT_EQ(1, map.erase("a"));
+    EXPECT_FALSE(map.contains("a"));
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(HashTrieMap, RandomOperations) { CheckRandomOperations<rcu::HashTrieMap<int, int>>(); }
+
+TEST(HashTrieMap, RandomOperationsCollisions) { CheckRandomOperations<rcu::HashTrieMap<int, int, BadHash>>(); }
+
+TEST(HashTrieMap, StructuralSharing) {
+    rcu::HashTrieMap<int, std::shared_ptr<int>> map;
+    std::unordered_map<int, std::shared_ptr<int>> reference;
+    for (int i = 0; i < 1000; ++i) {
+        auto value = std::make_shared<int>(i);
+        map.emplace(i, value);
+        reference.emplace(i, value);
+    }
+
+    const auto snapshot = map;
+    const auto snapshot_reference = reference;
+
+    for (int i = 0; i < 1000; i += 2) {
+        map.erase(i);
+        reference.erase(i);
+    }
+    for (int i = 1000; i < 1500; ++i) {
+        auto value = std::make_shared<int>(i);
+        map.insert_or_assign(i, value);
+        reference.insert_or_assign(i, value);
+    }
+    map.insert_or_assign(1, std::make_shared<int>(-1));
+    reference.insert_or_assign(1, map.find(1)->second);
+
+    ExpectSame(map, reference);
+    ExpectSame(snapshot, snapshot_reference);
+    EXPECT_EQ(1, *snapshot.find(1)->second);
+}
+
+TEST(HashTrieMap, Iteration) {
+    rcu::HashTrieMap<int, int> map;
+    for (int i = 0; i < 100; ++i) {
+        map.emplace(i, i * 2);
+    }
+
+    int sum = 0;
+    for (auto it = map.begin(); it != map.end(); it++) {
+        EXPECT_EQ(it->first * 2, it->second);
+        sum += it->first;
+    }
+    EXPECT_EQ(4950, sum);
+
+    auto it = map.find(42);
+    ASSERT_NE(it, map.end());
+    std::size_t rest = 0;
+    for (; it != map.end(); ++it) {
+        ++rest;
+    }
+    EXPECT_GT(rest, 0);
+    EXPECT_LE(rest, 100);
+}
+
+TEST(HashTrieMap, Move) {
+    rcu::HashTrieMap<int, int> map;
+    map.emplace(1, 1);
+
+    auto other = std::move(map);
+    EXPECT_EQ(1, other.size());
+    // NOLINTNEXTLINE(bugprone-use-after-move)
+    EXPECT_TRUE(map.empty());
+
+    map = std::move(other);
+    EXPECT_EQ(1, map.find(1)->second);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using DefaultTraits = rcu::DefaultRcuMapTraits<std::uint64_t>;
+using HashTrieTraits = rcu::HashTrieRcuMapTraits<std::uint64_t>;
+
+template <typename Traits>
+using Map = rcu::RcuMap<std::uint64_t, std::uint64_t, Traits>;
+
+template <typename Traits>
+void FillMap(Map<Traits>& map, std::size_t size) {
+    auto txn = map.StartWrite();
+    for (std::uint64_t i = 0; i < size; ++i) {
+        txn->emplace(i, std::make_shared<std::uint64_t>(i));
+    }
+    txn.Commit();
+}
+
+}  // namespace
+
+template <typename Traits>
+void rcu_map_read(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        const std::size_t size = state.range(0);
+        Map<Traits> map;
+        FillMap(map, size);
+
+        std::uint64_t i = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            benchmark::DoNotOptimize(map.Get(i++ % size));
+        }
+    });
+}
+BENCHMARK_TEMPLATE(rcu_map_read, DefaultTraits)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK_TEMPLATE(rcu_map_read, HashTrieTraits)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+// Every iteration is a single key insertion and a single key erasure
+template <typename Traits>
+void rcu_map_insert_erase(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        const std::size_t size = state.range(0);
+        Map<Traits> map;
+        FillMap(map, size);
+
+        std::uint64_t i = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            map.Emplace(size + i, i);
+            map.Erase(i);
+            ++i;
+        }
+    });
+}
+BENCHMARK_TEMPLATE(rcu_map_insert_erase, DefaultTraits)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_TEMPLATE(rcu_map_insert_erase, HashTrieTraits)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+// Writers constantly change the keyset of a large map, readers look up keys
+template <typename Traits>
+void rcu_map_write_heavy(benchmark::State& state) {
+    constexpr std::size_t kSize = 100'000;
+    const std::size_t writers_count = state.range(0);
+
+    engine::RunStandalone(writers_count + 1, [&] {
+        Map<Traits> map;
+        FillMap(map, kSize);
+
+        std::atomic<bool> run{true};
+        std::vector<engine::TaskWithResult<void>> writers;
+        writers.reserve(writers_count);
+        for (std::size_t j = 0; j < writers_count; ++j) {
+            writers.push_back(utils::Async("writer", [&, j] {
+                for (std::uint64_t i = j; run; i += writers_count) {
+                    map.InsertOrAssign(kSize + i % kSize, std::make_shared<std::uint64_t>(i));
+                    map.Erase(kSize + i % kSize);
+                }
+            }));
+        }
+
+        std::uint64_t i = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            benchmark::DoNotOptimize(map.Get(i++ % kSize));
+        }
+
+        run = false;
+        for (auto& writer : writers) writer.Get();
+    });
+}
+BENCHMARK_TEMPLATE(rcu_map_write_heavy, DefaultTraits)->Arg(1)->Arg(2);
+BENCHMARK_TEMPLATE(rcu_map_write_heavy, HashTrieTraits)->Arg(1)->Arg(2);
+
+USERVER_NAMESPACE_END
@@ -121,6 +121,60 @@ UTEST(RcuMap, Modify) {
     EXPECT_EQ(*map.Pop("any"), 5);
 }
 
+UTEST(RcuMap, HashTrieModify) {
+    rcu::RcuMap<std::string, int, rcu::HashTrieRcuMapTraits<std::string>> map;
+    const auto& cmap = map;
+
+    UEXPECT_THROW(cmap["any"], rcu::MissingKeyException);
+    EXPECT_FALSE(map.Erase("any"));
+
+    UEXPECT_NO_THROW(*map["any"] = 1);
+    EXPECT_EQ(1, *cmap["any"]);
+    EXPECT_TRUE(map.Erase("any"));
+    EXPECT_FALSE(map.Get("any"));
+
+    EXPECT_TRUE(map.Insert("any", std::make_shared<int>(3)).inserted);
+    EXPECT_FALSE(map.Insert("any", std::make_shared<int>(0)).inserted);
+    EXPECT_EQ(*map.Pop("any"), 3);
+
+    EXPECT_TRUE(map.Emplace("any", 4).inserted);
+    EXPECT_FALSE(map.TryEmplace("any", 0).inserted);
+    EXPECT_EQ(*map.TryEmplace("any", 0).value, 4);
+
+    map.InsertOrAssign("any", std::make_shared<int>(5));
+    EXPECT_EQ(*cmap["any"], 5);
+    EXPECT_EQ(1, map.SizeApprox());
+
+    map.Clear();
+    EXPECT_EQ(0, map.SizeApprox());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+UTEST(RcuMap, HashTrieSnapshots) {
+    rcu::RcuMap<int, int, rcu::HashTrieRcuMapTraits<int>> map;
+    for (int i = 0; i < 1000; ++i) {
+        map.Emplace(i, i);
+    }
+
+    const auto first_snap = map.GetSnapshot();
+    {
+        auto txn = map.StartWrite();
+        for (int i = 0; i < 1000; i += 2) {
+            txn->erase(i);
+        }
+        txn->insert_or_assign(1, std::make_shared<int>(-1));
+        txn.Commit();
+    }
+    const auto second_snap = map.GetSnapshot();
+
+    ASSERT_EQ(1000, first_snap.size());
+    EXPECT_EQ(1, *first_snap.at(1));
+    ASSERT_EQ(500, second_snap.size());
+    EXPECT_EQ(-1, *second_snap.at(1));
+    EXPECT_EQ(3, *second_snap.at(3));
+    EXPECT_FALSE(second_snap.count(2));
+}
+
 UTEST(RcuMap, InsertOrAssign) {
     rcu::RcuMap<std::string, int> map;
 
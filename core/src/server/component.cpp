@@ -217,6 +217,10 @@ properties:
                         type: integer
                         description: delay in microseconds of the start of abort check routine
                         defaultDescription: 20ms
+                    concurrent_pipelining:
+                        type: boolean
+                        description: start handlers of the consecutive pipelined HTTP/1.1 GET, HEAD and OPTIONS requests concurrently (at most requests_queue_size_threshold at once) and coalesce writes of the ready responses
+                        defaultDescription: false
                     http-version:
                         type: string
                         description: HTTP protocol version - 1.1 or 2
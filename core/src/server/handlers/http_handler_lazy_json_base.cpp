@@ -0,0 +1,89 @@
+#include <userver/server/handlers/http_handler_lazy_json_base.hpp>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/tracing/span.hpp>
+
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/handlers/json_error_builder.hpp>
+#include <userver/server/handlers/legacy_json_error_builder.hpp>
+#include <userver/server/http/http_error.hpp>
+#include <userver/server/http/http_status.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+const std::string kRequestDataName = "__request_lazy_json";
+const std::string kResponseDataName = "__response_json";
+const std::string kSerializeJson = "serialize_json";
+
+}  // namespace
+
+HttpHandlerLazyJsonBase::HttpHandlerLazyJsonBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context,
+    bool is_monitor
+)
+    : HttpHandlerBase(config, component_context, is_monitor) {}
+
+std::string
+HttpHandlerLazyJsonBase::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext& context) const {
+    const auto& request_json = context.GetData<const formats::json::LazyValue&>(kRequestDataName);
+
+    auto& response = request.GetHttpResponse();
+    response.SetContentType(USERVER_NAMESPACE::http::content_type::kApplicationJson);
+
+    const auto& response_json = context.SetData<formats::json::Value>(
+        kResponseDataName, HandleRequestJsonThrow(request, request_json, context)
+    );
+
+    const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime(kSerializeJson);
+    return formats::json::ToString(response_json);
+}
+
+const formats::json::LazyValue* HttpHandlerLazyJsonBase::GetRequestJson(const request::RequestContext& context) {
+    return context.GetDataOptional<const formats::json::LazyValue>(kRequestDataName);
+}
+
+const formats::json::Value* HttpHandlerLazyJsonBase::GetResponseJson(const request::RequestContext& context) {
+    return context.GetDataOptional<const formats::json::Value>(kResponseDataName);
+}
+
+FormattedErrorData HttpHandlerLazyJsonBase::GetFormattedExternalErrorBody(const CustomHandlerException& exc) const {
+    if (exc.GetServiceCode().empty()) {
+        // Legacy format has no "service codes", only HTTP codes.
+        return {LegacyJsonErrorBuilder(exc).GetExternalBody(), LegacyJsonErrorBuilder::GetContentType()};
+    }
+    return {JsonErrorBuilder(exc).GetExternalBody(), JsonErrorBuilder::GetContentType()};
+}
+
+void HttpHandlerLazyJsonBase::ParseRequestData(const http::HttpRequest& request, request::RequestContext& context)
+    const {
+    if (request.RequestBody().empty()) {
+        context.EmplaceData<formats::json::LazyValue>(kRequestDataName);
+        return;
+    }
+
+    try {
+        context.EmplaceData<formats::json::LazyValue>(kRequestDataName, request.RequestBody());
+    } catch (const formats::json::Exception& e) {
+        throw RequestParseError(
+            InternalMessage{"Invalid JSON body"}, ExternalBody{std::string("Invalid JSON body: ") + e.what()}
+        );
+    }
+}
+
+yaml_config::Schema HttpHandlerLazyJsonBase::GetStaticConfigSchema() {
+    auto schema = HttpHandlerBase::GetStaticConfigSchema();
+    schema.UpdateDescription("HTTP handler lazy JSON base config");
+    return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -1,18 +1,96 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <algorithm>
+#include <charconv>
+#include <optional>
+#include <string_view>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/http/common_headers.hpp>
+#include <userver/utils/text_light.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <dynamic_config/variables/USERVER_FILES_CONTENT_TYPE_MAP.hpp>
+#include <server/http/http_cached_date.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
 
+namespace {
+
+struct ByteRange {
+    std::size_t offset{0};
+    std::size_t size{0};
+};
+
+constexpr std::string_view kBytesUnit = "bytes=";
+
+std::string_view TrimSpaces(std::string_view str) {
+    while (!str.empty() && (str.front() == ' ' || str.front() == '\t')) str.remove_prefix(1);
+    while (!str.empty() && (str.back() == ' ' || str.back() == '\t')) str.remove_suffix(1);
+    return str;
+}
+
+std::optional<std::size_t> ParseRangePosition(std::string_view str) {
+    str = TrimSpaces(str);
+    std::size_t result = 0;
+    const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+    if (str.empty() || ec != std::errc{} || ptr != str.data() + str.size()) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+// Returns std::nullopt if the whole file should be sent: the header is
+// malformed, uses another unit or requests multiple ranges. Returns a range of
+// zero size if the range is not satisfiable.
+std::optional<ByteRange> ParseRange(std::string_view header, std::size_t file_size) {
+    if (!utils::text::StartsWith(header, kBytesUnit)) return std::nullopt;
+    header.remove_prefix(kBytesUnit.size());
+    if (header.find(',') != std::string_view::npos) return std::nullopt;
+
+    const auto dash_pos = header.find('-');
+    if (dash_pos == std::string_view::npos) return std::nullopt;
+    const auto first_str = header.substr(0, dash_pos);
+    const auto last_str = header.substr(dash_pos + 1);
+
+    if (TrimSpaces(first_str).empty()) {
+        // suffix range: "bytes=-N"
+        const auto suffix = ParseRangePosition(last_str);
+        if (!suffix) return std::nullopt;
+        const auto size = std::min(*suffix, file_size);
+        return ByteRange{file_size - size, size};
+    }
+
+    const auto first = ParseRangePosition(first_str);
+    if (!first) return std::nullopt;
+    std::size_t last = file_size ? file_size - 1 : 0;
+    if (!TrimSpaces(last_str).empty()) {
+        const auto parsed_last = ParseRangePosition(last_str);
+        if (!parsed_last || *parsed_last < *first) return std::nullopt;
+        last = std::min(*parsed_last, last);
+    }
+
+    if (*first >= file_size) return ByteRange{};
+    return ByteRange{*first, last - *first + 1};
+}
+
+bool IsETagMatching(std::string_view header, std::string_view etag) {
+    for (auto tag : utils::text::SplitIntoStringViewVector(header, ",")) {
+        tag = TrimSpaces(tag);
+        if (tag == "*" || tag == etag) return true;
+        // weak comparison is used for If-None-Match
+        if (utils::text::StartsWith(tag, "W/") && tag.substr(2) == etag) return true;
+    }
+    return false;
+}
+
+}  // namespace
+
 HttpHandlerStatic::HttpHandlerStatic(
     const components::ComponentConfig& config,
     const components::ComponentContext& context
@@ -61,12 +139,73 @@ std::string HttpHandlerStatic::HandleRequestThrow(const http::HttpRequest& reque
         const auto config = config_.GetSnapshot();
         response.SetHeader(USERVER_NAMESPACE::http::headers::kExpires, std::to_string(cache_age_.count()));
         response.SetContentType(config[::dynamic_config::USERVER_FILES_CONTENT_TYPE_MAP][file->extension]);
-        return file->data;
+        if (response.GetStatus() == http::HttpStatus::kNotFound) {
+            return MakeBody(response, file, 0, file->size);
+        }
+        return HandleConditionalRequest(request, file);
     }
     response.SetStatusNotFound();
     return "File not found";
 }
 
+std::string
+HttpHandlerStatic::HandleConditionalRequest(const http::HttpRequest& request, const fs::FileInfoWithDataConstPtr& file)
+    const {
+    namespace headers = USERVER_NAMESPACE::http::headers;
+
+    auto& response = request.GetHttpResponse();
+    auto last_modified = http::impl::MakeHttpDate(file->last_modified);
+    response.SetHeader(headers::kETag, file->etag);
+    response.SetHeader(headers::kLastModified, last_modified);
+    response.SetHeader(headers::kAcceptRanges, std::string{"bytes"});
+
+    const auto& if_none_match = request.GetHeader(headers::kIfNoneMatch);
+    if (!if_none_match.empty() && IsETagMatching(if_none_match, file->etag)) {
+        response.SetStatus(http::HttpStatus::kNotModified);
+        return {};
+    }
+
+    const auto& range_header = request.GetHeader(headers::kRange);
+    const auto& if_range = request.GetHeader(headers::kIfRange);
+    const bool is_range_applicable = !range_header.empty() &&
+                                     (if_range.empty() || if_range == file->etag || if_range == last_modified);
+    const auto range = is_range_applicable ? ParseRange(range_header, file->size) : std::nullopt;
+    if (!range) {
+        return MakeBody(response, file, 0, file->size);
+    }
+
+    if (range->size == 0) {
+        response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+        response.SetHeader(headers::kContentRange, fmt::format("bytes */{}", file->size));
+        return {};
+    }
+
+    response.SetStatus(http::HttpStatus::kPartialContent);
+    response.SetHeader(
+        headers::kContentRange,
+        fmt::format("bytes {}-{}/{}", range->offset, range->offset + range->size - 1, file->size)
+    );
+    return MakeBody(response, file, range->offset, range->size);
+}
+
+std::string HttpHandlerStatic::MakeBody(
+    http::HttpResponse& response,
+    const fs::FileInfoWithDataConstPtr& file,
+    std::size_t offset,
+    std::size_t size
+) {
+    if (size == 0) return {};
+
+    if (!file->file) {
+        if (offset == 0 && size == file->data.size()) return file->data;
+        return file->data.substr(offset, size);
+    }
+
+    // Sent directly from the file descriptor, without copying into the userspace
+    response.SetFileBody(http::impl::FileBody{file, offset, size});
+    return {};
+}
+
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
     return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
 type: object
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <server/http/request_handler_base.hpp>
+#include <server/net/connection.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/internal/net/net_listener.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
+constexpr std::string_view kResponseEnd = "\r\n\r\n";
+
+class SleepingRequestHandler final : public server::http::RequestHandlerBase {
+public:
+    explicit SleepingRequestHandler(std::chrono::microseconds handler_latency) : handler_latency_(handler_latency) {}
+
+    engine::TaskWithResult<void> StartRequestTask(std::shared_ptr<server::http::HttpRequest>) const override {
+        return engine::AsyncNoSpan([latency = handler_latency_] { engine::SleepFor(latency); });
+    }
+
+    const server::http::HandlerInfoIndex& GetHandlerInfoIndex() const override { return handler_info_index_; }
+
+    const logging::TextLoggerPtr& LoggerAccess() const noexcept override { return no_logger_; }
+    const logging::TextLoggerPtr& LoggerAccessTskv() const noexcept override { return no_logger_; }
+
+private:
+    const std::chrono::microseconds handler_latency_;
+    logging::TextLoggerPtr no_logger_;
+    server::http::HandlerInfoIndex handler_info_index_;
+};
+
+// Responses have no body, so each of them ends with an empty line
+std::size_t CountResponses(std::string_view data) {
+    std::size_t count = 0;
+    for (auto pos = data.find(kResponseEnd); pos != std::string_view::npos;
+         pos = data.find(kResponseEnd, pos + kResponseEnd.size())) {
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace
+
+// Args: concurrent pipelining (0/1), requests per pipelined batch, handler
+// latency in microseconds
+void http_pipelining_benchmark(benchmark::State& state) {
+    engine::RunStandalone(4, [&] {
+        const auto deadline = engine::Deadline::FromDuration(kDeadlineMaxTime);
+        const auto requests_count = static_cast<std::size_t>(state.range(1));
+
+        server::net::ConnectionConfig config;
+        config.concurrent_pipelining = state.range(0) != 0;
+        const server::request::HttpRequestConfig handler_defaults{};
+        const SleepingRequestHandler handler{std::chrono::microseconds{state.range(2)}};
+        auto stats = std::make_shared<server::net::Stats>();
+        server::request::ResponseDataAccounter data_accounter;
+
+        auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(deadline);
+        auto connection_task = engine::AsyncNoSpan([&, server = std::move(server)]() mutable {
+            server::net::Connection connection(
+                config,
+                handler_defaults,
+                std::make_unique<engine::io::Socket>(std::move(server)),
+                {},
+                handler,
+                stats,
+                data_accounter
+            );
+            connection.Process();
+        });
+
+        std::string requests;
+        for (std::size_t i = 0; i < requests_count; ++i) {
+            requests += fmt::format("GET /{} HTTP/1.1\r\n\r\n", i);
+        }
+
+        std::string replies;
+        std::array<char, 16 * 1024> buffer{};
+        for ([[maybe_unused]] auto _ : state) {
+            [[maybe_unused]] const auto sent = client.SendAll(requests.data(), requests.size(), deadline);
+
+            replies.clear();
+            while (CountResponses(replies) < requests_count) {
+                const auto received = client.RecvSome(buffer.data(), buffer.size(), deadline);
+                if (received == 0) {
+                    state.SkipWithError("Connection closed by server");
+                    break;
+                }
+                replies.append(buffer.data(), received);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * requests_count);
+
+        connection_task.SyncCancel();
+    });
+}
+BENCHMARK(http_pipelining_benchmark)
+    ->ArgNames({"concurrent", "requests", "latency_us"})
+    ->ArgsProduct({{0, 1}, {1, 8, 32}, {0, 100}})
+    ->UseRealTime();
+
+USERVER_NAMESPACE_END
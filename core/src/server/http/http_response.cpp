@@ -1,12 +1,18 @@
 #include <userver/server/http/http_response.hpp>
 
+#include <unistd.h>
+
+#include <algorithm>
 #include <array>
+#include <cerrno>
 
 #include <cctz/time_zone.h>
 #include <fmt/compile.h>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/fs/read.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
@@ -19,6 +25,7 @@
 #include <userver/utils/small_string.hpp>
 
 #include <server/http/http_cached_date.hpp>
+#include <server/http/response_body_encoder.hpp>
 
 #include <userver/server/http/http_request.hpp>
 
@@ -88,12 +95,31 @@ void AppendToCharArray(char*& data, const std::string_view what) {
 
 const std::string kEmptyString{};
 
+constexpr std::size_t kFileChunkSize = 64 * 1024;
+
+// Does not change the file offset, so the descriptor may be shared
+std::size_t ReadFilePart(int fd, char* buffer, std::size_t size, std::size_t offset) {
+    std::size_t read_bytes = 0;
+    while (read_bytes < size) {
+        const auto result = ::pread(fd, buffer + read_bytes, size - read_bytes, offset + read_bytes);
+        if (result == 0) break;
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            throw engine::io::IoSystemError(errno, "HttpResponse") << "Error while reading the file body, fd=" << fd;
+        }
+        read_bytes += result;
+    }
+    return read_bytes;
+}
+
 }  // namespace
 
 namespace server::http {
 
 namespace impl {
 
+ResponseBodyEncoder::~ResponseBodyEncoder() = default;
+
 void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header, std::string_view key, std::string_view val) {
     const auto old_size = header.size();
 
@@ -236,8 +262,43 @@ void HttpResponse::SetHeadersEnd() { headers_end_.Send(); }
 bool HttpResponse::WaitForHeadersEnd() { return headers_end_.WaitForEvent(); }
 
 void HttpResponse::SendResponse(engine::io::RwBase& socket) {
-    utils::SmallString<USERVER_NAMESPACE::http::headers::kTypicalHeadersSize> header;
+    USERVER_NAMESPACE::http::headers::HeadersString header;
+    OutputStatusLineAndHeaders(header);
+
+    std::size_t sent_bytes{};
+
+    if (IsBodyStreamed() && GetData().empty()) {
+        sent_bytes = SetBodyStreamed(socket, header);
+    } else if (HasFileBody()) {
+        sent_bytes = SetBodyFile(socket, header);
+    } else {
+        // e.g. a CustomHandlerException
+        sent_bytes = SetBodyNotStreamed(socket, header);
+    }
 
+    SetSent(sent_bytes, std::chrono::steady_clock::now());
+}
+
+std::string_view HttpResponse::SerializeNotStreamed(USERVER_NAMESPACE::http::headers::HeadersString& header) {
+    UASSERT(!IsBodyStreamed() || !GetData().empty());
+    UASSERT(!HasFileBody());
+    OutputStatusLineAndHeaders(header);
+    return OutputNotStreamedBodyHeaders(header);
+}
+
+void HttpResponse::SetSerializedSent(std::size_t bytes_sent, std::chrono::steady_clock::time_point sent_time) {
+    SetSent(bytes_sent, sent_time);
+}
+
+void HttpResponse::SetFileBody(impl::FileBody body) {
+    UASSERT(body.file && body.file->file);
+    file_body_.emplace(std::move(body));
+}
+
+bool HttpResponse::HasFileBody() const { return file_body_.has_value() && GetData().empty(); }
+
+void HttpResponse::OutputStatusLineAndHeaders(USERVER_NAMESPACE::http::headers::HeadersString& header) {
+    UASSERT(header.empty());
     header.resize_and_overwrite(USERVER_NAMESPACE::http::headers::kTypicalHeadersSize, [&](char* data, std::size_t) {
         char* old_data_pointer = data;
         AppendToCharArray(data, "HTTP/");
@@ -286,28 +347,32 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
         header.append(kCrlf);
     }
+}
 
-    std::size_t sent_bytes{};
+std::size_t
+HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
+    const auto body = OutputNotStreamedBodyHeaders(header);
 
-    if (IsBodyStreamed() && GetData().empty()) {
-        sent_bytes = SetBodyStreamed(socket, header);
+    ssize_t sent_bytes = 0;
+    if (!body.empty()) {
+        sent_bytes = socket.WriteAll({{header.data(), header.size()}, {body.data(), body.size()}}, engine::Deadline{});
     } else {
-        // e.g. a CustomHandlerException
-        sent_bytes = SetBodyNotStreamed(socket, header);
+        sent_bytes = socket.WriteAll(header.data(), header.size(), engine::Deadline{});
     }
 
-    SetSent(sent_bytes, std::chrono::steady_clock::now());
+    return sent_bytes;
 }
 
-std::size_t
-HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
+std::string_view
+HttpResponse::OutputNotStreamedBodyHeaders(USERVER_NAMESPACE::http::headers::HeadersString& header) const {
     const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
     const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
     const auto& data = GetData();
+    const auto body_size = HasFileBody() ? file_body_->size : data.size();
 
     if (!is_body_forbidden) {
         impl::OutputHeader(
-            header, USERVER_NAMESPACE::http::headers::kContentLength, fmt::format(FMT_COMPILE("{}"), data.size())
+            header, USERVER_NAMESPACE::http::headers::kContentLength, fmt::format(FMT_COMPILE("{}"), body_size)
         );
     }
     header.append(kCrlf);
@@ -317,16 +382,62 @@ HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::
                               << " which does not allow one, it will be dropped";
     }
 
-    ssize_t sent_bytes = 0;
-    if (!is_head_request && !is_body_forbidden) {
-        sent_bytes = socket.WriteAll({{header.data(), header.size()}, {data.data(), data.size()}}, engine::Deadline{});
+    if (is_head_request || is_body_forbidden) {
+        return {};
+    }
+    return data;
+}
+
+std::size_t
+HttpResponse::SetBodyFile(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
+    UASSERT(HasFileBody());
+    OutputNotStreamedBodyHeaders(header);
+
+    std::size_t sent_bytes = socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+    if (request_.GetMethod() == HttpMethod::kHead || IsBodyForbiddenForStatus(status_)) {
+        return sent_bytes;
+    }
+
+    const auto& body = *file_body_;
+    const int fd = body.file->file->GetNative();
+    std::size_t sent_body_bytes = 0;
+    if (auto* tcp_socket = dynamic_cast<engine::io::Socket*>(&socket)) {
+        sent_body_bytes = tcp_socket->SendFile(fd, body.offset, body.size, engine::Deadline{});
     } else {
-        sent_bytes = socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+        // e.g. TLS, the data has to pass through the userspace anyway
+        std::string buffer(std::min(body.size, kFileChunkSize), '\0');
+        while (sent_body_bytes < body.size) {
+            const auto chunk_size = ReadFilePart(
+                fd,
+                buffer.data(),
+                std::min(buffer.size(), body.size - sent_body_bytes),
+                body.offset + sent_body_bytes
+            );
+            if (chunk_size == 0) break;
+            const auto chunk_sent = socket.WriteAll(buffer.data(), chunk_size, engine::Deadline{});
+            sent_body_bytes += chunk_sent;
+            if (chunk_sent != chunk_size) break;
+        }
     }
+    sent_bytes += sent_body_bytes;
 
+    if (sent_body_bytes != body.size) {
+        // The file was truncated after the Content-Length was sent, or the peer
+        // stopped receiving. The connection may not be reused, as the peer would
+        // take the next response for the rest of this body.
+        throw engine::io::IoException(fmt::format("Sent {} of {} bytes of the file body", sent_body_bytes, body.size));
+    }
     return sent_bytes;
 }
 
+std::string HttpResponse::ReadFileBody() const {
+    UASSERT(HasFileBody());
+    const auto& body = *file_body_;
+    std::string data(body.size, '\0');
+    data.resize(ReadFilePart(body.file->file->GetNative(), data.data(), data.size(), body.offset));
+    return data;
+}
+
 std::size_t
 HttpResponse::SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
     const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
@@ -398,6 +509,15 @@ void HttpResponse::SetStreamBody() {
 
 bool HttpResponse::IsBodyStreamed() const { return is_stream_body_; }
 
+void HttpResponse::SetStreamBodyEncoder(std::unique_ptr<impl::ResponseBodyEncoder> encoder) {
+    UASSERT(is_stream_body_);
+    stream_body_encoder_ = std::move(encoder);
+}
+
+std::unique_ptr<impl::ResponseBodyEncoder> HttpResponse::ExtractStreamBodyEncoder() {
+    return std::move(stream_body_encoder_);
+}
+
 HttpResponse::Producer HttpResponse::GetBodyProducer() {
     Producer res{};
     std::visit(
@@ -1,8 +1,11 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/overloaded.hpp>
 
+#include <server/http/response_body_encoder.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
@@ -11,9 +14,25 @@ ResponseBodyStream::ResponseBodyStream(
     server::http::HttpResponse::Producer&& queue_producer,
     server::http::HttpResponse& http_response
 )
-    : queue_producer_(std::move(queue_producer)), http_response_(http_response) {}
+    : queue_producer_(std::move(queue_producer)),
+      http_response_(http_response),
+      encoder_(http_response.ExtractStreamBodyEncoder()) {}
+
+ResponseBodyStream::ResponseBodyStream(ResponseBodyStream&&) noexcept = default;
 
 ResponseBodyStream::~ResponseBodyStream() {
+    if (encoder_ && headers_ended_ && queue_producer_.index() != 0) {
+        try {
+            auto tail = encoder_->Finish();
+            if (!tail.empty()) {
+                // The consumer may be already gone, nothing to do with it
+                [[maybe_unused]] const bool success = PushEncodedChunk(std::move(tail), engine::Deadline{});
+            }
+        } catch (const std::exception& e) {
+            LOG_WARNING() << "Failed to finish the encoded response body: " << e;
+        }
+    }
+
     if (http_response_.GetStreamId().has_value()) {
         UASSERT(queue_producer_.index() == 2);
         std::get<impl::Http2StreamEventProducer>(queue_producer_).CloseStream(*http_response_.GetStreamId());
@@ -22,17 +41,30 @@ ResponseBodyStream::~ResponseBodyStream() {
 
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk, engine::Deadline deadline) {
     UASSERT_MSG(headers_ended_, "SetEndOfHeaders() was not called before PushBodyChunk()");
-    std::visit(
+    if (encoder_) {
+        chunk = encoder_->EncodeChunk(chunk);
+        if (chunk.empty()) return;
+    }
+
+    [[maybe_unused]] const bool success = PushEncodedChunk(std::move(chunk), deadline);
+    UASSERT(success);
+}
+
+bool ResponseBodyStream::PushEncodedChunk(std::string&& chunk, engine::Deadline deadline) {
+    return std::visit(
         utils::Overloaded{
             [&chunk, &deadline](HttpResponse::Queue::Producer& queue_producer) mutable {
-                const bool success = queue_producer.Push(std::move(chunk), deadline);
-                UASSERT(success);
+                return queue_producer.Push(std::move(chunk), deadline);
             },
             [this, &chunk, &deadline](impl::Http2StreamEventProducer& queue_producer) mutable {
                 UASSERT(http_response_.GetStreamId().has_value());
                 queue_producer.PushEvent({*http_response_.GetStreamId(), std::move(chunk)}, deadline);
+                return true;
             },
-            [](std::monostate) { UINVARIANT(false, "unreachable"); }},
+            [](std::monostate) {
+                UINVARIANT(false, "unreachable");
+                return false;
+            }},
         queue_producer_
     );
 }
@@ -46,6 +78,9 @@ void ResponseBodyStream::SetHeader(std::string_view name, const std::string& val
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+    if (encoder_ && !encoder_->Start(http_response_)) {
+        encoder_.reset();
+    }
     headers_ended_ = true;
     http_response_.SetHeadersEnd();
 }
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+class HttpResponse;
+}
+
+namespace server::http::impl {
+
+/// Transforms chunks of a streamed response body, e.g. compresses them
+class ResponseBodyEncoder {
+public:
+    virtual ~ResponseBodyEncoder();
+
+    /// Called right before the end of headers. Returns false if the body should
+    /// be sent as is, otherwise sets the headers describing the encoding.
+    virtual bool Start(HttpResponse& response) = 0;
+
+    /// Returns the encoded chunk, may return an empty string if the encoder
+    /// buffers the data.
+    virtual std::string EncodeChunk(std::string_view chunk) = 0;
+
+    /// Returns the remaining encoded data after the last chunk.
+    virtual std::string Finish() = 0;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -14,6 +14,7 @@
 #include <server/middlewares/handler_adapter.hpp>
 #include <server/middlewares/handler_metrics.hpp>
 #include <server/middlewares/rate_limit.hpp>
+#include <server/middlewares/response_compression.hpp>
 #include <server/middlewares/tracing.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -68,6 +69,7 @@ components::ComponentList DefaultMiddlewareComponents() {
         .Append<DeadlinePropagationFactory>()
         .Append<DecompressionFactory>()
         .Append<SetAcceptEncodingFactory>()
+        .Append<ResponseCompressionFactory>()
         .Append<ExceptionsHandlingFactory>()
         .Append<UnknownExceptionsHandlingFactory>()
         .Append<testsuite::ExceptionsHandlingMiddlewareFactory>();
@@ -0,0 +1,396 @@
+#include <server/middlewares/response_compression.hpp>
+
+#include <variant>
+
+#include <fmt/format.h>
+
+#include <compression/gzip.hpp>
+#include <server/http/response_body_encoder.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+constexpr std::string_view kAcceptEncodingVary = "Accept-Encoding";
+constexpr int kMaxQValue = 1000;
+
+std::string_view TrimView(std::string_view str) {
+    while (!str.empty() && utils::text::IsAsciiSpace(str.front())) str.remove_prefix(1);
+    while (!str.empty() && utils::text::IsAsciiSpace(str.back())) str.remove_suffix(1);
+    return str;
+}
+
+// qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] ), in thousandths
+std::optional<int> ParseQValue(std::string_view value) {
+    if (value.empty() || (value[0] != '0' && value[0] != '1')) return std::nullopt;
+
+    int result = (value[0] - '0') * kMaxQValue;
+    value.remove_prefix(1);
+    if (value.empty()) return result;
+    if (value[0] != '.' || value.size() > 4) return std::nullopt;
+    value.remove_prefix(1);
+
+    int multiplier = kMaxQValue / 10;
+    for (const char c : value) {
+        if (c < '0' || c > '9') return std::nullopt;
+        result += (c - '0') * multiplier;
+        multiplier /= 10;
+    }
+    if (result > kMaxQValue) return std::nullopt;
+    return result;
+}
+
+bool MatchesEncoding(std::string_view coding, ResponseEncoding encoding) {
+    const utils::StrIcaseEqual equal;
+    switch (encoding) {
+        case ResponseEncoding::kGzip:
+            return equal(coding, "gzip") || equal(coding, "x-gzip");
+        case ResponseEncoding::kZstd:
+            return equal(coding, "zstd");
+    }
+    UINVARIANT(false, "Unexpected response encoding");
+}
+
+ResponseEncoding ParseEncoding(const yaml_config::YamlConfig& value) {
+    const auto name = value.As<std::string>();
+    if (name == "gzip") return ResponseEncoding::kGzip;
+    if (name == "zstd") return ResponseEncoding::kZstd;
+    throw std::runtime_error(fmt::format("Unsupported response encoding '{}' at '{}'", name, value.GetPath()));
+}
+
+bool IsBodyAllowed(http::HttpStatus status) {
+    const auto code = static_cast<int>(status);
+    return code >= 200 && status != http::HttpStatus::kNoContent && status != http::HttpStatus::kNotModified &&
+           status != http::HttpStatus::kPartialContent;
+}
+
+bool IsCompressible(
+    const ResponseCompressionSettings& settings,
+    const http::HttpRequest& request,
+    const http::HttpResponse& response
+) {
+    return request.GetMethod() != http::HttpMethod::kHead && IsBodyAllowed(response.GetStatus()) &&
+           !response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding) &&
+           // ranges refer to the representation as is, not to the compressed one
+           !response.HasHeader(USERVER_NAMESPACE::http::headers::kContentRange) &&
+           // file bodies are sent with sendfile() as is
+           !response.HasFileBody() &&
+           impl::IsContentTypeCompressible(
+               response.GetHeader(USERVER_NAMESPACE::http::headers::kContentType), settings.content_types
+           );
+}
+
+void AddVaryAcceptEncoding(http::HttpResponse& response) {
+    const auto& vary = response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+    if (vary.empty()) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::string{kAcceptEncodingVary});
+        return;
+    }
+
+    for (const auto field : utils::text::SplitIntoStringViewVector(vary, ",")) {
+        const auto trimmed = TrimView(field);
+        if (trimmed == "*" || utils::StrIcaseEqual{}(trimmed, kAcceptEncodingVary)) return;
+    }
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, fmt::format("{}, {}", vary, kAcceptEncodingVary));
+}
+
+// The compressed representation differs from the original one byte by byte,
+// so a strong validator of the original one becomes weak, RFC 9110 8.8.1
+void WeakenETag(http::HttpResponse& response) {
+    const auto& etag = response.GetHeader(USERVER_NAMESPACE::http::headers::kETag);
+    if (etag.empty() || utils::text::StartsWith(etag, "W/")) return;
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, fmt::format("W/{}", etag));
+}
+
+using StreamCompressor = std::variant<compression::gzip::StreamCompressor, compression::zstd::StreamCompressor>;
+
+StreamCompressor MakeStreamCompressor(ResponseEncoding encoding) {
+    switch (encoding) {
+        case ResponseEncoding::kGzip:
+            return compression::gzip::StreamCompressor{};
+        case ResponseEncoding::kZstd:
+            return compression::zstd::StreamCompressor{};
+    }
+    UINVARIANT(false, "Unexpected response encoding");
+}
+
+class CompressingBodyEncoder final : public http::impl::ResponseBodyEncoder {
+public:
+    CompressingBodyEncoder(
+        const ResponseCompressionSettings& settings,
+        const http::HttpRequest& request,
+        std::optional<ResponseEncoding> encoding
+    )
+        : settings_(settings), request_(request), encoding_(encoding) {}
+
+    bool Start(http::HttpResponse& response) override {
+        if (!IsCompressible(settings_, request_, response)) return false;
+
+        // Caches must not serve the identity response to the clients that
+        // accept compressed ones and vice versa
+        AddVaryAcceptEncoding(response);
+        if (!encoding_) return false;
+
+        WeakenETag(response);
+        response.SetContentEncoding(std::string{ToString(*encoding_)});
+        compressor_.emplace(MakeStreamCompressor(*encoding_));
+        return true;
+    }
+
+    std::string EncodeChunk(std::string_view chunk) override {
+        UASSERT(compressor_);
+        return std::visit([chunk](auto& compressor) { return compressor.CompressChunk(chunk); }, *compressor_);
+    }
+
+    std::string Finish() override {
+        UASSERT(compressor_);
+        return std::visit([](auto& compressor) { return compressor.Finish(); }, *compressor_);
+    }
+
+private:
+    const ResponseCompressionSettings& settings_;
+    const http::HttpRequest& request_;
+    const std::optional<ResponseEncoding> encoding_;
+    std::optional<StreamCompressor> compressor_;
+};
+
+}  // namespace
+
+std::string_view ToString(ResponseEncoding encoding) {
+    switch (encoding) {
+        case ResponseEncoding::kGzip:
+            return "gzip";
+        case ResponseEncoding::kZstd:
+            return "zstd";
+    }
+    UINVARIANT(false, "Unexpected response encoding");
+}
+
+ResponseCompressionSettings ParseResponseCompressionSettings(
+    const yaml_config::YamlConfig& value,
+    const ResponseCompressionSettings& defaults
+) {
+    ResponseCompressionSettings settings = defaults;
+    settings.min_size = value["min-size"].As<std::size_t>(settings.min_size);
+    settings.content_types = value["content-types"].As<std::vector<std::string>>(settings.content_types);
+
+    const auto encodings = value["encodings"];
+    if (!encodings.IsMissing()) {
+        settings.encodings.clear();
+        for (const auto& encoding : encodings) {
+            settings.encodings.push_back(ParseEncoding(encoding));
+        }
+    }
+    return settings;
+}
+
+namespace impl {
+
+std::optional<ResponseEncoding>
+NegotiateResponseEncoding(std::string_view accept_encoding, const std::vector<ResponseEncoding>& supported) {
+    if (supported.empty() || TrimView(accept_encoding).empty()) return std::nullopt;
+
+    std::optional<int> wildcard_weight;
+    std::vector<std::optional<int>> weights(supported.size());
+    for (const auto element : utils::text::SplitIntoStringViewVector(accept_encoding, ",")) {
+        const auto params_pos = element.find(';');
+        const auto coding = TrimView(element.substr(0, params_pos));
+        if (coding.empty()) continue;
+
+        std::optional<int> weight = kMaxQValue;
+        if (params_pos != std::string_view::npos) {
+            for (const auto param : utils::text::SplitIntoStringViewVector(element.substr(params_pos + 1), ";")) {
+                const auto trimmed = TrimView(param);
+                if (trimmed.size() > 2 && (trimmed[0] == 'q' || trimmed[0] == 'Q') && trimmed[1] == '=') {
+                    weight = ParseQValue(trimmed.substr(2));
+                }
+            }
+        }
+        if (!weight) continue;  // malformed element, ignore it
+
+        if (coding == "*") {
+            wildcard_weight = weight;
+            continue;
+        }
+        for (std::size_t i = 0; i < supported.size(); ++i) {
+            if (MatchesEncoding(coding, supported[i])) weights[i] = weight;
+        }
+    }
+
+    std::optional<ResponseEncoding> result;
+    int best_weight = 0;
+    for (std::size_t i = 0; i < supported.size(); ++i) {
+        const auto weight = weights[i].value_or(wildcard_weight.value_or(0));
+        if (weight > best_weight) {
+            best_weight = weight;
+            result = supported[i];
+        }
+    }
+    return result;
+}
+
+bool IsContentTypeCompressible(std::string_view content_type, const std::vector<std::string>& allowed) {
+    if (content_type.empty() || allowed.empty()) return false;
+
+    try {
+        const USERVER_NAMESPACE::http::ContentType parsed{content_type};
+        const utils::StrIcaseEqual equal;
+        for (const std::string_view entry : allowed) {
+            const auto slash_pos = entry.find('/');
+            if (slash_pos == std::string_view::npos) continue;
+
+            const auto subtype = entry.substr(slash_pos + 1);
+            if (equal(entry.substr(0, slash_pos), parsed.TypeToken()) &&
+                (subtype == "*" || equal(subtype, parsed.SubtypeToken()))) {
+                return true;
+            }
+        }
+    } catch (const USERVER_NAMESPACE::http::MalformedContentType& e) {
+        LOG_LIMITED_WARNING() << "Not compressing a response with malformed Content-Type: " << e;
+    }
+    return false;
+}
+
+}  // namespace impl
+
+ResponseCompression::ResponseCompression(const handlers::HttpHandlerBase&, ResponseCompressionSettings settings)
+    : settings_(std::move(settings)) {}
+
+void ResponseCompression::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    auto& response = request.GetHttpResponse();
+    const auto encoding = impl::NegotiateResponseEncoding(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding), settings_.encodings
+    );
+
+    if (response.IsBodyStreamed()) {
+        response.SetStreamBodyEncoder(std::make_unique<CompressingBodyEncoder>(settings_, request, encoding));
+        Next(request, context);
+        return;
+    }
+
+    Next(request, context);
+
+    if (!IsCompressible(settings_, request, response)) return;
+    AddVaryAcceptEncoding(response);
+    if (!encoding || response.GetData().size() < settings_.min_size) return;
+
+    CompressResponseBody(response, *encoding);
+}
+
+void ResponseCompression::CompressResponseBody(http::HttpResponse& response, ResponseEncoding encoding) const {
+    const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime("http_compress_response_body");
+
+    std::string compressed;
+    try {
+        switch (encoding) {
+            case ResponseEncoding::kGzip:
+                compressed = compression::gzip::Compress(response.GetData());
+                break;
+            case ResponseEncoding::kZstd:
+                compressed = compression::zstd::Compress(response.GetData());
+                break;
+        }
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to compress response body, sending it as is: " << e;
+        return;
+    }
+
+    // Incompressible data, no reason to make the client decompress it
+    if (compressed.size() >= response.GetData().size()) return;
+
+    WeakenETag(response);
+    response.SetContentEncoding(std::string{ToString(encoding)});
+    response.SetData(std::move(compressed));
+}
+
+ResponseCompressionFactory::ResponseCompressionFactory(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : HttpMiddlewareFactoryBase(config, context),
+      settings_(ParseResponseCompressionSettings(config, ResponseCompressionSettings{})) {}
+
+std::unique_ptr<HttpMiddlewareBase> ResponseCompressionFactory::Create(
+    const handlers::HttpHandlerBase& handler,
+    yaml_config::YamlConfig middleware_config
+) const {
+    return std::make_unique<ResponseCompression>(
+        handler, ParseResponseCompressionSettings(middleware_config, settings_)
+    );
+}
+
+yaml_config::Schema ResponseCompressionFactory::GetMiddlewareConfigSchema() const {
+    return yaml_config::impl::SchemaFromString(R"(
+type: object
+description: per-handler overrides of the response compression settings
+additionalProperties: false
+properties:
+    min-size:
+        type: integer
+        description: responses with smaller bodies are not compressed, not applied to streamed bodies
+        minimum: 0
+    content-types:
+        type: array
+        description: media types to compress, 'type/*' matches any subtype
+        items:
+            type: string
+            description: media type
+    encodings:
+        type: array
+        description: supported encodings in the order of preference
+        items:
+            type: string
+            description: encoding
+            enum:
+              - gzip
+              - zstd
+)");
+}
+
+yaml_config::Schema ResponseCompressionFactory::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<HttpMiddlewareFactoryBase>(R"(
+type: object
+description: Http response compression middleware
+additionalProperties: false
+properties:
+    min-size:
+        type: integer
+        description: responses with smaller bodies are not compressed, not applied to streamed bodies
+        defaultDescription: 1024
+        minimum: 0
+    content-types:
+        type: array
+        description: media types to compress, 'type/*' matches any subtype
+        defaultDescription: application/json, application/javascript, application/xml, text/*
+        items:
+            type: string
+            description: media type
+    encodings:
+        type: array
+        description: supported encodings in the order of preference
+        defaultDescription: zstd, gzip
+        items:
+            type: string
+            description: encoding
+            enum:
+              - gzip
+              - zstd
+)");
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
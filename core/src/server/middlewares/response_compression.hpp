@@ -0,0 +1,93 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+class HttpResponse;
+}
+
+namespace server::middlewares {
+
+enum class ResponseEncoding { kGzip, kZstd };
+
+std::string_view ToString(ResponseEncoding encoding);
+
+struct ResponseCompressionSettings final {
+    // Non-streamed bodies smaller than this are sent as is
+    std::size_t min_size{1024};
+    // Media types to compress, `type/*` matches any subtype
+    std::vector<std::string> content_types{
+        "application/json",
+        "application/javascript",
+        "application/xml",
+        "text/*",
+    };
+    // Supported encodings in the order of server preference
+    std::vector<ResponseEncoding> encodings{ResponseEncoding::kZstd, ResponseEncoding::kGzip};
+};
+
+ResponseCompressionSettings ParseResponseCompressionSettings(
+    const yaml_config::YamlConfig& value,
+    const ResponseCompressionSettings& defaults
+);
+
+namespace impl {
+
+/// Picks the encoding from `supported` (ordered by server preference) with the
+/// highest non-zero weight in the Accept-Encoding header value, RFC 9110 12.5.3
+std::optional<ResponseEncoding>
+NegotiateResponseEncoding(std::string_view accept_encoding, const std::vector<ResponseEncoding>& supported);
+
+bool IsContentTypeCompressible(std::string_view content_type, const std::vector<std::string>& allowed);
+
+}  // namespace impl
+
+class ResponseCompression final : public HttpMiddlewareBase {
+public:
+    static constexpr std::string_view kName = builtin::kResponseCompression;
+
+    ResponseCompression(const handlers::HttpHandlerBase&, ResponseCompressionSettings settings);
+
+private:
+    void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
+
+    void CompressResponseBody(http::HttpResponse& response, ResponseEncoding encoding) const;
+
+    const ResponseCompressionSettings settings_;
+};
+
+class ResponseCompressionFactory final : public HttpMiddlewareFactoryBase {
+public:
+    static constexpr std::string_view kName = ResponseCompression::kName;
+
+    ResponseCompressionFactory(const components::ComponentConfig&, const components::ComponentContext&);
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<HttpMiddlewareBase>
+    Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig middleware_config) const override;
+
+    yaml_config::Schema GetMiddlewareConfigSchema() const override;
+
+    const ResponseCompressionSettings settings_;
+};
+
+}  // namespace server::middlewares
+
+template <>
+inline constexpr bool components::kHasValidate<server::middlewares::ResponseCompressionFactory> = true;
+
+template <>
+inline constexpr auto components::kConfigFileMode<server::middlewares::ResponseCompressionFactory> =
+    ConfigFileMode::kNotRequired;
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <server/middlewares/response_compression.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares::test {
+
+namespace {
+
+const std::vector<ResponseEncoding> kZstdFirst{ResponseEncoding::kZstd, ResponseEncoding::kGzip};
+const std::vector<ResponseEncoding> kGzipFirst{ResponseEncoding::kGzip, ResponseEncoding::kZstd};
+const std::vector<ResponseEncoding> kGzipOnly{ResponseEncoding::kGzip};
+
+}  // namespace
+
+TEST(ResponseCompressionNegotiation, NoHeader) {
+    EXPECT_EQ(impl::NegotiateResponseEncoding("", kZstdFirst), std::nullopt);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("  ", kZstdFirst), std::nullopt);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("identity", kZstdFirst), std::nullopt);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("gzip", {}), std::nullopt);
+}
+
+TEST(ResponseCompressionNegotiation, ServerPreferenceOnTie) {
+    EXPECT_EQ(impl::NegotiateResponseEncoding("gzip, deflate, br, zstd", kZstdFirst), ResponseEncoding::kZstd);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("gzip, deflate, br, zstd", kGzipFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("gzip, zstd", kGzipOnly), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("zstd", kGzipOnly), std::nullopt);
+}
+
+TEST(ResponseCompressionNegotiation, Weights) {
+    EXPECT_EQ(impl::NegotiateResponseEncoding("zstd;q=0.5, gzip", kZstdFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("zstd;q=0.501, gzip;q=0.5", kGzipFirst), ResponseEncoding::kZstd);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("zstd ; Q=0 , gzip ; q=1.000", kZstdFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("zstd;q=0, gzip;q=0", kZstdFirst), std::nullopt);
+}
+
+TEST(ResponseCompressionNegotiation, Wildcard) {
+    EXPECT_EQ(impl::NegotiateResponseEncoding("*", kGzipFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("*;q=0.1, zstd;q=0.5", kGzipFirst), ResponseEncoding::kZstd);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("*;q=0, gzip", kZstdFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("*;q=0", kZstdFirst), std::nullopt);
+}
+
+TEST(ResponseCompressionNegotiation, Aliases) {
+    EXPECT_EQ(impl::NegotiateResponseEncoding("x-gzip", kZstdFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("GZIP", kZstdFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("ZStd", kGzipOnly), std::nullopt);
+}
+
+TEST(ResponseCompressionNegotiation, MalformedElementsIgnored) {
+    EXPECT_EQ(impl::NegotiateResponseEncoding("zstd;q=2, gzip;q=0.1", kZstdFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("zstd;q=abc, gzip;q=0.1", kZstdFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding("zstd;q=0.1234, gzip;q=0.1", kZstdFirst), ResponseEncoding::kGzip);
+    EXPECT_EQ(impl::NegotiateResponseEncoding(",,;q=1, gzip", kZstdFirst), ResponseEncoding::kGzip);
+}
+
+TEST(ResponseCompressionContentType, Matching) {
+    const ResponseCompressionSettings settings;
+
+    EXPECT_TRUE(impl::IsContentTypeCompressible("application/json", settings.content_types));
+    EXPECT_TRUE(impl::IsContentTypeCompressible("Application/JSON; charset=utf-8", settings.content_types));
+    EXPECT_TRUE(impl::IsContentTypeCompressible("text/plain", settings.content_types));
+    EXPECT_TRUE(impl::IsContentTypeCompressible("text/html;charset=utf-8", settings.content_types));
+
+    EXPECT_FALSE(impl::IsContentTypeCompressible("", settings.content_types));
+    EXPECT_FALSE(impl::IsContentTypeCompressible("image/png", settings.content_types));
+    EXPECT_FALSE(impl::IsContentTypeCompressible("application/octet-stream", settings.content_types));
+    EXPECT_FALSE(impl::IsContentTypeCompressible("not a content type", settings.content_types));
+    EXPECT_FALSE(impl::IsContentTypeCompressible("application/json", {}));
+}
+
+}  // namespace server::middlewares::test
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include "connection.hpp"
 
+#include <algorithm>
 #include <array>
 #include <system_error>
 #include <vector>
@@ -30,6 +31,37 @@ namespace server::net {
 namespace {
 constexpr std::string_view kHttp2Preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
 constexpr std::string_view kPrefaceBegin = kHttp2Preface.substr(0, 2);
+
+// Each coalesced response takes up to 2 iovecs, keep well below IOV_MAX
+constexpr std::size_t kMaxCoalescedResponses = 256;
+
+// RFC 9112 section 9.3.2: only the pipelined requests with safe methods may be
+// processed in parallel
+bool IsSafeMethod(const http::HttpRequest& request) {
+    const auto method = request.GetMethod();
+    return method == http::HttpMethod::kGet || method == http::HttpMethod::kHead ||
+           method == http::HttpMethod::kOptions;
+}
+
+// Writes all the data, resuming after short writes. Returns false if the peer
+// stopped accepting the data.
+bool WriteAllIoData(engine::io::WritableBase& stream, std::vector<engine::io::IoData>& io_data) {
+    auto begin = io_data.begin();
+    while (begin != io_data.end()) {
+        auto sent = stream.WriteAll(&*begin, static_cast<std::size_t>(io_data.end() - begin), {});
+        if (sent == 0) return false;
+
+        while (begin != io_data.end() && sent >= begin->len) {
+            sent -= begin->len;
+            ++begin;
+        }
+        if (begin != io_data.end()) {
+            begin->data = static_cast<const char*>(begin->data) + sent;
+            begin->len -= sent;
+        }
+    }
+    return true;
+}
 }  // namespace
 
 Connection::Connection(
@@ -124,8 +156,13 @@ void Connection::ListenForRequests() noexcept {
             }
             pending_data_size_ = 0;
 
-            for (auto&& request : pending_requests_) {
-                ProcessRequest(std::move(request));
+            if (config_.concurrent_pipelining && config_.http_version == HttpVersion::k11 &&
+                pending_requests_.size() > 1) {
+                ProcessPipelinedRequests();
+            } else {
+                for (auto&& request : pending_requests_) {
+                    ProcessRequest(std::move(request));
+                }
             }
             pending_requests_.resize(0);
             if (should_stop_accepting_requests) is_accepting_requests_ = false;
@@ -221,6 +258,70 @@ void Connection::ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr
     }
 }
 
+void Connection::ProcessPipelinedRequests() {
+    const auto window_size =
+        static_cast<std::ptrdiff_t>(std::max<std::size_t>(config_.requests_queue_size_threshold, 1));
+
+    // A consecutive stretch of requests with safe methods is processed in
+    // parallel, a request with an unsafe method is processed alone once the
+    // previous ones are done, and the following ones wait for it
+    auto window_begin = pending_requests_.begin();
+    while (window_begin != pending_requests_.end()) {
+        auto window_end = window_begin + 1;
+        if (IsSafeMethod(**window_begin)) {
+            while (window_end != pending_requests_.end() && window_end - window_begin < window_size &&
+                   IsSafeMethod(**window_end)) {
+                ++window_end;
+            }
+        }
+        ProcessPipelinedRequestsWindow(window_begin, window_end);
+        window_begin = window_end;
+    }
+}
+
+void Connection::ProcessPipelinedRequestsWindow(HttpRequestPtrIterator begin, HttpRequestPtrIterator end) {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(end - begin);
+    for (auto it = begin; it != end; ++it) {
+        if ((*it)->IsFinal()) {
+            is_accepting_requests_ = false;
+        }
+
+        stats_->active_request_count.Add(1);
+        tasks.push_back(request_handler_.StartRequestTask(*it));
+    }
+
+    // Responses in [ready_begin, it) are ready and not sent yet
+    auto ready_begin = begin;
+    for (auto it = begin; it != end; ++it) {
+        const auto index = it - begin;
+        auto& request = **it;
+        WaitForRequestTask(request, tasks[index]);
+
+        if (request.GetHttpResponse().IsBodyStreamed() || request.GetHttpResponse().HasFileBody() ||
+            request.IsUpgradeWebsocket()) {
+            SendResponsesCoalesced(ready_begin, it);
+            SendResponse(request);
+            ready_begin = it + 1;
+
+            if (request.IsUpgradeWebsocket() && peer_socket_) {
+                request.DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
+                is_accepting_requests_ = false;
+            }
+            continue;
+        }
+
+        const auto next = it + 1;
+        if (next == end || !tasks[index + 1].IsFinished() ||
+            static_cast<std::size_t>(next - ready_begin) >= kMaxCoalescedResponses) {
+            // Do not hold the ready responses while waiting for a slower handler
+            SendResponsesCoalesced(ready_begin, next);
+            ready_begin = next;
+        }
+    }
+    UASSERT(ready_begin == end);
+}
+
 bool Connection::ReadSome() {
     if (pending_data_size_ == pending_data_.size()) return true;
 
@@ -246,18 +347,22 @@ bool Connection::ReadSome() {
 
 engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept {
     auto request_task = request_handler_.StartRequestTask(request);
+    WaitForRequestTask(*request, request_task);
+    return request_task;
+}
 
+void Connection::WaitForRequestTask(http::HttpRequest& request, engine::TaskWithResult<void>& request_task) noexcept {
     if (engine::current_task::IsCancelRequested()) {
         // We could've packed all remaining requests into a vector and cancel them
         // in parallel. But pipelining is almost never used so why bother.
         request_task.SyncCancel();
         LOG_DEBUG() << "Request processing interrupted";
         is_response_chain_valid_ = false;
-        return request_task;  // avoids throwing and catching exception down below
+        return;  // avoids throwing and catching exception down below
     }
 
     try {
-        auto& response = request->GetHttpResponse();
+        auto& response = request.GetHttpResponse();
         if (response.IsBodyStreamed()) {
             // TODO: wait for TCP connection closure too
             response.WaitForHeadersEnd();
@@ -274,7 +379,7 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
             // tolerate its cost.
 
             request_task.WaitFor(config_.abort_check_delay);
-            if (!request_task.IsFinished()) {
+            if (!request_task.IsFinished() && peer_socket_) {
                 // Slow path for not-so-fast handlers
                 engine::io::ReadableBase& peer_read = *peer_socket_;
                 const auto task_num = engine::WaitAny(peer_read, request_task);
@@ -296,7 +401,7 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
         auto lvl =
             reason == engine::TaskCancellationReason::kUserRequest ? logging::Level::kWarning : logging::Level::kError;
         LOG_LIMITED(lvl) << "Handler task was cancelled with reason: " << ToString(reason);
-        auto& response = request->GetHttpResponse();
+        auto& response = request.GetHttpResponse();
         if (!response.IsReady()) {
             response.SetReady();
             response.SetStatusServiceUnavailable();
@@ -306,9 +411,8 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
         is_response_chain_valid_ = false;
     } catch (const std::exception& e) {
         LOG_WARNING() << "Request failed with unhandled exception: " << e;
-        request->MarkAsInternalServerError();
+        request.MarkAsInternalServerError();
     }
-    return request_task;
 }
 
 void Connection::SendResponse(http::HttpRequest& request) {
@@ -360,13 +464,95 @@ void Connection::SendResponse(http::HttpRequest& request) {
                                                                                            : logging::Level::kError;
             LOG(log_level) << "I/O error while sending data: " << ex;
             response.SetSendFailed(std::chrono::steady_clock::now());
+            StopAfterSendFailure();
         } catch (const std::exception& ex) {
             LOG_ERROR() << "Error while sending data: " << ex;
             response.SetSendFailed(std::chrono::steady_clock::now());
+            StopAfterSendFailure();
         }
     } else {
         response.SetSendFailed(std::chrono::steady_clock::now());
     }
+    FinishResponse(request);
+}
+
+void Connection::SendResponsesCoalesced(HttpRequestPtrIterator begin, HttpRequestPtrIterator end) {
+    if (begin == end) return;
+    if (end - begin == 1 || !is_response_chain_valid_ || !peer_socket_) {
+        for (auto it = begin; it != end; ++it) {
+            SendResponse(**it);
+        }
+        return;
+    }
+
+    const auto count = static_cast<std::size_t>(end - begin);
+    UASSERT(count <= kMaxCoalescedResponses);
+
+    // Headers of all the responses are stored in a single buffer, so the
+    // iovecs are built only after it stops growing.
+    std::string headers;
+    std::vector<std::size_t> header_ends;
+    std::vector<std::string_view> bodies;
+    header_ends.reserve(count);
+    bodies.reserve(count);
+    for (auto it = begin; it != end; ++it) {
+        auto& request = **it;
+        request.SetStartSendResponseTime();
+        USERVER_NAMESPACE::http::headers::HeadersString header;
+        bodies.push_back(request.GetHttpResponse().SerializeNotStreamed(header));
+        headers.append(header.data(), header.size());
+        header_ends.push_back(headers.size());
+    }
+
+    std::vector<engine::io::IoData> io_data;
+    io_data.reserve(count * 2);
+    std::size_t header_begin = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        io_data.push_back({headers.data() + header_begin, header_ends[i] - header_begin});
+        if (!bodies[i].empty()) {
+            io_data.push_back({bodies[i].data(), bodies[i].size()});
+        }
+        header_begin = header_ends[i];
+    }
+
+    bool is_sent = false;
+    try {
+        is_sent = WriteAllIoData(*peer_socket_, io_data);
+        if (!is_sent) LOG_WARNING() << "Peer " << Getpeername() << " stopped receiving coalesced responses";
+    } catch (const engine::io::IoSystemError& ex) {
+        // working with raw values because std::errc compares error_category
+        // default_error_category() fixed only in GCC 9.1 (PR libstdc++/60555)
+        auto log_level = ex.Code().value() == static_cast<int>(std::errc::broken_pipe) ? logging::Level::kWarning
+                                                                                       : logging::Level::kError;
+        LOG(log_level) << "I/O error while sending coalesced responses: " << ex;
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "Error while sending coalesced responses: " << ex;
+    }
+    if (!is_sent) StopAfterSendFailure();
+
+    const auto now = std::chrono::steady_clock::now();
+    header_begin = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& request = *begin[i];
+        auto& response = request.GetHttpResponse();
+        if (is_sent) {
+            response.SetSerializedSent(header_ends[i] - header_begin + bodies[i].size(), now);
+        } else {
+            response.SetSendFailed(now);
+        }
+        header_begin = header_ends[i];
+        FinishResponse(request);
+    }
+}
+
+void Connection::StopAfterSendFailure() noexcept {
+    // A part of the response may have been sent, the peer would take the
+    // following responses for the rest of it
+    is_response_chain_valid_ = false;
+    is_accepting_requests_ = false;
+}
+
+void Connection::FinishResponse(http::HttpRequest& request) {
     request.SetFinishSendResponseTime();
     stats_->active_request_count.Subtract(1);
     ++stats_->requests_processed_count;
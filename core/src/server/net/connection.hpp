@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <server/http/request_handler_base.hpp>
 #include <server/net/connection_config.hpp>
@@ -44,12 +45,21 @@ private:
 
     bool IsRequestTasksEmpty() const noexcept;
 
+    using HttpRequestPtr = std::shared_ptr<http::HttpRequest>;
+    using HttpRequestPtrIterator = std::vector<HttpRequestPtr>::iterator;
+
     void ListenForRequests() noexcept;
     void ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr);
+    void ProcessPipelinedRequests();
+    void ProcessPipelinedRequestsWindow(HttpRequestPtrIterator begin, HttpRequestPtrIterator end);
     bool WaitOnSocket(engine::Deadline deadline);
 
     engine::TaskWithResult<void> HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept;
+    void WaitForRequestTask(http::HttpRequest& request, engine::TaskWithResult<void>& request_task) noexcept;
     void SendResponse(http::HttpRequest& request);
+    void SendResponsesCoalesced(HttpRequestPtrIterator begin, HttpRequestPtrIterator end);
+    void FinishResponse(http::HttpRequest& request);
+    void StopAfterSendFailure() noexcept;
 
     std::string Getpeername() const;
 
@@ -66,7 +76,6 @@ private:
     std::unique_ptr<request::RequestParser> parser_{nullptr};
     bool is_http2_parser_{false};
 
-    using HttpRequestPtr = std::shared_ptr<http::HttpRequest>;
     std::vector<HttpRequestPtr> pending_requests_;
 
     engine::io::Sockaddr remote_address_;
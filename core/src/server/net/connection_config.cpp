@@ -26,6 +26,8 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<
         config.abort_check_delay = utils::StringToDuration(value["stream_close_check_delay"].As<std::string>());
     }
 
+    config.concurrent_pipelining = value["concurrent_pipelining"].As<bool>(config.concurrent_pipelining);
+
     config.http_version = value["http-version"].As<USERVER_NAMESPACE::http::HttpVersion>(config.http_version);
     if (config.http_version == USERVER_NAMESPACE::http::HttpVersion::kDefault) {
         config.http_version = USERVER_NAMESPACE::http::HttpVersion::k11;
@@ -1,5 +1,9 @@
 #include <server/net/connection.hpp>
 
+#include <array>
+#include <string>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -8,6 +12,7 @@
 #include <userver/clients/http/client.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/internal/net/net_listener.hpp>
 #include <userver/server/http/http_request.hpp>
 
 #include <userver/utest/http_client.hpp>
@@ -23,7 +28,7 @@ constexpr auto kAcceptTimeout = utest::kMaxTestWaitTime;
 
 class TestHttprequestHandler : public server::http::RequestHandlerBase {
 public:
-    enum class Behaviors { kNoop, kHang };
+    enum class Behaviors { kNoop, kHang, kEchoPath };
 
     explicit TestHttprequestHandler(Behaviors behavior = Behaviors::kNoop) : behavior_(behavior) {}
 
@@ -34,6 +39,37 @@ public:
         switch (behavior_) {
             case Behaviors::kNoop:
                 return engine::AsyncNoSpan([this]() { ++asyncs_finished; });
+            case Behaviors::kEchoPath:
+                // Responds with the request path. The request to "/0" finishes
+                // after `wait_for_started - 1` other requests if it is set.
+                // Checks that the requests with unsafe methods run alone.
+                return engine::AsyncNoSpan([this, http_request] {
+                    const bool is_safe = http_request->GetMethod() != server::http::HttpMethod::kPost;
+                    const auto running_before = running++;
+                    if (is_safe) {
+                        EXPECT_FALSE(unsafe_running);
+                    } else {
+                        EXPECT_EQ(running_before, 0);
+                        unsafe_running = true;
+                        engine::SleepFor(std::chrono::milliseconds{20});
+                        unsafe_running = false;
+                    }
+
+                    const auto& path = http_request->GetRequestPath();
+                    if (path == "/0" && wait_for_started != 0) {
+                        const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+                        while (asyncs_finished + 1 < wait_for_started && !deadline.IsReached()) {
+                            engine::SleepFor(std::chrono::milliseconds{1});
+                        }
+                        EXPECT_EQ(asyncs_finished + 1, wait_for_started);
+                    }
+
+                    auto& response = http_request->GetHttpResponse();
+                    response.SetStatusOk();
+                    response.SetData(path);
+                    --running;
+                    ++asyncs_finished;
+                });
             case Behaviors::kHang:
                 return engine::AsyncNoSpan([this]() {
                     engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
@@ -52,6 +88,12 @@ public:
 
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     mutable std::atomic<std::size_t> asyncs_finished{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    std::size_t wait_for_started{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<std::size_t> running{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<bool> unsafe_running{false};
 
 private:
     const Behaviors behavior_;
@@ -85,6 +127,35 @@ clients::http::ResponseFuture CreateRequest(
     return ret.async_perform();
 }
 
+// Returns the bodies of the responses to the pipelined requests, in order
+std::vector<std::string> ReceiveBodies(engine::io::Socket& client, std::size_t count, engine::Deadline deadline) {
+    constexpr std::string_view kContentLength = "Content-Length: ";
+    std::string replies;
+    std::array<char, 4096> buffer{};
+    std::vector<std::string> bodies;
+    std::size_t pos = 0;
+    while (bodies.size() < count) {
+        const auto headers_end = replies.find("\r\n\r\n", pos);
+        const auto length_pos = replies.find(kContentLength, pos);
+        if (headers_end != std::string::npos && length_pos != std::string::npos && length_pos < headers_end) {
+            const auto length_begin = length_pos + kContentLength.size();
+            const auto length_end = replies.find("\r\n", length_begin);
+            const auto length = std::stoul(replies.substr(length_begin, length_end - length_begin));
+            const auto body_begin = headers_end + 4;
+            if (replies.size() >= body_begin + length) {
+                bodies.push_back(replies.substr(body_begin, length));
+                pos = body_begin + length;
+                continue;
+            }
+        }
+
+        const auto received = client.RecvSome(buffer.data(), buffer.size(), deadline);
+        if (received == 0) break;
+        replies.append(buffer.data(), received);
+    }
+    return bodies;
+}
+
 net::ListenerConfig CreateConfig(
     USERVER_NAMESPACE::http::HttpVersion http_ver = USERVER_NAMESPACE::http::HttpVersion::k11
 ) {
@@ -355,4 +426,92 @@ UTEST_P(ServerNetConnection, CancelMultipleInFlight) {
     FAIL() << "Failed to simulate cancellation of multiple requests";
 }
 
+UTEST_MT(ServerNetConnectionPipelining, ConcurrentResponsesInOrder, 2) {
+    constexpr std::size_t kPipelinedRequests = 5;
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.concurrent_pipelining = true;
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    // The first request finishes after all the others
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kEchoPath};
+    handler.wait_for_started = kPipelinedRequests;
+
+    auto task = engine::AsyncNoSpan([&, server = std::move(server)]() mutable {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(server)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    std::string requests;
+    std::vector<std::string> expected_bodies;
+    for (std::size_t i = 0; i < kPipelinedRequests; ++i) {
+        requests += fmt::format("GET /{} HTTP/1.1\r\n\r\n", i);
+        expected_bodies.push_back(fmt::format("/{}", i));
+    }
+    ASSERT_EQ(client.SendAll(requests.data(), requests.size(), test_deadline), requests.size());
+
+    EXPECT_EQ(ReceiveBodies(client, kPipelinedRequests, test_deadline), expected_bodies);
+    EXPECT_EQ(handler.asyncs_finished, kPipelinedRequests);
+    EXPECT_EQ(stats->requests_processed_count.Load().value, kPipelinedRequests);
+
+    task.RequestCancel();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST_MT(ServerNetConnectionPipelining, UnsafeMethodsRunAlone, 4) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.concurrent_pipelining = true;
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kEchoPath};
+
+    auto task = engine::AsyncNoSpan([&, server = std::move(server)]() mutable {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(server)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    const std::string requests =
+        "GET /1 HTTP/1.1\r\n\r\n"
+        "GET /2 HTTP/1.1\r\n\r\n"
+        "POST /3 HTTP/1.1\r\nContent-Length: 0\r\n\r\n"
+        "GET /4 HTTP/1.1\r\n\r\n"
+        "POST /5 HTTP/1.1\r\nContent-Length: 0\r\n\r\n"
+        "GET /6 HTTP/1.1\r\n\r\n";
+    ASSERT_EQ(client.SendAll(requests.data(), requests.size(), test_deadline), requests.size());
+
+    const std::vector<std::string> expected_bodies{"/1", "/2", "/3", "/4", "/5", "/6"};
+    EXPECT_EQ(ReceiveBodies(client, expected_bodies.size(), test_deadline), expected_bodies);
+    EXPECT_EQ(handler.asyncs_finished, expected_bodies.size());
+
+    task.RequestCancel();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,263 @@
+#include <server/websocket/deflate.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+
+#include <zlib.h>
+
+#include <userver/compression/error.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+constexpr std::string_view kServerNoContextTakeover = "server_no_context_takeover";
+constexpr std::string_view kClientNoContextTakeover = "client_no_context_takeover";
+constexpr std::string_view kServerMaxWindowBits = "server_max_window_bits";
+constexpr std::string_view kClientMaxWindowBits = "client_max_window_bits";
+
+constexpr int kMaxWindowBits = 15;
+// zlib silently uses 9 bits windows instead of 8 bits ones for raw deflate
+constexpr int kMinWindowBits = 9;
+
+// Empty non-compressed deflate block that ends a block flushed with
+// Z_SYNC_FLUSH, it is not sent over the wire
+constexpr std::array<char, 4> kFlushTail{'\x00', '\x00', '\xff', '\xff'};
+constexpr std::size_t kInflateChunkSize = 16 * 1024;
+
+std::string_view TrimView(std::string_view view) {
+    while (!view.empty() && utils::text::IsAsciiSpace(view.front())) view.remove_prefix(1);
+    while (!view.empty() && utils::text::IsAsciiSpace(view.back())) view.remove_suffix(1);
+    return view;
+}
+
+std::optional<int> ParseWindowBits(std::string_view value) {
+    if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+        value = value.substr(1, value.size() - 2);
+    }
+    int bits = 0;
+    const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), bits);
+    if (ec != std::errc{} || ptr != value.data() + value.size() || bits < 8 || bits > kMaxWindowBits) {
+        return std::nullopt;
+    }
+    return bits;
+}
+
+/// @returns the agreed parameters if the offer is valid and acceptable
+std::optional<DeflateParams> AcceptOffer(std::string_view offer_params, const PerMessageDeflateConfig& config) {
+    bool server_no_context_takeover = false;
+    bool client_no_context_takeover = false;
+    std::optional<int> server_max_window_bits;
+    bool has_client_max_window_bits = false;
+    std::optional<int> client_max_window_bits;
+
+    for (const auto raw_param : utils::text::SplitIntoStringViewVector(offer_params, ";")) {
+        const auto param = TrimView(raw_param);
+        if (param.empty()) continue;
+
+        const auto eq_pos = param.find('=');
+        const auto name = TrimView(param.substr(0, eq_pos));
+        const auto value =
+            eq_pos == std::string_view::npos ? std::optional<std::string_view>{} : TrimView(param.substr(eq_pos + 1));
+
+        // Duplicate, unknown and malformed parameters make the offer invalid
+        if (name == kServerNoContextTakeover && !value && !server_no_context_takeover) {
+            server_no_context_takeover = true;
+        } else if (name == kClientNoContextTakeover && !value && !client_no_context_takeover) {
+            client_no_context_takeover = true;
+        } else if (name == kServerMaxWindowBits && value && !server_max_window_bits) {
+            server_max_window_bits = ParseWindowBits(*value);
+            if (!server_max_window_bits) return std::nullopt;
+        } else if (name == kClientMaxWindowBits && !has_client_max_window_bits) {
+            has_client_max_window_bits = true;
+            if (value) {
+                client_max_window_bits = ParseWindowBits(*value);
+                if (!client_max_window_bits) return std::nullopt;
+            }
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    DeflateParams params;
+    params.server_no_context_takeover = server_no_context_takeover || config.server_no_context_takeover;
+    params.client_no_context_takeover = client_no_context_takeover || config.client_no_context_takeover;
+    params.server_max_window_bits =
+        std::min(server_max_window_bits.value_or(kMaxWindowBits), config.server_max_window_bits);
+    if (params.server_max_window_bits < kMinWindowBits) return std::nullopt;
+
+    // The window of the client may be limited only if the client supports that
+    if (has_client_max_window_bits) {
+        params.client_max_window_bits =
+            std::min(client_max_window_bits.value_or(kMaxWindowBits), config.client_max_window_bits);
+    }
+    return params;
+}
+
+}  // namespace
+
+std::optional<DeflateParams>
+NegotiateDeflate(std::string_view extensions_header, const PerMessageDeflateConfig& config) {
+    if (!config.enabled) return std::nullopt;
+
+    for (const auto extension : utils::text::SplitIntoStringViewVector(extensions_header, ",")) {
+        const auto name_end = extension.find(';');
+        if (TrimView(extension.substr(0, name_end)) != kExtensionName) continue;
+
+        auto params = AcceptOffer(
+            name_end == std::string_view::npos ? std::string_view{} : extension.substr(name_end + 1), config
+        );
+        if (params) return params;
+    }
+    return std::nullopt;
+}
+
+std::string FormatDeflateResponse(const DeflateParams& params) {
+    std::string response{kExtensionName};
+    const auto append_param = [&response](std::string_view name) {
+        response += "; ";
+        response += name;
+    };
+
+    if (params.server_no_context_takeover) append_param(kServerNoContextTakeover);
+    if (params.client_no_context_takeover) append_param(kClientNoContextTakeover);
+    if (params.server_max_window_bits < kMaxWindowBits) {
+        append_param(kServerMaxWindowBits);
+        response += '=';
+        response += std::to_string(params.server_max_window_bits);
+    }
+    if (params.client_max_window_bits < kMaxWindowBits) {
+        append_param(kClientMaxWindowBits);
+        response += '=';
+        response += std::to_string(params.client_max_window_bits);
+    }
+    return response;
+}
+
+struct MessageDeflater::Impl {
+    z_stream stream{};
+    bool no_context_takeover{false};
+};
+
+MessageDeflater::MessageDeflater(const DeflateParams& params, const PerMessageDeflateConfig& config)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->no_context_takeover = params.server_no_context_takeover;
+    // Negative window bits make zlib write a raw deflate stream
+    const auto ret = deflateInit2(
+        &impl_->stream,
+        config.compression_level,
+        Z_DEFLATED,
+        -params.server_max_window_bits,
+        config.mem_level,
+        Z_DEFAULT_STRATEGY
+    );
+    if (ret != Z_OK) {
+        throw compression::CompressionError(impl_->stream.msg ? impl_->stream.msg : "failed to initialize deflate");
+    }
+}
+
+MessageDeflater::~MessageDeflater() { deflateEnd(&impl_->stream); }
+
+void MessageDeflater::Compress(std::string_view message, std::string& output) {
+    auto& stream = impl_->stream;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(message.data()));
+    stream.avail_in = static_cast<uInt>(message.size());
+
+    // The bound does not account for the flush markers, so the loop may
+    // rarely need more than one iteration
+    output.resize(deflateBound(&stream, message.size()) + kFlushTail.size());
+    std::size_t used = 0;
+    while (true) {
+        stream.next_out = reinterpret_cast<Bytef*>(output.data() + used);
+        stream.avail_out = static_cast<uInt>(output.size() - used);
+
+        const auto ret = deflate(&stream, Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            throw compression::CompressionError(stream.msg ? stream.msg : "deflate failed");
+        }
+        used = output.size() - stream.avail_out;
+        if (stream.avail_out != 0) break;
+        output.resize(output.size() * 2);
+    }
+
+    UASSERT(std::string_view(output.data(), used).substr(used - kFlushTail.size()) ==
+            std::string_view(kFlushTail.data(), kFlushTail.size()));
+    output.resize(used - kFlushTail.size());
+
+    if (impl_->no_context_takeover) deflateReset(&stream);
+}
+
+struct MessageInflater::Impl {
+    z_stream stream{};
+    bool no_context_takeover{false};
+
+    // @returns true if the final deflate block was reached
+    bool Inflate(std::string_view input, std::size_t max_size, std::string& output) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        stream.avail_in = static_cast<uInt>(input.size());
+
+        do {
+            const auto used = output.size();
+            output.resize(used + kInflateChunkSize);
+            stream.next_out = reinterpret_cast<Bytef*>(output.data() + used);
+            stream.avail_out = static_cast<uInt>(kInflateChunkSize);
+
+            const auto ret = inflate(&stream, Z_SYNC_FLUSH);
+            output.resize(output.size() - stream.avail_out);
+            if (output.size() > max_size) throw compression::TooBigError();
+
+            if (ret == Z_STREAM_END) {
+                // The client may end a message with a final block, the next
+                // message then starts a new stream with the same window
+                inflateReset(&stream);
+                return true;
+            }
+            if (ret != Z_OK && ret != Z_BUF_ERROR) {
+                throw compression::ErrWithCode(stream.msg ? stream.msg : "inflate failed");
+            }
+        } while (stream.avail_out == 0);
+        return false;
+    }
+};
+
+MessageInflater::MessageInflater(const DeflateParams& params) : impl_(std::make_unique<Impl>()) {
+    impl_->no_context_takeover = params.client_no_context_takeover;
+    // The negotiated client window only limits what the client writes, the
+    // largest window decodes a stream written with any window
+    if (inflateInit2(&impl_->stream, -kMaxWindowBits) != Z_OK) {
+        throw compression::ErrWithCode(impl_->stream.msg ? impl_->stream.msg : "failed to initialize inflate");
+    }
+}
+
+MessageInflater::~MessageInflater() { inflateEnd(&impl_->stream); }
+
+void MessageInflater::Decompress(std::string_view payload, std::size_t max_size, std::string& output) {
+    output.clear();
+    if (!impl_->Inflate(payload, max_size, output)) {
+        impl_->Inflate(std::string_view(kFlushTail.data(), kFlushTail.size()), max_size, output);
+    }
+
+    if (impl_->no_context_takeover) inflateReset(&impl_->stream);
+}
+
+std::string CompressStandalone(std::string_view message, const PerMessageDeflateConfig& config) {
+    DeflateParams params;
+    params.server_no_context_takeover = true;
+    params.server_max_window_bits = config.server_max_window_bits;
+
+    std::string result;
+    MessageDeflater{params, config}.Compress(message, result);
+    return result;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/server/websocket/server.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+/// Parameters of the permessage-deflate extension agreed with the client,
+/// see https://datatracker.ietf.org/doc/html/rfc7692#section-7.1
+struct DeflateParams final {
+    bool server_no_context_takeover{false};
+    bool client_no_context_takeover{false};
+    int server_max_window_bits{15};
+    int client_max_window_bits{15};
+};
+
+/// Picks the first acceptable permessage-deflate offer from the value of the
+/// `Sec-WebSocket-Extensions` request header, std::nullopt if there is none
+std::optional<DeflateParams>
+NegotiateDeflate(std::string_view extensions_header, const PerMessageDeflateConfig& config);
+
+/// Value of the `Sec-WebSocket-Extensions` response header
+std::string FormatDeflateResponse(const DeflateParams& params);
+
+/// Compresses the messages sent by the server
+class MessageDeflater final {
+public:
+    MessageDeflater(const DeflateParams& params, const PerMessageDeflateConfig& config);
+    ~MessageDeflater();
+
+    MessageDeflater(MessageDeflater&&) = delete;
+    MessageDeflater& operator=(MessageDeflater&&) = delete;
+
+    /// Compresses the message into `output`, the tail of the flushed deflate
+    /// block is stripped as RFC 7692 requires.
+    /// @throws compression::CompressionError
+    void Compress(std::string_view message, std::string& output);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// Decompresses the messages received from the client
+class MessageInflater final {
+public:
+    explicit MessageInflater(const DeflateParams& params);
+    ~MessageInflater();
+
+    MessageInflater(MessageInflater&&) = delete;
+    MessageInflater& operator=(MessageInflater&&) = delete;
+
+    /// Decompresses the payload of a message into `output`.
+    /// @throws compression::TooBigError if the message exceeds `max_size`
+    /// @throws compression::DecompressionError on invalid data
+    void Decompress(std::string_view payload, std::size_t max_size, std::string& output);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// Compresses a single message with a fresh compression context, the result
+/// may be sent to any client that agreed on server_no_context_takeover
+std::string CompressStandalone(std::string_view message, const PerMessageDeflateConfig& config);
+
+/// Creates a connection that uses permessage-deflate if `deflate_params` are
+/// set
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    const std::optional<DeflateParams>& deflate_params
+);
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
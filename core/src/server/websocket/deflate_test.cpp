@@ -0,0 +1,252 @@
+#include <server/websocket/deflate.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include <userver/compression/error.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ws = server::websocket;
+
+ws::PerMessageDeflateConfig MakeConfig() {
+    ws::PerMessageDeflateConfig config;
+    config.enabled = true;
+    config.min_compress_size = 0;
+    return config;
+}
+
+std::string MakeText() {
+    std::string text;
+    for (int i = 0; i < 100; ++i) {
+        text += "{\"instrument\": \"ABC\", \"price\": " + std::to_string(i) + "}\n";
+    }
+    return text;
+}
+
+// Reads what was written to it
+class MemorySocket final : public engine::io::RwBase {
+public:
+    bool IsValid() const override { return true; }
+
+    bool WaitReadable(engine::Deadline) override { return true; }
+
+    std::optional<size_t> ReadNoblock(void* buf, size_t len) override { return ReadSome(buf, len, {}); }
+
+    size_t ReadSome(void* buf, size_t len, engine::Deadline) override {
+        const auto size = std::min(len, data_.size() - read_pos_);
+        std::memcpy(buf, data_.data() + read_pos_, size);
+        read_pos_ += size;
+        return size;
+    }
+
+    size_t ReadAll(void* buf, size_t len, engine::Deadline deadline) override { return ReadSome(buf, len, deadline); }
+
+    bool WaitWriteable(engine::Deadline) override { return true; }
+
+    size_t WriteAll(const void* buf, size_t len, engine::Deadline) override {
+        data_.append(static_cast<const char*>(buf), len);
+        return len;
+    }
+
+    const std::string& GetWritten() const { return data_; }
+
+private:
+    std::string data_;
+    std::size_t read_pos_{0};
+};
+
+struct Connection {
+    MemorySocket* socket;
+    std::shared_ptr<ws::WebSocketConnection> connection;
+};
+
+Connection MakeConnection(const std::optional<ws::impl::DeflateParams>& params) {
+    auto socket = std::make_unique<MemorySocket>();
+    auto* socket_ptr = socket.get();
+    ws::Config config;
+    config.deflate = MakeConfig();
+    return {socket_ptr, ws::impl::MakeWebSocket(std::move(socket), engine::io::Sockaddr{}, config, params)};
+}
+
+// RSV1 bit of the first frame
+bool IsCompressedFrame(std::string_view frame) { return static_cast<unsigned char>(frame.at(0)) & 0x40; }
+
+}  // namespace
+
+TEST(WebsocketDeflate, Negotiate) {
+    const auto config = MakeConfig();
+
+    const auto params = ws::impl::NegotiateDeflate("permessage-deflate; client_max_window_bits", config);
+    ASSERT_TRUE(params);
+    EXPECT_FALSE(params->server_no_context_takeover);
+    EXPECT_EQ(params->client_max_window_bits, 15);
+    EXPECT_EQ(ws::impl::FormatDeflateResponse(*params), "permessage-deflate");
+
+    const auto limited = ws::impl::NegotiateDeflate(
+        "x-webkit-deflate-frame, permessage-deflate; server_max_window_bits=8, "
+        "permessage-deflate; server_no_context_takeover; server_max_window_bits=10; client_max_window_bits=\"12\"",
+        config
+    );
+    ASSERT_TRUE(limited);
+    EXPECT_EQ(
+        ws::impl::FormatDeflateResponse(*limited),
+        "permessage-deflate; server_no_context_takeover; server_max_window_bits=10; client_max_window_bits=12"
+    );
+}
+
+TEST(WebsocketDeflate, NegotiateDeclined) {
+    auto config = MakeConfig();
+    EXPECT_FALSE(ws::impl::NegotiateDeflate("", config));
+    EXPECT_FALSE(ws::impl::NegotiateDeflate("permessage-deflate; unknown_param", config));
+    EXPECT_FALSE(ws::impl::NegotiateDeflate("permessage-deflate; server_max_window_bits=16", config));
+    EXPECT_FALSE(ws::impl::NegotiateDeflate(
+        "permessage-deflate; server_no_context_takeover; server_no_context_takeover", config
+    ));
+
+    config.enabled = false;
+    EXPECT_FALSE(ws::impl::NegotiateDeflate("permessage-deflate", config));
+}
+
+TEST(WebsocketDeflate, NegotiateServerLimits) {
+    auto config = MakeConfig();
+    config.client_no_context_takeover = true;
+    config.server_max_window_bits = 11;
+    config.client_max_window_bits = 10;
+
+    const auto params = ws::impl::NegotiateDeflate("permessage-deflate; client_max_window_bits", config);
+    ASSERT_TRUE(params);
+    EXPECT_EQ(
+        ws::impl::FormatDeflateResponse(*params),
+        "permessage-deflate; client_no_context_takeover; server_max_window_bits=11; client_max_window_bits=10"
+    );
+
+    // The window of a client that does not support the limit stays default
+    const auto default_client = ws::impl::NegotiateDeflate("permessage-deflate", config);
+    ASSERT_TRUE(default_client);
+    EXPECT_EQ(default_client->client_max_window_bits, 15);
+}
+
+TEST(WebsocketDeflate, RoundTrip) {
+    const auto config = MakeConfig();
+    for (const bool no_context_takeover : {false, true}) {
+        ws::impl::DeflateParams params;
+        params.server_no_context_takeover = no_context_takeover;
+        params.client_no_context_takeover = no_context_takeover;
+
+        ws::impl::MessageDeflater deflater{params, config};
+        ws::impl::MessageInflater inflater{params};
+
+        const auto text = MakeText();
+        std::string compressed;
+        std::string decompressed;
+        for (int i = 0; i < 3; ++i) {
+            deflater.Compress(text, compressed);
+            EXPECT_LT(compressed.size(), text.size());
+            inflater.Decompress(compressed, text.size(), decompressed);
+            EXPECT_EQ(decompressed, text);
+        }
+
+        deflater.Compress(text, compressed);
+        UEXPECT_THROW(inflater.Decompress(compressed, text.size() - 1, decompressed), compression::TooBigError);
+    }
+}
+
+TEST(WebsocketDeflate, ClientWindowLargerThanNegotiated) {
+    // Not compressible within the message, so the repeated message refers to
+    // the previous one further than the negotiated window
+    std::string text;
+    std::uint32_t state = 1;
+    for (int i = 0; i < 2000; ++i) {
+        state = state * 1103515245 + 12345;
+        text += static_cast<char>('a' + (state >> 16) % 26);
+    }
+
+    const auto config = MakeConfig();
+    ws::impl::MessageDeflater client_deflater{ws::impl::DeflateParams{}, config};
+    ws::impl::DeflateParams params;
+    params.client_max_window_bits = 9;
+    ws::impl::MessageInflater inflater{params};
+
+    std::string compressed;
+    std::string decompressed;
+    for (int i = 0; i < 3; ++i) {
+        client_deflater.Compress(text, compressed);
+        UEXPECT_NO_THROW(inflater.Decompress(compressed, text.size(), decompressed));
+        EXPECT_EQ(decompressed, text);
+    }
+}
+
+TEST(WebsocketDeflate, InvalidData) {
+    ws::impl::MessageInflater inflater{ws::impl::DeflateParams{}};
+    std::string decompressed;
+    UEXPECT_THROW(inflater.Decompress("\xff\xff\xff\xff", 1024, decompressed), compression::DecompressionError);
+}
+
+UTEST(WebsocketDeflate, SendRecv) {
+    auto connection = MakeConnection(ws::impl::DeflateParams{});
+    const auto text = MakeText();
+    connection.connection->SendText(text);
+    connection.connection->SendText(text);
+
+    const auto& written = connection.socket->GetWritten();
+    EXPECT_TRUE(IsCompressedFrame(written));
+    EXPECT_LT(written.size(), text.size());
+
+    ws::Message message;
+    for (int i = 0; i < 2; ++i) {
+        connection.connection->Recv(message);
+        EXPECT_FALSE(message.close_status);
+        EXPECT_TRUE(message.is_text);
+        EXPECT_EQ(message.data, text);
+    }
+}
+
+UTEST(WebsocketDeflate, CompressedFrameWithoutExtension) {
+    auto sender = MakeConnection(ws::impl::DeflateParams{});
+    sender.connection->SendText(MakeText());
+
+    auto receiver = MakeConnection(std::nullopt);
+    const auto& frames = sender.socket->GetWritten();
+    ASSERT_EQ(receiver.socket->WriteAll(frames.data(), frames.size(), {}), frames.size());
+
+    ws::Message message;
+    receiver.connection->Recv(message);
+    EXPECT_EQ(message.close_status, ws::CloseStatus::kProtocolError);
+}
+
+UTEST(WebsocketDeflate, PreparedMessage) {
+    const auto text = MakeText();
+    const ws::PreparedMessage prepared{text, /*is_text=*/true, MakeConfig()};
+    EXPECT_EQ(prepared.GetPayloadSize(), text.size());
+
+    ws::impl::DeflateParams no_context_takeover;
+    no_context_takeover.server_no_context_takeover = true;
+
+    auto compressed = MakeConnection(no_context_takeover);
+    auto takeover = MakeConnection(ws::impl::DeflateParams{});
+    auto plain = MakeConnection(std::nullopt);
+    for (auto* connection : {&compressed, &takeover, &plain}) {
+        connection->connection->SendPrepared(prepared);
+        connection->connection->SendPrepared(prepared);
+    }
+
+    EXPECT_TRUE(IsCompressedFrame(compressed.socket->GetWritten()));
+    EXPECT_FALSE(IsCompressedFrame(takeover.socket->GetWritten()));
+    EXPECT_FALSE(IsCompressedFrame(plain.socket->GetWritten()));
+
+    for (auto* connection : {&compressed, &takeover, &plain}) {
+        ws::Message message;
+        for (int i = 0; i < 2; ++i) {
+            connection->connection->Recv(message);
+            EXPECT_TRUE(message.is_text);
+            EXPECT_EQ(message.data, text);
+        }
+    }
+}
+
+USERVER_NAMESPACE_END
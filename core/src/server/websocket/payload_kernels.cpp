@@ -0,0 +1,272 @@
+#include <server/websocket/payload_kernels.hpp>
+
+#include <array>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+#if defined(__AVX2__)
+
+constexpr std::size_t kBlockSize = sizeof(__m256i);
+
+// Error bits of the lookup tables, a byte pair is invalid if the bit is set in
+// all the three lookups
+constexpr char kTooShort = 1 << 0;  // lead byte is not followed by a continuation
+constexpr char kTooLong = 1 << 1;   // ASCII followed by a continuation
+constexpr char kOverlong3 = 1 << 2;
+constexpr char kTooLarge = 1 << 3;
+constexpr char kSurrogate = 1 << 4;
+constexpr char kOverlong2 = 1 << 5;
+constexpr char kTooLarge1000 = 1 << 6;
+constexpr char kOverlong4 = 1 << 6;
+constexpr char kTwoConts = static_cast<char>(1 << 7);  // continuation not after a lead byte
+constexpr char kCarry = kTooShort | kTooLong | kTwoConts;
+
+__m256i Lookup16(__m256i nibbles, __m256i table) noexcept { return _mm256_shuffle_epi8(table, nibbles); }
+
+__m256i HighNibbles(__m256i input) noexcept {
+    return _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0f));
+}
+
+__m256i LowNibbles(__m256i input) noexcept { return _mm256_and_si256(input, _mm256_set1_epi8(0x0f)); }
+
+// Bytes of `input` shifted by N positions, with the last bytes of `prev` in front
+template <int N>
+__m256i Prev(__m256i input, __m256i prev) noexcept {
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+}
+
+// Errors of the byte pairs, the pairs that may be the 3rd and the 4th bytes of
+// a code point are checked separately
+__m256i CheckSpecialCases(__m256i input, __m256i prev1) noexcept {
+    // clang-format off
+    const auto byte_1_high = _mm256_setr_epi8(
+        // 0_______ ________ <ASCII in byte 1>
+        kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+        // 10______ ________ <continuation in byte 1>
+        kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+        // 1100____ ________ <two byte lead in byte 1>
+        kTooShort | kOverlong2,
+        // 1101____ ________ <two byte lead in byte 1>
+        kTooShort,
+        // 1110____ ________ <three byte lead in byte 1>
+        kTooShort | kOverlong3 | kSurrogate,
+        // 1111____ ________ <four+ byte lead in byte 1>
+        kTooShort | kTooLarge | kTooLarge1000 | kOverlong4,
+
+        kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+        kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+        kTooShort | kOverlong2,
+        kTooShort,
+        kTooShort | kOverlong3 | kSurrogate,
+        kTooShort | kTooLarge | kTooLarge1000 | kOverlong4
+    );
+    const auto byte_1_low = _mm256_setr_epi8(
+        // ____0000 ________
+        kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+        // ____0001 ________
+        kCarry | kOverlong2,
+        // ____001_ ________
+        kCarry, kCarry,
+        // ____0100 ________
+        kCarry | kTooLarge,
+        // ____0101 ________
+        kCarry | kTooLarge | kTooLarge1000,
+        // ____011_ ________
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        // ____1___ ________
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        // ____1101 ________
+        kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+
+        kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+        kCarry | kOverlong2,
+        kCarry, kCarry,
+        kCarry | kTooLarge,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+        kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000
+    );
+    const auto byte_2_high = _mm256_setr_epi8(
+        // ________ 0_______ <ASCII in byte 2>
+        kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+        // ________ 1000____
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+        // ________ 1001____
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+        // ________ 101_____
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        // ________ 11______
+        kTooShort, kTooShort, kTooShort, kTooShort,
+
+        kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooShort, kTooShort, kTooShort, kTooShort
+    );
+    // clang-format on
+
+    return _mm256_and_si256(
+        _mm256_and_si256(Lookup16(HighNibbles(prev1), byte_1_high), Lookup16(LowNibbles(prev1), byte_1_low)),
+        Lookup16(HighNibbles(input), byte_2_high)
+    );
+}
+
+__m256i CheckMultibyteLengths(__m256i input, __m256i prev_input, __m256i special_cases) noexcept {
+    // Only 111_____ and 1111____ are >= 0x80 after the subtraction
+    const auto is_third_byte = _mm256_subs_epu8(Prev<2>(input, prev_input), _mm256_set1_epi8(0xe0 - 0x80));
+    const auto is_fourth_byte = _mm256_subs_epu8(Prev<3>(input, prev_input), _mm256_set1_epi8(0xf0 - 0x80));
+    const auto must_be_continuation =
+        _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(static_cast<char>(0x80)));
+    return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+// Nonzero if the block ends with an incomplete code point
+__m256i IsIncomplete(__m256i input) noexcept {
+    const auto max_value = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,              //
+        static_cast<char>(0xf0 - 1),
+        static_cast<char>(0xe0 - 1),
+        static_cast<char>(0xc0 - 1)
+    );
+    return _mm256_subs_epu8(input, max_value);
+}
+
+bool IsZero(__m256i value) noexcept { return _mm256_testz_si256(value, value); }
+
+bool IsValidUtf8Avx2(const std::uint8_t* data, std::size_t size) noexcept {
+    auto error = _mm256_setzero_si256();
+    auto prev_input = _mm256_setzero_si256();
+    auto prev_incomplete = _mm256_setzero_si256();
+
+    const auto process = [&](__m256i input) {
+        if (_mm256_movemask_epi8(input) == 0) {
+            // ASCII block may not follow an incomplete code point
+            error = _mm256_or_si256(error, prev_incomplete);
+        } else {
+            const auto special_cases = CheckSpecialCases(input, Prev<1>(input, prev_input));
+            error = _mm256_or_si256(error, CheckMultibyteLengths(input, prev_input, special_cases));
+            prev_incomplete = IsIncomplete(input);
+        }
+        prev_input = input;
+    };
+
+    std::size_t pos = 0;
+    for (; pos + kBlockSize <= size; pos += kBlockSize) {
+        process(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)));
+        // Fail fast on the large invalid texts
+        if (pos % (16 * kBlockSize) == 0 && !IsZero(error)) return false;
+    }
+    if (pos < size) {
+        // Zero padding acts as ASCII
+        std::array<std::uint8_t, kBlockSize> tail{};
+        std::memcpy(tail.data(), data + pos, size - pos);
+        process(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail.data())));
+    }
+    error = _mm256_or_si256(error, prev_incomplete);
+    return IsZero(error);
+}
+
+#elif defined(__SSE2__)
+
+constexpr std::size_t kBlockSize = sizeof(__m128i);
+
+bool IsAsciiBlock(const std::uint8_t* data) noexcept {
+    return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))) == 0;
+}
+
+#else
+
+constexpr std::size_t kBlockSize = sizeof(std::uint64_t);
+
+bool IsAsciiBlock(const std::uint8_t* data) noexcept {
+    std::uint64_t block = 0;
+    std::memcpy(&block, data, sizeof(block));
+    return (block & 0x8080808080808080) == 0;
+}
+
+#endif
+
+}  // namespace
+
+void XorMaskInplace(std::uint8_t* data, std::size_t size, std::uint32_t mask) noexcept {
+    std::size_t pos = 0;
+
+    // The vectors repeat the key, so every vector starts at a multiple of 4
+#if defined(__AVX2__)
+    const auto mask256 = _mm256_set1_epi32(static_cast<int>(mask));
+    for (; pos + sizeof(__m256i) <= size; pos += sizeof(__m256i)) {
+        auto* block = reinterpret_cast<__m256i*>(data + pos);
+        _mm256_storeu_si256(block, _mm256_xor_si256(_mm256_loadu_si256(block), mask256));
+    }
+#endif
+#if defined(__SSE2__)
+    const auto mask128 = _mm_set1_epi32(static_cast<int>(mask));
+    for (; pos + sizeof(__m128i) <= size; pos += sizeof(__m128i)) {
+        auto* block = reinterpret_cast<__m128i*>(data + pos);
+        _mm_storeu_si128(block, _mm_xor_si128(_mm_loadu_si128(block), mask128));
+    }
+#endif
+
+    const std::uint64_t mask64 = (std::uint64_t{mask} << 32) | mask;
+    for (; pos + sizeof(mask64) <= size; pos += sizeof(mask64)) {
+        std::uint64_t block = 0;
+        std::memcpy(&block, data + pos, sizeof(block));
+        block ^= mask64;
+        std::memcpy(data + pos, &block, sizeof(block));
+    }
+
+    std::array<std::uint8_t, sizeof(mask)> mask8{};
+    std::memcpy(mask8.data(), &mask, sizeof(mask));
+    for (; pos < size; ++pos) {
+        data[pos] ^= mask8[pos % sizeof(mask)];
+    }
+}
+
+bool IsValidUtf8(std::string_view text) noexcept {
+    const auto* data = reinterpret_cast<const std::uint8_t*>(text.data());
+    const auto size = text.size();
+
+#if defined(__AVX2__)
+    return IsValidUtf8Avx2(data, size);
+#else
+    std::size_t pos = 0;
+    while (pos < size) {
+        // `pos` always points to the start of a code point
+        if (pos + kBlockSize <= size && IsAsciiBlock(data + pos)) {
+            pos += kBlockSize;
+            continue;
+        }
+        if (!utils::text::utf8::IsWellFormedCodePoint(data + pos, size - pos)) return false;
+        pos += utils::text::utf8::CodePointLengthByFirstByte(data[pos]);
+    }
+    return true;
+#endif
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+/// XORs the payload of a frame with its masking key in place, `mask` holds the
+/// 4 bytes of the key in the order they are received.
+///
+/// Uses AVX2 or SSE2 if the code is compiled for them.
+void XorMaskInplace(std::uint8_t* data, std::size_t size, std::uint32_t mask) noexcept;
+
+/// Checks that the payload of a text message is a valid UTF-8, as required by
+/// https://datatracker.ietf.org/doc/html/rfc6455#section-8.1
+///
+/// With AVX2 the whole text is validated with vector lookups, see
+/// "Validating UTF-8 In Less Than One Instruction Per Byte" by J. Keiser and
+/// D. Lemire. With SSE2 only the ASCII blocks are skipped with vector
+/// instructions.
+bool IsValidUtf8(std::string_view text) noexcept;
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,84 @@
+#include <server/websocket/payload_kernels.hpp>
+
+#include <array>
+#include <cstring>
+#include <string>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::websocket::impl::IsValidUtf8;
+using server::websocket::impl::XorMaskInplace;
+
+std::string ScalarXorMask(std::string data, std::uint32_t mask) {
+    std::array<char, sizeof(mask)> mask8{};
+    std::memcpy(mask8.data(), &mask, sizeof(mask));
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] ^= mask8[i % mask8.size()];
+    }
+    return data;
+}
+
+// Puts the text at every position of the vector blocks
+std::string Shifted(std::string_view text, std::size_t shift) { return std::string(shift, 'a') + std::string{text}; }
+
+}  // namespace
+
+TEST(WebsocketPayloadKernels, XorMask) {
+    constexpr std::uint32_t kMask = 0x12345678;
+    std::string payload;
+    for (std::size_t size = 0; size < 200; ++size) {
+        // Odd offsets make the payload unaligned
+        for (std::size_t offset = 0; offset < 4; ++offset) {
+            auto data = std::string(offset, '\0') + payload;
+            XorMaskInplace(reinterpret_cast<std::uint8_t*>(data.data() + offset), payload.size(), kMask);
+            EXPECT_EQ(data.substr(offset), ScalarXorMask(payload, kMask)) << "size=" << size << " offset=" << offset;
+
+            // XOR with the same mask restores the payload
+            XorMaskInplace(reinterpret_cast<std::uint8_t*>(data.data() + offset), payload.size(), kMask);
+            EXPECT_EQ(data.substr(offset), payload);
+        }
+        payload.push_back(static_cast<char>(size * 31));
+    }
+}
+
+TEST(WebsocketPayloadKernels, ValidUtf8) {
+    const std::string_view valid_texts[] = {
+        "",
+        "ascii only",
+        "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82",  // 2 bytes
+        "\xe2\x82\xac \xef\xbf\xbf \xed\x9f\xbf",            // 3 bytes
+        "\xf0\x9f\x98\x80 \xf4\x8f\xbf\xbf",                 // 4 bytes
+    };
+    for (const auto text : valid_texts) {
+        for (std::size_t shift = 0; shift < 70; ++shift) {
+            EXPECT_TRUE(IsValidUtf8(Shifted(text, shift))) << "shift=" << shift;
+        }
+    }
+}
+
+TEST(WebsocketPayloadKernels, InvalidUtf8) {
+    const std::string_view invalid_texts[] = {
+        "\x80",              // continuation without a lead byte
+        "\xff",              // invalid byte
+        "\xc0\xaf",          // overlong 2 bytes
+        "\xe0\x80\xaf",      // overlong 3 bytes
+        "\xf0\x80\x80\xaf",  // overlong 4 bytes
+        "\xed\xa0\x80",      // surrogate
+        "\xf4\x90\x80\x80",  // above U+10FFFF
+        "\xe2\x82",          // truncated
+        "\xf0\x9f\x98",      // truncated
+        "\xe2\x82" "a",      // ASCII after a lead byte
+    };
+    for (const auto text : invalid_texts) {
+        for (std::size_t shift = 0; shift < 70; ++shift) {
+            EXPECT_FALSE(IsValidUtf8(Shifted(text, shift))) << "shift=" << shift;
+            EXPECT_FALSE(IsValidUtf8(Shifted(text, shift) + std::string(100, 'a'))) << "shift=" << shift;
+        }
+    }
+}
+
+USERVER_NAMESPACE_END
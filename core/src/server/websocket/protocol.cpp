@@ -11,6 +11,8 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/span.hpp>
 
+#include <server/websocket/payload_kernels.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::websocket::impl {
@@ -55,26 +57,6 @@ union Mask32 {
     uint8_t mask8[4];
 };
 
-void XorMaskInplace(uint8_t* dest, size_t len, Mask32 mask) {
-    // Check if the pointer is aligned for uint32_t operations
-    const auto alignment = reinterpret_cast<std::uintptr_t>(dest) % sizeof(uint32_t);
-
-    if (alignment == 0 && len >= sizeof(uint32_t)) {
-        // Pointer is aligned, we can safely use uint32_t operations
-        auto* dest32 = reinterpret_cast<uint32_t*>(dest);
-        while (len >= sizeof(uint32_t)) {
-            *(dest32++) ^= mask.mask32;
-            len -= sizeof(uint32_t);
-        }
-        dest = reinterpret_cast<uint8_t*>(dest32);
-    }
-
-    // Process remaining bytes (or all bytes if unaligned) using byte operations
-    for (size_t i = 0; i < len; ++i) {
-        dest[i] ^= mask.mask8[i % 4];
-    }
-}
-
 template <class T, class V>
 void PushRaw(const T& value, V& data) {
     const auto* valBytes = reinterpret_cast<const char*>(&value);
@@ -85,8 +67,13 @@ void PushRaw(const T& value, V& data) {
 
 namespace frames {
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final) {
+boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed
+) {
     boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
     frame.resize(sizeof(WSHeader));
@@ -97,6 +84,10 @@ DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is
     hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
     hdr->bits.opcode = is_text ? kText : kBinary;
     if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+    // Only the first frame of a compressed message is marked
+    if (is_compressed == Compressed::kYes && is_continuation == Continuation::kNo) {
+        hdr->bits.reserved = kReservedCompressedBit;
+    }
 
     if (data.size() <= 125) {
         hdr->bits.payload_len = data.size();
@@ -194,6 +185,12 @@ CloseStatus ReadWSFrameImpl(
         return CloseStatus::kProtocolError;
     }
 
+    const bool isCompressed = hdr.bits.reserved & kReservedCompressedBit;
+    if (isCompressed && (!frame.compression_allowed || (hdr.bits.opcode != kText && hdr.bits.opcode != kBinary))) {
+        // only the first frame of a data message may be compressed
+        return CloseStatus::kProtocolError;
+    }
+
     if (payload_len + frame.payload->size() > max_payload_size) return CloseStatus::kTooBigData;
 
     Mask32 mask;
@@ -215,7 +212,9 @@ CloseStatus ReadWSFrameImpl(
 
         // Apply masking only to the current frame's data, not to the entire buffer
         if (mask.mask32)
-            XorMaskInplace(reinterpret_cast<uint8_t*>(frame.payload->data() + newPayloadOffset), payload_len, mask);
+            XorMaskInplace(
+                reinterpret_cast<uint8_t*>(frame.payload->data() + newPayloadOffset), payload_len, mask.mask32
+            );
     }
     const char opcode = hdr.bits.opcode;
     const char fin = hdr.bits.fin;
@@ -235,8 +234,13 @@ CloseStatus ReadWSFrameImpl(
             break;
         case kText:
             frame.is_text = true;
-            [[fallthrough]];
+            frame.is_compressed = isCompressed;
+            frame.waiting_continuation = !fin;
+            break;
         case kBinary:
+            frame.is_text = false;
+            frame.is_compressed = isCompressed;
+            [[fallthrough]];
         case kContinuation:
             frame.waiting_continuation = !fin;
             break;
@@ -61,6 +61,10 @@ union WSHeader {
 
 static_assert(sizeof(WSHeader) == 2);
 
+/// RSV1 bit in WSHeader::bits::reserved, marks the first frame of a
+/// compressed message, see https://datatracker.ietf.org/doc/html/rfc7692#section-6
+constexpr inline unsigned char kReservedCompressedBit = 0b100;
+
 constexpr inline unsigned int kMaxFrameHeaderSize = sizeof(WSHeader) + sizeof(uint64_t);
 
 namespace frames {
@@ -75,8 +79,18 @@ enum class Final {
     kNo,
 };
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final);
+enum class Compressed {
+    kYes,
+    kNo,
+};
+
+boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed = Compressed::kNo
+);
 std::array<char, sizeof(WSHeader)> MakeControlFrame(WSOpcodes opcode, utils::span<const std::byte> data = {});
 std::string CloseFrame(CloseStatusInt status_code);
 
@@ -92,6 +106,10 @@ struct FrameParserState {
     bool pong_received = false;
     bool waiting_continuation = false;
     bool is_text = false;
+    // the message is compressed with permessage-deflate
+    bool is_compressed = false;
+    // permessage-deflate is negotiated, so RSV1 bit is allowed
+    bool compression_allowed = false;
     CloseStatusInt remote_close_status = 0;
     size_t offset_when_noblock = 0;
 
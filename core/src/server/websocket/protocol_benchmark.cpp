@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include <server/websocket/payload_kernels.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint32_t kMask = 0x37fa213d;
+
+std::string MakeAsciiText(std::size_t size) {
+    std::string text;
+    text.reserve(size);
+    while (text.size() < size) {
+        text += static_cast<char>('a' + text.size() % 26);
+    }
+    return text;
+}
+
+// Mostly ASCII with a 2, 3 or 4 bytes long code point every few dozens bytes
+std::string MakeMixedText(std::size_t size) {
+    static constexpr const char* kCodePoints[] = {"\xd0\x96", "\xe2\x82\xac", "\xf0\x9f\x98\x80"};
+
+    std::string text;
+    text.reserve(size + 4);
+    std::size_t i = 0;
+    while (text.size() < size) {
+        if (i % 32 == 31) {
+            text += kCodePoints[(i / 32) % 3];
+        } else {
+            text += static_cast<char>('a' + i % 26);
+        }
+        ++i;
+    }
+    // Replaces the code point that is cut by the end of the text
+    text.resize(size);
+    while (!text.empty() && (text.back() & 0x80)) {
+        text.pop_back();
+    }
+    text.resize(size, 'x');
+    return text;
+}
+
+}  // namespace
+
+void WebsocketProtocolUnmask(benchmark::State& state) {
+    std::string payload(state.range(0), '\x5a');
+    auto* data = reinterpret_cast<std::uint8_t*>(payload.data());
+
+    for ([[maybe_unused]] auto _ : state) {
+        server::websocket::impl::XorMaskInplace(data, payload.size(), kMask);
+        benchmark::DoNotOptimize(payload.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(WebsocketProtocolUnmask)->RangeMultiplier(4)->Range(64, 1 << 20);
+
+void WebsocketProtocolValidateAsciiText(benchmark::State& state) {
+    const auto text = MakeAsciiText(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(server::websocket::impl::IsValidUtf8(text));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(WebsocketProtocolValidateAsciiText)->RangeMultiplier(4)->Range(64, 1 << 20);
+
+void WebsocketProtocolValidateMixedText(benchmark::State& state) {
+    const auto text = MakeMixedText(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(server::websocket::impl::IsValidUtf8(text));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(WebsocketProtocolValidateMixedText)->RangeMultiplier(4)->Range(64, 1 << 20);
+
+USERVER_NAMESPACE_END
@@ -3,12 +3,15 @@
 #include <atomic>
 
 #include <userver/components/component.hpp>
+#include <userver/compression/error.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include "deflate.hpp"
+#include "payload_kernels.hpp"
 #include "protocol.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -27,15 +30,80 @@ Message CloseMessage(CloseStatus status) { return {{}, status, false}; }
 
 utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) { return utils::as_bytes(span); }
 
+int ParseInRange(const yaml_config::YamlConfig& value, int default_value, int min, int max) {
+    const auto result = value.As<int>(default_value);
+    if (result < min || result > max) {
+        throw std::runtime_error(
+            fmt::format("Invalid value {} of '{}', expected a value from {} to {}", result, value.GetPath(), min, max)
+        );
+    }
+    return result;
+}
+
+std::string MakeFrame(std::string_view payload, bool is_text, impl::frames::Compressed is_compressed) {
+    const auto data = MakeBinarySpan(payload);
+    const auto header = impl::frames::DataFrameHeader(
+        data, is_text, impl::frames::Continuation::kNo, impl::frames::Final::kYes, is_compressed
+    );
+
+    std::string frame;
+    frame.reserve(header.size() + payload.size());
+    frame.append(header.data(), header.size());
+    frame.append(payload);
+    return frame;
+}
+
 }  // namespace
 
+PerMessageDeflateConfig Parse(const yaml_config::YamlConfig& config, formats::parse::To<PerMessageDeflateConfig>) {
+    PerMessageDeflateConfig result;
+    result.enabled = config["enabled"].As<bool>(result.enabled);
+    result.server_no_context_takeover =
+        config["server-no-context-takeover"].As<bool>(result.server_no_context_takeover);
+    result.client_no_context_takeover =
+        config["client-no-context-takeover"].As<bool>(result.client_no_context_takeover);
+    result.server_max_window_bits =
+        ParseInRange(config["server-max-window-bits"], result.server_max_window_bits, 9, 15);
+    result.client_max_window_bits =
+        ParseInRange(config["client-max-window-bits"], result.client_max_window_bits, 9, 15);
+    result.mem_level = ParseInRange(config["mem-level"], result.mem_level, 1, 9);
+    result.compression_level = ParseInRange(config["compression-level"], result.compression_level, -1, 9);
+    result.min_compress_size = config["min-compress-size"].As<unsigned>(result.min_compress_size);
+    return result;
+}
+
 Config Parse(const yaml_config::YamlConfig& config, formats::parse::To<Config>) {
     return {
         config["max-remote-payload"].As<unsigned>(65536),
         config["fragment-size"].As<unsigned>(65536),
+        config["permessage-deflate"].As<PerMessageDeflateConfig>(PerMessageDeflateConfig{}),
+        config["validate-utf8"].As<bool>(true),
     };
 }
 
+struct PreparedMessage::Impl final {
+    std::string plain_frame;
+    // Compressed with a fresh context, empty if the message is not compressed
+    std::string deflated_frame;
+    int deflate_window_bits{0};
+    std::size_t payload_size{0};
+};
+
+PreparedMessage::PreparedMessage(std::string_view data, bool is_text, const PerMessageDeflateConfig& deflate_config) {
+    auto impl = std::make_shared<Impl>();
+    impl->plain_frame = MakeFrame(data, is_text, impl::frames::Compressed::kNo);
+    if (deflate_config.enabled && data.size() >= deflate_config.min_compress_size) {
+        impl->deflated_frame = MakeFrame(
+            impl::CompressStandalone(data, deflate_config), is_text, impl::frames::Compressed::kYes
+        );
+        impl->deflate_window_bits = deflate_config.server_max_window_bits;
+    }
+    impl->payload_size = data.size();
+    impl_ = std::move(impl);
+}
+
+std::size_t PreparedMessage::GetPayloadSize() const noexcept { return impl_->payload_size; }
+
 class WebSocketConnectionImpl final : public WebSocketConnection {
 public:
 private:
@@ -63,13 +131,29 @@ private:
 
     std::atomic<std::size_t> ping_pending_count_{0};
 
+    // permessage-deflate state, set only if the extension is negotiated
+    const std::optional<impl::DeflateParams> deflate_params_;
+    std::unique_ptr<impl::MessageDeflater> deflater_;
+    std::unique_ptr<impl::MessageInflater> inflater_;
+    // protected by write_mutex_
+    std::string deflate_buffer_;
+    // used only by the single reading task
+    std::string inflate_buffer_;
+
 public:
     WebSocketConnectionImpl(
         std::unique_ptr<engine::io::RwBase> io_,
         const engine::io::Sockaddr& remote_addr,
-        const Config& server_config
+        const Config& server_config,
+        const std::optional<impl::DeflateParams>& deflate_params = std::nullopt
     )
-        : io_(std::move(io_)), remote_addr_(remote_addr), config_(server_config) {}
+        : io_(std::move(io_)), remote_addr_(remote_addr), config_(server_config), deflate_params_(deflate_params) {
+        if (deflate_params_) {
+            deflater_ = std::make_unique<impl::MessageDeflater>(*deflate_params_, config_.deflate);
+            inflater_ = std::make_unique<impl::MessageInflater>(*deflate_params_);
+            frame_.compression_allowed = true;
+        }
+    }
 
     ~WebSocketConnectionImpl() override { LOG_TRACE() << "Websocket connection closed"; }
 
@@ -90,20 +174,34 @@ public:
             SendExactly(*io_, close_frame, {});
         } else if (!message.data.empty()) {
             utils::span<const std::byte> data_to_send{message.data};
+            auto compressed = impl::frames::Compressed::kNo;
+            if (deflater_ && message.data.size() >= config_.deflate.min_compress_size) {
+                deflater_->Compress(
+                    std::string_view(reinterpret_cast<const char*>(message.data.data()), message.data.size()),
+                    deflate_buffer_
+                );
+                data_to_send = MakeBinarySpan(deflate_buffer_);
+                compressed = impl::frames::Compressed::kYes;
+            }
             auto continuation = impl::frames::Continuation::kNo;
             while (data_to_send.size() > config_.fragment_size && config_.fragment_size > 0) {
                 const auto data_frame_header = impl::frames::DataFrameHeader(
                     data_to_send.first(config_.fragment_size),
                     message.opcode == impl::WSOpcodes::kText,
                     continuation,
-                    impl::frames::Final::kNo
+                    impl::frames::Final::kNo,
+                    compressed
                 );
                 SendExactly(*io_, data_frame_header, data_to_send.first(config_.fragment_size));
                 continuation = impl::frames::Continuation::kYes;
                 data_to_send = data_to_send.last(data_to_send.size() - config_.fragment_size);
             }
             const auto data_frame_header = impl::frames::DataFrameHeader(
-                data_to_send, message.opcode == impl::WSOpcodes::kText, continuation, impl::frames::Final::kYes
+                data_to_send,
+                message.opcode == impl::WSOpcodes::kText,
+                continuation,
+                impl::frames::Final::kYes,
+                compressed
             );
             SendExactly(*io_, data_frame_header, data_to_send);
         }
@@ -122,6 +220,23 @@ public:
         SendExtended(mext);
     }
 
+    void SendPrepared(const PreparedMessage& message) override {
+        const auto& prepared = *message.impl_;
+        stats_.msg_sent++;
+        stats_.bytes_sent += prepared.payload_size;
+
+        // The frame compressed with a fresh context is decompressible only by the
+        // clients that do not expect the context to be taken over
+        const bool use_deflated = deflate_params_ && deflate_params_->server_no_context_takeover &&
+                                  !prepared.deflated_frame.empty() &&
+                                  prepared.deflate_window_bits <= deflate_params_->server_max_window_bits;
+        const auto& frame = use_deflated ? prepared.deflated_frame : prepared.plain_frame;
+
+        const std::lock_guard lock(write_mutex_);
+        LOG_TRACE() << "Write prepared message " << frame.size() << " bytes";
+        SendExactly(*io_, frame, {});
+    }
+
     void SendPing() override {
         MessageExtended ping_msg{{}, impl::WSOpcodes::kPing, {}};
         SendExtended(ping_msg);
@@ -191,6 +306,25 @@ public:
             }
             if (frame_.waiting_continuation) continue;
 
+            if (frame_.is_compressed) {
+                frame_.is_compressed = false;
+                const auto inflate_status = Inflate(msg.data);
+                if (inflate_status != CloseStatus::kNone) {
+                    MessageExtended close_msg{{}, impl::WSOpcodes::kClose, inflate_status};
+                    SendExtended(close_msg);
+                    msg = CloseMessage(inflate_status);
+                    return true;
+                }
+            }
+
+            if (frame_.is_text && config_.validate_utf8 && !impl::IsValidUtf8(msg.data)) {
+                LOG_WARNING() << "Text message is not a valid UTF-8";
+                MessageExtended close_msg{{}, impl::WSOpcodes::kClose, CloseStatus::kBadMessageData};
+                SendExtended(close_msg);
+                msg = CloseMessage(CloseStatus::kBadMessageData);
+                return true;
+            }
+
             msg.is_text = frame_.is_text;
             stats_.msg_recv++;
             stats_.bytes_recv += msg.data.size();
@@ -198,6 +332,22 @@ public:
         }
     }
 
+    CloseStatus Inflate(std::string& data) {
+        UASSERT(inflater_);
+        try {
+            inflater_->Decompress(data, config_.max_remote_payload, inflate_buffer_);
+        } catch (const compression::TooBigError& e) {
+            LOG_WARNING() << "Decompressed message is too big: " << e;
+            return CloseStatus::kTooBigData;
+        } catch (const compression::DecompressionError& e) {
+            LOG_WARNING() << "Failed to decompress a message: " << e;
+            return CloseStatus::kBadMessageData;
+        }
+        // keep the allocated memory of both buffers
+        data.swap(inflate_buffer_);
+        return CloseStatus::kNone;
+    }
+
     void Recv(Message& msg) override {
         const auto ok = RecvImpl(msg, /*do_not_wait_for_message_header*/ false);
         UASSERT(ok);
@@ -236,6 +386,19 @@ MakeWebSocket(std::unique_ptr<engine::io::RwBase>&& socket, engine::io::Sockaddr
     return std::make_shared<WebSocketConnectionImpl>(std::move(socket), std::move(peer_name), config);
 }
 
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    const std::optional<DeflateParams>& deflate_params
+) {
+    return std::make_shared<WebSocketConnectionImpl>(std::move(socket), std::move(peer_name), config, deflate_params);
+}
+
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/server/websocket/server.hpp>
+
+#include <server/websocket/deflate.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ws = server::websocket;
+
+// Discards the written data, so that only the CPU cost of a send is measured
+class NullSocket final : public engine::io::RwBase {
+public:
+    explicit NullSocket(std::size_t& bytes_written) : bytes_written_(bytes_written) {}
+
+    bool IsValid() const override { return true; }
+    bool WaitReadable(engine::Deadline) override { return false; }
+    size_t ReadSome(void*, size_t, engine::Deadline) override { return 0; }
+    size_t ReadAll(void*, size_t, engine::Deadline) override { return 0; }
+    bool WaitWriteable(engine::Deadline) override { return true; }
+
+    size_t WriteAll(const void*, size_t len, engine::Deadline) override {
+        bytes_written_ += len;
+        return len;
+    }
+
+private:
+    std::size_t& bytes_written_;
+};
+
+std::string MakeMarketData(std::size_t size) {
+    std::string data;
+    for (int i = 0; data.size() < size; ++i) {
+        data += R"({"instrument":"ABC)" + std::to_string(i % 16) + R"(","bid":)" + std::to_string(100 + i % 7) +
+                R"(,"ask":)" + std::to_string(101 + i % 5) + "}\n";
+    }
+    data.resize(size);
+    return data;
+}
+
+enum class Compression { kNone, kDeflate };
+
+struct FanOut {
+    FanOut(std::size_t connections_count, Compression compression) {
+        config.deflate.enabled = compression == Compression::kDeflate;
+        config.deflate.server_no_context_takeover = true;
+
+        std::optional<ws::impl::DeflateParams> params;
+        if (compression == Compression::kDeflate) {
+            params.emplace();
+            params->server_no_context_takeover = true;
+        }
+
+        connections.reserve(connections_count);
+        for (std::size_t i = 0; i < connections_count; ++i) {
+            connections.push_back(ws::impl::MakeWebSocket(
+                std::make_unique<NullSocket>(bytes_written), engine::io::Sockaddr{}, config, params
+            ));
+        }
+    }
+
+    ws::Config config;
+    std::size_t bytes_written{0};
+    std::vector<std::shared_ptr<ws::WebSocketConnection>> connections;
+};
+
+void SetCounters(benchmark::State& state, const FanOut& fan_out, std::size_t payload_size) {
+    const auto messages = static_cast<double>(state.iterations() * fan_out.connections.size());
+    state.counters["wire_bytes_per_msg"] = static_cast<double>(fan_out.bytes_written) / messages;
+    state.SetBytesProcessed(static_cast<std::int64_t>(messages) * payload_size);
+}
+
+}  // namespace
+
+void WebsocketFanOutSend(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        FanOut fan_out{static_cast<std::size_t>(state.range(0)), static_cast<Compression>(state.range(2))};
+        const auto message = MakeMarketData(state.range(1));
+
+        for ([[maybe_unused]] auto _ : state) {
+            for (const auto& connection : fan_out.connections) {
+                connection->SendText(message);
+            }
+        }
+        SetCounters(state, fan_out, message.size());
+    });
+}
+BENCHMARK(WebsocketFanOutSend)
+    ->ArgNames({"connections", "size", "deflate"})
+    ->ArgsProduct({{1000, 5000}, {256, 16 * 1024}, {0, 1}});
+
+void WebsocketFanOutSendPrepared(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        FanOut fan_out{static_cast<std::size_t>(state.range(0)), static_cast<Compression>(state.range(2))};
+        const auto message = MakeMarketData(state.range(1));
+
+        for ([[maybe_unused]] auto _ : state) {
+            // The message is framed and compressed once per fan-out
+            const ws::PreparedMessage prepared{message, /*is_text=*/true, fan_out.config.deflate};
+            for (const auto& connection : fan_out.connections) {
+                connection->SendPrepared(prepared);
+            }
+        }
+        SetCounters(state, fan_out, message.size());
+    });
+}
+BENCHMARK(WebsocketFanOutSendPrepared)
+    ->ArgNames({"connections", "size", "deflate"})
+    ->ArgsProduct({{1000, 5000}, {256, 16 * 1024}, {0, 1}});
+
+USERVER_NAMESPACE_END
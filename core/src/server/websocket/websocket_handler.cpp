@@ -11,6 +11,7 @@
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <userver/server/websocket/server.hpp>
+#include "deflate.hpp"
 #include "protocol.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -61,6 +62,16 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
 
     if (!HandleHandshake(request, response, context)) return "";
 
+    auto deflate_params = websocket::impl::NegotiateDeflate(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions), config_.deflate
+    );
+    if (deflate_params) {
+        response.SetHeader(
+            USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+            websocket::impl::FormatDeflateResponse(*deflate_params)
+        );
+    }
+
     response.SetStatus(server::http::HttpStatus::kSwitchingProtocols);
     response.SetHeader(USERVER_NAMESPACE::http::headers::kConnection, "Upgrade");
     response.SetHeader(USERVER_NAMESPACE::http::headers::kUpgrade, "websocket");
@@ -69,9 +80,10 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
     );
 
     request.SetUpgradeWebsocket([context = std::make_shared<server::request::RequestContext>(std::move(context)),
+                                 deflate_params,
                                  this](std::unique_ptr<engine::io::RwBase> socket, engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket), std::move(peer_name), config_);
+        auto ws = websocket::impl::MakeWebSocket(std::move(socket), std::move(peer_name), config_, deflate_params);
         try {
             Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -84,6 +96,10 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
     return "";
 }
 
+PreparedMessage WebsocketHandlerBase::PrepareMessage(std::string_view data, bool is_text) const {
+    return PreparedMessage{data, is_text, config_.deflate};
+}
+
 void WebsocketHandlerBase::WriteMetrics(utils::statistics::Writer& writer) const {
     writer["msg"]["sent"] = stats_.msg_sent.load();
     writer["msg"]["recv"] = stats_.msg_recv.load();
@@ -106,6 +122,56 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    validate-utf8:
+        type: boolean
+        description: close the connection with status 1007 on a text message that is not a valid UTF-8
+        defaultDescription: true
+    permessage-deflate:
+        type: object
+        description: permessage-deflate extension settings, see RFC 7692
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: accept the permessage-deflate offers of the clients
+                defaultDescription: false
+            server-no-context-takeover:
+                type: boolean
+                description: compress each message with a fresh context, required to send compressed prepared messages
+                defaultDescription: false
+            client-no-context-takeover:
+                type: boolean
+                description: ask the clients to compress each message with a fresh context
+                defaultDescription: false
+            server-max-window-bits:
+                type: integer
+                description: base-2 logarithm of the compression window size
+                defaultDescription: 15
+                minimum: 9
+                maximum: 15
+            client-max-window-bits:
+                type: integer
+                description: base-2 logarithm of the window size the clients may use
+                defaultDescription: 15
+                minimum: 9
+                maximum: 15
+            mem-level:
+                type: integer
+                description: memory level of the compressor
+                defaultDescription: 8
+                minimum: 1
+                maximum: 9
+            compression-level:
+                type: integer
+                description: compression level, -1 for the zlib default
+                defaultDescription: -1
+                minimum: -1
+                maximum: 9
+            min-compress-size:
+                type: integer
+                description: smaller messages are sent uncompressed
+                defaultDescription: 64
+                minimum: 0
 )");
 }
 
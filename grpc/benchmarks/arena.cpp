@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/struct.pb.h>
+
+#include <userver/ugrpc/server/impl/call_arena.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace {
+
+constexpr int kDepth = 4;
+constexpr int kFanout = 4;
+
+void FillStruct(google::protobuf::Struct& message, int depth) {
+    auto& fields = *message.mutable_fields();
+    for (int i = 0; i < kFanout; ++i) {
+        auto& value = fields["field-" + std::to_string(i)];
+        if (depth == 0) {
+            value.set_string_value("test-value-" + std::to_string(i));
+        } else {
+            FillStruct(*value.mutable_struct_value(), depth - 1);
+        }
+    }
+    fields["list"].mutable_list_value()->add_values()->set_number_value(depth);
+}
+
+std::string MakeSerializedMessage() {
+    google::protobuf::Struct message;
+    FillStruct(message, kDepth);
+    return message.SerializeAsString();
+}
+
+const auto kSerializedMessage = MakeSerializedMessage();
+
+}  // namespace
+
+void BenchParseDeepMessageHeap(benchmark::State& state) {
+    // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+    for (auto _ : state) {
+        google::protobuf::Struct message;
+        const bool parsed = message.ParseFromString(kSerializedMessage);
+        benchmark::DoNotOptimize(parsed);
+    }
+}
+BENCHMARK(BenchParseDeepMessageHeap);
+
+void BenchParseDeepMessageArena(benchmark::State& state) {
+    server::ArenaConfig config;
+    config.initial_block_size = state.range(0);
+    config.cache_blocks = state.range(1) != 0;
+
+    std::uint64_t blocks_bytes = 0;
+    // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
+    for (auto _ : state) {
+        server::impl::CallArena arena{config};
+        auto* message = google::protobuf::Arena::CreateMessage<google::protobuf::Struct>(&arena.Get());
+        const bool parsed = message->ParseFromString(kSerializedMessage);
+        benchmark::DoNotOptimize(parsed);
+        blocks_bytes += arena.Get().SpaceAllocated();
+    }
+
+    state.counters["arena_bytes"] =
+        benchmark::Counter(static_cast<double>(blocks_bytes), benchmark::Counter::kAvgIterations);
+    state.counters["message_bytes"] = static_cast<double>(kSerializedMessage.size());
+}
+BENCHMARK(BenchParseDeepMessageArena)
+    ->ArgNames({"initial_block_size", "cache_blocks"})
+    ->Args({0, 0})
+    ->Args({8 * 1024, 0})
+    ->Args({8 * 1024, 1})
+    ->Args({256 * 1024, 0})
+    ->Args({256 * 1024, 1});
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <google/protobuf/arena.h>
+
+#include <userver/ugrpc/server/service_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+/// @brief google::protobuf::Arena of a single RPC.
+///
+/// The first block of the arena is taken from a per-thread cache of the blocks
+/// of the finished RPCs if ArenaConfig::cache_blocks is set, so a request that
+/// fits in it is parsed without any heap allocations.
+class CallArena final {
+public:
+    explicit CallArena(const ArenaConfig& config);
+
+    CallArena(CallArena&&) = delete;
+    CallArena& operator=(CallArena&&) = delete;
+
+    google::protobuf::Arena& Get() noexcept { return arena_; }
+
+private:
+    class InitialBlock final {
+    public:
+        InitialBlock(std::size_t size, bool cached);
+        ~InitialBlock();
+
+        InitialBlock(InitialBlock&&) = delete;
+        InitialBlock& operator=(InitialBlock&&) = delete;
+
+        char* Data() const noexcept { return data_.get(); }
+        std::size_t Size() const noexcept { return size_; }
+
+    private:
+        std::unique_ptr<char[]> data_;
+        const std::size_t size_;
+        const bool cached_;
+    };
+
+    static google::protobuf::ArenaOptions MakeOptions(const InitialBlock& block);
+
+    // 'initial_block_' must outlive the arena, the arena keeps its own
+    // bookkeeping in the block
+    InitialBlock initial_block_;
+    google::protobuf::Arena arena_;
+};
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
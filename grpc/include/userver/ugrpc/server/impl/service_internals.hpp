@@ -5,6 +5,7 @@
 #include <userver/logging/fwd.hpp>
 
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
+#include <userver/ugrpc/server/service_base.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,6 +24,7 @@ struct ServiceInternals final {
     ugrpc::impl::StatisticsStorage& statistics_storage;
     Middlewares middlewares;
     const dynamic_config::Source config_source;
+    const ArenaConfig arena;
 };
 
 }  // namespace ugrpc::server::impl
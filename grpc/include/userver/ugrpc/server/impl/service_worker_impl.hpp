@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/message.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/server_context.h>
 
@@ -29,6 +30,7 @@
 #include <userver/ugrpc/server/call_context.hpp>
 #include <userver/ugrpc/server/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/server/impl/async_service.hpp>
+#include <userver/ugrpc/server/impl/call_arena.hpp>
 #include <userver/ugrpc/server/impl/call_processor.hpp>
 #include <userver/ugrpc/server/impl/call_state.hpp>
 #include <userver/ugrpc/server/impl/call_traits.hpp>
@@ -80,6 +82,44 @@ struct MethodData final {
     // Remove name of the service and slash
     std::string_view method_name{GetMethodName(service_data.metadata, method_id)};
     ugrpc::impl::MethodStatistics& statistics{service_data.service_statistics.GetMethodStatistics(method_id)};
+    const bool use_arena{service_data.internals.arena.IsEnabledFor(method_name)};
+};
+
+/// The initial request of an RPC, allocated on the arena of the RPC if that is
+/// enabled for the method
+template <typename InitialRequest, bool IsMessage = std::is_base_of_v<google::protobuf::Message, InitialRequest>>
+class InitialRequestStorage final {
+public:
+    InitialRequestStorage(const ArenaConfig& /*arena_config*/, bool /*use_arena*/) {}
+
+    InitialRequest& Get() noexcept { return request_; }
+
+private:
+    InitialRequest request_{};
+};
+
+template <typename InitialRequest>
+class InitialRequestStorage<InitialRequest, true> final {
+public:
+    InitialRequestStorage(const ArenaConfig& arena_config, bool use_arena) {
+        if (use_arena) {
+            arena_.emplace(arena_config);
+            request_ = google::protobuf::Arena::CreateMessage<InitialRequest>(&arena_->Get());
+        } else {
+            request_ = &heap_request_.emplace();
+        }
+    }
+
+    InitialRequestStorage(InitialRequestStorage&&) = delete;
+    InitialRequestStorage& operator=(InitialRequestStorage&&) = delete;
+
+    InitialRequest& Get() noexcept { return *request_; }
+
+private:
+    // The arena frees the request and all its parts at once
+    std::optional<CallArena> arena_;
+    std::optional<InitialRequest> heap_request_;
+    InitialRequest* request_{nullptr};
 };
 
 template <typename GrpcppService, typename CallTraits>
@@ -106,7 +146,7 @@ public:
         method_data_.service_data.async_service.template Prepare<CallTraits>(
             method_data_.method_id,
             context_,
-            initial_request_,
+            initial_request_.Get(),
             raw_responder_,
             queue,
             queue,
@@ -172,7 +212,7 @@ private:
                 method_data_.service_data.internals.config_source,
             },
             raw_responder_,
-            initial_request_,
+            initial_request_.Get(),
             method_data_.service,
             method_data_.service_method,
         };
@@ -187,7 +227,10 @@ private:
     MethodData<GrpcppService, CallTraits> method_data_;
 
     typename CallTraits::RawContext context_{};
-    InitialRequest initial_request_{};
+    InitialRequestStorage<InitialRequest> initial_request_{
+        method_data_.service_data.internals.arena,
+        method_data_.use_arena,
+    };
     RawResponder raw_responder_{&context_};
     ugrpc::impl::AsyncMethodInvocation prepare_;
     std::optional<tracing::InPlaceSpan> span_storage_{};
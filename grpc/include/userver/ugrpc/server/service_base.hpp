@@ -3,6 +3,11 @@
 /// @file userver/ugrpc/server/service_base.hpp
 /// @brief @copybrief ugrpc::server::ServiceBase
 
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <userver/ugrpc/server/call_context.hpp>
@@ -17,6 +22,34 @@ namespace impl {
 struct ServiceInternals;
 }  // namespace impl
 
+/// @brief Settings of the protobuf Arena allocation of the requests.
+///
+/// The initial request of a unary or a server-streaming RPC is allocated on a
+/// `google::protobuf::Arena` that lives as long as the RPC. All the
+/// sub-messages, strings and repeated fields of a deep request are then
+/// allocated from a few large blocks that are freed at once when the RPC is
+/// finished.
+///
+/// @warning Moving a request out of the arena into a heap-allocated message
+/// copies it, so the handlers of such methods should read the request in place.
+struct ArenaConfig final {
+    /// Allocate the requests of the service methods on an arena.
+    bool enabled{false};
+
+    /// Names of the methods (without the service name) to allocate the requests
+    /// of on an arena, all the methods of the service if empty.
+    std::vector<std::string> methods{};
+
+    /// Size of the first block of the arena of an RPC.
+    std::size_t initial_block_size{8 * 1024};
+
+    /// Reuse the first blocks of the arenas of the finished RPCs.
+    bool cache_blocks{true};
+
+    /// @returns whether the requests of the method are allocated on an arena.
+    bool IsEnabledFor(std::string_view method_name) const;
+};
+
 /// Per-service settings
 struct ServiceConfig final {
     /// TaskProcessor to use for serving RPCs.
@@ -24,6 +57,9 @@ struct ServiceConfig final {
 
     /// Server middlewares to use for the gRPC service.
     Middlewares middlewares;
+
+    /// Arena allocation of the requests, disabled by default.
+    ArenaConfig arena{};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
@@ -43,6 +43,10 @@ using MiddlewareRunnerComponentBase = USERVER_NAMESPACE::middlewares::RunnerComp
 /// disable-user-pipeline-middlewares | flag to disable `groups::User` middlewares from pipeline | false
 /// disable-all-pipeline-middlewares | flag to disable all middlewares from pipeline | false
 /// middlewares | middlewares names to use | `{}` (use server defaults)
+/// arena.enabled | allocate the requests of unary and server-streaming RPCs on a per-RPC protobuf Arena, see ugrpc::server::ArenaConfig | false
+/// arena.methods | names of the methods to allocate the requests of on an arena | all the methods of the service
+/// arena.initial-block-size | size of the first block of an arena in bytes | 8192
+/// arena.cache-blocks | reuse the first blocks of the arenas of the finished RPCs | true
 
 // clang-format on
 
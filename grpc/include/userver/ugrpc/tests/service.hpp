@@ -69,6 +69,10 @@ public:
     /// Client middlewares can be modified before the first RegisterService call.
     void SetClientMiddlewares(client::Middlewares middlewares);
 
+    /// Arena allocation of the requests can be modified before the first
+    /// RegisterService call.
+    void SetServerArena(server::ArenaConfig arena);
+
     /// Modifies the internal dynamic configs storage. It is used by the server
     /// and clients, and is accessible through @ref GetConfigSource.
     /// Initially, the configs are filled with compile-time defaults.
@@ -96,6 +100,7 @@ private:
     std::optional<std::string> unix_socket_path_;
     server::Server server_;
     server::Middlewares server_middlewares_;
+    server::ArenaConfig server_arena_;
     SimpleClientMiddlewarePipeline simple_client_middleware_pipeline_;
     bool middlewares_change_allowed_{true};
     testsuite::GrpcControl testsuite_;
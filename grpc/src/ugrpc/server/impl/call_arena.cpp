@@ -0,0 +1,75 @@
+#include <userver/ugrpc/server/impl/call_arena.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <userver/compiler/thread_local.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+namespace {
+
+// Bounds the memory kept by an idle thread
+constexpr std::size_t kMaxCachedBlocks = 64;
+
+struct CachedBlock final {
+    std::unique_ptr<char[]> data;
+    std::size_t size{0};
+};
+
+compiler::ThreadLocal local_block_cache = [] { return std::vector<CachedBlock>{}; };
+
+std::unique_ptr<char[]> TakeCachedBlock(std::size_t size) {
+    auto cache = local_block_cache.Use();
+    const auto it = std::find_if(cache->rbegin(), cache->rend(), [size](const CachedBlock& block) {
+        return block.size == size;
+    });
+    if (it == cache->rend()) return nullptr;
+
+    auto data = std::move(it->data);
+    cache->erase(std::next(it).base());
+    return data;
+}
+
+void ReturnCachedBlock(std::unique_ptr<char[]>&& data, std::size_t size) {
+    auto cache = local_block_cache.Use();
+    if (cache->size() < kMaxCachedBlocks) {
+        cache->push_back(CachedBlock{std::move(data), size});
+    }
+}
+
+}  // namespace
+
+CallArena::InitialBlock::InitialBlock(std::size_t size, bool cached)
+    : data_(cached && size != 0 ? TakeCachedBlock(size) : nullptr), size_(size), cached_(cached) {
+    if (!data_ && size_ != 0) {
+        // The block is not value-initialized, the arena does not need that
+        data_.reset(new char[size_]);
+    }
+}
+
+CallArena::InitialBlock::~InitialBlock() {
+    if (cached_ && data_) {
+        ReturnCachedBlock(std::move(data_), size_);
+    }
+}
+
+CallArena::CallArena(const ArenaConfig& config)
+    : initial_block_(config.initial_block_size, config.cache_blocks), arena_(MakeOptions(initial_block_)) {}
+
+google::protobuf::ArenaOptions CallArena::MakeOptions(const InitialBlock& block) {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block.Data();
+    options.initial_block_size = block.Size();
+    // The blocks allocated after the initial one are not smaller than it
+    options.start_block_size = std::max(options.start_block_size, block.Size());
+    options.max_block_size = std::max(options.max_block_size, block.Size());
+    return options;
+}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
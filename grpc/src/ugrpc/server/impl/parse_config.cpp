@@ -1,7 +1,11 @@
 #include <ugrpc/server/impl/parse_config.hpp>
 
+#include <string>
+#include <vector>
+
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/logging/impl/logger_base.hpp>
@@ -52,6 +56,15 @@ ParseTaskProcessor(const yaml_config::YamlConfig& field, const components::Compo
     return context.GetTaskProcessor(field.As<std::string>());
 }
 
+ArenaConfig ParseArenaConfig(const yaml_config::YamlConfig& value) {
+    ArenaConfig config;
+    config.enabled = value["enabled"].As<bool>(config.enabled);
+    config.methods = value["methods"].As<std::vector<std::string>>({});
+    config.initial_block_size = value["initial-block-size"].As<std::size_t>(config.initial_block_size);
+    config.cache_blocks = value["cache-blocks"].As<bool>(config.cache_blocks);
+    return config;
+}
+
 }  // namespace
 
 ServiceDefaults
@@ -71,6 +84,7 @@ server::ServiceConfig ParseServiceConfig(
             value[kTaskProcessorKey], defaults.task_processor, context, ParseTaskProcessor
         ),
         /*middlewares=*/{},
+        /*arena=*/ParseArenaConfig(value["arena"]),
     };
 }
 
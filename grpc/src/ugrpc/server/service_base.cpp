@@ -1,9 +1,15 @@
 #include <userver/ugrpc/server/service_base.hpp>
 
+#include <algorithm>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server {
 
+bool ArenaConfig::IsEnabledFor(std::string_view method_name) const {
+    return enabled && (methods.empty() || std::find(methods.begin(), methods.end(), method_name) != methods.end());
+}
+
 ServiceBase::~ServiceBase() = default;
 
 }  // namespace ugrpc::server
@@ -52,6 +52,31 @@ properties:
         type: string
         description: the task processor to use for responses
         defaultDescription: uses grpc-server.service-defaults.task-processor
+    arena:
+        type: object
+        description: protobuf Arena allocation of the requests of unary and server-streaming RPCs
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: allocate the requests on a per-RPC arena
+                defaultDescription: false
+            methods:
+                type: array
+                description: names of the methods to allocate the requests of on an arena
+                defaultDescription: all the methods of the service
+                items:
+                    type: string
+                    description: method name without the service name
+            initial-block-size:
+                type: integer
+                description: size of the first block of an arena in bytes
+                defaultDescription: 8192
+                minimum: 0
+            cache-blocks:
+                type: boolean
+                description: reuse the first blocks of the arenas of the finished RPCs
+                defaultDescription: true
 )");
 }
 
@@ -33,6 +33,7 @@ server::ServiceConfig ServiceBase::MakeServiceConfig() {
     return server::ServiceConfig{
         engine::current_task::GetTaskProcessor(),
         server_middlewares_,
+        server_arena_,
     };
 }
 
@@ -80,6 +81,11 @@ void ServiceBase::SetServerMiddlewares(server::Middlewares middlewares) {
     server_middlewares_ = std::move(middlewares);
 }
 
+void ServiceBase::SetServerArena(server::ArenaConfig arena) {
+    UINVARIANT(middlewares_change_allowed_, "Set server arena after RegisterService call is not allowed");
+    server_arena_ = std::move(arena);
+}
+
 void ServiceBase::SetClientMiddlewares(client::Middlewares middlewares) {
     UINVARIANT(
         middlewares_change_allowed_,
@@ -0,0 +1,82 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string DescribeArena(const google::protobuf::Message& request) {
+    return request.GetArena() ? "arena" : "heap";
+}
+
+class ArenaCheckingService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name(request.name() + " from " + DescribeArena(request));
+        return response;
+    }
+
+    ReadManyResult ReadMany(
+        CallContext& /*context*/,
+        sample::ugrpc::StreamGreetingRequest&& request,
+        ReadManyWriter& writer
+    ) override {
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_name(request.name() + " from " + DescribeArena(request));
+        writer.Write(response);
+        return grpc::Status::OK;
+    }
+};
+
+class GrpcServerArena : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    GrpcServerArena() {
+        ugrpc::server::ArenaConfig arena;
+        arena.enabled = true;
+        arena.methods = {"SayHello"};
+        arena.initial_block_size = 1024;
+        SetServerArena(std::move(arena));
+
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~GrpcServerArena() override { StopServer(); }
+
+private:
+    ArenaCheckingService service_;
+};
+
+}  // namespace
+
+UTEST_F(GrpcServerArena, EnabledMethod) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(std::string(4096, 'x'));
+    for (int i = 0; i < 3; ++i) {
+        const auto response = client.SayHello(request);
+        EXPECT_EQ(response.name(), request.name() + " from arena");
+    }
+}
+
+UTEST_F(GrpcServerArena, DisabledMethod) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_name("userver");
+    auto stream = client.ReadMany(request);
+
+    sample::ugrpc::StreamGreetingResponse response;
+    ASSERT_TRUE(stream.Read(response));
+    EXPECT_EQ(response.name(), "userver from heap");
+    EXPECT_FALSE(stream.Read(response));
+}
+
+USERVER_NAMESPACE_END
@@ -88,6 +88,17 @@ public:
     /// process.
     /// @note If `callback` throws an exception, entire message batch (also
     /// with successfully processed messages) come again, until callback succeeds
+    ///
+    /// If `parallel_partitions_processing` is enabled in the static config,
+    /// the polled batch is split by the topic partitions and `callback` is
+    /// invoked concurrently for the messages of each partition, in their order
+    /// within the partition. Offsets of each partition are committed after
+    /// its callback succeeds, so ConsumerScope::AsyncCommit must not be
+    /// called. If `callback` throws, only the messages of its partition come
+    /// again after `restart_after_failure_delay`, while other partitions are
+    /// consumed. A partition is paused while its messages are processed, the
+    /// other partitions are polled meanwhile, so a slow partition does not
+    /// delay them.
     /// @warning Each callback duration must not exceed the
     /// `max_callback_duration` time. Otherwise, consumer may stop consuming the
     /// message for unpredictable amount of time.
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <stdexcept>
 #include <string_view>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -70,6 +73,30 @@ public:
     UnknownPartitionException();
 };
 
+/// @brief Exception thrown by Producer::SendBatch if some of the messages
+/// are not delivered.
+class SendBatchException final : public SendException {
+public:
+    struct Failure final {
+        /// Index of the message in the batch
+        std::size_t index{0};
+        /// SendException or its descendant
+        std::exception_ptr error;
+    };
+
+    /// @param failures must be not empty and sorted by the indices
+    /// @param messages_count size of the batch
+    SendBatchException(std::vector<Failure> failures, std::size_t messages_count, bool is_retryable);
+
+    /// @brief Returns the messages that are not delivered.
+    ///
+    /// The batch is retryable only if each of them is retryable.
+    const std::vector<Failure>& GetFailures() const noexcept;
+
+private:
+    std::vector<Failure> failures_;
+};
+
 /// @brief Exception thrown when there is an error retrieving the offset range.
 class OffsetRangeException : public std::runtime_error {
 public:
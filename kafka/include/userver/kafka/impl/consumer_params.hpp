@@ -38,6 +38,8 @@ struct ConsumerExecutionParams final {
 
     /// @brief Time consumer suspends execution after user-callback exception.
     /// @note After consumer restart, all uncommitted messages come again.
+    /// With `parallel_partitions_processing` only the partition of the failed
+    /// callback is suspended.
     std::chrono::milliseconds restart_after_failure_delay{10000};
 
     /// @brief Specifies the logging format for the message key.
@@ -51,6 +53,13 @@ struct ConsumerExecutionParams final {
     /// @brief Log level for infos about ordinary actions.
     /// Acceptable values - 'trace', 'debug', 'info', 'warning', 'error', 'critical'
     logging::Level operation_log_level{logging::Level::kInfo};
+
+    /// @brief Whether the polled batch is split by the topic partitions.
+    /// The callback is invoked concurrently for the messages of different
+    /// partitions, and the offsets of each partition are committed after its
+    /// messages are processed. The partitions that are not being processed
+    /// are polled meanwhile.
+    bool parallel_partitions_processing{false};
 };
 
 MessageKeyLogFormat Parse(const yaml_config::YamlConfig& config, formats::parse::To<MessageKeyLogFormat>);
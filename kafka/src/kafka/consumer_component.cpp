@@ -38,6 +38,8 @@ ConsumerComponent::ConsumerComponent(
               params.restart_after_failure_delay =
                   config["restart_after_failure_delay"].As<std::chrono::milliseconds>(params.restart_after_failure_delay
                   );
+              params.parallel_partitions_processing =
+                  config["parallel_partitions_processing"].As<bool>(params.parallel_partitions_processing);
               params.message_key_log_format = config["message_key_log_format"].As<impl::MessageKeyLogFormat>();
               params.debug_info_log_level =
                   config["debug_info_log_level"].As<logging::Level>(params.debug_info_log_level);
@@ -113,6 +115,12 @@ properties:
         type: string
         description: backoff consumer waits until restart after user-callback exception.
         defaultDescription: 10s
+    parallel_partitions_processing:
+        type: boolean
+        description: |
+            process the messages of each partition of a polled batch in a separate
+            task and commit the offsets of each partition independently
+        defaultDescription: false
     auto_offset_reset:
         type: string
         description: |
@@ -21,6 +21,15 @@ UnknownTopicException::UnknownTopicException() : SendException(kWhat) {}
 
 UnknownPartitionException::UnknownPartitionException() : SendException(kWhat) {}
 
+SendBatchException::SendBatchException(std::vector<Failure> failures, std::size_t messages_count, bool is_retryable)
+    : SendException(
+          fmt::format("{} of {} messages of the batch are not delivered", failures.size(), messages_count).c_str(),
+          is_retryable
+      ),
+      failures_(std::move(failures)) {}
+
+const std::vector<SendBatchException::Failure>& SendBatchException::GetFailures() const noexcept { return failures_; }
+
 OffsetRangeException::OffsetRangeException(std::string_view what, std::string_view topic, std::uint32_t partition)
     : std::runtime_error(fmt::format("{} topic: '{}', partition: {}", what, topic, partition)) {}
 
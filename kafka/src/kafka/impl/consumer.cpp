@@ -1,6 +1,10 @@
 #include <userver/kafka/impl/consumer.hpp>
 
+#include <algorithm>
+#include <optional>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/value_builder.hpp>
@@ -9,6 +13,7 @@
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/scope_guard.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
@@ -46,6 +51,148 @@ std::function<void()> CreateDurationNotifier(std::chrono::milliseconds max_callb
     };
 }
 
+/// Groups the messages by their topic partitions keeping the order of the
+/// messages of each partition
+std::vector<std::vector<Message>> SplitByPartitions(std::vector<Message>&& polled_messages) {
+    // Batch usually contains messages of a few partitions, so the linear
+    // lookup is cheaper than hashing the topic names
+    std::vector<std::vector<Message>> partitions;
+    for (auto& message : polled_messages) {
+        const auto it = std::find_if(partitions.begin(), partitions.end(), [&message](const auto& partition) {
+            const auto& first_message = partition.front();
+            return first_message.GetPartition() == message.GetPartition() &&
+                   first_message.GetTopic() == message.GetTopic();
+        });
+        if (it == partitions.end()) {
+            partitions.emplace_back().push_back(std::move(message));
+        } else {
+            it->push_back(std::move(message));
+        }
+    }
+    return partitions;
+}
+
+/// Processes the messages of each partition in a separate task. The partition
+/// is paused while its messages are processed, so that the other partitions
+/// are polled meanwhile and a slow partition does not stall them.
+class PartitionsProcessor final {
+public:
+    PartitionsProcessor(
+        ConsumerImpl& consumer,
+        const ConsumerScope::Callback& callback,
+        const ConsumerExecutionParams& execution_params,
+        const std::string& name,
+        engine::TaskProcessor& main_task_processor
+    )
+        : consumer_(consumer),
+          callback_(callback),
+          execution_params_(execution_params),
+          name_(name),
+          main_task_processor_(main_task_processor) {}
+
+    /// Starts the processing of the messages of each polled partition
+    void Start(std::vector<Message>&& polled_messages) {
+        for (auto& messages : SplitByPartitions(std::move(polled_messages))) {
+            const auto& first_message = messages.front();
+            if (IsProcessed(first_message)) {
+                // Fetched before the partition was paused, the messages come
+                // again once the partition is resumed
+                consumer_.SeekBack(first_message);
+                continue;
+            }
+
+            consumer_.Pause(first_message);
+            const MessageBatchView batch{messages.data(), messages.size()};
+            auto task = utils::Async(main_task_processor_, "partition_messages_processing", [this, batch] {
+                const utils::FastScopeGuard wakeup_poll([this]() noexcept { consumer_.InterruptPoll(); });
+                const utils::ScopeGuard callback_duration_notifier{
+                    CreateDurationNotifier(execution_params_.max_callback_duration)};
+                callback_(batch);
+            });
+            tasks_.push_back(PartitionTask{std::move(messages), std::move(task)});
+        }
+    }
+
+    /// Commits the offsets of the processed partitions and resumes them, the
+    /// failed ones are paused for retry
+    void FinishCompleted() {
+        const auto completed_begin = std::stable_partition(tasks_.begin(), tasks_.end(), [](const auto& task) {
+            return !task.task.IsFinished();
+        });
+        Finish(completed_begin);
+    }
+
+    /// Waits for all the partitions being processed and finishes them
+    void FinishAll() {
+        const engine::TaskCancellationBlocker cancellation_blocker;
+        for (auto& task : tasks_) {
+            task.task.Wait();
+        }
+        Finish(tasks_.begin());
+    }
+
+private:
+    struct PartitionTask {
+        std::vector<Message> messages;
+        // Destroyed before the messages it processes
+        engine::TaskWithResult<void> task;
+    };
+
+    bool IsProcessed(const Message& message) const {
+        return std::any_of(tasks_.begin(), tasks_.end(), [&message](const PartitionTask& task) {
+            const auto& first_message = task.messages.front();
+            return first_message.GetPartition() == message.GetPartition() &&
+                   first_message.GetTopic() == message.GetTopic();
+        });
+    }
+
+    void Finish(std::vector<PartitionTask>::iterator completed_begin) {
+        if (completed_begin == tasks_.end()) return;
+
+        std::vector<MessageBatchView> processed_batches;
+        for (auto it = completed_begin; it != tasks_.end(); ++it) {
+            const MessageBatchView batch{it->messages.data(), it->messages.size()};
+            try {
+                it->task.Get();
+
+                consumer_.AccountMessageBatchProcessingSucceeded(batch);
+                processed_batches.push_back(batch);
+                consumer_.ResumeAfter(batch[batch.size() - 1]);
+                TESTPOINT(fmt::format("tp_{}", name_), {});
+            } catch (const std::exception& e) {
+                consumer_.AccountMessageBatchProcessingFailed(batch);
+
+                const auto& first_message = batch[0];
+                LOG_ERROR(
+                    "Messages processing failed in consumer for topic '{}' partition {}: {}",
+                    first_message.GetTopic(),
+                    first_message.GetPartition(),
+                    e.what()
+                );
+                CallErrorTestpoint(fmt::format("tp_error_{}", name_), e.what());
+
+                // The partition stays paused until the retry
+                consumer_.PauseForRetry(
+                    batch, engine::Deadline::FromDuration(execution_params_.restart_after_failure_delay)
+                );
+            }
+        }
+
+        if (!processed_batches.empty()) {
+            consumer_.AsyncCommit(processed_batches);
+        }
+        tasks_.erase(completed_begin, tasks_.end());
+    }
+
+    ConsumerImpl& consumer_;
+    const ConsumerScope::Callback& callback_;
+    const ConsumerExecutionParams& execution_params_;
+    const std::string& name_;
+    engine::TaskProcessor& main_task_processor_;
+
+    std::vector<PartitionTask> tasks_;
+};
+
 }  // namespace
 
 Consumer::Consumer(
@@ -97,7 +244,17 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
 
     LOG_INFO("Started messages polling");
 
+    std::optional<PartitionsProcessor> partitions_processor;
+    if (execution_params_.parallel_partitions_processing) {
+        partitions_processor.emplace(*consumer_, callback, execution_params_, name_, main_task_processor_);
+    }
+
     while (!engine::current_task::ShouldCancel()) {
+        consumer_->ResumePausedPartitions();
+        if (partitions_processor) {
+            partitions_processor->FinishCompleted();
+        }
+
         auto polled_messages = consumer_->PollBatch(
             execution_params_.max_batch_size, engine::Deadline::FromDuration(execution_params_.poll_timeout)
         );
@@ -115,6 +272,11 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
 
         TESTPOINT(fmt::format("tp_{}_polled", name_), {});
 
+        if (partitions_processor) {
+            partitions_processor->Start(std::move(polled_messages));
+            continue;
+        }
+
         auto batch_processing_task =
             utils::Async(main_task_processor_, "messages_processing", callback, utils::span{polled_messages});
         const utils::ScopeGuard callback_duration_notifier{
@@ -130,6 +292,12 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
             throw;
         }
     }
+
+    if (partitions_processor) {
+        // The messages being processed are committed, so that they do not
+        // come again after the restart
+        partitions_processor->FinishAll();
+    }
 }
 
 void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
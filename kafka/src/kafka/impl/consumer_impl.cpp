@@ -462,6 +462,137 @@ void ConsumerImpl::Commit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*
 
 void ConsumerImpl::AsyncCommit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*async=*/1); }
 
+void ConsumerImpl::AsyncCommit(const std::vector<MessageBatchView>& processed_partition_batches) {
+    TopicPartitionsListHolder topic_partitions_list{
+        rd_kafka_topic_partition_list_new(static_cast<int>(processed_partition_batches.size()))};
+    for (const auto& batch : processed_partition_batches) {
+        UASSERT(!batch.empty());
+        const auto& last_message = batch[batch.size() - 1];
+        rd_kafka_topic_partition_t* part = rd_kafka_topic_partition_list_add(
+            topic_partitions_list.GetHandle(), last_message.GetTopic().c_str(), last_message.GetPartition()
+        );
+        /// Committed offset is the offset of the next message to consume
+        part->offset = last_message.GetOffset() + 1;
+    }
+
+    rd_kafka_commit(consumer_.GetHandle(), topic_partitions_list.GetHandle(), /*async=*/1);
+}
+
+void ConsumerImpl::PauseForRetry(MessageBatchView partition_batch, engine::Deadline resume_deadline) {
+    UASSERT(!partition_batch.empty());
+    const auto& first_message = partition_batch[0];
+
+    if (!SeekBack(first_message)) {
+        /// Partition is revoked, its messages come to the next owner from the
+        /// committed offset
+        return;
+    }
+    Pause(first_message);
+
+    LOG_WARNING(
+        "Topic '{}' partition {} is paused for {}ms, messages from offset {} come again after that",
+        first_message.GetTopic(),
+        first_message.GetPartition(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(resume_deadline.TimeLeft()).count(),
+        first_message.GetOffset()
+    );
+    paused_partitions_.push_back({first_message.GetTopic(), first_message.GetPartition(), resume_deadline});
+}
+
+void ConsumerImpl::Pause(const Message& message) {
+    TopicPartitionsListHolder topic_partitions_list{rd_kafka_topic_partition_list_new(1)};
+    rd_kafka_topic_partition_list_add(
+        topic_partitions_list.GetHandle(), message.GetTopic().c_str(), message.GetPartition()
+    );
+
+    const auto pause_error = rd_kafka_pause_partitions(consumer_.GetHandle(), topic_partitions_list.GetHandle());
+    if (pause_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+        LOG_WARNING(
+            "Failed to pause topic '{}' partition {}: {}",
+            message.GetTopic(),
+            message.GetPartition(),
+            rd_kafka_err2str(pause_error)
+        );
+    }
+}
+
+void ConsumerImpl::ResumeAfter(const Message& last_message) {
+    if (!Seek(last_message, last_message.GetOffset() + 1)) return;
+
+    TopicPartitionsListHolder topic_partitions_list{rd_kafka_topic_partition_list_new(1)};
+    rd_kafka_topic_partition_list_add(
+        topic_partitions_list.GetHandle(), last_message.GetTopic().c_str(), last_message.GetPartition()
+    );
+
+    /// Revoked partition is reported as an error and is skipped
+    const auto resume_error = rd_kafka_resume_partitions(consumer_.GetHandle(), topic_partitions_list.GetHandle());
+    if (resume_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+        LOG_WARNING(
+            "Failed to resume topic '{}' partition {}: {}",
+            last_message.GetTopic(),
+            last_message.GetPartition(),
+            rd_kafka_err2str(resume_error)
+        );
+    }
+}
+
+bool ConsumerImpl::SeekBack(const Message& message) { return Seek(message, message.GetOffset()); }
+
+bool ConsumerImpl::Seek(const Message& message, std::int64_t offset) {
+    TopicPartitionsListHolder topic_partitions_list{rd_kafka_topic_partition_list_new(1)};
+    rd_kafka_topic_partition_t* part = rd_kafka_topic_partition_list_add(
+        topic_partitions_list.GetHandle(), message.GetTopic().c_str(), message.GetPartition()
+    );
+    part->offset = offset;
+
+    /// Zero timeout makes the seek asynchronous, so the polling task is not
+    /// blocked. Messages fetched from the old position are dropped by
+    /// `librdkafka`.
+    const ErrorHolder seek_error{
+        rd_kafka_seek_partitions(consumer_.GetHandle(), topic_partitions_list.GetHandle(), /*timeout_ms=*/0)};
+    if (seek_error) {
+        LOG_WARNING(
+            "Failed to seek topic '{}' partition {} to offset {}: {}",
+            message.GetTopic(),
+            message.GetPartition(),
+            offset,
+            rd_kafka_error_string(seek_error.GetHandle())
+        );
+        return false;
+    }
+    return true;
+}
+
+void ConsumerImpl::InterruptPoll() {
+    poll_interrupted_ = true;
+    queue_became_non_empty_event_.Send();
+}
+
+void ConsumerImpl::ResumePausedPartitions() {
+    if (paused_partitions_.empty()) {
+        return;
+    }
+
+    TopicPartitionsListHolder topic_partitions_list{rd_kafka_topic_partition_list_new(0)};
+    const auto resumed_begin =
+        std::partition(paused_partitions_.begin(), paused_partitions_.end(), [](const PausedPartition& paused) {
+            return !paused.resume_deadline.IsReached();
+        });
+    if (resumed_begin == paused_partitions_.end()) {
+        return;
+    }
+    for (auto it = resumed_begin; it != paused_partitions_.end(); ++it) {
+        rd_kafka_topic_partition_list_add(topic_partitions_list.GetHandle(), it->topic.c_str(), it->partition);
+    }
+    paused_partitions_.erase(resumed_begin, paused_partitions_.end());
+
+    /// Revoked partitions are reported as errors per partition and are skipped
+    const auto resume_error = rd_kafka_resume_partitions(consumer_.GetHandle(), topic_partitions_list.GetHandle());
+    if (resume_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+        LOG_WARNING("Failed to resume paused partitions: {}", rd_kafka_err2str(resume_error));
+    }
+}
+
 OffsetRange ConsumerImpl::GetOffsetRange(
     utils::zstring_view topic,
     std::uint32_t partition,
@@ -609,6 +740,11 @@ std::optional<Message> ConsumerImpl::PollMessage(engine::Deadline deadline) {
     bool just_waked_up{false};
 
     while (!deadline.IsReached() || std::exchange(just_waked_up, false)) {
+        if (poll_interrupted_.exchange(false)) {
+            LOG(execution_params_.debug_info_log_level) << "Polling is interrupted";
+            return std::nullopt;
+        }
+
         const auto time_left_ms = ToRdKafkaTimeout(deadline);
         LOG(execution_params_.debug_info_log_level) << fmt::format("Polling message for {}ms", time_left_ms);
         if (EventHolder event = PollEvent()) {
@@ -679,7 +815,7 @@ void ConsumerImpl::AccountMessageProcessingSucceeded(const Message& message) {
     ++GetTopicStats(message.GetTopic())->messages_counts.messages_success;
 }
 
-void ConsumerImpl::AccountMessageBatchProcessingSucceeded(const MessageBatch& batch) {
+void ConsumerImpl::AccountMessageBatchProcessingSucceeded(MessageBatchView batch) {
     for (const auto& message : batch) {
         AccountMessageProcessingSucceeded(message);
     }
@@ -688,7 +824,7 @@ void ConsumerImpl::AccountMessageProcessingFailed(const Message& message) {
     ++GetTopicStats(message.GetTopic())->messages_counts.messages_error;
 }
 
-void ConsumerImpl::AccountMessageBatchProcessingFailed(const MessageBatch& batch) {
+void ConsumerImpl::AccountMessageBatchProcessingFailed(MessageBatchView batch) {
     for (const auto& message : batch) {
         AccountMessageProcessingFailed(message);
     }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include <librdkafka/rdkafka.h>
@@ -48,6 +50,36 @@ public:
     /// @brief Schedules the commitment task.
     void AsyncCommit();
 
+    /// @brief Schedules the commitment of the offsets that follow the last
+    /// messages of the batches, each batch is of a single partition.
+    void AsyncCommit(const std::vector<MessageBatchView>& processed_partition_batches);
+
+    /// @brief Seeks the partition of `partition_batch` back to its first message
+    /// and pauses the partition until `resume_deadline`, so the messages come
+    /// again after ResumePausedPartitions call.
+    void PauseForRetry(MessageBatchView partition_batch, engine::Deadline resume_deadline);
+
+    /// @brief Stops fetching the messages of the partition of `message`.
+    void Pause(const Message& message);
+
+    /// @brief Continues fetching the messages of the partition of
+    /// `last_message` from the one that follows it. The messages fetched
+    /// before the partition was paused may be dropped by `librdkafka`.
+    void ResumeAfter(const Message& last_message);
+
+    /// @brief Seeks the partition of `message` back to it, so that the message
+    /// and the following ones come again.
+    /// @returns false if the partition could not be seeked, e.g. it is revoked
+    bool SeekBack(const Message& message);
+
+    /// @brief Makes the current or the next PollBatch return at once with
+    /// the messages polled so far. May be called from any task.
+    void InterruptPoll();
+
+    /// @brief Resumes the partitions paused by PauseForRetry, whose resume
+    /// deadline is reached.
+    void ResumePausedPartitions();
+
     /// @brief Retrieves the low and high offsets for the specified topic and partition.
     OffsetRange GetOffsetRange(
         utils::zstring_view topic,
@@ -79,9 +111,9 @@ public:
     MessageBatch PollBatch(std::size_t max_batch_size, engine::Deadline deadline);
 
     void AccountMessageProcessingSucceeded(const Message& message);
-    void AccountMessageBatchProcessingSucceeded(const MessageBatch& batch);
+    void AccountMessageBatchProcessingSucceeded(MessageBatchView batch);
     void AccountMessageProcessingFailed(const Message& message);
-    void AccountMessageBatchProcessingFailed(const MessageBatch& batch);
+    void AccountMessageBatchProcessingFailed(MessageBatchView batch);
 
     void EventCallback();
 
@@ -154,7 +186,15 @@ private:
 
     void AccountPolledMessageStat(const Message& polled_message);
 
+    bool Seek(const Message& message, std::int64_t offset);
+
 private:
+    struct PausedPartition {
+        std::string topic;
+        std::int32_t partition{0};
+        engine::Deadline resume_deadline;
+    };
+
     const std::string& name_;
     const std::vector<std::string> topics_;
     const ConsumerExecutionParams execution_params_;
@@ -162,6 +202,9 @@ private:
     Stats& stats_;
 
     engine::SingleConsumerEvent queue_became_non_empty_event_;
+    std::atomic<bool> poll_interrupted_{false};
+
+    std::vector<PausedPartition> paused_partitions_;
 
     ConsumerHolder consumer_;
 };
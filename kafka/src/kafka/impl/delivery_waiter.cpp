@@ -1,5 +1,7 @@
 #include <kafka/impl/delivery_waiter.hpp>
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace kafka::impl {
@@ -20,6 +22,49 @@ void DeliveryWaiter::SetDeliveryResult(DeliveryResult delivery_result) {
     wait_handle_.set_value(std::move(delivery_result));
 }
 
+void DeliveryWaiter::OnDeliveryReport(DeliveryResult&& delivery_result) {
+    SetDeliveryResult(std::move(delivery_result));
+    delete this;
+}
+
+BatchDeliveryWaiter::BatchDeliveryWaiter(std::size_t messages_count) : remaining_(messages_count + 1) {
+    receivers_.reserve(messages_count);
+    results_.reserve(messages_count);
+    for (std::size_t index{0}; index < messages_count; ++index) {
+        receivers_.emplace_back(*this, index);
+        results_.emplace_back(RD_KAFKA_RESP_ERR__IN_PROGRESS);
+    }
+}
+
+engine::Future<std::vector<DeliveryResult>> BatchDeliveryWaiter::GetFuture() { return wait_handle_.get_future(); }
+
+DeliveryReceiver& BatchDeliveryWaiter::GetReceiver(std::size_t index) {
+    UASSERT(index < receivers_.size());
+    return receivers_[index];
+}
+
+void BatchDeliveryWaiter::Release() { OnDone(); }
+
+void BatchDeliveryWaiter::OnDone() {
+    /// The reports of the messages may be handled concurrently by different
+    /// tasks. Each of them writes its own result, the last one publishes all
+    /// of them.
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    wait_handle_.set_value(std::move(results_));
+    delete this;
+}
+
+BatchDeliveryWaiter::Receiver::Receiver(BatchDeliveryWaiter& batch, std::size_t index)
+    : batch_(batch), index_(index) {}
+
+void BatchDeliveryWaiter::Receiver::OnDeliveryReport(DeliveryResult&& delivery_result) {
+    batch_.results_[index_] = std::move(delivery_result);
+    batch_.OnDone();
+}
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
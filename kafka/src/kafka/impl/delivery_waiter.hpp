@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
 #include <librdkafka/rdkafka.h>
 
 #include <userver/engine/future.hpp>
@@ -16,6 +20,7 @@ public:
     );
 
     DeliveryResult(DeliveryResult&&) noexcept = default;
+    DeliveryResult& operator=(DeliveryResult&&) noexcept = default;
 
     bool IsSuccess() const;
 
@@ -26,9 +31,21 @@ private:
     std::optional<rd_kafka_msg_status_t> message_status_;
 };
 
+/// @brief Receiver of the message delivery report, which is passed to
+/// `librdkafka` as the message opaque
+class DeliveryReceiver {
+public:
+    /// @brief Called exactly once per message. The receiver must not be used
+    /// after the call, it frees itself if needed.
+    virtual void OnDeliveryReport(DeliveryResult&& delivery_result) = 0;
+
+protected:
+    ~DeliveryReceiver() = default;
+};
+
 /// @brief State for waiting delivery callback invoked after producer send
 /// called
-class DeliveryWaiter final {
+class DeliveryWaiter final : public DeliveryReceiver {
 public:
     DeliveryWaiter() = default;
 
@@ -36,10 +53,57 @@ public:
 
     void SetDeliveryResult(DeliveryResult delivery_result);
 
+    /// Sets the result and frees the waiter
+    void OnDeliveryReport(DeliveryResult&& delivery_result) override;
+
 private:
     engine::Promise<DeliveryResult> wait_handle_;
 };
 
+/// @brief State for waiting the delivery callbacks of a batch of messages.
+///
+/// One allocation serves the whole batch. The waiter frees itself after the
+/// last delivery report and the Release call, whichever happens later.
+class BatchDeliveryWaiter final {
+public:
+    explicit BatchDeliveryWaiter(std::size_t messages_count);
+
+    BatchDeliveryWaiter(const BatchDeliveryWaiter&) = delete;
+    BatchDeliveryWaiter& operator=(const BatchDeliveryWaiter&) = delete;
+
+    /// @returns future for the delivery results in the order of the messages
+    engine::Future<std::vector<DeliveryResult>> GetFuture();
+
+    /// @returns receiver of the delivery report of the `index`-th message
+    DeliveryReceiver& GetReceiver(std::size_t index);
+
+    /// @brief Must be called once all the messages are scheduled, the waiter
+    /// must not be used after the call.
+    void Release();
+
+private:
+    class Receiver final : public DeliveryReceiver {
+    public:
+        Receiver(BatchDeliveryWaiter& batch, std::size_t index);
+
+        void OnDeliveryReport(DeliveryResult&& delivery_result) override;
+
+    private:
+        BatchDeliveryWaiter& batch_;
+        const std::size_t index_;
+    };
+
+    ~BatchDeliveryWaiter() = default;
+
+    void OnDone();
+
+    std::vector<Receiver> receivers_;
+    std::vector<DeliveryResult> results_;
+    // Reports that are not received yet plus the reference of the scheduler
+    std::atomic<std::size_t> remaining_;
+    engine::Promise<std::vector<DeliveryResult>> wait_handle_;
+};
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
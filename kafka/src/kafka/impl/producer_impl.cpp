@@ -64,7 +64,7 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
 
     const char* topic_name = rd_kafka_topic_name(message->rkt);
 
-    auto* complete_handle = static_cast<DeliveryWaiter*>(message->_private);
+    auto* complete_handle = static_cast<DeliveryReceiver*>(message->_private);
 
     auto& topic_stats = stats_.topics_stats[topic_name];
     ++topic_stats->messages_counts.messages_total;
@@ -100,8 +100,7 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
         LOG_WARNING("Failed to delivery message to topic '{}': {}", topic_name, rd_kafka_err2str(message->err));
     }
 
-    complete_handle->SetDeliveryResult(std::move(delivery_result));
-    delete complete_handle;
+    complete_handle->OnDeliveryReport(std::move(delivery_result));
 }
 
 ProducerImpl::ProducerImpl(
@@ -143,6 +142,22 @@ DeliveryResult ProducerImpl::Send(
     return delivery_result_future.get();
 }
 
+std::vector<DeliveryResult>
+ProducerImpl::SendBatch(utils::zstring_view topic_name, utils::span<const BatchMessage> messages) const {
+    LOG(operation_log_level_) << fmt::format(
+        "Batch of {} messages to topic '{}' is requested to send", messages.size(), topic_name
+    );
+    if (messages.empty()) {
+        return {};
+    }
+
+    auto delivery_results_future = ScheduleBatchDelivery(topic_name, messages);
+
+    WaitUntilDeliveryReported(delivery_results_future);
+
+    return delivery_results_future.get();
+}
+
 engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     utils::zstring_view topic_name,
     std::string_view key,
@@ -169,7 +184,8 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     ///
     /// It is safe to release the `waiter` because (i)
     /// `rd_kafka_producev` does not throws, therefore it owns the `waiter`,
-    /// (ii) delivery report callback fries its memory
+    /// (ii) delivery report callback fries its memory. The opaque is passed as
+    /// DeliveryReceiver, because the callback does not know the waiter type
     ///
     /// const qualifier remove for `message` is required because of
     /// the `librdkafka` API requirements. If `msgflags` set to
@@ -191,7 +207,7 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
         RD_KAFKA_V_MSGFLAGS(0),
         RD_KAFKA_V_HEADERS(headers_holder.GetHandle()),
         RD_KAFKA_V_PARTITION(partition.value_or(RD_KAFKA_PARTITION_UA)),
-        RD_KAFKA_V_OPAQUE(waiter.get()),
+        RD_KAFKA_V_OPAQUE(static_cast<DeliveryReceiver*>(waiter.get())),
         RD_KAFKA_V_END
     );
     // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks,cppcoreguidelines-pro-type-const-cast)
@@ -211,6 +227,67 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     return wait_handle;
 }
 
+engine::Future<std::vector<DeliveryResult>>
+ProducerImpl::ScheduleBatchDelivery(utils::zstring_view topic_name, utils::span<const BatchMessage> messages) const {
+    /// Headers are created before the first message is enqueued, so nothing
+    /// throws while the batch waiter is shared with `librdkafka`
+    std::vector<HeadersHolder> headers_holders;
+    headers_holders.reserve(messages.size());
+    for (const auto& message : messages) {
+        headers_holders.emplace_back(message.headers);
+    }
+
+    /// All the messages share the single waiter, see ScheduleMessageDelivery
+    /// for the details of `rd_kafka_producev` arguments. Enqueue errors are
+    /// reported to the waiter the same way as the delivery reports.
+    auto* batch_waiter = new BatchDeliveryWaiter{messages.size()};
+    auto wait_handle = batch_waiter->GetFuture();
+
+    std::size_t enqueue_errors{0};
+    for (std::size_t index{0}; index < messages.size(); ++index) {
+        const auto& message = messages[index];
+        auto& headers_holder = headers_holders[index];
+        auto& receiver = batch_waiter->GetReceiver(index);
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wgnu-statement-expression"
+#endif
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+        const rd_kafka_resp_err_t enqueue_error = rd_kafka_producev(
+            producer_.GetHandle(),
+            RD_KAFKA_V_TOPIC(topic_name.c_str()),
+            RD_KAFKA_V_KEY(message.key.data(), message.key.size()),
+            RD_KAFKA_V_VALUE(const_cast<char*>(message.message.data()), message.message.size()),
+            RD_KAFKA_V_MSGFLAGS(0),
+            RD_KAFKA_V_HEADERS(headers_holder.GetHandle()),
+            RD_KAFKA_V_PARTITION(message.partition.value_or(RD_KAFKA_PARTITION_UA)),
+            RD_KAFKA_V_OPAQUE(&receiver),
+            RD_KAFKA_V_END
+        );
+        // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+        if (enqueue_error == RD_KAFKA_RESP_ERR_NO_ERROR) {
+            [[maybe_unused]] const auto _headers_holder = headers_holder.release();
+        } else {
+            ++enqueue_errors;
+            receiver.OnDeliveryReport(DeliveryResult{enqueue_error});
+        }
+    }
+
+    if (enqueue_errors != 0) {
+        LOG_WARNING(
+            "Failed to enqueue {} of {} messages to Kafka local queue", enqueue_errors, messages.size()
+        );
+    }
+    batch_waiter->Release();
+
+    return wait_handle;
+}
+
 EventHolder ProducerImpl::PollEvent() const {
     /// zero `timeout_ms` means no logical blocking wait for new events in
     /// producer queue. Actually, `rd_kafka_queue_poll` locks some pthread
@@ -268,7 +345,8 @@ std::size_t ProducerImpl::HandleEvents(std::string_view context) const {
     return handled;
 }
 
-void ProducerImpl::WaitUntilDeliveryReported(engine::Future<DeliveryResult>& delivery_result) const {
+template <typename DeliveryResultFuture>
+void ProducerImpl::WaitUntilDeliveryReported(DeliveryResultFuture& delivery_result) const {
     /// While this task is waiting for corresponding message delivery, it can
     /// handle other messages delivery reports and errors.
     /// Waiting strategy is as follows:
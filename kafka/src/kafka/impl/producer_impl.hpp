@@ -3,10 +3,12 @@
 #include <chrono>
 #include <cstdint>
 #include <optional>
+#include <vector>
 
 #include <librdkafka/rdkafka.h>
 
 #include <userver/kafka/impl/stats.hpp>
+#include <userver/kafka/producer.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/utils/periodic_task.hpp>
 
@@ -40,6 +42,11 @@ public:
         HeadersHolder headers
     ) const;
 
+    /// @brief Sends the messages and waits for delivery of all of them.
+    /// @returns the delivery results in the order of `messages`
+    [[nodiscard]] std::vector<DeliveryResult>
+    SendBatch(utils::zstring_view topic_name, utils::span<const BatchMessage> messages) const;
+
     /// @brief Waits until scheduled messages are delivered for
     /// at most 2 x `delivery_timeout`.
     ///
@@ -61,6 +68,11 @@ private:
         HeadersHolder headers
     ) const;
 
+    /// @brief Schedules the delivery of all the messages with one waiter.
+    /// @returns the future for delivery results, which must be awaited.
+    [[nodiscard]] engine::Future<std::vector<DeliveryResult>>
+    ScheduleBatchDelivery(utils::zstring_view topic_name, utils::span<const BatchMessage> messages) const;
+
     /// @brief Poll a delivery or error event from producer's queue.
     EventHolder PollEvent() const;
 
@@ -75,7 +87,8 @@ private:
 
     /// @brief Waits until message delivery status reported by `librdkafka`.
     /// Suspends for no more than `delivery_timeout` milliseconds.
-    void WaitUntilDeliveryReported(engine::Future<DeliveryResult>& delivery_result) const;
+    template <typename DeliveryResultFuture>
+    void WaitUntilDeliveryReported(DeliveryResultFuture& delivery_result) const;
 
     /// @brief Callback called on error in `librdkafka` work.
     void ErrorCallback(rd_kafka_resp_err_t error, const char* reason, bool is_fatal) const;
@@ -86,8 +99,8 @@ private:
     /// @brief Callback called on each succeeded/failed message delivery.
     /// @param message represents the delivered (or not) message. Its `_private`
     /// field contains and `opaque` argument, which was passed to
-    /// `rd_kafka_producev`, i.e. the Promise which must be set to notify
-    /// waiter about the delivery.
+    /// `rd_kafka_producev`, i.e. the DeliveryReceiver which must be notified
+    /// about the delivery.
     void DeliveryReportCallback(const rd_kafka_message_s* message) const;
 
 private:
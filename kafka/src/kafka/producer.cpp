@@ -76,6 +76,8 @@ void SendToTestPoint(
     UASSERT(false);
 }
 
+std::vector<OwningHeader> CopyHeaders(HeaderViews headers) { return {headers.begin(), headers.end()}; }
+
 }  // namespace
 
 Producer::Producer(
@@ -131,6 +133,12 @@ engine::TaskWithResult<void> Producer::SendAsync(
     );
 }
 
+void Producer::SendBatch(utils::zstring_view topic_name, utils::span<const BatchMessage> messages) const {
+    utils::Async(producer_task_processor_, "producer_send_batch", [this, topic_name, messages] {
+        SendBatchImpl(topic_name, messages);
+    }).Get();
+}
+
 void Producer::DumpMetric(utils::statistics::Writer& writer) const {
     impl::DumpMetric(writer, producer_->GetStats(), this->name_);
 }
@@ -165,6 +173,54 @@ void Producer::SendImpl(
     }
 }
 
+void Producer::SendBatchImpl(utils::zstring_view topic_name, utils::span<const BatchMessage> messages) const {
+    tracing::Span::CurrentSpan().AddTag("kafka_producer", name_);
+    tracing::Span::CurrentSpan().AddTag("kafka_send_batch_size", messages.size());
+
+    if (testsuite::AreTestpointsAvailable()) {
+        for (const auto& message : messages) {
+            SendToTestPoint(
+                name_,
+                topic_name,
+                message.key,
+                message.message,
+                message.partition,
+                CopyHeaders(message.headers),
+                "::started"
+            );
+        }
+    }
+
+    const auto delivery_results = producer_->SendBatch(topic_name, messages);
+    UASSERT(delivery_results.size() == messages.size());
+
+    std::vector<SendBatchException::Failure> failures;
+    bool is_retryable{true};
+    for (std::size_t index{0}; index < delivery_results.size(); ++index) {
+        const auto& delivery_result = delivery_results[index];
+        if (delivery_result.IsSuccess()) {
+            if (testsuite::AreTestpointsAvailable()) {
+                const auto& message = messages[index];
+                SendToTestPoint(
+                    name_, topic_name, message.key, message.message, message.partition, CopyHeaders(message.headers)
+                );
+            }
+            continue;
+        }
+
+        try {
+            ThrowSendError(delivery_result);
+        } catch (const SendException& ex) {
+            is_retryable = is_retryable && ex.IsRetryable();
+            failures.push_back({index, std::current_exception()});
+        }
+    }
+
+    if (!failures.empty()) {
+        throw SendBatchException{std::move(failures), messages.size(), is_retryable};
+    }
+}
+
 }  // namespace kafka
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/kafka/utest/kafka_fixture.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <unordered_set>
 #include <vector>
@@ -8,6 +9,7 @@
 #include <gmock/gmock-matchers.h>
 #include <sys/syslog.h>
 
+#include <userver/concurrent/variable.hpp>
 #include <userver/engine/single_use_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/async.hpp>
@@ -535,4 +537,113 @@ UTEST_F(ConsumerTest, HeadersSaveAfterMessageDestroy) {
     EXPECT_EQ(saved_headers[0].GetValue(), "value-1");
 }
 
+UTEST_F_MT(ConsumerTest, ParallelPartitionsProcessing, 4) {
+    constexpr std::uint32_t kPartitionsCount{4};
+    constexpr std::size_t kMessagesPerPartition{5};
+    constexpr std::uint32_t kFailingPartition{1};
+
+    const auto topic = GenerateTopic(kPartitionsCount);
+    const auto messages =
+        utils::GenerateFixedArray(kPartitionsCount * kMessagesPerPartition, [&topic](std::size_t i) {
+            return kafka::utest::Message{
+                topic, fmt::format("key-{}", i), fmt::format("msg-{}", i), i % kPartitionsCount};
+        });
+    SendMessages(messages);
+
+    kafka::impl::ConsumerExecutionParams params{};
+    params.max_batch_size = messages.size();
+    params.restart_after_failure_delay = std::chrono::milliseconds{100};
+    params.parallel_partitions_processing = true;
+    auto consumer = MakeConsumer("kafka-consumer", {topic}, kafka::impl::ConsumerConfiguration{}, params);
+    auto consumer_scope = consumer.MakeConsumerScope();
+
+    concurrent::Variable<std::vector<std::vector<std::int64_t>>> processed_offsets{
+        std::vector<std::vector<std::int64_t>>(kPartitionsCount)};
+    std::atomic<std::size_t> processed{0};
+    std::atomic<bool> failed{false};
+    engine::SingleUseEvent processed_event;
+    consumer_scope.Start([&](kafka::MessageBatchView batch) {
+        ASSERT_FALSE(batch.empty());
+        const auto partition = batch[0].GetPartition();
+        for (const auto& message : batch) {
+            EXPECT_EQ(message.GetPartition(), partition);
+        }
+
+        if (partition == kFailingPartition && !failed.exchange(true)) {
+            throw std::runtime_error{"failure of a single partition"};
+        }
+
+        {
+            auto offsets = processed_offsets.Lock();
+            for (const auto& message : batch) {
+                (*offsets)[partition].push_back(message.GetOffset());
+            }
+        }
+        if (processed.fetch_add(batch.size()) + batch.size() == messages.size()) {
+            processed_event.Send();
+        }
+    });
+
+    UEXPECT_NO_THROW(processed_event.Wait());
+    consumer_scope.Stop();
+
+    EXPECT_TRUE(failed.load());
+    const auto offsets = processed_offsets.Lock();
+    for (const auto& partition_offsets : *offsets) {
+        // Messages of the failed partition come again from its first message,
+        // other partitions are not re-delivered
+        EXPECT_EQ(partition_offsets.size(), kMessagesPerPartition);
+        EXPECT_TRUE(std::is_sorted(partition_offsets.begin(), partition_offsets.end()));
+    }
+}
+
+UTEST_F_MT(ConsumerTest, SlowPartitionDoesNotStallOthers, 4) {
+    constexpr std::uint32_t kSlowPartition{0};
+    constexpr std::uint32_t kFastPartition{1};
+
+    const auto topic = GenerateTopic(2);
+    const std::vector<kafka::utest::Message> first_messages{
+        {topic, "key-0", "msg-0", kSlowPartition},
+        {topic, "key-1", "msg-1", kFastPartition},
+    };
+    SendMessages(first_messages);
+
+    kafka::impl::ConsumerExecutionParams params{};
+    params.parallel_partitions_processing = true;
+    auto consumer = MakeConsumer("kafka-consumer", {topic}, kafka::impl::ConsumerConfiguration{}, params);
+    auto consumer_scope = consumer.MakeConsumerScope();
+
+    std::atomic<std::size_t> fast_processed{0};
+    engine::SingleUseEvent first_fast_processed;
+    engine::SingleUseEvent second_fast_processed;
+    engine::SingleUseEvent slow_processed;
+    consumer_scope.Start([&](kafka::MessageBatchView batch) {
+        ASSERT_FALSE(batch.empty());
+        if (batch[0].GetPartition() == kSlowPartition) {
+            // The fast partition is polled and processed meanwhile
+            const auto status =
+                second_fast_processed.WaitUntil(engine::Deadline::FromDuration(utest::kMaxTestWaitTime));
+            EXPECT_EQ(status, engine::FutureStatus::kReady);
+            slow_processed.Send();
+            return;
+        }
+
+        const auto processed = fast_processed.fetch_add(batch.size()) + batch.size();
+        if (processed == 1) {
+            first_fast_processed.Send();
+        } else if (processed == 2) {
+            second_fast_processed.Send();
+        }
+    });
+
+    UEXPECT_NO_THROW(first_fast_processed.Wait());
+    const std::vector<kafka::utest::Message> second_messages{{topic, "key-2", "msg-2", kFastPartition}};
+    SendMessages(second_messages);
+
+    UEXPECT_NO_THROW(slow_processed.Wait());
+    consumer_scope.Stop();
+
+    EXPECT_EQ(fast_processed.load(), 2);
+}
+
 USERVER_NAMESPACE_END
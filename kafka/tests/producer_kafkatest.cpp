@@ -255,6 +255,54 @@ UTEST_F(ProducerTest, OneProducerManySendAsync) {
     /// [Producer batch send async]
 }
 
+UTEST_F(ProducerTest, OneProducerSendBatch) {
+    constexpr std::size_t kSendCount{100};
+
+    auto producer = MakeProducer("kafka-producer");
+    const auto topic = GenerateTopic();
+
+    /// [Producer send batch]
+    const auto keys =
+        utils::GenerateFixedArray(kSendCount, [](std::size_t i) { return fmt::format("test-key-{}", i); });
+    const auto payloads =
+        utils::GenerateFixedArray(kSendCount, [](std::size_t i) { return fmt::format("test-msg-{}", i); });
+
+    std::vector<kafka::BatchMessage> messages;
+    messages.reserve(kSendCount);
+    for (std::size_t send{0}; send < kSendCount; ++send) {
+        messages.push_back({keys[send], payloads[send]});
+    }
+
+    UEXPECT_NO_THROW(producer.SendBatch(topic, messages));
+    /// [Producer send batch]
+}
+
+UTEST_F(ProducerTest, SendBatchPartialFailure) {
+    auto producer = MakeProducer("kafka-producer");
+
+    constexpr std::array kHeaders{kafka::HeaderView{"key-1", "value-1"}};
+    const std::array messages{
+        kafka::BatchMessage{"test-key-1", "test-msg-1"},
+        kafka::BatchMessage{"test-key-2", "test-msg-2", /*partition=*/100500},
+        kafka::BatchMessage{"test-key-3", "test-msg-3", kafka::kUnassignedPartition, kHeaders},
+    };
+
+    try {
+        producer.SendBatch(GenerateTopic(), messages);
+        ADD_FAILURE() << "SendBatch must throw";
+    } catch (const kafka::SendBatchException& e) {
+        EXPECT_FALSE(e.IsRetryable());
+        ASSERT_EQ(e.GetFailures().size(), 1u);
+        EXPECT_EQ(e.GetFailures()[0].index, 1u);
+        UEXPECT_THROW(std::rethrow_exception(e.GetFailures()[0].error), kafka::UnknownPartitionException);
+    }
+}
+
+UTEST_F(ProducerTest, SendEmptyBatch) {
+    auto producer = MakeProducer("kafka-producer");
+    UEXPECT_NO_THROW(producer.SendBatch(GenerateTopic(), {}));
+}
+
 UTEST_F(ProducerTest, ManyProducersManySendSync) {
     constexpr std::size_t kProducerCount{4};
     constexpr std::size_t kSendCount{100};
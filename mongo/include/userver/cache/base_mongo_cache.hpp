@@ -4,6 +4,8 @@
 /// @brief @copybrief components::MongoCache
 
 #include <chrono>
+#include <optional>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -14,6 +16,7 @@
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
@@ -34,6 +37,56 @@ namespace impl {
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 
+/// Limits the number of changes applied by an incremental update, the rest is
+/// applied by the following updates
+inline constexpr std::size_t kMongoCacheMaxChangesPerUpdate = 10000;
+
+enum class MongoCacheChangeType {
+    kUpsert,
+    kDelete,
+    // The collection is dropped or renamed, the change stream is closed
+    kInvalidate,
+};
+
+MongoCacheChangeType GetMongoCacheChangeType(const formats::bson::Document& change);
+
+/// Opens the change stream of the updated documents of the collection, starts
+/// it from the specified time or from the current time
+storages::mongo::ChangeStream WatchMongoCacheCollection(
+    const storages::mongo::Collection& collection,
+    bool is_secondary_preferred,
+    std::optional<std::chrono::system_clock::time_point> start_time
+);
+
+/// Reads the changes for a single incremental update from the stream
+std::vector<formats::bson::Document> ReadMongoCacheChanges(storages::mongo::ChangeStream& change_stream);
+
+/// Applies the changes to the cache data, throws on an invalidate event
+template <class MongoCacheTraits, class ParseDocumentFunc>
+void ApplyMongoCacheChanges(
+    typename MongoCacheTraits::DataType& cache,
+    const std::vector<formats::bson::Document>& changes,
+    ParseDocumentFunc&& parse_document
+) {
+    for (const auto& change : changes) {
+        switch (GetMongoCacheChangeType(change)) {
+            case MongoCacheChangeType::kUpsert:
+                // The key is a function of _id, so the new version replaces
+                // the previous one
+                parse_document(cache, change["fullDocument"]);
+                break;
+            case MongoCacheChangeType::kDelete:
+                cache.erase(MongoCacheTraits::GetKeyById(change["documentKey"]["_id"]));
+                break;
+            case MongoCacheChangeType::kInvalidate:
+                // The caller makes a full update that reopens the stream
+                throw std::runtime_error(fmt::format(
+                    "Change stream is invalidated by '{}' operation", change["operationType"].template As<std::string>()
+                ));
+        }
+    }
+}
+
 }
 
 // clang-format off
@@ -53,6 +106,24 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 /// ---- | ----------- | -------------
 /// update-correction | adjusts incremental updates window to overlap with previous update | 0
 ///
+/// ## Change stream updates
+/// If the traits specify `GetKeyById`, each full update opens a change stream
+/// of the collection before reading it, and the incremental updates apply the
+/// inserts, updates and deletes from the stream instead of querying the
+/// collection. That gives the freshness of `update-interval` with the cost of
+/// a single getMore per incremental update. Requires a replica set or a
+/// sharded cluster.
+///
+/// The cache key must be a function of `_id`, and the traits must use the
+/// default find operation: the stream delivers all the changes of the
+/// collection and can't tell the previous key of an updated document.
+///
+/// If the stream fails (e.g. its resume point is no longer in the oplog, or
+/// the collection is dropped), the incremental update falls back to a full
+/// update that reopens the stream. After the cache is loaded from a dump, the
+/// stream is started from the time of the dumped update minus
+/// `update-correction`.
+///
 /// ## Traits example:
 /// All fields below (except for function overrides) are mandatory.
 ///
@@ -111,6 +182,15 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   // Whether update part of the cache even if failed to parse some documents
 ///   static constexpr bool kAreInvalidDocumentsSkipped = false;
 ///
+///   // Optional function that enables the incremental updates from the change
+///   // stream of the collection, returns the cache key of the document by its
+///   // _id. It is used to remove the deleted documents from the cache. The
+///   // key of a document must not depend on other fields, and it can't be
+///   // combined with a custom GetFindOperation.
+///   static KeyType GetKeyById(const formats::bson::Value& id) {
+///     return id.As<KeyType>();
+///   }
+///
 ///   // Component to get the collections
 ///   using MongoCollectionsComponent = components::MongoCollections;
 /// };
@@ -150,10 +230,24 @@ private:
 
     std::unique_ptr<typename MongoCacheTraits::DataType> GetData(cache::UpdateType type);
 
+    void ParseDocument(
+        typename MongoCacheTraits::DataType& cache,
+        const formats::bson::Document& doc,
+        cache::UpdateType type,
+        cache::UpdateStatisticsScope& stats_scope
+    ) const;
+
+    void UpdateFromChangeStream(
+        const std::chrono::system_clock::time_point& last_update,
+        cache::UpdateStatisticsScope& stats_scope
+    );
+
     const std::shared_ptr<CollectionsType> mongo_collections_;
     const storages::mongo::Collection* const mongo_collection_;
     const std::chrono::system_clock::duration correction_;
     std::size_t cpu_relax_iterations_{0};
+    // Opened by the full updates, read by the incremental updates
+    std::optional<storages::mongo::ChangeStream> change_stream_;
 };
 
 template <class MongoCacheTraits>
@@ -171,7 +265,7 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config, const Co
     if (CachingComponentBase<typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes() ==
             cache::AllowedUpdateTypes::kFullAndIncremental &&
         !mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
-        !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+        !mongo_cache::impl::kHasFindOperation<MongoCacheTraits> && !mongo_cache::impl::kHasKeyById<MongoCacheTraits>) {
         throw std::logic_error(fmt::format(
             "Incremental update support is requested in config but no update field "
             "name is specified in traits of '{}' cache",
@@ -203,6 +297,30 @@ void MongoCache<MongoCacheTraits>::Update(
 ) {
     namespace sm = storages::mongo;
 
+    if constexpr (mongo_cache::impl::kHasKeyById<MongoCacheTraits>) {
+        if (type == cache::UpdateType::kIncremental) {
+            try {
+                UpdateFromChangeStream(last_update, stats_scope);
+                return;
+            } catch (const std::exception& e) {
+                LOG_WARNING() << "Failed to update cache " << MongoCacheTraits::kName
+                              << " from the change stream, falling back to a full update: " << e;
+                type = cache::UpdateType::kFull;
+            }
+        }
+
+        // The stream is opened before the collection is read, so the changes
+        // made during the full update are applied by the next incremental one
+        change_stream_.reset();
+        try {
+            change_stream_.emplace(impl::WatchMongoCacheCollection(
+                *mongo_collection_, MongoCacheTraits::kIsSecondaryPreferred, std::nullopt
+            ));
+        } catch (const std::exception& e) {
+            LOG_WARNING() << "Failed to open the change stream of cache " << MongoCacheTraits::kName << ": " << e;
+        }
+    }
+
     const auto* collection = mongo_collection_;
     auto find_op = GetFindOperation(type, last_update, now, correction_);
     auto cursor = collection->Execute(find_op);
@@ -228,24 +346,7 @@ void MongoCache<MongoCacheTraits>::Update(
         relax.Relax();
 
         stats_scope.IncreaseDocumentsReadCount(1);
-
-        try {
-            auto object = DeserializeObject(doc);
-            auto key = (object.*MongoCacheTraits::kKeyField);
-
-            if (type == cache::UpdateType::kIncremental || new_cache->count(key) == 0) {
-                (*new_cache)[key] = std::move(object);
-            } else {
-                LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache " << MongoCacheTraits::kName
-                                    << ", key=" << key;
-            }
-        } catch (const std::exception& e) {
-            LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache " << MongoCacheTraits::kName
-                                << ", _id=" << doc["_id"].template ConvertTo<std::string>() << ", what(): " << e;
-            stats_scope.IncreaseDocumentsParseFailures(1);
-
-            if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
-        }
+        ParseDocument(*new_cache, doc, type, stats_scope);
     }
 
     const auto elapsed_time = scope.ElapsedTotal(kFetchAndParseStage);
@@ -269,6 +370,76 @@ void MongoCache<MongoCacheTraits>::Update(
     stats_scope.Finish(size);
 }
 
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::ParseDocument(
+    typename MongoCacheTraits::DataType& cache,
+    const formats::bson::Document& doc,
+    cache::UpdateType type,
+    cache::UpdateStatisticsScope& stats_scope
+) const {
+    try {
+        auto object = DeserializeObject(doc);
+        auto key = (object.*MongoCacheTraits::kKeyField);
+
+        if (type == cache::UpdateType::kIncremental || cache.count(key) == 0) {
+            cache[key] = std::move(object);
+        } else {
+            LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache " << MongoCacheTraits::kName
+                                << ", key=" << key;
+        }
+    } catch (const std::exception& e) {
+        LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache " << MongoCacheTraits::kName
+                            << ", _id=" << doc["_id"].template ConvertTo<std::string>() << ", what(): " << e;
+        stats_scope.IncreaseDocumentsParseFailures(1);
+
+        if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+    }
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::UpdateFromChangeStream(
+    [[maybe_unused]] const std::chrono::system_clock::time_point& last_update,
+    [[maybe_unused]] cache::UpdateStatisticsScope& stats_scope
+) {
+    if constexpr (mongo_cache::impl::kHasKeyById<MongoCacheTraits>) {
+        if (!change_stream_) {
+            // The cache is loaded from a dump or the stream has failed to open
+            change_stream_.emplace(impl::WatchMongoCacheCollection(
+                *mongo_collection_, MongoCacheTraits::kIsSecondaryPreferred, last_update - correction_
+            ));
+        }
+
+        auto scope = tracing::Span::CurrentSpan().CreateScopeTime(kFetchAndParseStage);
+        const auto changes = impl::ReadMongoCacheChanges(*change_stream_);
+        if (changes.empty()) {
+            LOG_INFO() << "No changes in cache " << MongoCacheTraits::kName;
+            stats_scope.FinishNoChanges();
+            return;
+        }
+
+        scope.Reset("copy_data");
+        auto new_cache = GetData(cache::UpdateType::kIncremental);
+        scope.Reset(kFetchAndParseStage);
+
+        stats_scope.IncreaseDocumentsReadCount(changes.size());
+        impl::ApplyMongoCacheChanges<MongoCacheTraits>(
+            *new_cache,
+            changes,
+            [this, &stats_scope](typename MongoCacheTraits::DataType& data, const formats::bson::Document& doc) {
+                ParseDocument(data, doc, cache::UpdateType::kIncremental, stats_scope);
+            }
+        );
+
+        scope.Reset();
+
+        const auto size = new_cache->size();
+        this->Set(std::move(new_cache));
+        stats_scope.Finish(size);
+    } else {
+        UASSERT_MSG(false, "No key by id defined but UpdateFromChangeStream invoked");
+    }
+}
+
 template <class MongoCacheTraits>
 typename MongoCacheTraits::ObjectType MongoCache<MongoCacheTraits>::DeserializeObject(const formats::bson::Document& doc
 ) const {
@@ -11,7 +11,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::bson {
 class Document;
-}
+class Value;
+}  // namespace formats::bson
 
 namespace storages::mongo::operations {
 class Find;
@@ -84,6 +85,18 @@ using HasDefaultFindOperation = decltype(T::kUseDefaultFindOperation);
 template <typename T>
 inline constexpr bool kHasDefaultFindOperation = meta::IsDetected<HasDefaultFindOperation, T>;
 
+template <typename T>
+using HasKeyById = decltype(T::GetKeyById);
+template <typename T>
+inline constexpr bool kHasKeyById = meta::IsDetected<HasKeyById, T>;
+
+template <typename T>
+using HasCorrectKeyById = meta::ExpectSame<
+    typename T::DataType::key_type,
+    decltype(std::declval<const T&>().GetKeyById(std::declval<const formats::bson::Value&>()))>;
+template <typename T>
+inline constexpr bool kHasCorrectKeyById = meta::IsDetected<HasCorrectKeyById, T>;
+
 template <typename T>
 using HasInvalidDocumentsSkipped = decltype(T::kAreInvalidDocumentsSkipped);
 template <typename T>
@@ -147,6 +160,18 @@ struct CheckTraits {
         "const std::chrono::system_clock::duration& correction)"
     );
 
+    static_assert(
+        !kHasKeyById<MongoCacheTraits> || kHasCorrectKeyById<MongoCacheTraits>,
+        "Mongo cache traits must specify key by id with correct "
+        "signature and return value type: "
+        "static DataType::key_type GetKeyById(const formats::bson::Value& id)"
+    );
+    static_assert(
+        !kHasKeyById<MongoCacheTraits> || !kHasFindOperation<MongoCacheTraits>,
+        "Mongo cache traits must not specify both key by id and find operation: "
+        "the change stream updates do not apply the filter of the find operation"
+    );
+
     static_assert(
         kHasDeserializeObject<MongoCacheTraits> || kHasDefaultDeserializeObject<MongoCacheTraits>,
         "Mongo cache traits must specify deserialize object"
@@ -0,0 +1,47 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief Change stream of a collection, see Collection::Watch
+///
+/// The change stream occupies a connection of the pool while it is alive.
+/// If the stream fails, e.g. when the changes after its resume token are no
+/// longer in the oplog, the stream is no longer usable and has to be opened
+/// again.
+class ChangeStream {
+public:
+    explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+    ~ChangeStream();
+
+    ChangeStream(ChangeStream&&) noexcept;
+    ChangeStream& operator=(ChangeStream&&) noexcept;
+
+    /// @brief Returns the next change event, waits for it on the server up to
+    /// options::MaxAwaitTime
+    /// @returns std::nullopt if there were no new changes
+    std::optional<formats::bson::Document> Next();
+
+    /// @brief Returns the token to resume the stream after the last returned
+    /// change with options::ResumeAfter
+    std::optional<formats::bson::Document> GetResumeToken() const;
+
+private:
+    std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -12,6 +12,7 @@
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/value.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -117,6 +118,12 @@ public:
     template <typename... Options>
     Cursor Aggregate(formats::bson::Value pipeline, Options&&... options);
 
+    /// @brief Opens a change stream of the collection
+    /// @note Requires a replica set or a sharded cluster
+    /// @param options see @ref storages::mongo::options
+    template <typename... Options>
+    ChangeStream Watch(Options&&... options) const;
+
     /// @brief Retrieves distinct values for a specified field
     /// @param field name of the field for which to return distinct values
     /// @param options see @ref storages::mongo::options
@@ -149,6 +156,7 @@ public:
     WriteResult Execute(const operations::FindAndRemove&);
     WriteResult Execute(operations::Bulk&&);
     Cursor Execute(const operations::Aggregate&);
+    ChangeStream Execute(const operations::Watch&) const;
     void Execute(const operations::Drop&);
     /// @}
 private:
@@ -291,6 +299,13 @@ Cursor Collection::Aggregate(formats::bson::Value pipeline, Options&&... options
     return Execute(aggregate);
 }
 
+template <typename... Options>
+ChangeStream Collection::Watch(Options&&... options) const {
+    operations::Watch watch_op;
+    (watch_op.SetOption(std::forward<Options>(options)), ...);
+    return Execute(watch_op);
+}
+
 template <typename... Options>
 std::vector<formats::bson::Value> Collection::Distinct(std::string field, Options&&... options) const {
     operations::Distinct distinct_op(std::move(field));
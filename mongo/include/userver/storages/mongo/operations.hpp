@@ -339,6 +339,39 @@ private:
     utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// @brief Opens a change stream of the collection
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+class Watch {
+public:
+    Watch();
+
+    /// @param pipeline an array of aggregation stages to filter or modify the
+    /// change events
+    explicit Watch(formats::bson::Value pipeline);
+    ~Watch();
+
+    Watch(const Watch&);
+    Watch(Watch&&) noexcept;
+    Watch& operator=(const Watch&);
+    Watch& operator=(Watch&&) noexcept;
+
+    void SetOption(const options::ReadPreference&);
+    void SetOption(options::ReadPreference::Mode);
+    void SetOption(const options::ResumeAfter&);
+    void SetOption(const options::StartAtOperationTime&);
+    void SetOption(options::FullDocumentLookup);
+    void SetOption(const options::MaxAwaitTime&);
+    void SetOption(const options::Comment&);
+
+private:
+    friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+    class Impl;
+    static constexpr size_t kSize = 120;
+    static constexpr size_t kAlignment = 8;
+    utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 /// Retrieves distinct values for a specified field
 class Distinct final {
 public:
@@ -15,6 +15,7 @@
 
 #include <userver/formats/bson/bson_builder.hpp>
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/types.hpp>
 #include <userver/formats/bson/value.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/formats/common/type.hpp>
@@ -312,6 +313,47 @@ private:
     std::chrono::milliseconds value_;
 };
 
+/// @brief Specifies how long the server waits for new changes of a change
+/// stream before replying that there are none
+/// @see storages::mongo::ChangeStream
+class MaxAwaitTime {
+public:
+    explicit MaxAwaitTime(const std::chrono::milliseconds& value) : value_(value) {}
+
+    const std::chrono::milliseconds& Value() const { return value_; }
+
+private:
+    std::chrono::milliseconds value_;
+};
+
+/// @brief Starts a change stream after the change of the resume token
+/// @see storages::mongo::ChangeStream::GetResumeToken
+class ResumeAfter {
+public:
+    explicit ResumeAfter(formats::bson::Document token) : token_(std::move(token)) {}
+
+    const formats::bson::Document& Value() const { return token_; }
+
+private:
+    formats::bson::Document token_;
+};
+
+/// @brief Starts a change stream with the changes that happened at or after
+/// the specified cluster time
+class StartAtOperationTime {
+public:
+    explicit StartAtOperationTime(formats::bson::Timestamp value) : value_(value) {}
+
+    const formats::bson::Timestamp& Value() const { return value_; }
+
+private:
+    formats::bson::Timestamp value_;
+};
+
+/// @brief Makes a change stream return the current majority-committed version
+/// of the updated documents, not only the descriptions of the updates
+class FullDocumentLookup {};
+
 /// @brief Specifies collation options for text comparison
 /// @see https://docs.mongodb.com/manual/reference/collation/
 /// @see https://unicode-org.github.io/icu/userguide/collation/concepts.html
@@ -1,6 +1,12 @@
 #include <userver/cache/base_mongo_cache.hpp>
 
+#include <algorithm>
+#include <cstdint>
+
 #include <userver/components/component_config.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/storages/mongo/operations.hpp>
+#include <userver/storages/mongo/options.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -11,6 +17,57 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig& c
     return config["update-correction"].As<std::chrono::milliseconds>(0);
 }
 
+namespace {
+
+// The server replies with no changes after this time, so the incremental
+// update does not wait for the changes that are not there
+constexpr std::chrono::milliseconds kChangeStreamMaxAwaitTime{10};
+
+}  // namespace
+
+MongoCacheChangeType GetMongoCacheChangeType(const formats::bson::Document& change) {
+    const auto operation_type = change["operationType"].As<std::string>();
+    if (operation_type == "insert" || operation_type == "update" || operation_type == "replace") {
+        // The document may be deleted before the lookup of the updated version
+        const auto full_document = change["fullDocument"];
+        if (full_document.IsMissing() || full_document.IsNull()) return MongoCacheChangeType::kDelete;
+        return MongoCacheChangeType::kUpsert;
+    }
+    if (operation_type == "delete") return MongoCacheChangeType::kDelete;
+    return MongoCacheChangeType::kInvalidate;
+}
+
+storages::mongo::ChangeStream WatchMongoCacheCollection(
+    const storages::mongo::Collection& collection,
+    bool is_secondary_preferred,
+    std::optional<std::chrono::system_clock::time_point> start_time
+) {
+    namespace sm = storages::mongo;
+
+    sm::operations::Watch watch_op;
+    watch_op.SetOption(sm::options::FullDocumentLookup{});
+    watch_op.SetOption(sm::options::MaxAwaitTime{kChangeStreamMaxAwaitTime});
+    if (start_time) {
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(start_time->time_since_epoch());
+        watch_op.SetOption(sm::options::StartAtOperationTime{
+            formats::bson::Timestamp(static_cast<uint32_t>(std::max<std::int64_t>(seconds.count(), 0)), 0)});
+    }
+    if (is_secondary_preferred) {
+        watch_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+    }
+    return collection.Execute(watch_op);
+}
+
+std::vector<formats::bson::Document> ReadMongoCacheChanges(storages::mongo::ChangeStream& change_stream) {
+    std::vector<formats::bson::Document> changes;
+    while (changes.size() < kMongoCacheMaxChangesPerUpdate) {
+        auto change = change_stream.Next();
+        if (!change) break;
+        changes.push_back(std::move(*change));
+    }
+    return changes;
+}
+
 std::string GetMongoCacheSchema() {
     return R"(
 type: object
@@ -0,0 +1,118 @@
+#include <userver/cache/base_mongo_cache.hpp>
+
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+
+struct Item {
+    int id{0};
+    int value{0};
+};
+
+struct ItemsTraits {
+    using DataType = std::unordered_map<int, Item>;
+
+    static int GetKeyById(const bson::Value& id) { return id.As<int>(); }
+};
+
+class MongoCacheChangeStream : public MongoPoolFixture {};
+
+void ParseItem(ItemsTraits::DataType& data, const bson::Document& doc) {
+    const auto id = doc["_id"].As<int>();
+    data[id] = Item{id, doc["value"].As<int>()};
+}
+
+ItemsTraits::DataType FullUpdate(const mongo::Collection& coll) {
+    ItemsTraits::DataType data;
+    for (const auto& doc : coll.Find({})) {
+        ParseItem(data, doc);
+    }
+    return data;
+}
+
+void IncrementalUpdate(ItemsTraits::DataType& data, mongo::ChangeStream& stream, std::size_t expected_changes) {
+    // The changes may become visible to the stream with a delay
+    std::vector<bson::Document> changes;
+    for (int attempts = 0; changes.size() < expected_changes && attempts < 100; ++attempts) {
+        for (auto& change : components::impl::ReadMongoCacheChanges(stream)) {
+            changes.push_back(std::move(change));
+        }
+    }
+    ASSERT_EQ(changes.size(), expected_changes);
+    components::impl::ApplyMongoCacheChanges<ItemsTraits>(data, changes, &ParseItem);
+}
+
+}  // namespace
+
+UTEST_F(MongoCacheChangeStream, FullAndIncrementalUpdates) {
+    auto coll = GetDefaultPool().GetCollection("cache_updates");
+    coll.InsertOne(bson::MakeDoc("_id", 1, "value", 1));
+    coll.InsertOne(bson::MakeDoc("_id", 2, "value", 2));
+
+    auto stream = components::impl::WatchMongoCacheCollection(coll, false, std::nullopt);
+    auto data = FullUpdate(coll);
+    EXPECT_EQ(data.size(), 2);
+
+    coll.InsertOne(bson::MakeDoc("_id", 3, "value", 3));
+    coll.UpdateOne(bson::MakeDoc("_id", 1), bson::MakeDoc("$set", bson::MakeDoc("value", 10)));
+    coll.DeleteOne(bson::MakeDoc("_id", 2));
+    UEXPECT_NO_THROW(IncrementalUpdate(data, stream, 3));
+
+    ASSERT_EQ(data.size(), 2);
+    EXPECT_EQ(data.at(1).value, 10);
+    EXPECT_EQ(data.at(3).value, 3);
+    EXPECT_EQ(data.count(2), 0);
+    EXPECT_TRUE(components::impl::ReadMongoCacheChanges(stream).empty());
+}
+
+UTEST_F(MongoCacheChangeStream, StartTime) {
+    auto coll = GetDefaultPool().GetCollection("cache_start_time");
+    // Operation time has a precision of seconds
+    const auto last_update = std::chrono::system_clock::now() - std::chrono::seconds{1};
+    coll.InsertOne(bson::MakeDoc("_id", 1, "value", 1));
+
+    // The cache is loaded from a dump made before the insert
+    auto stream = components::impl::WatchMongoCacheCollection(coll, false, last_update);
+    ItemsTraits::DataType data;
+    UEXPECT_NO_THROW(IncrementalUpdate(data, stream, 1));
+
+    ASSERT_EQ(data.size(), 1);
+    EXPECT_EQ(data.at(1).value, 1);
+}
+
+UTEST_F(MongoCacheChangeStream, InvalidateFallsBackToFullUpdate) {
+    auto coll = GetDefaultPool().GetCollection("cache_invalidate");
+    coll.InsertOne(bson::MakeDoc("_id", 1, "value", 1));
+
+    auto stream = components::impl::WatchMongoCacheCollection(coll, false, std::nullopt);
+    auto data = FullUpdate(coll);
+    EXPECT_EQ(data.size(), 1);
+
+    // 'drop' and 'invalidate' events
+    coll.Drop();
+    UEXPECT_THROW(IncrementalUpdate(data, stream, 2), std::exception);
+
+    // The full update reopens the stream
+    coll.InsertOne(bson::MakeDoc("_id", 2, "value", 2));
+    stream = components::impl::WatchMongoCacheCollection(coll, false, std::nullopt);
+    data = FullUpdate(coll);
+    ASSERT_EQ(data.size(), 1);
+    EXPECT_EQ(data.at(2).value, 2);
+
+    coll.UpdateOne(bson::MakeDoc("_id", 2), bson::MakeDoc("$set", bson::MakeDoc("value", 20)));
+    UEXPECT_NO_THROW(IncrementalUpdate(data, stream, 1));
+    EXPECT_EQ(data.at(2).value, 20);
+}
+
+USERVER_NAMESPACE_END
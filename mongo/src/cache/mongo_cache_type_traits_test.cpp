@@ -2,6 +2,7 @@
 
 #include <userver/cache/update_type.hpp>
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/value.hpp>
 #include <userver/storages/mongo/operations.hpp>
 
 #include <gtest/gtest.h>
@@ -55,6 +56,18 @@ struct IncorrectSignatureOfFindOperation {
     static storages::mongo::operations::Find GetFindOperation(int x, int y);
 };
 
+struct CorrectKeyById {
+    using DataType = std::unordered_map<int, int>;
+
+    static int GetKeyById(const formats::bson::Value& id);
+};
+
+struct IncorrectReturnTypeOfKeyById {
+    using DataType = std::unordered_map<int, int>;
+
+    static std::string GetKeyById(const formats::bson::Value& id);
+};
+
 TEST(CheckTraits, DeserializeObject) {
     EXPECT_TRUE(mongo_cache::impl::kHasCorrectDeserializeObject<CorrectDeserializeObject>);
     EXPECT_FALSE(mongo_cache::impl::kHasCorrectDeserializeObject<IncorrectReturnTypeOfDeserializeObject>);
@@ -67,6 +80,12 @@ TEST(CheckTraits, FindOperation) {
     EXPECT_FALSE(mongo_cache::impl::kHasCorrectFindOperation<IncorrectSignatureOfFindOperation>);
 }
 
+TEST(CheckTraits, KeyById) {
+    EXPECT_TRUE(mongo_cache::impl::kHasCorrectKeyById<CorrectKeyById>);
+    EXPECT_FALSE(mongo_cache::impl::kHasCorrectKeyById<IncorrectReturnTypeOfKeyById>);
+    EXPECT_FALSE(mongo_cache::impl::kHasKeyById<CorrectMongoCacheTraits>);
+}
+
 TEST(CheckTraits, CorrectTraits) { mongo_cache::impl::CheckTraits<CorrectMongoCacheTraits>{}; }
 
 USERVER_NAMESPACE_END
@@ -16,6 +16,7 @@
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -578,6 +579,38 @@ Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
     ));
 }
 
+ChangeStream CDriverCollectionImpl::Execute(const operations::Watch& operation) const {
+    auto context = MakeRequestContext("mongo_watch", operation);
+
+    auto options = operation.impl_->options;
+    bool has_comment_option = operation.impl_->has_comment_option;
+    if (!has_comment_option) SetLinkComment(impl::EnsureBuilder(options), has_comment_option);
+
+    // The change stream is opened with the read preference of the collection
+    if (operation.impl_->read_prefs) {
+        mongoc_collection_set_read_prefs(context.collection.get(), operation.impl_->read_prefs.Get());
+    }
+
+    auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+    const bson_t* native_pipeline_bson_ptr = pipeline_doc.GetBson().get();
+
+    MongoError error;
+    const bson_t* error_reply = nullptr;
+    stats::OperationStopwatch stopwatch(context.stats);
+    impl::cdriver::ChangeStreamPtr cdriver_stream(
+        mongoc_collection_watch(context.collection.get(), native_pipeline_bson_ptr, impl::GetNative(options))
+    );
+    if (mongoc_change_stream_error_document(cdriver_stream.get(), error.GetNative(), &error_reply)) {
+        stopwatch.AccountError(error.GetKind());
+        error.Throw("Error opening the change stream");
+    }
+    stopwatch.AccountSuccess();
+
+    return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+        std::move(context.client), std::move(cdriver_stream), std::move(context.stats)
+    ));
+}
+
 void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
     auto context = MakeRequestContext("mongo_drop", operation);
 
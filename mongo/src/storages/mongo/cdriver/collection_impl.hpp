@@ -40,6 +40,7 @@ public:
     WriteResult Execute(const operations::FindAndRemove&) override;
     WriteResult Execute(operations::Bulk&&) override;
     Cursor Execute(const operations::Aggregate&) override;
+    ChangeStream Execute(const operations::Watch&) const override;
     void Execute(const operations::Drop&) override;
 
 private:
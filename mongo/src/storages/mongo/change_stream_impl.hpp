@@ -0,0 +1,21 @@
+#pragma once
+
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl {
+
+class ChangeStreamImpl {
+public:
+    virtual ~ChangeStreamImpl() = default;
+
+    virtual std::optional<formats::bson::Document> Next() = 0;
+    virtual std::optional<formats::bson::Document> GetResumeToken() const = 0;
+};
+
+}  // namespace storages::mongo::impl
+
+USERVER_NAMESPACE_END
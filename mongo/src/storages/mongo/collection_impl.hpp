@@ -4,6 +4,7 @@
 
 #include <storages/mongo/stats.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -33,6 +34,7 @@ public:
     virtual WriteResult Execute(const operations::FindAndRemove&) = 0;
     virtual WriteResult Execute(operations::Bulk&&) = 0;
     virtual Cursor Execute(const operations::Aggregate&) = 0;
+    virtual ChangeStream Execute(const operations::Watch&) const = 0;
     virtual void Execute(const operations::Drop&) = 0;
 
 protected:
@@ -620,6 +620,42 @@ std::vector<formats::bson::Value> SortBsonValues(std::vector<formats::bson::Valu
     return values;
 }
 
+UTEST_F(Collection, Watch) {
+    auto coll = GetDefaultPool().GetCollection("watch");
+    coll.InsertOne(bson::MakeDoc("_id", 0));
+
+    auto stream = coll.Watch(
+        mongo::options::FullDocumentLookup{}, mongo::options::MaxAwaitTime(std::chrono::milliseconds{100})
+    );
+    coll.InsertOne(bson::MakeDoc("_id", 1, "x", 1));
+    coll.UpdateOne(bson::MakeDoc("_id", 1), bson::MakeDoc("$set", bson::MakeDoc("x", 2)));
+    coll.DeleteOne(bson::MakeDoc("_id", 1));
+
+    std::vector<bson::Document> changes;
+    for (int attempts = 0; changes.size() < 3 && attempts < 100; ++attempts) {
+        auto change = stream.Next();
+        if (change) changes.push_back(std::move(*change));
+    }
+    ASSERT_EQ(3, changes.size());
+    EXPECT_EQ("insert", changes[0]["operationType"].As<std::string>());
+    EXPECT_EQ("update", changes[1]["operationType"].As<std::string>());
+    EXPECT_EQ(1, changes[1]["documentKey"]["_id"].As<int>());
+    EXPECT_EQ("delete", changes[2]["operationType"].As<std::string>());
+    EXPECT_FALSE(stream.Next());
+
+    const auto resume_token = stream.GetResumeToken();
+    ASSERT_TRUE(resume_token);
+    coll.InsertOne(bson::MakeDoc("_id", 2));
+
+    auto resumed = coll.Watch(
+        mongo::options::ResumeAfter{*resume_token}, mongo::options::MaxAwaitTime(std::chrono::milliseconds{100})
+    );
+    std::optional<bson::Document> change;
+    for (int attempts = 0; !change && attempts < 100; ++attempts) change = resumed.Next();
+    ASSERT_TRUE(change);
+    EXPECT_EQ(2, (*change)["documentKey"]["_id"].As<int>());
+}
+
 UTEST_F(Collection, Distinct) {
     {
         auto coll = GetDefaultPool().GetCollection("distinct");
@@ -3,6 +3,7 @@
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/utils/assert.hpp>
@@ -552,6 +553,54 @@ void Aggregate::SetOption(const options::MaxServerTime& max_server_time) {
     AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+Watch::Watch() : Watch(formats::bson::MakeArray()) {}
+
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+    if (!impl_->pipeline.IsArray()) {
+        throw InvalidQueryArgumentException("Change stream pipeline is not an array");
+    }
+}
+
+Watch::~Watch() = default;
+
+Watch::Watch(const Watch& other) = default;
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(const options::ReadPreference& read_prefs) {
+    impl_->read_prefs = MakeCDriverReadPrefs(read_prefs);
+}
+
+void Watch::SetOption(options::ReadPreference::Mode mode) { impl_->read_prefs = MakeCDriverReadPrefs(mode); }
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+    static constexpr utils::StringLiteral kOptionName = "resumeAfter";
+    impl::EnsureBuilder(impl_->options).Append(kOptionName, resume_after.Value());
+}
+
+void Watch::SetOption(const options::StartAtOperationTime& start_at) {
+    static constexpr utils::StringLiteral kOptionName = "startAtOperationTime";
+    impl::EnsureBuilder(impl_->options).Append(kOptionName, start_at.Value());
+}
+
+void Watch::SetOption(options::FullDocumentLookup) {
+    static constexpr utils::StringLiteral kOptionName = "fullDocument";
+    impl::EnsureBuilder(impl_->options).Append(kOptionName, "updateLookup");
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+    static constexpr utils::StringLiteral kOptionName = "maxAwaitTimeMS";
+    if (max_await_time.Value() <= std::chrono::milliseconds::zero()) {
+        throw InvalidQueryArgumentException("Change stream max await time must be positive");
+    }
+    impl::EnsureBuilder(impl_->options).Append(kOptionName, static_cast<int64_t>(max_await_time.Value().count()));
+}
+
+void Watch::SetOption(const options::Comment& comment) {
+    AppendComment(impl::EnsureBuilder(impl_->options), impl_->has_comment_option, comment);
+}
+
 Drop::Drop() = default;
 Drop::~Drop() = default;
 
@@ -157,6 +157,17 @@ public:
     std::chrono::milliseconds max_server_time{kNoMaxServerTime};
 };
 
+class Watch::Impl {
+public:
+    explicit Impl(formats::bson::Value pipeline_) : pipeline(std::move(pipeline_)) {}
+
+    formats::bson::Value pipeline;
+    impl::cdriver::ReadPrefsPtr read_prefs;
+    stats::OperationKey op_key{stats::OpType::kWatch};
+    std::optional<formats::bson::impl::BsonBuilder> options;
+    bool has_comment_option{false};
+};
+
 class Distinct::Impl {
 public:
     explicit Impl(std::string field_) : field(std::move(field_)) {}
@@ -140,6 +140,8 @@ std::string_view ToString(OpType type) {
             return "bulk";
         case Type::kAggregate:
             return "aggregate";
+        case Type::kWatch:
+            return "watch";
         case Type::kDrop:
             return "drop";
     }
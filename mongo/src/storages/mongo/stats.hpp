@@ -74,6 +74,7 @@ enum class OpType {
     kFind,
     kDistinct,
     kAggregate,
+    kWatch,
 
     kWriteMin,
     kInsertOne = kWriteMin,
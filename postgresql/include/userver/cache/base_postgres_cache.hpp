@@ -5,11 +5,15 @@
 
 #include <userver/cache/base_postgres_cache_fwd.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <map>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -23,11 +27,17 @@
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/void_t.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -66,6 +76,7 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// prefetch-next-chunk | whether to fetch the next chunk of rows while the current one is parsed | true
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -105,6 +116,26 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Container With Write Notification Example
 ///
+/// @section pg_cc_partitions Partitioned full updates
+///
+/// Full updates of large caches are bound by the speed of a single connection
+/// and a single parsing task. Policy may have a static function
+/// GetFullUpdatePartitions that returns a container of SQL conditions. Each
+/// condition is added to the where clause of the full update query and the
+/// partitions are loaded concurrently in separate transactions, so they are
+/// spread over the hosts of the cluster according to `kClusterHostType`. Rows
+/// are parsed concurrently and merged into the cache container.
+///
+/// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Partitions Example
+///
+/// The conditions must cover all the rows of the query and should not
+/// overlap, otherwise the order of the merged rows is not specified.
+/// Incremental updates are not partitioned.
+///
+/// The load duration and the number of read rows of each partition are
+/// reported in the `cache.postgres.partitions` metrics with the `partition`
+/// label holding the index of the partition.
+///
 /// @section pg_cc_forward_declaration Forward Declaration
 ///
 /// To forward declare a cache you can forward declare a trait and
@@ -174,6 +205,12 @@ using HasOrderBy = decltype(T::kOrderBy);
 template <typename T>
 inline constexpr bool kHasOrderBy = meta::IsDetected<HasOrderBy, T>;
 
+// Full update partitions in policy
+template <typename T>
+using HasFullUpdatePartitions = decltype(T::GetFullUpdatePartitions());
+template <typename T>
+inline constexpr bool kHasFullUpdatePartitions = meta::IsDetected<HasFullUpdatePartitions, T>;
+
 // Update field
 template <typename T>
 using HasUpdatedField = decltype(T::kUpdatedField);
@@ -382,8 +419,22 @@ inline constexpr std::chrono::milliseconds kCpuRelaxInterval{2};
 inline constexpr std::string_view kCopyStage = "copy_data";
 inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
+inline constexpr std::string_view kMergeStage = "merge";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+
+struct PartitionStatistics final {
+    std::atomic<std::chrono::milliseconds> last_load_duration{{}};
+    utils::statistics::RateCounter documents_read_count{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const PartitionStatistics& stats);
+
+utils::statistics::Entry RegisterPartitionStatistics(
+    const ComponentContext& context,
+    std::string_view cache_name,
+    const std::vector<PartitionStatistics>& stats
+);
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -435,10 +486,40 @@ private:
         tracing::ScopeTime& scope
     );
 
+    /// Calls `consume` with each chunk of the query results
+    template <typename Consumer>
+    void FetchResults(
+        storages::postgres::Cluster& cluster,
+        const storages::postgres::Query& query,
+        std::chrono::milliseconds timeout,
+        const UpdatedFieldType& last_updated,
+        tracing::ScopeTime& scope,
+        Consumer&& consume
+    );
+
+    /// Calls `consume` with each parsed value of the results
+    template <typename Consumer>
+    void ParseResults(
+        const storages::postgres::ResultSet& res,
+        cache::UpdateStatisticsScope& stats_scope,
+        tracing::ScopeTime& scope,
+        Consumer&& consume
+    );
+
+    /// Loads the partitions of a full update concurrently, returns the number
+    /// of read rows
+    std::size_t LoadPartitions(
+        const UpdatedFieldType& last_updated,
+        DataType& data_cache,
+        cache::UpdateStatisticsScope& stats_scope
+    );
+
     static storages::postgres::Query GetAllQuery();
     static storages::postgres::Query GetDeltaQuery();
+    static std::vector<storages::postgres::Query> GetPartitionQueries();
     static std::string GetWhereClause();
     static std::string GetDeltaWhereClause();
+    static std::string GetPartitionWhereClause(std::string_view partition);
     static std::string GetOrderByClause();
 
     std::chrono::milliseconds ParseCorrection(const ComponentConfig& config);
@@ -449,8 +530,14 @@ private:
     const std::chrono::milliseconds full_update_timeout_;
     const std::chrono::milliseconds incremental_update_timeout_;
     const std::size_t chunk_size_;
+    const bool prefetch_next_chunk_;
+    const std::vector<storages::postgres::Query> partition_queries_;
+    std::vector<pg_cache::detail::PartitionStatistics> partition_stats_;
     std::size_t cpu_relax_iterations_parse_{0};
     std::size_t cpu_relax_iterations_copy_{0};
+
+    // Must be the last field
+    utils::statistics::Entry partition_statistics_holder_;
 };
 
 template <typename PostgreCachePolicy>
@@ -465,7 +552,10 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
       incremental_update_timeout_{config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
           pg_cache::detail::kDefaultIncrementalUpdateTimeout
       )},
-      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)} {
+      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)},
+      prefetch_next_chunk_{config["prefetch-next-chunk"].As<bool>(true)},
+      partition_queries_{GetPartitionQueries()},
+      partition_stats_(partition_queries_.size()) {
     UINVARIANT(
         !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
         "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
@@ -500,6 +590,15 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
 
     LOG_INFO() << "Cache " << kName << " full update query `" << GetAllQuery().GetStatementView()
                << "` incremental update query `" << GetDeltaQuery().GetStatementView() << "`";
+    for (const auto& partition_query : partition_queries_) {
+        LOG_INFO() << "Cache " << kName << " full update partition query `" << partition_query.GetStatementView()
+                   << "`";
+    }
+
+    if (!partition_stats_.empty()) {
+        partition_statistics_holder_ =
+            pg_cache::detail::RegisterPartitionStatistics(context, config.Name(), partition_stats_);
+    }
 
     this->StartPeriodicUpdates();
 }
@@ -507,6 +606,7 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
 template <typename PostgreCachePolicy>
 PostgreCache<PostgreCachePolicy>::~PostgreCache() {
     this->StopPeriodicUpdates();
+    partition_statistics_holder_.Unregister();
 }
 
 template <typename PostgreCachePolicy>
@@ -529,6 +629,15 @@ std::string PostgreCache<PostgreCachePolicy>::GetDeltaWhereClause() {
     }
 }
 
+template <typename PostgreCachePolicy>
+std::string PostgreCache<PostgreCachePolicy>::GetPartitionWhereClause(std::string_view partition) {
+    if constexpr (pg_cache::detail::kHasWhere<PostgreCachePolicy>) {
+        return fmt::format(FMT_COMPILE("where ({}) and ({})"), PostgreCachePolicy::kWhere, partition);
+    } else {
+        return fmt::format(FMT_COMPILE("where {}"), partition);
+    }
+}
+
 template <typename PostgreCachePolicy>
 std::string PostgreCache<PostgreCachePolicy>::GetOrderByClause() {
     if constexpr (pg_cache::detail::kHasOrderBy<PostgreCachePolicy>) {
@@ -557,6 +666,20 @@ storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetDeltaQuery() {
     }
 }
 
+template <typename PostgreCachePolicy>
+std::vector<storages::postgres::Query> PostgreCache<PostgreCachePolicy>::GetPartitionQueries() {
+    std::vector<storages::postgres::Query> queries;
+    if constexpr (pg_cache::detail::kHasFullUpdatePartitions<PostgreCachePolicy>) {
+        const storages::postgres::Query query = PolicyCheckerType::GetQuery();
+        for (const auto& partition : PostgreCachePolicy::GetFullUpdatePartitions()) {
+            queries.emplace_back(fmt::format(
+                "{} {} {}", query.GetStatementView(), GetPartitionWhereClause(partition), GetOrderByClause()
+            ));
+        }
+    }
+    return queries;
+}
+
 template <typename PostgreCachePolicy>
 std::chrono::milliseconds PostgreCache<PostgreCachePolicy>::ParseCorrection(const ComponentConfig& config) {
     static constexpr std::string_view kUpdateCorrection = "update-correction";
@@ -587,7 +710,6 @@ void PostgreCache<PostgreCachePolicy>::Update(
     const std::chrono::system_clock::time_point& /*now*/,
     cache::UpdateStatisticsScope& stats_scope
 ) {
-    namespace pg = storages::postgres;
     if constexpr (!kIncrementalUpdates) {
         type = cache::UpdateType::kFull;
     }
@@ -603,43 +725,25 @@ void PostgreCache<PostgreCachePolicy>::Update(
     scope.Reset(std::string{pg_cache::detail::kFetchStage});
 
     size_t changes = 0;
-    // Iterate clusters
-    for (auto& cluster : clusters_) {
-        if (chunk_size_ > 0) {
-            auto trx = cluster->Begin(
-                kClusterHostTypeFlags,
-                pg::Transaction::RO,
-                pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff}
+    if (type == cache::UpdateType::kFull && !partition_queries_.empty()) {
+        changes = LoadPartitions(GetLastUpdated(last_update, *data_cache), *data_cache, stats_scope);
+    } else {
+        // Iterate clusters
+        for (auto& cluster : clusters_) {
+            FetchResults(
+                *cluster,
+                query,
+                timeout,
+                GetLastUpdated(last_update, *data_cache),
+                scope,
+                [&](storages::postgres::ResultSet&& res) {
+                    stats_scope.IncreaseDocumentsReadCount(res.Size());
+
+                    scope.Reset(std::string{pg_cache::detail::kParseStage});
+                    CacheResults(res, data_cache, stats_scope, scope);
+                    changes += res.Size();
+                }
             );
-            auto portal = trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
-            while (portal) {
-                scope.Reset(std::string{pg_cache::detail::kFetchStage});
-                auto res = portal.Fetch(chunk_size_);
-                stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-                scope.Reset(std::string{pg_cache::detail::kParseStage});
-                CacheResults(res, data_cache, stats_scope, scope);
-                changes += res.Size();
-            }
-            trx.Commit();
-        } else {
-            const bool has_parameter = query.GetStatementView().find('$') != std::string::npos;
-            auto res = has_parameter ? cluster->Execute(
-                                           kClusterHostTypeFlags,
-                                           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
-                                           query,
-                                           GetLastUpdated(last_update, *data_cache)
-                                       )
-                                     : cluster->Execute(
-                                           kClusterHostTypeFlags,
-                                           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
-                                           query
-                                       );
-            stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-            scope.Reset(std::string{pg_cache::detail::kParseStage});
-            CacheResults(res, data_cache, stats_scope, scope);
-            changes += res.Size();
         }
     }
 
@@ -691,16 +795,27 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
     CachedData& data_cache,
     cache::UpdateStatisticsScope& stats_scope,
     tracing::ScopeTime& scope
+) {
+    ParseResults(res, stats_scope, scope, [&data_cache](ValueType&& value) {
+        using pg_cache::detail::CacheInsertOrAssign;
+        CacheInsertOrAssign(*data_cache, std::move(value), PostgreCachePolicy::kKeyMember);
+    });
+}
+
+template <typename PostgreCachePolicy>
+template <typename Consumer>
+void PostgreCache<PostgreCachePolicy>::ParseResults(
+    const storages::postgres::ResultSet& res,
+    cache::UpdateStatisticsScope& stats_scope,
+    tracing::ScopeTime& scope,
+    Consumer&& consume
 ) {
     auto values = res.AsSetOf<RawValueType>(storages::postgres::kRowTag);
     utils::CpuRelax relax{cpu_relax_iterations_parse_, &scope};
     for (auto p = values.begin(); p != values.end(); ++p) {
         relax.Relax();
         try {
-            using pg_cache::detail::CacheInsertOrAssign;
-            CacheInsertOrAssign(
-                *data_cache, pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p), PostgreCachePolicy::kKeyMember
-            );
+            consume(pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p));
         } catch (const std::exception& e) {
             stats_scope.IncreaseDocumentsParseFailures(1);
             LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
@@ -709,6 +824,124 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
     }
 }
 
+template <typename PostgreCachePolicy>
+template <typename Consumer>
+void PostgreCache<PostgreCachePolicy>::FetchResults(
+    storages::postgres::Cluster& cluster,
+    const storages::postgres::Query& query,
+    std::chrono::milliseconds timeout,
+    const UpdatedFieldType& last_updated,
+    tracing::ScopeTime& scope,
+    Consumer&& consume
+) {
+    namespace pg = storages::postgres;
+    const pg::CommandControl cmd_ctl{timeout, pg_cache::detail::kStatementTimeoutOff};
+
+    if (chunk_size_ == 0) {
+        const bool has_parameter = query.GetStatementView().find('$') != std::string::npos;
+        auto res = has_parameter ? cluster.Execute(kClusterHostTypeFlags, cmd_ctl, query, last_updated)
+                                 : cluster.Execute(kClusterHostTypeFlags, cmd_ctl, query);
+        consume(std::move(res));
+        return;
+    }
+
+    auto trx = cluster.Begin(kClusterHostTypeFlags, pg::Transaction::RO, cmd_ctl);
+    auto portal = trx.MakePortal(query, last_updated);
+    // The next chunk is fetched while the current one is consumed. Declared
+    // after the portal and the transaction to be cancelled before them.
+    std::optional<engine::TaskWithResult<pg::ResultSet>> next_chunk;
+    bool has_more = static_cast<bool>(portal);
+    while (has_more) {
+        scope.Reset(std::string{pg_cache::detail::kFetchStage});
+        auto res = next_chunk ? next_chunk->Get() : portal.Fetch(chunk_size_);
+        next_chunk.reset();
+
+        // The portal must not be accessed while the next chunk is fetched
+        has_more = static_cast<bool>(portal);
+        if (has_more && prefetch_next_chunk_) {
+            next_chunk.emplace(utils::Async("pg_cache_fetch", [&portal, chunk_size = chunk_size_] {
+                return portal.Fetch(chunk_size);
+            }));
+        }
+
+        consume(std::move(res));
+    }
+    trx.Commit();
+}
+
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::LoadPartitions(
+    const UpdatedFieldType& last_updated,
+    DataType& data_cache,
+    cache::UpdateStatisticsScope& stats_scope
+) {
+    struct PartitionResult {
+        std::size_t rows{0};
+        std::chrono::milliseconds duration{0};
+    };
+
+    // Rows are parsed concurrently, only the insertion is serialized
+    engine::Mutex data_cache_mutex;
+    const auto load_partition = [&](storages::postgres::Cluster& cluster, const storages::postgres::Query& query) {
+        const auto start = std::chrono::steady_clock::now();
+        auto scope = tracing::Span::CurrentSpan().CreateScopeTime(std::string{pg_cache::detail::kFetchStage});
+        PartitionResult result;
+        std::vector<ValueType> values;
+
+        const auto consume = [&](storages::postgres::ResultSet&& res) {
+            stats_scope.IncreaseDocumentsReadCount(res.Size());
+            result.rows += res.Size();
+
+            scope.Reset(std::string{pg_cache::detail::kParseStage});
+            values.clear();
+            values.reserve(res.Size());
+            ParseResults(res, stats_scope, scope, [&values](ValueType&& value) { values.push_back(std::move(value)); });
+
+            scope.Reset(std::string{pg_cache::detail::kMergeStage});
+            const std::lock_guard lock{data_cache_mutex};
+            for (auto& value : values) {
+                using pg_cache::detail::CacheInsertOrAssign;
+                CacheInsertOrAssign(data_cache, std::move(value), PostgreCachePolicy::kKeyMember);
+            }
+        };
+        FetchResults(cluster, query, full_update_timeout_, last_updated, scope, consume);
+
+        result.duration =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        return result;
+    };
+
+    std::vector<std::size_t> task_partitions;
+    std::vector<engine::TaskWithResult<PartitionResult>> tasks;
+    task_partitions.reserve(clusters_.size() * partition_queries_.size());
+    tasks.reserve(clusters_.size() * partition_queries_.size());
+    for (const auto& cluster : clusters_) {
+        for (std::size_t i = 0; i < partition_queries_.size(); ++i) {
+            task_partitions.push_back(i);
+            tasks.push_back(utils::Async(
+                "pg_cache_partition", load_partition, std::ref(*cluster), std::cref(partition_queries_[i])
+            ));
+        }
+    }
+
+    std::vector<PartitionResult> partition_results(partition_queries_.size());
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        const auto result = tasks[i].Get();
+        auto& partition_result = partition_results[task_partitions[i]];
+        partition_result.rows += result.rows;
+        partition_result.duration = std::max(partition_result.duration, result.duration);
+    }
+
+    std::size_t changes = 0;
+    for (std::size_t i = 0; i < partition_results.size(); ++i) {
+        auto& stats = partition_stats_[i];
+        stats.last_load_duration = partition_results[i].duration;
+        stats.documents_read_count += utils::statistics::Rate{partition_results[i].rows};
+        changes += partition_results[i].rows;
+    }
+    return changes;
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::CachedData
 PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type, tracing::ScopeTime& scope) {
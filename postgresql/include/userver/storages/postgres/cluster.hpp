@@ -59,6 +59,37 @@
 /// ⇦ @ref pg_errors | @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md ⇨
 /// @htmlonly </div> @endhtmlonly
 
+/// @page pg_query_batching uPg: Batching of single statements
+///
+/// Each single statement executed via Cluster::Execute occupies a connection
+/// for a whole network roundtrip, so a service that runs a lot of concurrent
+/// short reads needs a large pool, and the server needs a backend process per
+/// connection.
+///
+/// With `query_batching_enabled: true` in the static config of the component
+/// the concurrent single statements to read-only hosts (any host type other
+/// than ClusterHostType::kMaster) share a connection. A statement joins the
+/// batch of statements that is open for the same host, or acquires a
+/// connection for a new batch. The batch collects statements for
+/// `query_batching_window_us`, or until `query_batching_max_size` statements
+/// have arrived, and then sends them all in a single pipeline, so one
+/// connection serves up to `query_batching_max_size` statements per roundtrip.
+/// Every batched statement waits for the window, so the window adds to its
+/// latency. The statements that come later are sent in the next roundtrip on
+/// the same connection. The `queries.batch-rounds` and `queries.batched`
+/// metrics show how many statements a roundtrip serves.
+///
+/// An error of a statement is reported only to its caller, other statements
+/// of the batch are not affected unless the connection fails.
+///
+/// Batching requires the pipeline mode (the `pipeline_enabled` static option
+/// or @ref POSTGRES_CONNECTION_PIPELINE_EXPERIMENT) and prepared statements.
+/// Without them the statements of a batch are executed one by one on the
+/// shared connection, which still saves the connections but adds latency.
+///
+/// Statements that are executed in transactions, on the master host, and via
+/// QueryQueue are never batched.
+
 USERVER_NAMESPACE_BEGIN
 
 namespace components {
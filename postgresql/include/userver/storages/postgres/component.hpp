@@ -138,6 +138,9 @@ namespace components {
 /// max_pool_size           | maximum number of created connections for "connlimit_mode: manual"            | 15
 /// max_queue_size          | maximum number of clients waiting for a connection                            | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// query_batching_enabled  | share pipelined connections between concurrent single statements to read-only hosts, see @ref pg_query_batching | false
+/// query_batching_window_us| how long a batch of single statements waits for concurrent statements, in microseconds | 500
+/// query_batching_max_size | maximum number of single statements in a batch                                | 32
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings                | --
 /// deadline-propagation-enabled | whether deadline propagation sets statement timeout                      | true
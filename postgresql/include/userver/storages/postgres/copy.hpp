@@ -0,0 +1,231 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief Streaming of rows via COPY in binary format
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include <userver/engine/deadline.hpp>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/type_mapping.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @page pg_copy uPg: Bulk data transfer via COPY
+///
+/// For loading and unloading of a large number of rows uPg provides the
+/// streaming interface to the PostgreSQL `COPY` command. Rows are
+/// transferred in PostgreSQL binary format, which is the format that uPg
+/// uses for query parameters and results, so the same C++ types are
+/// supported.
+///
+/// COPY is several times faster than multi-row `INSERT`s or
+/// Transaction::ExecuteDecompose, as the server does not plan and execute
+/// a statement per chunk of rows and the client does not build the parameter
+/// arrays.
+///
+/// Only `COPY ... FROM STDIN (FORMAT binary)` and
+/// `COPY ... TO STDOUT (FORMAT binary)` statements are supported. The
+/// statements may be named, named statements are accounted in the statement
+/// statistics.
+///
+/// COPY is started via Transaction::MakeCopyIn or Transaction::MakeCopyOut
+/// and occupies the connection of the transaction until it is finished. The
+/// CopyIn and CopyOut objects must not outlive the transaction.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopySample
+///
+/// Network timeout from the command control applies to each network
+/// operation, statement timeout applies to the whole COPY on the server side.
+/// The optional engine::Deadline passed to the factory methods limits the
+/// duration of the whole COPY on the client side.
+///
+/// If the COPY is interrupted by a network error, a timeout or a task
+/// cancellation, the connection is closed.
+
+/// @brief Streams rows to a `COPY ... FROM STDIN (FORMAT binary)` statement.
+///
+/// Rows are accumulated in a buffer and sent in chunks, each chunk is sent
+/// only when the previous one is accepted by the network, so a slow server
+/// slows down the producer instead of making the buffers grow.
+///
+/// If the object is destroyed before Finish() is called, the COPY is
+/// aborted and the transaction fails.
+class CopyIn {
+public:
+    CopyIn(CopyIn&&) noexcept;
+    CopyIn& operator=(CopyIn&&) noexcept;
+    ~CopyIn();
+
+    /// @brief Write a row consisting of the values of the columns
+    template <typename... Columns>
+    void WriteRow(const Columns&... columns);
+
+    /// @brief Write a row from the fields of a row type
+    ///
+    /// @see @ref pg_user_row_types
+    template <typename Row>
+    void WriteRow(const Row& row, RowTag);
+
+    /// @brief Write the elements of the container as rows. Elements of a row
+    /// type are written field by field, other elements are written as
+    /// single-column rows.
+    template <typename Container>
+    void WriteRows(const Container& rows);
+
+    /// @brief Send the rest of the data and finish the COPY.
+    /// @returns the number of copied rows as reported by the server
+    std::size_t Finish();
+
+    /// @brief Number of rows written so far
+    std::size_t RowsWritten() const;
+
+private:
+    friend class Transaction;
+
+    CopyIn(
+        const detail::ConnectionPtr& conn,
+        const Query& query,
+        OptionalCommandControl statement_cmd_ctl,
+        engine::Deadline deadline
+    );
+
+    template <typename... Columns>
+    void DoWriteRow(const Columns&... columns);
+
+    const UserTypes& GetUserTypes() const;
+    std::string& GetBuffer();
+    void RollbackRow(std::size_t row_begin) noexcept;
+    void OnRowWritten();
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+/// @brief Reads rows of a `COPY ... TO STDOUT (FORMAT binary)` statement.
+///
+/// Rows are read from the network on demand, only the data of a single
+/// network message is buffered.
+///
+/// If the object is destroyed before all the rows are read, the connection
+/// is closed, as there is no way to stop the COPY on the server side.
+class CopyOut {
+public:
+    CopyOut(CopyOut&&) noexcept;
+    CopyOut& operator=(CopyOut&&) noexcept;
+    ~CopyOut();
+
+    /// @brief Read the next row into the columns.
+    /// @returns false if there are no more rows.
+    /// @throws InvalidInputBufferSize if the number of columns does not match.
+    template <typename... Columns>
+    bool ReadRow(Columns&... columns);
+
+    /// @brief Read the next row into the fields of a row type.
+    /// @returns false if there are no more rows.
+    ///
+    /// @see @ref pg_user_row_types
+    template <typename Row>
+    bool ReadRow(Row& row, RowTag);
+
+    /// @brief Returns true if all the rows are read and the COPY is finished
+    bool IsDone() const;
+
+    /// @brief Number of rows read so far
+    std::size_t RowsRead() const;
+
+private:
+    friend class Transaction;
+
+    CopyOut(
+        const detail::ConnectionPtr& conn,
+        const Query& query,
+        OptionalCommandControl statement_cmd_ctl,
+        engine::Deadline deadline
+    );
+
+    /// Returns the buffer with the fields of the next row
+    std::optional<io::FieldBuffer> FetchRow(std::size_t columns_count);
+    const io::TypeBufferCategory& GetTypeBufferCategories() const;
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+template <typename... Columns>
+void CopyIn::WriteRow(const Columns&... columns) {
+    DoWriteRow(columns...);
+}
+
+template <typename Row>
+void CopyIn::WriteRow(const Row& row, RowTag) {
+    io::traits::AssertIsValidRowType<Row>();
+    std::apply([this](const auto&... columns) { DoWriteRow(columns...); }, io::RowType<Row>::GetTuple(row));
+}
+
+template <typename Container>
+void CopyIn::WriteRows(const Container& rows) {
+    for (const auto& row : rows) {
+        using Row = std::decay_t<decltype(row)>;
+        if constexpr (io::traits::kIsRowType<Row>) {
+            WriteRow(row, kRowTag);
+        } else {
+            WriteRow(row);
+        }
+    }
+}
+
+template <typename... Columns>
+void CopyIn::DoWriteRow(const Columns&... columns) {
+    static_assert(sizeof...(Columns) > 0, "A row must have at least one column");
+    static_assert((io::traits::kIsMappedToPg<Columns> && ...), "Type doesn't have mapping to Postgres type");
+
+    const auto& types = GetUserTypes();
+    auto& buffer = GetBuffer();
+    const auto row_begin = buffer.size();
+    try {
+        io::WriteBuffer(types, buffer, static_cast<Smallint>(sizeof...(Columns)));
+        (io::WriteRawBinary(types, buffer, columns), ...);
+    } catch (const std::exception&) {
+        RollbackRow(row_begin);
+        throw;
+    }
+    OnRowWritten();
+}
+
+template <typename... Columns>
+bool CopyOut::ReadRow(Columns&... columns) {
+    static_assert(sizeof...(Columns) > 0, "A row must have at least one column");
+
+    auto row = FetchRow(sizeof...(Columns));
+    if (!row) return false;
+
+    const auto& categories = GetTypeBufferCategories();
+    (row->ReadRaw(columns, categories, io::traits::kTypeBufferCategory<Columns>), ...);
+    return true;
+}
+
+template <typename Row>
+bool CopyOut::ReadRow(Row& row, RowTag) {
+    io::traits::AssertIsValidRowType<Row>();
+    return std::apply(
+        [this](auto&... columns) { return ReadRow(columns...); }, io::RowType<Row>::GetTuple(row)
+    );
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
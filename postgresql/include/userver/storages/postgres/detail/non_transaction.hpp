@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <userver/storages/postgres/options.hpp>
@@ -18,10 +19,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::detail {
 
+class QueryBatch;
+
 class NonTransaction {
 public:
     explicit NonTransaction(ConnectionPtr&& conn, SteadyClock::time_point start_time = detail::SteadyClock::now());
 
+    /// Statement is executed in a batch with statements of other
+    /// NonTransactions on a shared connection
+    explicit NonTransaction(std::shared_ptr<QueryBatch>&& batch);
+
     NonTransaction(NonTransaction&&) noexcept;
     NonTransaction& operator=(NonTransaction&&) noexcept;
 
@@ -72,7 +79,10 @@ private:
     DoExecute(const Query& query, const detail::QueryParameters& params, OptionalCommandControl statement_cmd_ctl);
     const UserTypes& GetConnectionUserTypes() const;
 
+    const detail::ConnectionPtr& GetConnection() const;
+
     detail::ConnectionPtr conn_;
+    std::shared_ptr<QueryBatch> batch_;
 };
 
 }  // namespace storages::postgres::detail
@@ -47,9 +47,15 @@ public:
 
     template <typename T>
     size_type To(T&& val) const {
+        return To(GetBuffer(), std::forward<T>(val));
+    }
+
+    /// Read the buffer of the field that was obtained beforehand, e.g. for all
+    /// the rows of a column at once
+    template <typename T>
+    size_type To(const io::FieldBuffer& buffer, T&& val) const {
         using ValueType = typename std::decay<T>::type;
-        auto fb = GetBuffer();
-        return ReadNullable(fb, std::forward<T>(val), io::traits::IsNullable<ValueType>{});
+        return ReadNullable(buffer, std::forward<T>(val), io::traits::IsNullable<ValueType>{});
     }
 
 private:
@@ -166,6 +166,12 @@ inline constexpr std::size_t kDefaultPoolMaxQueueSize = 200;
 /// Default limit for concurrent establishing connections number
 inline constexpr std::size_t kDefaultConnectingLimit = 0;
 
+/// Default time a batch of single statements waits for concurrent statements
+inline constexpr std::chrono::microseconds kDefaultQueryBatchingWindow{500};
+
+/// Default maximum number of single statements in a batch
+inline constexpr std::size_t kDefaultQueryBatchingMaxSize = 32;
+
 /// @brief PostgreSQL topology options
 ///
 /// Dynamic option @ref POSTGRES_TOPOLOGY_SETTINGS
@@ -194,9 +200,21 @@ struct PoolSettings final {
     /// Limits number of concurrent establishing connections (0 - unlimited)
     std::size_t connecting_limit{kDefaultConnectingLimit};
 
+    /// Whether concurrent single statements to read-only hosts share
+    /// a pipelined connection, see @ref pg_query_batching
+    bool query_batching_enabled{false};
+
+    /// How long a batch of single statements waits for concurrent statements
+    std::chrono::microseconds query_batching_window{kDefaultQueryBatchingWindow};
+
+    /// Maximum number of single statements in a batch
+    std::size_t query_batching_max_size{kDefaultQueryBatchingMaxSize};
+
     bool operator==(const PoolSettings& rhs) const {
         return min_size == rhs.min_size && max_size == rhs.max_size && max_queue_size == rhs.max_queue_size &&
-               connecting_limit == rhs.connecting_limit;
+               connecting_limit == rhs.connecting_limit && query_batching_enabled == rhs.query_batching_enabled &&
+               query_batching_window == rhs.query_batching_window &&
+               query_batching_max_size == rhs.query_batching_max_size;
     }
 };
 
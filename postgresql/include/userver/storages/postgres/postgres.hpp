@@ -38,6 +38,7 @@
 ///   of network bandwidth on select statements that return multiple columns
 ///   (compared to the libpq implementation);
 /// - Portals for effective background cache updates;
+/// - Streaming bulk loads and unloads via binary COPY, see @ref pg_copy;
 /// - Queries pipelining to execute multiple queries in one network roundtrip
 ///   (for example `begin + set transaction timeout + insert` result in one
 ///   roundtrip);
@@ -6,8 +6,11 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -18,6 +21,8 @@
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/meta.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -156,6 +161,21 @@ namespace storages::postgres {
 /// @endcode
 ///
 ///
+/// @par Borrowing string values
+///
+/// Fields of text and bytea types can be extracted into `std::string_view`,
+/// either directly or as members of user row types. Such values point into
+/// the buffer of the result set and are valid only while the ResultSet (or a
+/// copy of it) is alive, no memory is allocated for them. Extraction of such
+/// values from a temporary ResultSet via AsContainer, AsSingleRow or
+/// AsOptionalSingleRow does not compile.
+///
+/// @code
+/// auto res = trx.Execute("select id, name from users");
+/// // Views into `res`, `res` must outlive `users`
+/// auto users = res.AsContainer<std::vector<std::tuple<int, std::string_view>>>(kRowTag);
+/// @endcode
+///
 /// @par Converting a Row to a user row type
 ///
 /// A row can be converted to a user type (tuple, structure, class), for more
@@ -184,6 +204,56 @@ namespace storages::postgres {
 template <typename T, typename ExtractionTag>
 class TypedResultSet;
 
+namespace detail {
+
+template <typename Container>
+using SubscriptResult = decltype(std::declval<Container&>()[std::declval<std::size_t>()]);
+
+// Containers that can be filled column by column
+template <typename Container>
+inline constexpr bool kIsDecodableByColumns =
+    io::traits::kCanResize<Container> &&
+    std::is_same_v<meta::DetectedType<SubscriptResult, Container>, typename Container::value_type&> &&
+    std::is_default_constructible_v<typename Container::value_type>;
+
+template <typename T>
+constexpr bool HasBorrowedFields();
+
+template <typename Tuple, std::size_t... Indexes>
+constexpr bool HasBorrowedTupleFields(std::index_sequence<Indexes...>) {
+    return (HasBorrowedFields<std::tuple_element_t<Indexes, Tuple>>() || ...);
+}
+
+// Whether the type points into the buffer of a result set
+template <typename T>
+constexpr bool HasBorrowedFields() {
+    using ValueType = std::decay_t<T>;
+    if constexpr (std::is_same_v<ValueType, std::string_view>) {
+        return true;
+    } else if constexpr (meta::kIsOptional<ValueType>) {
+        return HasBorrowedFields<typename ValueType::value_type>();
+    } else if constexpr (io::traits::kIsRowType<ValueType>) {
+        using TupleType = std::decay_t<typename io::RowType<ValueType>::TupleType>;
+        return HasBorrowedTupleFields<TupleType>(std::make_index_sequence<std::tuple_size_v<TupleType>>{});
+    } else if constexpr (meta::kIsRange<ValueType> && !meta::kIsRecursiveRange<ValueType>) {
+        return HasBorrowedFields<meta::RangeValueType<ValueType>>();
+    } else {
+        return false;
+    }
+}
+
+template <typename T>
+constexpr void AssertNotBorrowedFromTemporary() {
+    static_assert(
+        !HasBorrowedFields<T>(),
+        "The extracted value points into the buffer of a temporary ResultSet "
+        "and would dangle (e.g. std::string_view). Store the ResultSet in a "
+        "variable before extracting the data"
+    );
+}
+
+}  // namespace detail
+
 /// @brief PostgreSQL result set
 ///
 /// Provides random access to rows via indexing operations
@@ -284,38 +354,99 @@ public:
     auto AsSetOf(FieldTag) const;
 
     /// @brief Extract data into a container.
+    ///
+    /// Containers with `resize` and indexing (e.g. std::vector or std::deque)
+    /// are filled column by column: the buffers of a column are obtained once
+    /// and all the values of the column are parsed in a row.
+    ///
     /// For more information see @ref pg_user_row_types
     template <typename Container>
-    Container AsContainer() const;
+    Container AsContainer() const&;
     template <typename Container>
-    Container AsContainer(RowTag) const;
+    Container AsContainer(RowTag) const&;
 
     /// @brief Extract first row into user type.
     /// A single row result set is expected, will throw an exception when result
     /// set size != 1
     template <typename T>
-    auto AsSingleRow() const;
+    auto AsSingleRow() const&;
     template <typename T>
-    auto AsSingleRow(RowTag) const;
+    auto AsSingleRow(RowTag) const&;
     template <typename T>
-    auto AsSingleRow(FieldTag) const;
+    auto AsSingleRow(FieldTag) const&;
 
     /// @brief Extract first row into user type.
     /// @returns A single row result set if non empty result was returned, empty
     /// std::optional otherwise
     /// @throws exception when result set size > 1
     template <typename T>
-    std::optional<T> AsOptionalSingleRow() const;
+    std::optional<T> AsOptionalSingleRow() const&;
+    template <typename T>
+    std::optional<T> AsOptionalSingleRow(RowTag) const&;
+    template <typename T>
+    std::optional<T> AsOptionalSingleRow(FieldTag) const&;
+
+    // Values that point into the buffer of a temporary result set would dangle
+    template <typename Container>
+    Container AsContainer() const&& {
+        detail::AssertNotBorrowedFromTemporary<typename Container::value_type>();
+        return AsContainer<Container>();
+    }
+    template <typename Container>
+    Container AsContainer(RowTag) const&& {
+        detail::AssertNotBorrowedFromTemporary<typename Container::value_type>();
+        return AsContainer<Container>(kRowTag);
+    }
+    template <typename T>
+    auto AsSingleRow() const&& {
+        detail::AssertNotBorrowedFromTemporary<T>();
+        return AsSingleRow<T>();
+    }
+    template <typename T>
+    auto AsSingleRow(RowTag) const&& {
+        detail::AssertNotBorrowedFromTemporary<T>();
+        return AsSingleRow<T>(kRowTag);
+    }
+    template <typename T>
+    auto AsSingleRow(FieldTag) const&& {
+        detail::AssertNotBorrowedFromTemporary<T>();
+        return AsSingleRow<T>(kFieldTag);
+    }
+    template <typename T>
+    std::optional<T> AsOptionalSingleRow() const&& {
+        detail::AssertNotBorrowedFromTemporary<T>();
+        return AsOptionalSingleRow<T>();
+    }
     template <typename T>
-    std::optional<T> AsOptionalSingleRow(RowTag) const;
+    std::optional<T> AsOptionalSingleRow(RowTag) const&& {
+        detail::AssertNotBorrowedFromTemporary<T>();
+        return AsOptionalSingleRow<T>(kRowTag);
+    }
     template <typename T>
-    std::optional<T> AsOptionalSingleRow(FieldTag) const;
+    std::optional<T> AsOptionalSingleRow(FieldTag) const&& {
+        detail::AssertNotBorrowedFromTemporary<T>();
+        return AsOptionalSingleRow<T>(kFieldTag);
+    }
     //@}
 private:
     friend class detail::ConnectionImpl;
     void FillBufferCategories(const UserTypes& types);
     void SetBufferCategoriesFrom(const ResultSet&);
 
+    //@{
+    /** @name Columnar extraction */
+    template <typename Container>
+    void FillByColumns(Container& c, FieldTag) const;
+    template <typename Container>
+    void FillByColumns(Container& c, RowTag) const;
+    template <typename Container, std::size_t... Indexes>
+    void ReadRowColumns(Container& c, std::vector<io::FieldBuffer>& buffers, std::index_sequence<Indexes...>) const;
+    template <typename Container, typename Projection>
+    void ReadColumn(Container& c, size_type column, std::vector<io::FieldBuffer>& buffers, Projection projection)
+        const;
+    void GetColumnBuffers(size_type column, std::vector<io::FieldBuffer>& buffers) const;
+    //@}
+
     template <typename T, typename Tag>
     friend class TypedResultSet;
     friend class ConnectionImpl;
@@ -348,7 +479,7 @@ auto ResultSet::AsSetOf(FieldTag) const {
 }
 
 template <typename Container>
-Container ResultSet::AsContainer() const {
+Container ResultSet::AsContainer() const& {
     detail::AssertSaneTypeToDeserialize<Container>();
     using ValueType = typename Container::value_type;
     Container c;
@@ -357,17 +488,21 @@ Container ResultSet::AsContainer() const {
     }
     auto res = AsSetOf<ValueType>();
 
-    auto inserter = io::traits::Inserter(c);
-    auto row_it = res.begin();
-    for (std::size_t i = 0; i < res.Size(); ++i, ++row_it, ++inserter) {
-        *inserter = *row_it;
+    if constexpr (detail::kIsDecodableByColumns<Container>) {
+        FillByColumns(c, kFieldTag);
+    } else {
+        auto inserter = io::traits::Inserter(c);
+        auto row_it = res.begin();
+        for (std::size_t i = 0; i < res.Size(); ++i, ++row_it, ++inserter) {
+            *inserter = *row_it;
+        }
     }
 
     return c;
 }
 
 template <typename Container>
-Container ResultSet::AsContainer(RowTag) const {
+Container ResultSet::AsContainer(RowTag) const& {
     detail::AssertSaneTypeToDeserialize<Container>();
     using ValueType = typename Container::value_type;
     Container c;
@@ -376,22 +511,26 @@ Container ResultSet::AsContainer(RowTag) const {
     }
     auto res = AsSetOf<ValueType>(kRowTag);
 
-    auto inserter = io::traits::Inserter(c);
-    auto row_it = res.begin();
-    for (std::size_t i = 0; i < res.Size(); ++i, ++row_it, ++inserter) {
-        *inserter = *row_it;
+    if constexpr (detail::kIsDecodableByColumns<Container>) {
+        FillByColumns(c, kRowTag);
+    } else {
+        auto inserter = io::traits::Inserter(c);
+        auto row_it = res.begin();
+        for (std::size_t i = 0; i < res.Size(); ++i, ++row_it, ++inserter) {
+            *inserter = *row_it;
+        }
     }
 
     return c;
 }
 
 template <typename T>
-auto ResultSet::AsSingleRow() const {
+auto ResultSet::AsSingleRow() const& {
     return AsSingleRow<T>(kFieldTag);
 }
 
 template <typename T>
-auto ResultSet::AsSingleRow(RowTag) const {
+auto ResultSet::AsSingleRow(RowTag) const& {
     detail::AssertSaneTypeToDeserialize<T>();
     if (Size() != 1) {
         throw NonSingleRowResultSet{Size()};
@@ -400,7 +539,7 @@ auto ResultSet::AsSingleRow(RowTag) const {
 }
 
 template <typename T>
-auto ResultSet::AsSingleRow(FieldTag) const {
+auto ResultSet::AsSingleRow(FieldTag) const& {
     detail::AssertSaneTypeToDeserialize<T>();
     if (Size() != 1) {
         throw NonSingleRowResultSet{Size()};
@@ -409,20 +548,79 @@ auto ResultSet::AsSingleRow(FieldTag) const {
 }
 
 template <typename T>
-std::optional<T> ResultSet::AsOptionalSingleRow() const {
+std::optional<T> ResultSet::AsOptionalSingleRow() const& {
     return AsOptionalSingleRow<T>(kFieldTag);
 }
 
 template <typename T>
-std::optional<T> ResultSet::AsOptionalSingleRow(RowTag) const {
+std::optional<T> ResultSet::AsOptionalSingleRow(RowTag) const& {
     return IsEmpty() ? std::nullopt : std::optional<T>{AsSingleRow<T>(kRowTag)};
 }
 
 template <typename T>
-std::optional<T> ResultSet::AsOptionalSingleRow(FieldTag) const {
+std::optional<T> ResultSet::AsOptionalSingleRow(FieldTag) const& {
     return IsEmpty() ? std::nullopt : std::optional<T>{AsSingleRow<T>(kFieldTag)};
 }
 
+template <typename Container>
+void ResultSet::FillByColumns(Container& c, FieldTag) const {
+    if (IsEmpty()) return;
+    if (FieldCount() < 1) {
+        throw InvalidTupleSizeRequested{FieldCount(), 1};
+    }
+
+    c.resize(Size());
+    std::vector<io::FieldBuffer> buffers;
+    ReadColumn(c, 0, buffers, [](auto& value) -> auto& { return value; });
+}
+
+template <typename Container>
+void ResultSet::FillByColumns(Container& c, RowTag) const {
+    using RowType = io::RowType<typename Container::value_type>;
+    if (IsEmpty()) return;
+    if (RowType::size > FieldCount()) {
+        throw InvalidTupleSizeRequested(FieldCount(), RowType::size);
+    } else if (RowType::size < FieldCount()) {
+        LOG_LIMITED_WARNING() << "Row size is greater that the number of data members in "
+                                 "C++ user datatype "
+                              << compiler::GetTypeName<typename Container::value_type>();
+    }
+
+    c.resize(Size());
+    std::vector<io::FieldBuffer> buffers;
+    ReadRowColumns(c, buffers, std::make_index_sequence<RowType::size>{});
+}
+
+template <typename Container, std::size_t... Indexes>
+void ResultSet::ReadRowColumns(
+    Container& c,
+    std::vector<io::FieldBuffer>& buffers,
+    std::index_sequence<Indexes...>
+) const {
+    using RowType = io::RowType<typename Container::value_type>;
+    (ReadColumn(
+         c,
+         Indexes,
+         buffers,
+         [](auto& row) -> decltype(auto) { return std::get<Indexes>(RowType::GetTuple(row)); }
+     ),
+     ...);
+}
+
+template <typename Container, typename Projection>
+void ResultSet::ReadColumn(
+    Container& c,
+    size_type column,
+    std::vector<io::FieldBuffer>& buffers,
+    Projection projection
+) const {
+    GetColumnBuffers(column, buffers);
+    UASSERT(buffers.size() == c.size());
+    for (size_type row = 0; row < buffers.size(); ++row) {
+        FieldView{*pimpl_, row, column}.To(buffers[row], projection(c[row]));
+    }
+}
+
 /// @page pg_user_row_types uPg: Typed PostgreSQL results
 ///
 /// The ResultSet provides access to a generic PostgreSQL result buffer wrapper
@@ -551,6 +749,17 @@ std::optional<T> ResultSet::AsOptionalSingleRow(FieldTag) const {
 ///
 /// @endcode
 ///
+/// @par Columnar extraction
+///
+/// AsContainer fills containers that support `resize` and indexing (e.g.
+/// std::vector or std::deque) column by column. The buffers of a column are
+/// obtained once per result set, and then the values of all the rows are
+/// parsed in a tight loop, which is considerably faster for results with many
+/// rows than the row by row iteration via AsSetOf. Elements of such
+/// containers must be default constructible. Combined with `std::string_view`
+/// members the extraction does not allocate memory for string values, see
+/// @ref pg_process_results.
+///
 ///
 /// ----------
 ///
@@ -40,6 +40,10 @@ struct TransactionStatistics {
     Counter reply_total = 0;
     /// Number of portal bind operations
     Counter portal_bind_total{0};
+    /// Number of rounds of batched single statements sent
+    Counter batch_round_total{0};
+    /// Number of single statements sent in batches
+    Counter batched_statement_total{0};
     /// Error during query execution
     Counter error_execute_total = 0;
     /// Timeout while executing query
@@ -177,6 +181,8 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
         transaction.execute_total = stats.transaction.execute_total;
         transaction.reply_total = stats.transaction.reply_total;
         transaction.portal_bind_total = stats.transaction.portal_bind_total;
+        transaction.batch_round_total = stats.transaction.batch_round_total;
+        transaction.batched_statement_total = stats.transaction.batched_statement_total;
         transaction.error_execute_total = stats.transaction.error_execute_total;
         transaction.execute_timeout = stats.transaction.execute_timeout;
         transaction.duplicate_prepared_statements = stats.transaction.duplicate_prepared_statements;
@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -372,6 +373,38 @@ public:
     ///       See @ref scripts/docs/en/userver/sql_files.md for more information.
     Portal MakePortal(OptionalCommandControl statement_cmd_ctl, const Query& query, const ParameterStore& store);
 
+    /// @brief Start a `COPY ... FROM STDIN (FORMAT binary)` statement for
+    /// streaming of rows to the database.
+    ///
+    /// @param deadline limits the duration of the whole COPY
+    ///
+    /// @see @ref pg_copy
+    CopyIn MakeCopyIn(const Query& query, engine::Deadline deadline = {}) {
+        return MakeCopyIn(OptionalCommandControl{}, query, deadline);
+    }
+
+    /// @brief Start a `COPY ... FROM STDIN (FORMAT binary)` statement with
+    /// per-statement command control.
+    ///
+    /// @see @ref pg_copy
+    CopyIn MakeCopyIn(OptionalCommandControl statement_cmd_ctl, const Query& query, engine::Deadline deadline = {});
+
+    /// @brief Start a `COPY ... TO STDOUT (FORMAT binary)` statement for
+    /// streaming of rows from the database.
+    ///
+    /// @param deadline limits the duration of the whole COPY
+    ///
+    /// @see @ref pg_copy
+    CopyOut MakeCopyOut(const Query& query, engine::Deadline deadline = {}) {
+        return MakeCopyOut(OptionalCommandControl{}, query, deadline);
+    }
+
+    /// @brief Start a `COPY ... TO STDOUT (FORMAT binary)` statement with
+    /// per-statement command control.
+    ///
+    /// @see @ref pg_copy
+    CopyOut MakeCopyOut(OptionalCommandControl statement_cmd_ctl, const Query& query, engine::Deadline deadline = {});
+
     /// Set a connection parameter
     /// https://www.postgresql.org/docs/current/sql-set.html
     /// The parameter is set for this transaction only
@@ -404,6 +437,7 @@ private:
     );
 
     const UserTypes& GetConnectionUserTypes() const;
+    OptionalCommandControl PrepareCopy(const Query& query, OptionalCommandControl statement_cmd_ctl) const;
 
     std::string name_;
     detail::ConnectionPtr conn_;
@@ -1,9 +1,37 @@
 #include <userver/cache/base_postgres_cache.hpp>
 
+#include <userver/components/statistics_storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace components::pg_cache::detail {
+
+void DumpMetric(utils::statistics::Writer& writer, const PartitionStatistics& stats) {
+    writer["last-load-duration-ms"] = stats.last_load_duration.load().count();
+    writer["documents-read"] = stats.documents_read_count;
+}
+
+utils::statistics::Entry RegisterPartitionStatistics(
+    const ComponentContext& context,
+    std::string_view cache_name,
+    const std::vector<PartitionStatistics>& stats
+) {
+    return context.FindComponent<components::StatisticsStorage>().GetStorage().RegisterWriter(
+        "cache",
+        [&stats](utils::statistics::Writer& writer) {
+            auto partitions = writer["postgres"]["partitions"];
+            for (std::size_t i = 0; i < stats.size(); ++i) {
+                partitions.ValueWithLabels(stats[i], {"partition", std::to_string(i)});
+            }
+        },
+        {{"cache_name", std::string{cache_name}}}
+    );
+}
+
+}  // namespace components::pg_cache::detail
+
 namespace components::impl {
 
 std::string GetPostgreCacheSchema() {
@@ -28,6 +56,10 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    prefetch-next-chunk:
+        type: boolean
+        description: whether to fetch the next chunk of rows while the current one is parsed
+        defaultDescription: true
     pgcomponent:
         type: string
         description: PostgreSQL component name
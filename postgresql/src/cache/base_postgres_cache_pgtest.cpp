@@ -0,0 +1,183 @@
+#include <userver/cache/base_postgres_cache.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <storages/postgres/tests/util_pgtest.hpp>
+#include <userver/components/component_base.hpp>
+#include <userver/components/minimal_component_list.hpp>
+#include <userver/components/run.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/storages/postgres/component.hpp>
+#include <userver/storages/postgres/portal.hpp>
+#include <userver/testsuite/cache_control.hpp>
+#include <userver/testsuite/testsuite_support.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+
+constexpr int kRowsCount = 100;
+constexpr std::string_view kPostgresName = "postgres-db";
+
+struct Item {
+    int id{0};
+    std::string value;
+};
+
+struct PartitionedPolicy {
+    static constexpr std::string_view kName = "partitioned-pg-cache";
+    using ValueType = Item;
+    static constexpr auto kKeyMember = &Item::id;
+    static constexpr const char* kQuery = "select id, value from partitioned_cache_test";
+    static constexpr const char* kUpdatedField = "";
+    static constexpr auto kClusterHostType = pg::ClusterHostType::kMaster;
+
+    static std::vector<std::string> GetFullUpdatePartitions() { return {"id % 3 = 0", "id % 3 = 1", "id % 3 = 2"}; }
+};
+
+using PartitionedCache = components::PostgreCache<PartitionedPolicy>;
+
+// Rows of the generate_series(1, kRowsCount) matching each partition
+const std::vector<std::uint64_t> kExpectedPartitionRows{33, 34, 33};
+
+std::vector<std::uint64_t> GetPartitionRows(const utils::statistics::Storage& storage) {
+    const utils::statistics::Snapshot snapshot{
+        storage, "cache.postgres.partitions", {{"cache_name", std::string{PartitionedPolicy::kName}}}};
+
+    std::vector<std::uint64_t> rows;
+    for (std::size_t i = 0; i < kExpectedPartitionRows.size(); ++i) {
+        const auto metric = snapshot.SingleMetricOptional("documents-read", {{"partition", std::to_string(i)}});
+        rows.push_back(metric ? metric->AsRate().value : 0);
+    }
+    return rows;
+}
+
+class PartitionedCacheChecker final : public components::ComponentBase {
+public:
+    static constexpr std::string_view kName = "partitioned-pg-cache-checker";
+
+    PartitionedCacheChecker(const components::ComponentConfig& config, const components::ComponentContext& context)
+        : components::ComponentBase(config, context),
+          cluster_(context.FindComponent<components::Postgres>(kPostgresName).GetCluster()),
+          cache_(context.FindComponent<PartitionedCache>()),
+          storage_(context.FindComponent<components::StatisticsStorage>().GetStorage()),
+          cc_(testsuite::FindCacheControl(context)) {
+        cluster_->Execute(pg::ClusterHostType::kMaster, "drop table if exists partitioned_cache_test");
+        cluster_->Execute(
+            pg::ClusterHostType::kMaster,
+            "create table partitioned_cache_test(id integer primary key, value text not null)"
+        );
+        cluster_->Execute(
+            pg::ClusterHostType::kMaster,
+            "insert into partitioned_cache_test select i, 'value-' || i from generate_series(1, $1) i",
+            kRowsCount
+        );
+    }
+
+    void OnAllComponentsLoaded() override {
+        // The first update of the cache has happened before the table was
+        // created
+        const auto rows_before = GetPartitionRows(storage_);
+        cc_.ResetCaches(cache::UpdateType::kFull, {std::string{PartitionedPolicy::kName}}, {});
+        const auto rows_after = GetPartitionRows(storage_);
+
+        for (std::size_t i = 0; i < kExpectedPartitionRows.size(); ++i) {
+            EXPECT_EQ(rows_after[i] - rows_before[i], kExpectedPartitionRows[i]) << "partition " << i;
+        }
+
+        const auto data = cache_.Get();
+        EXPECT_EQ(data->size(), std::size_t{kRowsCount});
+        for (int id = 1; id <= kRowsCount; ++id) {
+            const auto it = data->find(id);
+            if (it == data->end()) {
+                ADD_FAILURE() << "Missing row " << id;
+                continue;
+            }
+            EXPECT_EQ(it->second.value, fmt::format("value-{}", id));
+        }
+
+        cluster_->Execute(pg::ClusterHostType::kMaster, "drop table partitioned_cache_test");
+    }
+
+private:
+    const pg::ClusterPtr cluster_;
+    PartitionedCache& cache_;
+    const utils::statistics::Storage& storage_;
+    testsuite::CacheControl& cc_;
+};
+
+}  // namespace
+
+template <>
+inline constexpr auto components::kConfigFileMode<PartitionedCacheChecker> = ConfigFileMode::kNotRequired;
+
+namespace {
+
+components::InMemoryConfig MakeConfig(const pg::Dsn& dsn) {
+    // BEWARE! No separate fs-task-processor
+    return components::InMemoryConfig{fmt::format(
+        R"(
+components_manager:
+  coro_pool:
+    initial_size: 50
+  default_task_processor: main-task-processor
+  fs_task_processor: main-task-processor
+  event_thread_pool:
+    threads: 1
+  task_processors:
+    main-task-processor:
+      worker_threads: 4
+  components:
+    logging:
+      fs-task-processor: main-task-processor
+      loggers:
+        default:
+          file_path: '@null'
+    testsuite-support: {{}}
+    {}:
+      dbconnection: '{}'
+      dns_resolver: getaddrinfo
+    {}:
+      pgcomponent: {}
+      update-types: only-full
+      update-interval: 1h
+      first-update-fail-ok: true
+      chunk-size: 10
+      prefetch-next-chunk: true
+)",
+        kPostgresName,
+        dsn.GetUnderlying(),
+        PartitionedPolicy::kName,
+        kPostgresName
+    )};
+}
+
+components::ComponentList MakeComponentList() {
+    return components::MinimalComponentList()
+        .Append<components::TestsuiteSupport>()
+        .Append<components::Postgres>(kPostgresName)
+        .Append<PartitionedCache>()
+        .Append<PartitionedCacheChecker>();
+}
+
+class PostgreCachePartitions : public PostgreSQLBase {};
+
+}  // namespace
+
+TEST_F(PostgreCachePartitions, FullUpdateWithPrefetch) {
+    if (!pg::Portal::IsSupportedByDriver()) {
+        GTEST_SKIP() << "Chunked fetching requires PostgreSQL portals";
+    }
+
+    UEXPECT_NO_THROW(components::RunOnce(MakeConfig(GetDsnFromEnv()), MakeComponentList()));
+}
+
+USERVER_NAMESPACE_END
@@ -397,6 +397,20 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    query_batching_enabled:
+        type: boolean
+        description: share pipelined connections between concurrent single statements to read-only hosts
+        defaultDescription: false
+    query_batching_window_us:
+        type: integer
+        description: how long a batch of single statements waits for concurrent statements, in microseconds
+        defaultDescription: 500
+        minimum: 1
+    query_batching_max_size:
+        type: integer
+        description: maximum number of single statements in a batch
+        defaultDescription: 32
+        minimum: 1
     connlimit_mode:
         type: string
         enum:
@@ -0,0 +1,336 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/statement_stats.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// Signature, flags field and header extension area length
+constexpr std::string_view kCopySignature{"PGCOPY\n\377\r\n\0", 11};
+constexpr std::size_t kCopyHeaderSize = kCopySignature.size() + 2 * sizeof(Integer);
+constexpr Smallint kCopyTrailer = -1;
+
+// Rows are sent to the server in chunks of about this size
+constexpr std::size_t kCopyChunkSize = 64 * 1024;
+
+constexpr const char* kCopyAbortedMessage = "COPY is aborted by the client";
+
+template <typename T>
+T ReadInteger(std::string_view data, std::size_t offset) {
+    UASSERT(offset + sizeof(T) <= data.size());
+    T value{0};
+    io::ReadBuffer(
+        io::FieldBuffer{
+            false,
+            io::BufferCategory::kPlainBuffer,
+            sizeof(T),
+            reinterpret_cast<const std::uint8_t*>(data.data() + offset)},
+        value
+    );
+    return value;
+}
+
+}  // namespace
+
+struct CopyIn::Impl {
+    detail::Connection* conn;
+    const Query query;
+    detail::StatementStats stats;
+    std::string buffer;
+    std::size_t rows_written{0};
+    bool finished{false};
+
+    Impl(const detail::ConnectionPtr& conn, const Query& query)
+        : conn{conn.get()}, query{query}, stats{this->query, conn} {
+        buffer.reserve(kCopyChunkSize + kCopyChunkSize / 4);
+    }
+
+    void Start(OptionalCommandControl statement_cmd_ctl, engine::Deadline deadline) {
+        try {
+            conn->CopyInStart(query, std::move(statement_cmd_ctl), deadline);
+        } catch (const std::exception&) {
+            finished = true;
+            stats.AccountStatementError();
+            throw;
+        }
+
+        buffer.append(kCopySignature);
+        io::WriteBuffer(conn->GetUserTypes(), buffer, Integer{0});  // flags
+        io::WriteBuffer(conn->GetUserTypes(), buffer, Integer{0});  // header extension length
+    }
+
+    void Send() {
+        if (buffer.empty()) return;
+        try {
+            conn->CopyInPutData(buffer);
+        } catch (const std::exception&) {
+            finished = true;
+            stats.AccountStatementError();
+            throw;
+        }
+        buffer.clear();
+    }
+
+    std::size_t Finish() {
+        UINVARIANT(!finished, "COPY is already finished");
+        io::WriteBuffer(conn->GetUserTypes(), buffer, kCopyTrailer);
+        Send();
+
+        finished = true;
+        try {
+            const auto res = conn->CopyInEnd(nullptr);
+            stats.AccountStatementExecution();
+            return res.RowsAffected();
+        } catch (const std::exception&) {
+            stats.AccountStatementError();
+            throw;
+        }
+    }
+
+    void Abort() noexcept {
+        if (finished) return;
+        finished = true;
+        stats.AccountStatementError();
+        try {
+            conn->CopyInEnd(kCopyAbortedMessage);
+        } catch (const std::exception& e) {
+            // The server always reports the aborted COPY as an error
+            LOG_LIMITED_INFO() << "COPY was not finished: " << e;
+        }
+    }
+};
+
+CopyIn::CopyIn(
+    const detail::ConnectionPtr& conn,
+    const Query& query,
+    OptionalCommandControl statement_cmd_ctl,
+    engine::Deadline deadline
+)
+    : pimpl_(std::make_unique<Impl>(conn, query)) {
+    pimpl_->Start(std::move(statement_cmd_ctl), deadline);
+}
+
+CopyIn::CopyIn(CopyIn&&) noexcept = default;
+
+CopyIn& CopyIn::operator=(CopyIn&& rhs) noexcept {
+    if (this != &rhs) {
+        if (pimpl_) pimpl_->Abort();
+        pimpl_ = std::move(rhs.pimpl_);
+    }
+    return *this;
+}
+
+CopyIn::~CopyIn() {
+    if (pimpl_) pimpl_->Abort();
+}
+
+std::size_t CopyIn::Finish() {
+    UINVARIANT(pimpl_, "COPY was moved out");
+    return pimpl_->Finish();
+}
+
+std::size_t CopyIn::RowsWritten() const {
+    UASSERT(pimpl_);
+    return pimpl_->rows_written;
+}
+
+const UserTypes& CopyIn::GetUserTypes() const {
+    UINVARIANT(pimpl_, "COPY was moved out");
+    UINVARIANT(!pimpl_->finished, "COPY is already finished");
+    return pimpl_->conn->GetUserTypes();
+}
+
+std::string& CopyIn::GetBuffer() { return pimpl_->buffer; }
+
+void CopyIn::RollbackRow(std::size_t row_begin) noexcept { pimpl_->buffer.resize(row_begin); }
+
+void CopyIn::OnRowWritten() {
+    ++pimpl_->rows_written;
+    if (pimpl_->buffer.size() >= kCopyChunkSize) {
+        pimpl_->Send();
+    }
+}
+
+struct CopyOut::Impl {
+    detail::Connection* conn;
+    const Query query;
+    detail::StatementStats stats;
+    // Received and not yet consumed data
+    std::string pending;
+    std::size_t offset{0};
+    std::size_t rows_read{0};
+    bool header_read{false};
+    bool trailer_read{false};
+    bool done{false};
+
+    Impl(const detail::ConnectionPtr& conn, const Query& query)
+        : conn{conn.get()}, query{query}, stats{this->query, conn} {}
+
+    void Start(OptionalCommandControl statement_cmd_ctl, engine::Deadline deadline) {
+        try {
+            conn->CopyOutStart(query, std::move(statement_cmd_ctl), deadline);
+        } catch (const std::exception&) {
+            done = true;
+            stats.AccountStatementError();
+            throw;
+        }
+    }
+
+    std::size_t Available() const { return pending.size() - offset; }
+
+    // Makes at least `size` unconsumed bytes available, returns false if the
+    // data is over
+    bool Ensure(std::size_t size) {
+        while (Available() < size) {
+            if (offset != 0) {
+                pending.erase(0, offset);
+                offset = 0;
+            }
+            if (!GetData()) return false;
+        }
+        return true;
+    }
+
+    bool GetData() {
+        try {
+            if (conn->CopyOutGetData(pending)) return true;
+        } catch (const std::exception&) {
+            done = true;
+            stats.AccountStatementError();
+            throw;
+        }
+        done = true;
+        stats.AccountStatementExecution();
+        return false;
+    }
+
+    void ThrowInvalidData(std::string_view what) {
+        Abort();
+        throw InvalidBinaryBuffer(fmt::format("Invalid COPY data: {}", what));
+    }
+
+    void ReadHeader() {
+        if (!Ensure(kCopyHeaderSize)) ThrowInvalidData("no header");
+        const std::string_view data{pending};
+        if (data.substr(offset, kCopySignature.size()) != kCopySignature) {
+            ThrowInvalidData("wrong signature");
+        }
+        const auto extension_size = ReadInteger<Integer>(data, offset + kCopyHeaderSize - sizeof(Integer));
+        if (extension_size < 0) ThrowInvalidData("negative header extension length");
+        const auto header_size = kCopyHeaderSize + static_cast<std::size_t>(extension_size);
+        if (!Ensure(header_size)) ThrowInvalidData("no header extension");
+        offset += header_size;
+        header_read = true;
+    }
+
+    std::optional<io::FieldBuffer> FetchRow(std::size_t columns_count) {
+        if (done || trailer_read) {
+            DrainTrailing();
+            return std::nullopt;
+        }
+        if (!header_read) ReadHeader();
+
+        if (!Ensure(sizeof(Smallint))) ThrowInvalidData("no trailer");
+        const auto fields = ReadInteger<Smallint>(pending, offset);
+        if (fields == kCopyTrailer) {
+            offset += sizeof(Smallint);
+            trailer_read = true;
+            DrainTrailing();
+            return std::nullopt;
+        }
+        if (fields < 0) ThrowInvalidData("negative field count");
+        if (static_cast<std::size_t>(fields) != columns_count) {
+            throw InvalidInputBufferSize(
+                fmt::format("COPY row has {} columns, {} columns are requested", fields, columns_count)
+            );
+        }
+
+        // Scan the field lengths to make sure the whole row is received
+        std::size_t row_size = sizeof(Smallint);
+        for (Smallint field = 0; field < fields; ++field) {
+            if (!Ensure(row_size + sizeof(Integer))) ThrowInvalidData("incomplete row");
+            const auto field_size = ReadInteger<Integer>(pending, offset + row_size);
+            row_size += sizeof(Integer);
+            if (field_size == io::kPgNullBufferSize) continue;
+            if (field_size < 0) ThrowInvalidData("negative field length");
+            row_size += static_cast<std::size_t>(field_size);
+        }
+        if (!Ensure(row_size)) ThrowInvalidData("incomplete row");
+
+        const auto* row_data = reinterpret_cast<const std::uint8_t*>(pending.data() + offset);
+        offset += row_size;
+        ++rows_read;
+        return io::FieldBuffer{
+            false,
+            io::BufferCategory::kPlainBuffer,
+            row_size - sizeof(Smallint),
+            row_data + sizeof(Smallint)};
+    }
+
+    // Reads the end of the COPY after the trailer
+    void DrainTrailing() {
+        while (!done) {
+            GetData();
+        }
+        pending.clear();
+        offset = 0;
+    }
+
+    void Abort() noexcept {
+        if (done) return;
+        done = true;
+        stats.AccountStatementError();
+        conn->CopyAbort();
+    }
+};
+
+CopyOut::CopyOut(
+    const detail::ConnectionPtr& conn,
+    const Query& query,
+    OptionalCommandControl statement_cmd_ctl,
+    engine::Deadline deadline
+)
+    : pimpl_(std::make_unique<Impl>(conn, query)) {
+    pimpl_->Start(std::move(statement_cmd_ctl), deadline);
+}
+
+CopyOut::CopyOut(CopyOut&&) noexcept = default;
+
+CopyOut& CopyOut::operator=(CopyOut&& rhs) noexcept {
+    if (this != &rhs) {
+        if (pimpl_) pimpl_->Abort();
+        pimpl_ = std::move(rhs.pimpl_);
+    }
+    return *this;
+}
+
+CopyOut::~CopyOut() {
+    if (pimpl_) pimpl_->Abort();
+}
+
+bool CopyOut::IsDone() const { return !pimpl_ || pimpl_->done; }
+
+std::size_t CopyOut::RowsRead() const {
+    UASSERT(pimpl_);
+    return pimpl_->rows_read;
+}
+
+std::optional<io::FieldBuffer> CopyOut::FetchRow(std::size_t columns_count) {
+    UINVARIANT(pimpl_, "COPY was moved out");
+    return pimpl_->FetchRow(columns_count);
+}
+
+const io::TypeBufferCategory& CopyOut::GetTypeBufferCategories() const {
+    return pimpl_->conn->GetUserTypes().GetTypeBufferCategories();
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+struct IdAndValue final {
+    int id{};
+    std::string value;
+};
+
+std::vector<IdAndValue> MakeRows(std::size_t count) {
+    std::vector<IdAndValue> rows;
+    rows.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        rows.push_back({static_cast<int>(i), "value " + std::to_string(i)});
+    }
+    return rows;
+}
+
+void InsertDecompose(pg::Transaction& trx, const std::vector<IdAndValue>& rows) {
+    trx.ExecuteDecompose("insert into copy_bench(id, value) select unnest($1), unnest($2)", rows);
+}
+
+void InsertCopy(pg::Transaction& trx, const std::vector<IdAndValue>& rows) {
+    auto copy = trx.MakeCopyIn("COPY copy_bench(id, value) FROM STDIN (FORMAT binary)");
+    copy.WriteRows(rows);
+    copy.Finish();
+}
+
+template <void (*Insert)(pg::Transaction&, const std::vector<IdAndValue>&)>
+void RunInsert(pg::detail::ConnectionPool& pool, benchmark::State& state) {
+    const auto rows = MakeRows(state.range(0));
+    pool.Start().Execute("drop table if exists copy_bench");
+    pool.Start().Execute("create table copy_bench(id integer, value text)");
+    for (auto _ : state) {
+        auto trx = pool.Begin({});
+        Insert(trx, rows);
+        trx.Rollback();
+    }
+    pool.Start().Execute("drop table copy_bench");
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(PgConnection, InsertDecompose)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] { RunInsert<InsertDecompose>(*MakePool(), state); });
+}
+BENCHMARK_REGISTER_F(PgConnection, InsertDecompose)->RangeMultiplier(10)->Range(100, 100'000);
+
+BENCHMARK_DEFINE_F(PgConnection, InsertCopy)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] { RunInsert<InsertCopy>(*MakePool(), state); });
+}
+BENCHMARK_REGISTER_F(PgConnection, InsertCopy)->RangeMultiplier(10)->Range(100, 100'000);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -330,6 +330,10 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags, OptionalCommandCon
         throw LogicError("Host role must be specified for execution of a single statement");
     }
     LOG_TRACE() << "Requested single statement on " << flags;
+    // A statement that may be executed on a replica is a read-only one
+    if ((flags & kClusterHostRolesMask) != ClusterHostType::kMaster) {
+        return FindPool(flags)->StartReadOnly(cmd_ctl);
+    }
     return FindPool(flags)->Start(cmd_ctl);
 }
 
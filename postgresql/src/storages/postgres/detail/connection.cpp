@@ -140,6 +140,11 @@ std::vector<ResultSet> Connection::GatherPipeline(TimeoutDuration timeout, const
     return pimpl_->GatherPipeline(timeout, descriptions);
 }
 
+std::vector<PipelineResult>
+Connection::GatherPipelineResults(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+    return pimpl_->GatherPipelineResults(timeout, descriptions);
+}
+
 ResultSet Connection::Execute(const Query& query, const ParameterStore& store) {
     return Execute(query, detail::QueryParameters{store.GetInternalData()});
 }
@@ -166,6 +171,30 @@ ResultSet Connection::PortalExecute(
     return pimpl_->PortalExecute(statement_id, portal_name, n_rows, std::move(statement_cmd_ctl));
 }
 
+void Connection::CopyInStart(
+    const Query& query,
+    OptionalCommandControl statement_cmd_ctl,
+    engine::Deadline deadline
+) {
+    pimpl_->CopyInStart(query, std::move(statement_cmd_ctl), deadline);
+}
+
+void Connection::CopyInPutData(std::string_view data) { pimpl_->CopyInPutData(data); }
+
+ResultSet Connection::CopyInEnd(const char* error_message) { return pimpl_->CopyInEnd(error_message); }
+
+void Connection::CopyOutStart(
+    const Query& query,
+    OptionalCommandControl statement_cmd_ctl,
+    engine::Deadline deadline
+) {
+    pimpl_->CopyOutStart(query, std::move(statement_cmd_ctl), deadline);
+}
+
+bool Connection::CopyOutGetData(std::string& buffer) { return pimpl_->CopyOutGetData(buffer); }
+
+void Connection::CopyAbort() { pimpl_->CopyAbort(); }
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) { pimpl_->CancelAndCleanup(timeout); }
 
 bool Connection::Cleanup(TimeoutDuration timeout) { return pimpl_->Cleanup(timeout); }
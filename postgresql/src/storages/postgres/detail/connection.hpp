@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
 #include <string>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -11,6 +12,7 @@
 #include <userver/error_injection/settings.hpp>
 #include <userver/testsuite/postgres_control.hpp>
 #include <userver/tracing/scope_time.hpp>
+#include <userver/utils/expected.hpp>
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/strong_typedef.hpp>
 
@@ -41,6 +43,9 @@ namespace detail {
 
 class ConnectionImpl;
 
+/// Result of a pipelined query or the error of the query
+using PipelineResult = USERVER_NAMESPACE::utils::expected<ResultSet, std::exception_ptr>;
+
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
 /// and closing Postgres connection.
@@ -232,6 +237,11 @@ public:
 
     std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
+    /// Gather the results of the pipeline, an error of a query doesn't affect
+    /// the results of the other queries
+    std::vector<PipelineResult>
+    GatherPipelineResults(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+
     template <typename... T>
     ResultSet Execute(const Query& query, const T&... args) {
         detail::StaticQueryParameters<sizeof...(args)> params;
@@ -258,6 +268,26 @@ public:
     );
     ResultSet PortalExecute(StatementId, const std::string& portal_name, std::uint32_t n_rows, OptionalCommandControl);
 
+    /// @brief Start `COPY ... FROM STDIN (FORMAT binary)`
+    /// @param deadline the deadline of the whole COPY, the network timeout
+    /// applies to each of the network operations
+    void CopyInStart(const Query& query, OptionalCommandControl statement_cmd_ctl, engine::Deadline deadline);
+    /// Send a chunk of COPY data, waits until the data is sent
+    void CopyInPutData(std::string_view data);
+    /// Finish the COPY, the COPY fails if `error_message` is not nullptr
+    ResultSet CopyInEnd(const char* error_message);
+
+    /// @brief Start `COPY ... TO STDOUT (FORMAT binary)`
+    /// @param deadline the deadline of the whole COPY, the network timeout
+    /// applies to each of the network operations
+    void CopyOutStart(const Query& query, OptionalCommandControl statement_cmd_ctl, engine::Deadline deadline);
+    /// Append the next chunk of COPY data to the buffer. Returns false and
+    /// finishes the COPY if there is no more data.
+    bool CopyOutGetData(std::string& buffer);
+    /// Interrupt the COPY that cannot be finished gracefully, the connection
+    /// is closed
+    void CopyAbort();
+
     /// Send cancel to the database backend
     /// Try to return connection to idle state discarding all results.
     /// If there is a transaction in progress - roll it back.
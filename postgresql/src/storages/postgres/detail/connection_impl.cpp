@@ -535,6 +535,137 @@ ResultSet ConnectionImpl::PortalExecute(
     );
 }
 
+void ConnectionImpl::CopyInStart(
+    const Query& query,
+    OptionalCommandControl statement_cmd_ctl,
+    engine::Deadline deadline
+) {
+    CopyStart(query, std::move(statement_cmd_ctl), deadline, PGRES_COPY_IN);
+}
+
+void ConnectionImpl::CopyInPutData(std::string_view data) {
+    UASSERT(copy_state_);
+    try {
+        conn_wrapper_.PutCopyData(data, MakeCopyDeadline());
+    } catch (const std::exception&) {
+        HandleCopyError();
+        throw;
+    }
+}
+
+ResultSet ConnectionImpl::CopyInEnd(const char* error_message) { return FinishCopy(true, error_message); }
+
+void ConnectionImpl::CopyOutStart(
+    const Query& query,
+    OptionalCommandControl statement_cmd_ctl,
+    engine::Deadline deadline
+) {
+    CopyStart(query, std::move(statement_cmd_ctl), deadline, PGRES_COPY_OUT);
+}
+
+bool ConnectionImpl::CopyOutGetData(std::string& buffer) {
+    UASSERT(copy_state_);
+    try {
+        if (conn_wrapper_.GetCopyData(MakeCopyDeadline(), buffer)) return true;
+    } catch (const std::exception&) {
+        HandleCopyError();
+        throw;
+    }
+    FinishCopy(false, nullptr);
+    return false;
+}
+
+void ConnectionImpl::CopyAbort() { HandleCopyError(); }
+
+void ConnectionImpl::CopyStart(
+    const Query& query,
+    OptionalCommandControl statement_cmd_ctl,
+    engine::Deadline deadline,
+    ExecStatusType copy_status
+) {
+    const ScopeGuard guard([this]() { in_transaction_ = IsInTransaction(); });
+    UASSERT_MSG(!copy_state_, "Another COPY is in progress");
+
+    CheckBusy();
+    const auto network_timeout = NetworkTimeout(statement_cmd_ctl);
+    copy_state_.emplace(CopyState{query, network_timeout, deadline, SteadyClock::now(), false});
+    ++stats_.execute_total;
+
+    std::optional<tracing::Span> span;
+    try {
+        const auto current_deadline = MakeCopyDeadline();
+        CheckDeadlineReached(current_deadline);
+        if (IsPipelineActive()) {
+            // COPY is not allowed in pipeline mode, sync the queued commands and
+            // leave the mode until the COPY is finished
+            ExecuteCommandNoPrepare(kPingStatement, current_deadline);
+            conn_wrapper_.ExitPipelineMode();
+            copy_state_->restore_pipeline_mode = true;
+        }
+        SetStatementTimeout(std::move(statement_cmd_ctl));
+
+        span.emplace(MakeQuerySpan(query, {network_timeout, GetStatementTimeout()}));
+        auto scope = span->CreateScopeTime();
+        conn_wrapper_.SendQuery(query.GetStatementView(), scope);
+        conn_wrapper_.WaitCopyStart(current_deadline, scope, copy_status);
+    } catch (const std::exception&) {
+        if (span) span->AddTag(tracing::kErrorFlag, true);
+        HandleCopyError();
+        throw;
+    }
+}
+
+engine::Deadline ConnectionImpl::MakeCopyDeadline() const {
+    UASSERT(copy_state_);
+    return std::min(copy_state_->deadline, testsuite_pg_ctl_.MakeExecuteDeadline(copy_state_->network_timeout));
+}
+
+ResultSet ConnectionImpl::FinishCopy(bool put_copy_end, const char* error_message) {
+    UASSERT(copy_state_);
+    const ScopeGuard guard([this]() { in_transaction_ = IsInTransaction(); });
+
+    tracing::Span span{FindQueryShortInfo(scopes::kCopy, copy_state_->query.GetStatementView())};
+    conn_wrapper_.FillSpanTags(span, {copy_state_->network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+    try {
+        const auto deadline = MakeCopyDeadline();
+        if (put_copy_end) conn_wrapper_.PutCopyEnd(error_message, deadline, scope);
+        auto res = conn_wrapper_.WaitResult(deadline, scope, nullptr);
+        EndCopy(true);
+        return res;
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        HandleCopyError();
+        throw;
+    }
+}
+
+void ConnectionImpl::HandleCopyError() {
+    if (!copy_state_) return;
+    if (GetConnectionState() == ConnectionState::kTranActive) {
+        // The connection is stuck in the middle of COPY, the server is still
+        // waiting for the data or sending it
+        LOG_LIMITED_WARNING() << "COPY was interrupted, the connection is closed";
+        MarkAsBroken();
+    }
+    EndCopy(false);
+}
+
+void ConnectionImpl::EndCopy(bool success) {
+    UASSERT(copy_state_);
+    const auto state = std::move(*copy_state_);
+    copy_state_.reset();
+
+    const auto now = SteadyClock::now();
+    if (!success) ++stats_.error_execute_total;
+    stats_.sum_query_duration += now - state.start_time;
+    stats_.last_execute_finish = now;
+
+    if (state.restore_pipeline_mode && IsConnected() && !IsBroken()) {
+        conn_wrapper_.EnterPipelineMode();
+    }
+}
+
 void ConnectionImpl::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     ExecuteCommandNoPrepare(
         fmt::format(kStatementListen, conn_wrapper_.EscapeIdentifier(channel)),
@@ -961,22 +1092,41 @@ ConnectionImpl::GatherPipeline(TimeoutDuration timeout, const std::vector<Result
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
     CheckDeadlineReached(deadline);
 
-    std::vector<const PGresult*> native_descriptions(descriptions.size(), nullptr);
-    if (IsOmitDescribeInExecuteEnabled()) {
-        for (std::size_t i = 0; i < descriptions.size(); ++i) {
-            native_descriptions[i] = descriptions[i].pimpl_->handle.get();
-        }
+    auto result = conn_wrapper_.GatherPipeline(deadline, GetNativeDescriptions(descriptions));
+
+    for (auto& single_result : result) {
+        FillBufferCategories(single_result);
     }
 
-    auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions);
+    return result;
+}
+
+std::vector<PipelineResult>
+ConnectionImpl::GatherPipelineResults(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
+    CheckDeadlineReached(deadline);
+
+    auto result = conn_wrapper_.GatherPipelineResults(deadline, GetNativeDescriptions(descriptions));
 
     for (auto& single_result : result) {
-        FillBufferCategories(single_result);
+        if (single_result.has_value()) {
+            FillBufferCategories(single_result.value());
+        }
     }
 
     return result;
 }
 
+std::vector<const PGresult*> ConnectionImpl::GetNativeDescriptions(const std::vector<ResultSet>& descriptions) const {
+    std::vector<const PGresult*> native_descriptions(descriptions.size(), nullptr);
+    if (IsOmitDescribeInExecuteEnabled()) {
+        for (std::size_t i = 0; i < descriptions.size(); ++i) {
+            native_descriptions[i] = descriptions[i].pimpl_->handle.get();
+        }
+    }
+    return native_descriptions;
+}
+
 ResultSet ConnectionImpl::ExecuteCommandNoPrepare(const Query& query, engine::Deadline deadline) {
     static const QueryParameters kNoParams;
     return ExecuteCommandNoPrepare(query, kNoParams, deadline);
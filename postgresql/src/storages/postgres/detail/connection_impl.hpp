@@ -92,6 +92,8 @@ public:
         tracing::ScopeTime& scope
     );
     std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+    std::vector<PipelineResult>
+    GatherPipelineResults(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
     void Begin(
         const TransactionOptions& options,
@@ -118,6 +120,14 @@ public:
         OptionalCommandControl statement_cmd_ctl
     );
 
+    void CopyInStart(const Query& query, OptionalCommandControl statement_cmd_ctl, engine::Deadline deadline);
+    void CopyInPutData(std::string_view data);
+    ResultSet CopyInEnd(const char* error_message);
+
+    void CopyOutStart(const Query& query, OptionalCommandControl statement_cmd_ctl, engine::Deadline deadline);
+    bool CopyOutGetData(std::string& buffer);
+    void CopyAbort();
+
     void Listen(std::string_view channel, OptionalCommandControl);
     void Unlisten(std::string_view channel, OptionalCommandControl);
     Notification WaitNotify(engine::Deadline deadline);
@@ -141,6 +151,15 @@ private:
 
     struct ResetTransactionCommandControl;
 
+    struct CopyState {
+        Query query;
+        TimeoutDuration network_timeout;
+        // deadline of the whole COPY
+        engine::Deadline deadline;
+        SteadyClock::time_point start_time;
+        bool restore_pipeline_mode{false};
+    };
+
     void CheckBusy() const;
     void CheckDeadlineReached(const engine::Deadline& deadline);
     tracing::Span MakeQuerySpan(const Query& query, const CommandControl& cc) const;
@@ -201,6 +220,7 @@ private:
 
     void LoadUserTypes(engine::Deadline deadline);
     void FillBufferCategories(ResultSet& res);
+    std::vector<const PGresult*> GetNativeDescriptions(const std::vector<ResultSet>& descriptions) const;
 
     template <typename Counter>
     ResultSet WaitResult(
@@ -213,6 +233,17 @@ private:
         const ResultSet* description_ptr
     );
 
+    void CopyStart(
+        const Query& query,
+        OptionalCommandControl statement_cmd_ctl,
+        engine::Deadline deadline,
+        ExecStatusType copy_status
+    );
+    engine::Deadline MakeCopyDeadline() const;
+    ResultSet FinishCopy(bool put_copy_end, const char* error_message);
+    void HandleCopyError();
+    void EndCopy(bool success);
+
     void Cancel();
 
     void ReportStatement(std::string_view name);
@@ -241,6 +272,7 @@ private:
 
     USERVER_NAMESPACE::utils::impl::TransparentSet<std::string> statements_reported_;
     engine::Mutex statements_mutex_;
+    std::optional<CopyState> copy_state_;
     // Flag to check a correct order of calling Begin.
     bool in_transaction_{false};
 };
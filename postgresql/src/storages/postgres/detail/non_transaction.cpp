@@ -2,6 +2,7 @@
 #include <userver/testsuite/testpoint.hpp>
 
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/query_batch.hpp>
 #include <storages/postgres/detail/statement_stats.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,8 +14,18 @@ NonTransaction::NonTransaction(ConnectionPtr&& conn, detail::SteadyClock::time_p
     conn_->Start(start_time);
 }
 
+NonTransaction::NonTransaction(std::shared_ptr<QueryBatch>&& batch)
+    : conn_{std::unique_ptr<Connection>{}}, batch_{std::move(batch)} {}
+
 NonTransaction::NonTransaction(NonTransaction&&) noexcept = default;
-NonTransaction::~NonTransaction() { conn_->Finish(); }
+
+NonTransaction::~NonTransaction() {
+    if (conn_) {
+        conn_->Finish();
+    } else if (batch_) {
+        batch_->Leave();
+    }
+}
 
 NonTransaction& NonTransaction::operator=(NonTransaction&&) noexcept = default;
 
@@ -54,9 +65,10 @@ ResultSet NonTransaction::DoExecute(
         );
     }
 
-    StatementStats stats{query, conn_};
+    StatementStats stats{query, GetConnection()};
     try {
-        auto res = conn_->Execute(query, params, statement_cmd_ctl);
+        auto res = batch_ ? batch_->Execute(query, params, statement_cmd_ctl)
+                          : conn_->Execute(query, params, statement_cmd_ctl);
         stats.AccountStatementExecution();
         return res;
     } catch (const std::exception& e) {
@@ -65,7 +77,9 @@ ResultSet NonTransaction::DoExecute(
     }
 }
 
-const UserTypes& NonTransaction::GetConnectionUserTypes() const { return conn_->GetUserTypes(); }
+const UserTypes& NonTransaction::GetConnectionUserTypes() const { return GetConnection()->GetUserTypes(); }
+
+const detail::ConnectionPtr& NonTransaction::GetConnection() const { return batch_ ? batch_->GetConnection() : conn_; }
 
 }  // namespace storages::postgres::detail
 
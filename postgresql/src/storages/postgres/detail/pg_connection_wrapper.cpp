@@ -483,6 +483,19 @@ void PGConnectionWrapper::Flush(Deadline deadline) {
     }
 }
 
+void PGConnectionWrapper::WaitAndConsumeInput(Deadline deadline) {
+    HandleSocketPostClose();
+    if (!WaitSocketReadable(deadline)) {
+        if (engine::current_task::ShouldCancel()) {
+            throw ConnectionInterrupted("Task cancelled while consuming input");
+        }
+        PGCW_LOG_LIMITED_WARNING() << "Timeout while consuming input from PostgreSQL connection";
+        throw ConnectionTimeoutError("Timeout while consuming input from PostgreSQL connection");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    UpdateLastUse();
+}
+
 void PGConnectionWrapper::HandlePipelineSync() {
     if (!pipeline_sync_counter_) {
         MarkAsBroken();
@@ -560,6 +573,80 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline, tracing::ScopeTime&
     return MakeResult(std::move(handle));
 }
 
+void PGConnectionWrapper::WaitCopyStart(Deadline deadline, tracing::ScopeTime& scope, ExecStatusType copy_status) {
+    scope.Reset(scopes::kLibpqWaitResult);
+    Flush(deadline);
+    auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+    const auto status = handle ? PQresultStatus(handle.get()) : PGRES_EMPTY_QUERY;
+    if (status == PGRES_COPY_IN || status == PGRES_COPY_OUT || status == PGRES_COPY_BOTH) {
+        // There is no way to leave COPY quietly, the connection is closed
+        if (status != copy_status) {
+            PGCW_LOG_LIMITED_ERROR() << "COPY of unexpected direction was started";
+            CloseWithError(LogicError{"COPY FROM STDIN and COPY TO STDOUT are mixed up"});
+        }
+        if (!PQbinaryTuples(handle.get())) {
+            PGCW_LOG_LIMITED_ERROR() << "COPY in text format was started";
+            CloseWithError(LogicError{"COPY must use the binary format, add `(FORMAT binary)` to the statement"});
+        }
+        return;
+    }
+
+    // Not a COPY statement, read the rest of the results and throw the error
+    while (auto* pg_res = ReadResult(deadline, nullptr)) {
+        handle = MakeResultHandle(pg_res);
+    }
+    MakeResult(std::move(handle));
+    throw LogicError{"The statement is not a COPY FROM STDIN or COPY TO STDOUT"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data, Deadline deadline) {
+    for (;;) {
+        const int put_res = PQputCopyData(conn_, data.data(), static_cast<int>(data.size()));
+        if (put_res > 0) break;
+        if (put_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(fmt::format("PQputCopyData execution error: {}", PQerrorMessage(conn_)));
+        }
+        // libpq buffer is full
+        Flush(deadline);
+    }
+    // Sending the data right away applies the backpressure of the server to
+    // the producer and keeps libpq buffer small
+    Flush(deadline);
+}
+
+void PGConnectionWrapper::PutCopyEnd(const char* error_message, Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqPutCopyEnd);
+    for (;;) {
+        const int put_res = PQputCopyEnd(conn_, error_message);
+        if (put_res > 0) break;
+        if (put_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(fmt::format("PQputCopyEnd execution error: {}", PQerrorMessage(conn_)));
+        }
+        Flush(deadline);
+    }
+    UpdateLastUse();
+}
+
+bool PGConnectionWrapper::GetCopyData(Deadline deadline, std::string& buffer) {
+    for (;;) {
+        char* data = nullptr;
+        const int get_res = PQgetCopyData(conn_, &data, 1);
+        if (get_res > 0) {
+            const std::unique_ptr<char, decltype(&PQfreemem)> data_guard{data, &PQfreemem};
+            buffer.append(data, get_res);
+            return true;
+        }
+        if (get_res == -1) return false;
+        if (get_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(fmt::format("PQgetCopyData execution error: {}", PQerrorMessage(conn_)));
+        }
+        WaitAndConsumeInput(deadline);
+    }
+}
+
 Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
     auto notify = std::unique_ptr<PGnotify, decltype(&PQfreemem)>(PQnotifies(conn_), &PQfreemem);
     while (!notify) {
@@ -578,8 +665,38 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
 }
 
 std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
-    [[maybe_unused]] Deadline deadline,
+    Deadline deadline,
+    const std::vector<const PGresult*>& descriptions
+) {
+    std::vector<ResultSet> result{};
+    DoGatherPipeline(deadline, descriptions, [this, &result](ResultHandle&& handle) {
+        result.push_back(MakeResult(std::move(handle)));
+    });
+    return result;
+}
+
+std::vector<PipelineResult> PGConnectionWrapper::GatherPipelineResults(
+    Deadline deadline,
     const std::vector<const PGresult*>& descriptions
+) {
+    std::vector<PipelineResult> result{};
+    DoGatherPipeline(deadline, descriptions, [this, &result](ResultHandle&& handle) {
+        // Every query is followed by its own sync point, so an error of a
+        // query does not abort the following ones
+        try {
+            result.emplace_back(MakeResult(std::move(handle)));
+        } catch (const std::exception&) {
+            result.emplace_back(USERVER_NAMESPACE::utils::unexpected<std::exception_ptr>{std::current_exception()});
+        }
+    });
+    return result;
+}
+
+template <typename ResultConsumer>
+void PGConnectionWrapper::DoGatherPipeline(
+    [[maybe_unused]] Deadline deadline,
+    const std::vector<const PGresult*>& descriptions,
+    [[maybe_unused]] ResultConsumer&& consume_result
 ) {
     UASSERT(!descriptions.empty());
 
@@ -588,7 +705,7 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
 #else
     Flush(deadline);
 
-    std::vector<ResultSet> result{};
+    std::size_t results_count{0};
     const PGresult* current_description = descriptions.front();
 
     std::size_t null_res_counter{0};
@@ -623,7 +740,8 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
                 return first_field_name != nullptr && std::string_view{first_field_name} == kSetConfigQueryResultName;
             }();
             if (!is_set_config_response) {
-                result.push_back(MakeResult(std::move(handle)));
+                consume_result(std::move(handle));
+                ++results_count;
             }
         }
 
@@ -633,10 +751,8 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
         // We do it this way instead of 1:1 matching because we need to feed
         // something into the last ReadResult call, which is expected to just return
         // null right away. And if it doesn't -- we get an error, as we should.
-        current_description = result.size() < descriptions.size() ? descriptions[result.size()] : nullptr;
+        current_description = results_count < descriptions.size() ? descriptions[results_count] : nullptr;
     }
-
-    return result;
 #endif
 }
 
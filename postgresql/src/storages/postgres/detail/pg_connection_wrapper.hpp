@@ -115,11 +115,32 @@ public:
     /// Will return result or throw an exception
     ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&, const PGresult* description);
 
+    /// @brief Wait for the server to start the COPY of `copy_status` direction
+    /// in binary format. Will throw an exception if the statement is not
+    /// a suitable COPY.
+    void WaitCopyStart(Deadline deadline, tracing::ScopeTime&, ExecStatusType copy_status);
+
+    /// @brief Wrapper for PQputCopyData, waits until the data is sent
+    void PutCopyData(std::string_view data, Deadline deadline);
+
+    /// @brief Wrapper for PQputCopyEnd, the result is read via WaitResult
+    void PutCopyEnd(const char* error_message, Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Wrapper for PQgetCopyData, appends the received data to `buffer`
+    /// @returns false if there is no more data, the result of COPY is read via
+    /// WaitResult
+    bool GetCopyData(Deadline deadline, std::string& buffer);
+
     /// @brief Wait for notification
     Notification WaitNotify(Deadline deadline);
 
     std::vector<ResultSet> GatherPipeline(Deadline deadline, const std::vector<const PGresult*>& descriptions);
 
+    /// @brief Same as GatherPipeline, but an error of a query is returned in
+    /// its result instead of being thrown
+    std::vector<PipelineResult>
+    GatherPipelineResults(Deadline deadline, const std::vector<const PGresult*>& descriptions);
+
     /// Consume input from connection
     void ConsumeInput(Deadline deadline, const PGresult* description);
 
@@ -170,10 +191,20 @@ private:
 
     void Flush(Deadline deadline);
 
+    /// Waits for the socket to become readable and consumes the input
+    void WaitAndConsumeInput(Deadline deadline);
+
     PGresult* ReadResult(Deadline deadline, const PGresult* description);
 
     ResultSet MakeResult(ResultHandle&& handle);
 
+    template <typename ResultConsumer>
+    void DoGatherPipeline(
+        Deadline deadline,
+        const std::vector<const PGresult*>& descriptions,
+        ResultConsumer&& consume_result
+    );
+
     template <typename ExceptionType>
     void CheckError(USERVER_NAMESPACE::utils::zstring_view cmd, int pg_dispatch_result);
 
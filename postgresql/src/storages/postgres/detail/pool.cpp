@@ -1,6 +1,7 @@
 #include <storages/postgres/detail/pool.hpp>
 
 #include <storages/postgres/deadline.hpp>
+#include <storages/postgres/detail/query_batch.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 
 #include <userver/dynamic_config/value.hpp>
@@ -343,6 +344,15 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
     return NonTransaction{std::move(conn), start_time};
 }
 
+NonTransaction ConnectionPool::StartReadOnly(OptionalCommandControl cmd_ctl) {
+    const auto settings = settings_.ReadCopy();
+    if (!settings.query_batching_enabled) return Start(cmd_ctl);
+
+    const auto start_time = detail::SteadyClock::now();
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
+    return NonTransaction{JoinQueryBatch(settings, deadline, start_time)};
+}
+
 NotifyScope ConnectionPool::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
     auto conn = Acquire(deadline);
@@ -716,6 +726,36 @@ void ConnectionPool::StopConnectTasks() {
     connect_task_storage_.CancelAndWait();
 }
 
+std::shared_ptr<QueryBatch> ConnectionPool::JoinQueryBatch(
+    const PoolSettings& settings,
+    engine::Deadline deadline,
+    SteadyClock::time_point start_time
+) {
+    // The lock is held while a connection for a new batch is acquired, so
+    // that the concurrent statements join the new batch instead of acquiring
+    // connections of their own
+    if (!query_batch_mutex_.try_lock_until(deadline)) {
+        ++stats_.connection.error_timeout;
+        throw PoolError("Deadline reached or task cancelled while waiting for a batch of statements");
+    }
+    const std::unique_lock lock{query_batch_mutex_, std::adopt_lock};
+
+    auto batch = query_batch_.lock();
+    if (batch && batch->TryJoin()) return batch;
+
+    batch = std::make_shared<QueryBatch>(
+        Acquire(deadline),
+        settings.query_batching_max_size,
+        engine::Deadline::FromDuration(settings.query_batching_window),
+        start_time,
+        stats_
+    );
+    [[maybe_unused]] const auto joined = batch->TryJoin();
+    UASSERT(joined);
+    query_batch_ = batch;
+    return batch;
+}
+
 void ConnectionPool::CheckUserTypes() {
     try {
         auto conn = Acquire(engine::Deadline::FromDuration(kConnectingTimeout));
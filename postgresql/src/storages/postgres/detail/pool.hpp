@@ -9,6 +9,7 @@
 #include <userver/concurrent/queue.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/semaphore.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
@@ -86,6 +87,10 @@ public:
 
     [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+    /// Starts a single read-only statement, which is batched with concurrent
+    /// statements if the query batching is enabled
+    [[nodiscard]] NonTransaction StartReadOnly(OptionalCommandControl cmd_ctl = {});
+
     NotifyScope Listen(std::string_view channel, OptionalCommandControl cmd_ctl = {});
 
     CommandControl GetDefaultCommandControl() const;
@@ -138,6 +143,12 @@ private:
 
     void CheckUserTypes();
 
+    std::shared_ptr<QueryBatch> JoinQueryBatch(
+        const PoolSettings& settings,
+        engine::Deadline deadline,
+        SteadyClock::time_point start_time
+    );
+
     using RecentCounter = USERVER_NAMESPACE::utils::statistics::
         RecentPeriod<USERVER_NAMESPACE::utils::statistics::RelaxedCounter<size_t>, size_t>;
 
@@ -173,6 +184,10 @@ private:
     cc::Limiter cc_limiter_;
     congestion_control::v2::LinearController cc_controller_;
     std::atomic<std::size_t> cc_max_connections_{0};
+
+    // Batch of single statements that is open for joining
+    engine::Mutex query_batch_mutex_;
+    std::weak_ptr<QueryBatch> query_batch_;
 };
 
 }  // namespace storages::postgres::detail
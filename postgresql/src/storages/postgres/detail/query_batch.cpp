@@ -0,0 +1,240 @@
+#include <storages/postgres/detail/query_batch.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+bool ArePreparedStatementsDisabled(const CommandControl& cmd_ctl) {
+    return cmd_ctl.prepared_statements_enabled == CommandControl::PreparedStatementsOptionOverride::kDisabled;
+}
+
+}  // namespace
+
+struct QueryBatch::Entry final {
+    // Owned by the participant, which waits for the results
+    const Query& query;
+    const QueryParameters& params;
+    const CommandControl cmd_ctl;
+
+    std::optional<ResultSet> result{};
+    std::exception_ptr error{};
+    // The entry is being sent and must stay alive until it is done
+    bool taken{false};
+    bool done{false};
+};
+
+QueryBatch::QueryBatch(
+    ConnectionPtr&& conn,
+    std::size_t max_size,
+    engine::Deadline window_end,
+    SteadyClock::time_point start_time,
+    InstanceStatistics& stats
+)
+    : conn_{std::move(conn)},
+      // Statements prepared for a round must not evict each other from the
+      // prepared statements cache
+      max_size_{std::max<std::size_t>(std::min(max_size, conn_->GetSettings().max_prepared_cache_size), 1)},
+      window_end_{window_end},
+      stats_{stats} {
+    conn_->Start(start_time);
+}
+
+QueryBatch::~QueryBatch() {
+    UASSERT(!sending_);
+    UASSERT(entries_.empty());
+    conn_->Finish();
+}
+
+bool QueryBatch::TryJoin() {
+    const std::lock_guard lock{mutex_};
+    if (closed_ || joined_ >= max_size_ || window_end_.IsReached()) return false;
+    ++joined_;
+    return true;
+}
+
+void QueryBatch::Leave() {
+    {
+        const std::lock_guard lock{mutex_};
+        ++left_;
+    }
+    cv_.NotifyAll();
+}
+
+ResultSet QueryBatch::Execute(
+    const Query& query,
+    const QueryParameters& params,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    if (!statement_cmd_ctl) statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetOptionalNameView());
+    Entry entry{query, params, statement_cmd_ctl.value_or(conn_->GetDefaultCommandControl())};
+
+    std::unique_lock lock{mutex_};
+    entries_.push_back(&entry);
+    ++enqueued_;
+    cv_.NotifyAll();
+    return Wait(lock, entry);
+}
+
+ResultSet QueryBatch::Wait(std::unique_lock<engine::Mutex>& lock, Entry& entry) {
+    const auto deadline = engine::Deadline::FromDuration(
+        std::max(window_end_.TimeLeft(), engine::Deadline::Duration::zero()) + entry.cmd_ctl.network_timeout_ms
+    );
+
+    while (!entry.done) {
+        if (!sending_ && !entry.taken) {
+            SendRound(lock);
+            continue;
+        }
+
+        if (entry.taken) {
+            // The sender uses the data of the entry until the round is done
+            const engine::TaskCancellationBlocker block_cancel;
+            [[maybe_unused]] const auto done = cv_.Wait(lock, [&entry] { return entry.done; });
+            break;
+        }
+
+        if (!cv_.WaitUntil(lock, deadline, [this, &entry] { return entry.done || entry.taken || !sending_; })) {
+            entries_.erase(std::find(entries_.begin(), entries_.end(), &entry));
+            if (engine::current_task::ShouldCancel()) {
+                throw ConnectionInterrupted("Task was cancelled while waiting for a batch of statements to be sent");
+            }
+            throw ConnectionTimeoutError("Timed out while waiting for a batch of statements to be sent");
+        }
+    }
+
+    if (entry.error) std::rethrow_exception(entry.error);
+    UASSERT(entry.result);
+    return std::move(*entry.result);
+}
+
+void QueryBatch::SendRound(std::unique_lock<engine::Mutex>& lock) {
+    // Other participants wait for their results, so the round is sent even if
+    // the sender is cancelled
+    const engine::TaskCancellationBlocker block_cancel;
+    sending_ = true;
+
+    if (!closed_) {
+        // The batch stays joinable until the window is over, unless it is
+        // full and all of its participants have arrived. Participants that
+        // have left count as arrived, a participant that has executed its
+        // statement can't leave before the first round is sent.
+        [[maybe_unused]] const auto all_arrived = cv_.WaitUntil(lock, window_end_, [this] {
+            return joined_ >= max_size_ && enqueued_ + left_ >= joined_;
+        });
+        closed_ = true;
+    }
+
+    auto entries = std::exchange(entries_, {});
+    for (auto* entry : entries) entry->taken = true;
+    ++stats_.transaction.batch_round_total;
+    stats_.transaction.batched_statement_total += entries.size();
+
+    lock.unlock();
+    Send(entries);
+    lock.lock();
+
+    for (auto* entry : entries) entry->done = true;
+    sending_ = false;
+    cv_.NotifyAll();
+}
+
+void QueryBatch::Send(const std::vector<Entry*>& entries) {
+    try {
+        const bool can_pipeline = conn_->IsPipelineActive() && conn_->ArePreparedStatementsEnabled();
+        std::vector<Entry*> pipelined;
+        std::vector<Entry*> sequential;
+        for (auto* entry : entries) {
+            if (can_pipeline && !ArePreparedStatementsDisabled(entry->cmd_ctl)) {
+                pipelined.push_back(entry);
+            } else {
+                sequential.push_back(entry);
+            }
+        }
+
+        if (!pipelined.empty()) SendPipelined(pipelined);
+        SendSequentially(sequential);
+    } catch (const std::exception&) {
+        const auto error = std::current_exception();
+        for (auto* entry : entries) {
+            if (!entry->result && !entry->error) entry->error = error;
+        }
+    }
+}
+
+void QueryBatch::SendPipelined(const std::vector<Entry*>& entries) {
+    tracing::Span span{"pg_query_batch"};
+    span.AddTag("batch_size", entries.size());
+    auto scope = span.CreateScopeTime();
+
+    std::vector<Entry*> prepared;
+    std::vector<std::string> statement_names;
+    std::vector<ResultSet> descriptions;
+    prepared.reserve(entries.size());
+    statement_names.reserve(entries.size());
+    descriptions.reserve(entries.size());
+
+    TimeoutDuration timeout{0};
+    for (auto* entry : entries) {
+        try {
+            auto meta = conn_->PrepareStatement(entry->query, entry->params, entry->cmd_ctl.network_timeout_ms);
+            statement_names.push_back(std::move(meta.statement_name));
+            descriptions.push_back(std::move(meta.description));
+            prepared.push_back(entry);
+            timeout = std::max(timeout, entry->cmd_ctl.network_timeout_ms);
+        } catch (const std::exception&) {
+            // A broken connection fails the whole round
+            if (conn_->IsBroken()) throw;
+            entry->error = std::current_exception();
+        }
+    }
+    if (prepared.empty()) return;
+
+    for (std::size_t i = 0; i < prepared.size(); ++i) {
+        conn_->AddIntoPipeline(prepared[i]->cmd_ctl, statement_names[i], prepared[i]->params, descriptions[i], scope);
+    }
+
+    auto results = conn_->GatherPipelineResults(timeout, descriptions);
+    if (results.size() != prepared.size()) {
+        throw RuntimeError{fmt::format(
+            "Batch of statements results count mismatch: expected {}, got {}", prepared.size(), results.size()
+        )};
+    }
+    for (std::size_t i = 0; i < prepared.size(); ++i) {
+        if (results[i].has_value()) {
+            prepared[i]->result.emplace(std::move(results[i].value()));
+        } else {
+            prepared[i]->error = results[i].error();
+        }
+    }
+}
+
+void QueryBatch::SendSequentially(const std::vector<Entry*>& entries) {
+    for (auto* entry : entries) {
+        try {
+            entry->result.emplace(conn_->Execute(entry->query, entry->params, OptionalCommandControl{entry->cmd_ctl}));
+        } catch (const std::exception&) {
+            if (conn_->IsBroken()) throw;
+            entry->error = std::current_exception();
+        }
+    }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
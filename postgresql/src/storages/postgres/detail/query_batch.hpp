@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/detail/time_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// @brief Single statements of concurrent NonTransactions that share a
+/// connection.
+///
+/// Participants join the batch while it is open. The first participant that
+/// executes its statement becomes the sender: it waits for the other
+/// participants until the batching window is over or the batch is full, then
+/// sends all the statements in a single pipeline and distributes the results.
+/// Statements that come after the send has started are sent in the following
+/// rounds on the same connection.
+///
+/// An error of a statement is reported only to the participant that executed
+/// it, unless the connection is broken.
+class QueryBatch final {
+public:
+    QueryBatch(
+        ConnectionPtr&& conn,
+        std::size_t max_size,
+        engine::Deadline window_end,
+        SteadyClock::time_point start_time,
+        InstanceStatistics& stats
+    );
+    ~QueryBatch();
+
+    QueryBatch(const QueryBatch&) = delete;
+    QueryBatch& operator=(const QueryBatch&) = delete;
+
+    /// Reserves a place in the batch for a participant, returns false if the
+    /// batch is full, its window is over or the first round is already sent
+    bool TryJoin();
+
+    /// Must be called by each joined participant when it no longer needs the
+    /// batch, whether it has executed a statement or not
+    void Leave();
+
+    /// Executes a statement of a joined participant, suspends the coroutine
+    /// until the results are received. May be called once per participant.
+    ResultSet Execute(const Query& query, const QueryParameters& params, OptionalCommandControl statement_cmd_ctl);
+
+    const ConnectionPtr& GetConnection() const { return conn_; }
+
+private:
+    struct Entry;
+
+    ResultSet Wait(std::unique_lock<engine::Mutex>& lock, Entry& entry);
+    void SendRound(std::unique_lock<engine::Mutex>& lock);
+    void Send(const std::vector<Entry*>& entries);
+    void SendPipelined(const std::vector<Entry*>& entries);
+    void SendSequentially(const std::vector<Entry*>& entries);
+
+    ConnectionPtr conn_;
+    const std::size_t max_size_;
+    const engine::Deadline window_end_;
+    // Owned by the pool, which outlives the connection of the batch
+    InstanceStatistics& stats_;
+
+    engine::Mutex mutex_;
+    engine::ConditionVariable cv_;
+    std::vector<Entry*> entries_;
+    std::size_t joined_{0};
+    std::size_t enqueued_{0};
+    std::size_t left_{0};
+    bool closed_{false};
+    bool sending_{false};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
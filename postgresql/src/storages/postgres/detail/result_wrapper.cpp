@@ -268,6 +268,26 @@ io::FieldBuffer ResultWrapper::GetFieldBuffer(std::size_t row, std::size_t col)
         reinterpret_cast<const std::uint8_t*>(PQgetvalue(handle.get(), row, col))};
 }
 
+void ResultWrapper::GetColumnBuffers(std::size_t col, std::vector<io::FieldBuffer>& buffers) const {
+    if (PQfformat(handle.get(), col) != io::kPgBinaryDataFormat) {
+        throw ResultSetError{
+            fmt::format("Column with index {} has text format\n", col) +
+            logging::stacktrace_cache::to_string(boost::stacktrace::stacktrace{})};
+    }
+    const auto category = GetFieldBufferCategory(col);
+    const auto n_rows = RowCount();
+
+    buffers.clear();
+    buffers.reserve(n_rows);
+    for (std::size_t row = 0; row < n_rows; ++row) {
+        buffers.push_back(io::FieldBuffer{
+            IsFieldNull(row, col),
+            category,
+            GetFieldLength(row, col),
+            reinterpret_cast<const std::uint8_t*>(PQgetvalue(handle.get(), row, col))});
+    }
+}
+
 std::string ResultWrapper::GetErrorMessage() const {
     const char* msg = PQresultErrorMessage(handle.get());
     return {msg ? msg : "no error message"};
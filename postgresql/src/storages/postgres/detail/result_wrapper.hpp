@@ -4,6 +4,7 @@
 #include <memory>
 #include <optional>
 #include <string_view>
+#include <vector>
 
 #include <userver/storages/postgres/postgres_fwd.hpp>
 
@@ -47,6 +48,9 @@ public:
     bool IsFieldNull(std::size_t row, std::size_t col) const;
     std::size_t GetFieldLength(std::size_t row, std::size_t col) const;
     io::FieldBuffer GetFieldBuffer(std::size_t row, std::size_t col) const;
+    /// Replaces the contents of `buffers` with the buffers of the column in
+    /// all the rows
+    void GetColumnBuffers(std::size_t col, std::vector<io::FieldBuffer>& buffers) const;
     //@}
 
     //@{
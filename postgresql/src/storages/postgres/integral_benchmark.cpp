@@ -1,6 +1,10 @@
 #include <benchmark/benchmark.h>
 
 #include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <storages/postgres/detail/connection.hpp>
 
@@ -53,6 +57,63 @@ BENCHMARK_F(PgConnection, Int64Roundtrip)(benchmark::State& state) {
     });
 }
 
+struct WideRow {
+    int id;
+    std::int64_t amount;
+    std::string name;
+    std::optional<std::string> note;
+    double ratio;
+};
+
+struct WideRowView {
+    int id;
+    std::int64_t amount;
+    std::string_view name;
+    std::optional<std::string_view> note;
+    double ratio;
+};
+
+// Row by row extraction via the typed result set
+BENCHMARK_DEFINE_F(PgConnection, WideResultByRows)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = FetchWideResult(state.range(0));
+        for (auto _ : state) {
+            std::vector<WideRow> rows;
+            rows.reserve(res.Size());
+            for (auto row : res.AsSetOf<WideRow>(pg::kRowTag)) {
+                rows.push_back(std::move(row));
+            }
+            benchmark::DoNotOptimize(rows);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, WideResultByRows)->RangeMultiplier(10)->Range(100, 100'000);
+
+BENCHMARK_DEFINE_F(PgConnection, WideResultByColumns)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = FetchWideResult(state.range(0));
+        for (auto _ : state) {
+            auto rows = res.AsContainer<std::vector<WideRow>>(pg::kRowTag);
+            benchmark::DoNotOptimize(rows);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, WideResultByColumns)->RangeMultiplier(10)->Range(100, 100'000);
+
+BENCHMARK_DEFINE_F(PgConnection, WideResultViewsByColumns)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = FetchWideResult(state.range(0));
+        for (auto _ : state) {
+            auto rows = res.AsContainer<std::vector<WideRowView>>(pg::kRowTag);
+            benchmark::DoNotOptimize(rows);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, WideResultViewsByColumns)->RangeMultiplier(10)->Range(100, 100'000);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -169,7 +169,18 @@ PoolSettingsDynamic Parse(const formats::json::Value& config, formats::parse::To
 }
 
 PoolSettings Parse(const yaml_config::YamlConfig& config, formats::parse::To<PoolSettings>) {
-    return ParsePoolSettings<PoolSettings>(config);
+    auto result = ParsePoolSettings<PoolSettings>(config);
+    result.query_batching_enabled = config["query_batching_enabled"].As<bool>(result.query_batching_enabled);
+    result.query_batching_window = std::chrono::microseconds{
+        config["query_batching_window_us"].As<std::int64_t>(result.query_batching_window.count())};
+    result.query_batching_max_size = config["query_batching_max_size"].As<std::size_t>(result.query_batching_max_size);
+
+    if (result.query_batching_window.count() <= 0) {
+        throw InvalidConfig{"query_batching_window_us must be greater than 0"};
+    }
+    if (result.query_batching_max_size == 0) throw InvalidConfig{"query_batching_max_size must be greater than 0"};
+
+    return result;
 }
 
 TopologySettings Parse(const formats::json::Value& config, formats::parse::To<TopologySettings>) {
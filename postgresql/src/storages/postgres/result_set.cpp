@@ -40,6 +40,10 @@ void ResultSet::FillBufferCategories(const UserTypes& types) { pimpl_->FillBuffe
 
 void ResultSet::SetBufferCategoriesFrom(const ResultSet& dsc) { pimpl_->SetTypeBufferCategories(*dsc.pimpl_); }
 
+void ResultSet::GetColumnBuffers(size_type column, std::vector<io::FieldBuffer>& buffers) const {
+    pimpl_->GetColumnBuffers(column, buffers);
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -34,6 +34,8 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
         query["portals-bound"] = stats.transaction.portal_bind_total;
         query["executed"] = stats.transaction.execute_total;
         query["replies"] = stats.transaction.reply_total;
+        query["batch-rounds"] = stats.transaction.batch_round_total;
+        query["batched"] = stats.transaction.batched_statement_total;
     }
 
     if (auto errors = writer["errors"]) {
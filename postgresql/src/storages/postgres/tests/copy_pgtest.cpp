@@ -0,0 +1,216 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+/// [CopySample]
+struct IdAndValue final {
+    int id{};
+    std::string value;
+};
+
+std::size_t LoadRows(pg::Transaction& trx, const std::vector<IdAndValue>& rows) {
+    auto copy = trx.MakeCopyIn("COPY copy_test(id, value) FROM STDIN (FORMAT binary)");
+    copy.WriteRows(rows);
+    return copy.Finish();
+}
+
+std::vector<IdAndValue> UnloadRows(pg::Transaction& trx) {
+    std::vector<IdAndValue> result;
+    auto copy = trx.MakeCopyOut("COPY (SELECT id, value FROM copy_test ORDER BY id) TO STDOUT (FORMAT binary)");
+    IdAndValue row;
+    while (copy.ReadRow(row, pg::kRowTag)) {
+        result.push_back(std::move(row));
+    }
+    return result;
+}
+/// [CopySample]
+
+void CreateTable(pg::detail::ConnectionPtr& conn) {
+    conn->Execute("create temporary table copy_test(id integer, value text)");
+}
+
+std::vector<IdAndValue> MakeRows(std::size_t count) {
+    std::vector<IdAndValue> rows;
+    rows.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        rows.push_back({static_cast<int>(i), "value " + std::to_string(i)});
+    }
+    return rows;
+}
+
+void ExpectSameRows(const std::vector<IdAndValue>& expected, const std::vector<IdAndValue>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i].id, actual[i].id);
+        EXPECT_EQ(expected[i].value, actual[i].value);
+    }
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyRoundtrip) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    // Large enough to be sent in several chunks
+    const auto rows = MakeRows(50'000);
+    EXPECT_EQ(LoadRows(trx, rows), rows.size());
+    EXPECT_EQ(trx.Execute("select count(*) from copy_test").AsSingleRow<pg::Bigint>(), rows.size());
+
+    ExpectSameRows(rows, UnloadRows(trx));
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyColumns) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    {
+        auto copy = trx.MakeCopyIn("COPY copy_test(id, value) FROM STDIN (FORMAT binary)");
+        copy.WriteRow(1, std::string{"one"});
+        copy.WriteRow(2, std::optional<std::string>{});
+        copy.WriteRow(3, std::string{});
+        EXPECT_EQ(copy.RowsWritten(), 3);
+        EXPECT_EQ(copy.Finish(), 3);
+    }
+
+    auto copy = trx.MakeCopyOut("COPY (SELECT id, value FROM copy_test ORDER BY id) TO STDOUT (FORMAT binary)");
+    int id{};
+    std::optional<std::string> value;
+
+    ASSERT_TRUE(copy.ReadRow(id, value));
+    EXPECT_EQ(id, 1);
+    EXPECT_EQ(value, "one");
+
+    ASSERT_TRUE(copy.ReadRow(id, value));
+    EXPECT_EQ(id, 2);
+    EXPECT_FALSE(value);
+
+    ASSERT_TRUE(copy.ReadRow(id, value));
+    EXPECT_EQ(id, 3);
+    EXPECT_EQ(value, "");
+
+    EXPECT_FALSE(copy.IsDone());
+    EXPECT_FALSE(copy.ReadRow(id, value));
+    EXPECT_TRUE(copy.IsDone());
+    EXPECT_EQ(copy.RowsRead(), 3);
+    EXPECT_FALSE(copy.ReadRow(id, value));
+
+    // The connection is usable after the COPY
+    EXPECT_EQ(trx.Execute("select 1").AsSingleRow<int>(), 1);
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyEmpty) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    EXPECT_EQ(LoadRows(trx, {}), 0);
+    EXPECT_TRUE(UnloadRows(trx).empty());
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyInAbort) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    {
+        auto copy = trx.MakeCopyIn("COPY copy_test(id, value) FROM STDIN (FORMAT binary)");
+        copy.WriteRows(MakeRows(10));
+        // Not finished
+    }
+    UEXPECT_THROW(trx.Execute("select 1"), pg::Error);
+    UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, CopyInServerError) {
+    CheckConnection(GetConn());
+    GetConn()->Execute("create temporary table copy_test(id integer primary key, value text)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    auto copy = trx.MakeCopyIn("COPY copy_test(id, value) FROM STDIN (FORMAT binary)");
+    copy.WriteRow(1, std::string{"one"});
+    copy.WriteRow(1, std::string{"duplicate"});
+    UEXPECT_THROW(copy.Finish(), pg::UniqueViolation);
+    UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, CopyOutColumnsMismatch) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    auto copy = trx.MakeCopyOut("COPY (SELECT 1, 2) TO STDOUT (FORMAT binary)");
+    int value{};
+    UEXPECT_THROW(copy.ReadRow(value), pg::InvalidInputBufferSize);
+}
+
+UTEST_P(PostgreConnection, CopyOutNotFinished) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    {
+        auto copy = trx.MakeCopyOut("COPY (SELECT generate_series(1, 100000)) TO STDOUT (FORMAT binary)");
+        int value{};
+        EXPECT_TRUE(copy.ReadRow(value));
+        EXPECT_EQ(value, 1);
+    }
+    // The COPY could not be stopped, so the connection is closed
+    UEXPECT_THROW(trx.Execute("select 1"), pg::Error);
+}
+
+UTEST_P(PostgreConnection, CopyWrongStatement) {
+    CheckConnection(GetConn());
+
+    {
+        pg::Transaction trx{std::move(GetConn())};
+        UEXPECT_THROW(trx.MakeCopyIn("select 1"), pg::LogicError);
+        // The statement is executed normally, the transaction is usable
+        EXPECT_EQ(trx.Execute("select 1").AsSingleRow<int>(), 1);
+        trx.Rollback();
+    }
+
+    GetConn() = MakeConnection(GetDsnFromEnv(), GetTaskProcessor());
+    CheckConnection(GetConn());
+    {
+        pg::Transaction trx{std::move(GetConn())};
+        UEXPECT_THROW(trx.MakeCopyIn("COPY (SELECT 1) TO STDOUT (FORMAT binary)"), pg::LogicError);
+    }
+
+    GetConn() = MakeConnection(GetDsnFromEnv(), GetTaskProcessor());
+    CheckConnection(GetConn());
+    {
+        pg::Transaction trx{std::move(GetConn())};
+        UEXPECT_THROW(trx.MakeCopyOut("COPY (SELECT 1) TO STDOUT"), pg::LogicError);
+    }
+}
+
+UTEST_P(PostgreConnection, CopyDeadline) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    auto copy = trx.MakeCopyOut(
+        "COPY (SELECT pg_sleep(1)::text) TO STDOUT (FORMAT binary)",
+        engine::Deadline::FromDuration(std::chrono::milliseconds{50})
+    );
+    std::string value;
+    UEXPECT_THROW(copy.ReadRow(value), pg::ConnectionTimeoutError);
+}
+
+USERVER_NAMESPACE_END
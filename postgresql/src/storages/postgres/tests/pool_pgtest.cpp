@@ -708,6 +708,80 @@ UTEST_P(PostgrePool, ForQueryQueueBeingNonTransactional) {
     EXPECT_EQ(inserted_values.front(), 1);
 }
 
+namespace {
+
+std::shared_ptr<pg::detail::ConnectionPool>
+MakeBatchingPool(const pg::Dsn& dsn, engine::TaskProcessor& task_processor, pg::InitMode init_mode) {
+    pg::PoolSettings settings{1, 10, 10};
+    settings.query_batching_enabled = true;
+    settings.query_batching_window = std::chrono::milliseconds{50};
+
+    return pg::detail::ConnectionPool::Create(
+        dsn,
+        nullptr,
+        task_processor,
+        "",
+        init_mode,
+        settings,
+        kPipelineEnabled,
+        {},
+        GetTestCmdCtls(),
+        {},
+        {},
+        {},
+        dynamic_config::GetDefaultSource(),
+        std::make_shared<utils::statistics::MetricsStorage>()
+    );
+}
+
+}  // namespace
+
+UTEST_P(PostgrePool, QueryBatching) {
+    auto pool = MakeBatchingPool(GetDsnFromEnv(), GetTaskProcessor(), GetParam());
+
+    std::vector<engine::TaskWithResult<int>> tasks;
+    for (int i = 0; i < 20; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&pool, i] {
+            return pool->StartReadOnly().Execute("select $1::integer", i).AsSingleRow<int>();
+        }));
+    }
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(tasks[i].Get(), i);
+    }
+
+    // The concurrent statements join the open batch instead of acquiring
+    // connections of their own and share the roundtrips
+    const auto& stats = pool->GetStatistics();
+    EXPECT_EQ(20, stats.transaction.batched_statement_total);
+    EXPECT_GE(2, stats.transaction.batch_round_total);
+
+    // Sequential statements work as well
+    EXPECT_EQ(pool->StartReadOnly().Execute("select 1").AsSingleRow<int>(), 1);
+    EXPECT_EQ(pool->StartReadOnly().Execute("select 2").AsSingleRow<int>(), 2);
+}
+
+UTEST_P(PostgrePool, QueryBatchingErrors) {
+    auto pool = MakeBatchingPool(GetDsnFromEnv(), GetTaskProcessor(), GetParam());
+
+    std::vector<engine::TaskWithResult<int>> tasks;
+    for (int i = 0; i < 10; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&pool, i] {
+            // Division by zero for a single statement of the batch
+            return pool->StartReadOnly().Execute("select 10 / $1::integer", i % 5).AsSingleRow<int>();
+        }));
+    }
+    for (int i = 0; i < 10; ++i) {
+        if (i % 5 == 0) {
+            UEXPECT_THROW(tasks[i].Get(), pg::DataException);
+        } else {
+            EXPECT_EQ(tasks[i].Get(), 10 / (i % 5));
+        }
+    }
+
+    // The connection is usable after the errors
+    EXPECT_EQ(pool->StartReadOnly().Execute("select 1").AsSingleRow<int>(), 1);
+}
+
 INSTANTIATE_UTEST_SUITE_P(
     PoolTests,
     PostgrePool,
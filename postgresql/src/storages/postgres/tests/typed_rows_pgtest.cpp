@@ -72,6 +72,19 @@ static_assert(tt::kRowCategory<MyPolymorphicBase> == tt::RowCategoryType::kNonRo
 static_assert(tt::kRowCategory<MyPolymorphicDerived> == tt::RowCategoryType::kNonRow);
 static_assert(tt::kRowCategory<MyPolymorphicInrospected> == tt::RowCategoryType::kIntrusiveIntrospection);
 
+static_assert(pg::detail::kIsDecodableByColumns<std::vector<MyTupleType>>);
+static_assert(pg::detail::kIsDecodableByColumns<std::deque<MyIntrusiveClass>>);
+static_assert(!pg::detail::kIsDecodableByColumns<std::list<MyTupleType>>);
+static_assert(!pg::detail::kIsDecodableByColumns<std::set<MyTupleType>>);
+static_assert(!pg::detail::kIsDecodableByColumns<std::vector<bool>>);
+
+static_assert(pg::detail::HasBorrowedFields<std::string_view>());
+static_assert(pg::detail::HasBorrowedFields<std::tuple<int, std::optional<std::string_view>>>());
+static_assert(pg::detail::HasBorrowedFields<std::vector<std::string_view>>());
+static_assert(!pg::detail::HasBorrowedFields<std::string>());
+static_assert(!pg::detail::HasBorrowedFields<MyAggregateStruct>());
+static_assert(!pg::detail::HasBorrowedFields<MyIntrusiveClass>());
+
 }  // namespace static_test
 
 namespace {
@@ -130,6 +143,59 @@ UTEST_P(PostgreConnection, TypedResult) {
     UEXPECT_NO_THROW(res.AsSingleRow<MyTuple>(pg::kRowTag));
 }
 
+UTEST_P(PostgreConnection, TypedResultByColumns) {
+    using MyStruct = static_test::MyStructWithOptional;
+    using MyView = std::tuple<int, std::optional<std::string_view>, double>;
+
+    CheckConnection(GetConn());
+    pg::ResultSet res{nullptr};
+
+    UEXPECT_NO_THROW(
+        res = GetConn()->Execute("select g, case when g % 2 = 0 then 'str ' || g end, g::float8 / 2 "
+                                 "from generate_series(1, 100) g")
+    );
+    ASSERT_EQ(100, res.Size());
+
+    // std::vector is filled by columns, std::list is filled by rows
+    const auto by_columns = res.AsContainer<std::vector<MyStruct>>(pg::kRowTag);
+    const auto by_rows = res.AsContainer<std::list<MyStruct>>(pg::kRowTag);
+    ASSERT_EQ(by_rows.size(), by_columns.size());
+    auto row_it = by_rows.begin();
+    for (const auto& value : by_columns) {
+        EXPECT_EQ(row_it->int_member, value.int_member);
+        EXPECT_EQ(row_it->string_member, value.string_member);
+        EXPECT_EQ(row_it->double_member, value.double_member);
+        ++row_it;
+    }
+
+    const auto views = res.AsContainer<std::vector<MyView>>(pg::kRowTag);
+    ASSERT_EQ(by_columns.size(), views.size());
+    for (std::size_t i = 0; i < views.size(); ++i) {
+        EXPECT_EQ(by_columns[i].int_member, std::get<0>(views[i]));
+        EXPECT_EQ(by_columns[i].string_member.has_value(), std::get<1>(views[i]).has_value());
+        if (std::get<1>(views[i])) {
+            EXPECT_EQ(*by_columns[i].string_member, *std::get<1>(views[i]));
+        }
+        EXPECT_EQ(by_columns[i].double_member, std::get<2>(views[i]));
+    }
+
+    UEXPECT_THROW(res.AsContainer<std::vector<int>>(), pg::NonSingleColumnResultSet);
+    UEXPECT_THROW(
+        (res.AsContainer<std::vector<std::tuple<int, std::string, double, int>>>(pg::kRowTag)),
+        pg::InvalidTupleSizeRequested
+    );
+
+    UEXPECT_NO_THROW(res = GetConn()->Execute("select g from generate_series(1, 10) g"));
+    const auto ints = res.AsContainer<std::vector<int>>();
+    ASSERT_EQ(10, ints.size());
+    for (std::size_t i = 0; i < ints.size(); ++i) {
+        EXPECT_EQ(static_cast<int>(i + 1), ints[i]);
+    }
+
+    UEXPECT_NO_THROW(res = GetConn()->Execute("select 1, 2 where false"));
+    EXPECT_TRUE((res.AsContainer<std::vector<std::tuple<int, int, int>>>(pg::kRowTag).empty()));
+}
+
 UTEST_P(PostgreConnection, TypedResultIterators) {
     using MyTuple = static_test::MyTupleType;
 
@@ -105,6 +105,38 @@ Portal Transaction::MakePortal(
     return Portal{conn_.get(), portal_name, query, params, std::move(statement_cmd_ctl)};
 }
 
+CopyIn Transaction::MakeCopyIn(
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    engine::Deadline deadline
+) {
+    statement_cmd_ctl = PrepareCopy(query, std::move(statement_cmd_ctl));
+    return CopyIn{conn_, query, std::move(statement_cmd_ctl), deadline};
+}
+
+CopyOut Transaction::MakeCopyOut(
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    engine::Deadline deadline
+) {
+    statement_cmd_ctl = PrepareCopy(query, std::move(statement_cmd_ctl));
+    return CopyOut{conn_, query, std::move(statement_cmd_ctl), deadline};
+}
+
+OptionalCommandControl
+Transaction::PrepareCopy(const Query& query, OptionalCommandControl statement_cmd_ctl) const {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "Copy called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    if (!statement_cmd_ctl) {
+        statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetOptionalNameView());
+    }
+    auto source = conn_.GetConfigSource();
+    if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+    return statement_cmd_ctl;
+}
+
 void Transaction::SetParameter(const std::string& param_name, const std::string& value) {
     if (!conn_) {
         LOG_LIMITED_ERROR() << "Set parameter called after transaction finished" << logging::LogExtra::Stacktrace();
@@ -5,6 +5,8 @@
 
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/utils/statistics/metrics_storage.hpp>
@@ -67,6 +69,33 @@ void PgConnection::RunStandalone(benchmark::State& state, std::size_t thread_cou
 
 bool PgConnection::IsConnectionValid() const { return conn_ && conn_->IsConnected(); }
 
+ResultSet PgConnection::FetchWideResult(std::size_t rows) const {
+    return conn_->Execute(
+        "select g, g::bigint * 1000, 'value ' || g, case when g % 2 = 0 then 'even ' || g end, g::float8 / 3 "
+        "from generate_series(1, $1) g",
+        static_cast<Integer>(rows)
+    );
+}
+
+std::shared_ptr<detail::ConnectionPool> PgConnection::MakePool() const {
+    return detail::ConnectionPool::Create(
+        GetDsnFromEnv(),
+        nullptr,
+        engine::current_task::GetTaskProcessor(),
+        "",
+        InitMode::kSync,
+        {1, 1, 1},
+        {ConnectionSettings::kCachePreparedStatements},
+        {},
+        DefaultCommandControls(kBenchCmdCtl, {}, {}),
+        {},
+        {},
+        {},
+        dynamic_config::GetDefaultSource(),
+        std::make_shared<USERVER_NAMESPACE::utils::statistics::MetricsStorage>()
+    );
+}
+
 }  // namespace storages::postgres::bench
 
 USERVER_NAMESPACE_END
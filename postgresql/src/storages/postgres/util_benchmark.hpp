@@ -1,10 +1,13 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include <benchmark/benchmark.h>
 
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -21,6 +24,14 @@ protected:
 
     detail::Connection& GetConnection() const noexcept { return *conn_; }
 
+    // Result with `rows` rows of integer, bigint, text, nullable text and
+    // double precision columns
+    ResultSet FetchWideResult(std::size_t rows) const;
+
+    // Pool of a single connection to the same database, for the benchmarks of
+    // Transaction methods. Must be destroyed before the payload returns.
+    std::shared_ptr<detail::ConnectionPool> MakePool() const;
+
     // Should be used for starting the benchmark's coroutine environment instead
     // of engine::RunStandalone
     void RunStandalone(benchmark::State& state, std::function<void()> payload);
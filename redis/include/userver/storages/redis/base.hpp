@@ -20,6 +20,15 @@ using Password = utils::NonLoggable<class PasswordTag, std::string>;
 
 enum class ConnectionSecurity { kNone, kTLS };
 
+/// Settings of the `CLIENT TRACKING` in the broadcasting mode. Connections with
+/// the tracking enabled receive the names of the modified keys in the
+/// `__redis__:invalidate` channel.
+struct ClientTrackingSettings {
+    bool enabled{false};
+    /// Prefixes of the keys to track, all the keys are tracked if empty
+    std::vector<std::string> prefixes;
+};
+
 struct ConnectionInfo {
     std::string host = "localhost";
     int port = 26379;
@@ -28,6 +37,7 @@ struct ConnectionInfo {
     ConnectionSecurity connection_security = ConnectionSecurity::kNone;
     using HostVector = std::vector<std::string>;
     std::size_t database_index = 0;
+    ClientTrackingSettings client_tracking;
 
     ConnectionInfo() = default;
     ConnectionInfo(
@@ -277,6 +277,8 @@ public:
 
     virtual RequestMget Mget(std::vector<std::string> keys, const CommandControl& command_control) = 0;
 
+    /// The keys of distinct shards (and of distinct hash slots in RedisCluster)
+    /// are set by separate requests, so the command is not atomic for them
     virtual RequestMset
     Mset(std::vector<std::pair<std::string, std::string>> key_values, const CommandControl& command_control) = 0;
 
@@ -123,7 +123,10 @@ struct CommandControl {
     /// If set, force execution on specific shard
     std::optional<std::size_t> force_shard_idx{};
 
-    /// Split execution of multi-key commands (i.e., MGET) to multiple requests
+    /// Split execution of multi-key commands (i.e., MGET) to multiple requests.
+    /// The keys of distinct shards (and of distinct hash slots in RedisCluster)
+    /// are always sent in separate requests and the replies are merged in the
+    /// order of the keys.
     std::optional<std::size_t> chunk_size{};
 
     /// If set, the user wants a specific Redis instance to handle the command.
@@ -131,6 +134,11 @@ struct CommandControl {
     /// ignored.
     std::optional<ServerId> force_server_id{};
 
+    /// Serve GET and HGET from the client side cache of the client, if the
+    /// cache is configured in the `client_side_cache` option of the group.
+    /// Cached values may be stale for the `ttl` of the cache at most.
+    std::optional<bool> client_side_caching{};
+
     /// If set, command retries are directed to the master instance
     bool force_retries_to_master_on_nil_reply{false};
 
@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/components/component_base.hpp>
 #include <userver/components/component_fwd.hpp>
@@ -13,6 +14,7 @@
 #include <userver/rcu/rcu.hpp>
 #include <userver/storages/redis/base.hpp>
 #include <userver/storages/redis/fwd.hpp>
+#include <userver/storages/redis/subscription_token.hpp>
 #include <userver/storages/redis/wait_connected_mode.hpp>
 #include <userver/storages/secdist/secdist.hpp>
 #include <userver/testsuite/redis_control.hpp>
@@ -26,6 +28,7 @@ namespace storages {}
 /// Valkey and Redis client and helpers
 namespace storages::redis {
 
+class ClientSideCache;
 class SubscribeClientImpl;
 
 namespace impl {
@@ -65,10 +68,16 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, RedisStandalone, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].client_side_cache.max_keys | maximum number of keys in the client side cache | 10000
+/// groups.[].client_side_cache.max_entry_size | values of the keys taking more bytes are not cached | 4096
+/// groups.[].client_side_cache.ttl | maximum staleness of the cached values | 10s
+/// groups.[].client_side_cache.invalidation_subscribe_group | name of the subscribe group with `client_tracking` to receive invalidations from | -
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
 /// subscribe_groups.[].sharding_strategy | either RedisCluster or KeyShardTaximeterCrc32 | "KeyShardTaximeterCrc32"
+/// subscribe_groups.[].client_tracking.enabled | enables `CLIENT TRACKING` on the subscriber connections, not supported for RedisCluster | false
+/// subscribe_groups.[].client_tracking.prefixes | prefixes of the tracked keys, all the keys are tracked if empty | []
 ///
 /// ## Static configuration example:
 ///
@@ -131,6 +140,43 @@ namespace components {
 /// 1. `"shards"` field is ignored, you can specify an empty array there;
 /// 2. `"sentinels"` field should contain some of the cluster nodes. They are
 ///    only used for topology discovery; it is not necessary to list all nodes.
+///
+/// ## Client side caching
+///
+/// Replies of GET and HGET of a group with the `client_side_cache` option may
+/// be cached in memory of the service. Caching is enabled per command via
+/// storages::redis::CommandControl::client_side_caching.
+///
+/// The cache relies on the server assisted invalidation: the subscriber
+/// connections of the `invalidation_subscribe_group` enable `CLIENT TRACKING`
+/// in the broadcasting mode and receive the names of the modified keys in the
+/// `__redis__:invalidate` channel. The subscribe group must use the same
+/// secdist configuration as the group. Keys that are modified while the
+/// subscriber is reconnecting and values read from a lagging replica stay
+/// stale for `ttl` at most, the same holds for a cache without the
+/// `invalidation_subscribe_group`.
+///
+/// Invalidation messages are node local, so the client tracking is not
+/// supported for the subscribe groups with the RedisCluster sharding
+/// strategy.
+///
+/// ```
+///    # yaml
+///    redis:
+///        groups:
+///          - config_name: dogs
+///            db: hello_service_dogs_catalogue
+///            client_side_cache:
+///                max_keys: 100000
+///                ttl: 30s
+///                invalidation_subscribe_group: dogs_invalidations
+///        subscribe_groups:
+///          - config_name: dogs
+///            db: dogs_invalidations
+///            client_tracking:
+///                enabled: true
+///                prefixes: ['dog:']
+/// ```
 
 // clang-format on
 class Redis : public ComponentBase {
@@ -169,6 +215,8 @@ private:
     std::unordered_map<std::string, std::shared_ptr<storages::redis::impl::Sentinel>> sentinels_;
     std::unordered_map<std::string, std::shared_ptr<storages::redis::Client>> clients_;
     std::unordered_map<std::string, std::shared_ptr<storages::redis::SubscribeClientImpl>> subscribe_clients_;
+    std::unordered_map<std::string, std::shared_ptr<storages::redis::ClientSideCache>> client_side_caches_;
+    std::vector<storages::redis::SubscriptionToken> invalidation_subscriptions_;
 
     dynamic_config::Source config_;
     concurrent::AsyncEventSubscriberScope config_subscription_;
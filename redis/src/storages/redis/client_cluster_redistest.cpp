@@ -99,8 +99,12 @@ UTEST_F(RedisClusterClientTest, MgetCrossSlot) {
     }
 
     {
-        auto req = client->Mget({MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
-        UASSERT_THROW(req.Get(), storages::redis::RequestFailedException);
+        // The keys of the distinct slots are requested separately
+        auto req = client->Mget({MakeKey(idx[1]), MakeKey(idx[0])}, kDefaultCc);
+        auto reply = req.Get();
+        ASSERT_EQ(reply.size(), 2);
+        EXPECT_EQ(reply[0], std::to_string(add + idx[1]));
+        EXPECT_EQ(reply[1], std::to_string(add + idx[0]));
     }
 
     for (const unsigned long i : idx) {
@@ -109,6 +113,32 @@ UTEST_F(RedisClusterClientTest, MgetCrossSlot) {
     }
 }
 
+UTEST_F(RedisClusterClientTest, MultiKeyCommandsAcrossShards) {
+    auto client = GetClient();
+
+    const size_t kNumKeys = 30;
+    const int add = 100;
+
+    std::vector<std::string> keys;
+    std::vector<std::pair<std::string, std::string>> key_values;
+    for (size_t i = 0; i < kNumKeys; ++i) {
+        keys.push_back(MakeKey(i));
+        key_values.emplace_back(MakeKey(i), std::to_string(add + i));
+    }
+
+    UASSERT_NO_THROW(client->Mset(key_values, kDefaultCc).Get());
+    EXPECT_EQ(client->Exists(keys, kDefaultCc).Get(), kNumKeys);
+
+    auto reply = client->Mget(keys, kDefaultCc).Get();
+    ASSERT_EQ(reply.size(), kNumKeys);
+    for (size_t i = 0; i < kNumKeys; ++i) {
+        EXPECT_EQ(reply[i], std::to_string(add + i));
+    }
+
+    EXPECT_EQ(client->Del(keys, kDefaultCc).Get(), kNumKeys);
+    EXPECT_EQ(client->Exists(keys, kDefaultCc).Get(), 0);
+}
+
 UTEST_F(RedisClusterClientTest, Transaction) {
     auto client = GetClient();
     auto transaction = client->Multi();
@@ -1,9 +1,12 @@
 #include "client_impl.hpp"
 
+#include <unordered_map>
+
 #include <userver/utils/assert.hpp>
 
 #include <storages/redis/impl/sentinel.hpp>
 
+#include "client_side_cache.hpp"
 #include "impl/command_control_impl.hpp"
 #include "request_impl.hpp"
 #include "transaction_impl.hpp"
@@ -37,9 +40,73 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
         );
 }
 
+ReplyPtr MakeCachedReply(std::string command, ClientSideCache::Value&& value) {
+    return std::make_shared<Reply>(std::move(command), value ? ReplyData(std::move(*value)) : ReplyData::CreateNil());
+}
+
+template <typename T>
+struct ArgsChunk {
+    size_t shard{0};
+    std::vector<T> args;
+    // Positions of the args in the arguments of the command
+    std::vector<size_t> positions;
+};
+
+// Splits the arguments of a multi-key command into the chunks that may be sent
+// in a single request each: the keys of a chunk belong to the same shard (and
+// to the same hash slot in RedisCluster), a chunk holds at most
+// CommandControl::chunk_size arguments
+template <typename T, typename GetKey>
+std::vector<ArgsChunk<T>>
+SplitByShards(const impl::Sentinel& sentinel, std::vector<T>&& args, GetKey get_key, const CommandControl& cc) {
+    const auto max_chunk_size = CommandControlImpl{cc}.chunk_size;
+
+    std::vector<ArgsChunk<T>> chunks;
+    // Keys group -> index of the last chunk of the group
+    std::unordered_map<size_t, size_t> group_chunks;
+    for (size_t i = 0; i < args.size(); ++i) {
+        const std::string& key = get_key(args[i]);
+        const size_t group = cc.force_shard_idx ? 0 : sentinel.KeysGroupByKey(key);
+
+        auto it = group_chunks.find(group);
+        if (it == group_chunks.end() || (max_chunk_size && chunks[it->second].args.size() >= max_chunk_size)) {
+            chunks.push_back({cc.force_shard_idx.value_or(sentinel.ShardByKey(key)), {}, {}});
+            it = group_chunks.insert_or_assign(group, chunks.size() - 1).first;
+        }
+        auto& chunk = chunks[it->second];
+        chunk.args.push_back(std::move(args[i]));
+        chunk.positions.push_back(i);
+    }
+    return chunks;
+}
+
+// Sends a request per chunk, make_request(shard, args) makes the request
+template <typename Request, typename T, typename MakeRequest>
+Request MakeSplitRequest(std::vector<ArgsChunk<T>>&& chunks, MakeRequest make_request) {
+    UASSERT(!chunks.empty());
+    if (chunks.size() == 1) {
+        return CreateRequest<Request>(make_request(chunks.front().shard, std::move(chunks.front().args)));
+    }
+
+    std::vector<impl::Request> requests;
+    std::vector<std::vector<size_t>> positions;
+    requests.reserve(chunks.size());
+    positions.reserve(chunks.size());
+    for (auto& chunk : chunks) {
+        requests.push_back(make_request(chunk.shard, std::move(chunk.args)));
+        positions.push_back(std::move(chunk.positions));
+    }
+    return CreateAggregateRequest<Request>(std::move(requests), std::move(positions));
+}
+
+const std::string& GetKey(const std::string& key) { return key; }
+
+const std::string& GetPairKey(const std::pair<std::string, std::string>& key_value) { return key_value.first; }
+
 }  // namespace
 
-ClientImpl::ClientImpl(std::shared_ptr<impl::Sentinel> sentinel) : redis_client_(std::move(sentinel)) {}
+ClientImpl::ClientImpl(std::shared_ptr<impl::Sentinel> sentinel, std::shared_ptr<ClientSideCache> client_side_cache)
+    : redis_client_(std::move(sentinel)), client_side_cache_(std::move(client_side_cache)) {}
 
 void ClientImpl::WaitConnectedOnce(RedisWaitConnected wait_connected) {
     redis_client_->WaitConnectedOnce(wait_connected);
@@ -126,9 +193,11 @@ RequestDel ClientImpl::Del(std::string key, const CommandControl& command_contro
 
 RequestDel ClientImpl::Del(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestDel>(std::make_shared<Reply>("del", 0));
-    auto shard = ShardByKey(keys.at(0), command_control);
-    return CreateRequest<RequestDel>(
-        MakeRequest(CmdArgs{"del", std::move(keys)}, shard, true, GetCommandControl(command_control))
+    return MakeSplitRequest<RequestDel>(
+        SplitByShards(*redis_client_, std::move(keys), GetKey, command_control),
+        [this, cc = GetCommandControl(command_control)](size_t shard, std::vector<std::string> keys) {
+            return MakeRequest(CmdArgs{"del", std::move(keys)}, shard, true, cc);
+        }
     );
 }
 
@@ -141,9 +210,11 @@ RequestUnlink ClientImpl::Unlink(std::string key, const CommandControl& command_
 
 RequestUnlink ClientImpl::Unlink(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestUnlink>(std::make_shared<Reply>("unlink", 0));
-    auto shard = ShardByKey(keys.at(0), command_control);
-    return CreateRequest<RequestUnlink>(
-        MakeRequest(CmdArgs{"unlink", std::move(keys)}, shard, true, GetCommandControl(command_control))
+    return MakeSplitRequest<RequestUnlink>(
+        SplitByShards(*redis_client_, std::move(keys), GetKey, command_control),
+        [this, cc = GetCommandControl(command_control)](size_t shard, std::vector<std::string> keys) {
+            return MakeRequest(CmdArgs{"unlink", std::move(keys)}, shard, true, cc);
+        }
     );
 }
 
@@ -208,9 +279,11 @@ RequestExists ClientImpl::Exists(std::string key, const CommandControl& command_
 
 RequestExists ClientImpl::Exists(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestExists>(std::make_shared<Reply>("exists", 0));
-    auto shard = ShardByKey(keys.at(0), command_control);
-    return CreateRequest<RequestExists>(
-        MakeRequest(CmdArgs{"exists", std::move(keys)}, shard, false, GetCommandControl(command_control))
+    return MakeSplitRequest<RequestExists>(
+        SplitByShards(*redis_client_, std::move(keys), GetKey, command_control),
+        [this, cc = GetCommandControl(command_control)](size_t shard, std::vector<std::string> keys) {
+            return MakeRequest(CmdArgs{"exists", std::move(keys)}, shard, false, cc);
+        }
     );
 }
 
@@ -348,8 +421,21 @@ RequestGeosearch ClientImpl::Geosearch(
 
 RequestGet ClientImpl::Get(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
-    return CreateRequest<RequestGet>(
-        MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, GetCommandControl(command_control))
+    if (!UseClientSideCache(command_control)) {
+        return CreateRequest<RequestGet>(
+            MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, GetCommandControl(command_control))
+        );
+    }
+
+    if (auto cached = client_side_cache_->Get(key)) {
+        return CreateDummyRequest<RequestGet>(MakeCachedReply("get", std::move(*cached)));
+    }
+    const auto version = client_side_cache_->GetVersion(key);
+    return CreateCachingRequest<RequestGet>(
+        MakeRequest(CmdArgs{"get", key}, shard, false, GetCommandControl(command_control)),
+        [cache = client_side_cache_, key, version](const std::optional<std::string>& value) {
+            cache->Put(key, value, version);
+        }
     );
 }
 
@@ -384,8 +470,21 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field, const Com
 
 RequestHget ClientImpl::Hget(std::string key, std::string field, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
-    return CreateRequest<RequestHget>(
-        MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, GetCommandControl(command_control))
+    if (!UseClientSideCache(command_control)) {
+        return CreateRequest<RequestHget>(MakeRequest(
+            CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, GetCommandControl(command_control)
+        ));
+    }
+
+    if (auto cached = client_side_cache_->Hget(key, field)) {
+        return CreateDummyRequest<RequestHget>(MakeCachedReply("hget", std::move(*cached)));
+    }
+    const auto version = client_side_cache_->GetVersion(key);
+    return CreateCachingRequest<RequestHget>(
+        MakeRequest(CmdArgs{"hget", key, field}, shard, false, GetCommandControl(command_control)),
+        [cache = client_side_cache_, key, field, version](const std::optional<std::string>& value) {
+            cache->Hput(key, field, value, version);
+        }
     );
 }
 
@@ -567,29 +666,23 @@ RequestLtrim ClientImpl::Ltrim(std::string key, int64_t start, int64_t stop, con
 
 RequestMget ClientImpl::Mget(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestMget>(std::make_shared<Reply>("mget", ReplyData::Array{}));
-    const auto shard = ShardByKey(keys.at(0), command_control);
-    auto max_chunk_size = CommandControlImpl{command_control}.chunk_size;
-    if (max_chunk_size == 0) {
-        max_chunk_size = keys.size();
-    }
-    auto make_request = [this, shard, cc = GetCommandControl(command_control)](auto keys) {
-        return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
-    };
-    if (max_chunk_size >= keys.size()) {
-        return CreateRequest<RequestMget>(make_request(std::move(keys)));
-    }
-    return CreateAggregateRequest<RequestMget>(MakeRequestChunks(
-        max_chunk_size, std::move(keys), [&make_request](auto keys) { return make_request(std::move(keys)); }
-    ));
+    return MakeSplitRequest<RequestMget>(
+        SplitByShards(*redis_client_, std::move(keys), GetKey, command_control),
+        [this, cc = GetCommandControl(command_control)](size_t shard, std::vector<std::string> keys) {
+            return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
+        }
+    );
 }
 
 RequestMset
 ClientImpl::Mset(std::vector<std::pair<std::string, std::string>> key_values, const CommandControl& command_control) {
     if (key_values.empty())
         return CreateDummyRequest<RequestMset>(std::make_shared<Reply>("mset", ReplyData::CreateStatus("OK")));
-    auto shard = ShardByKey(key_values.at(0).first, command_control);
-    return CreateRequest<RequestMset>(
-        MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true, GetCommandControl(command_control))
+    return MakeSplitRequest<RequestMset>(
+        SplitByShards(*redis_client_, std::move(key_values), GetPairKey, command_control),
+        [this, cc = GetCommandControl(command_control)](
+            size_t shard, std::vector<std::pair<std::string, std::string>> key_values
+        ) { return MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true, cc); }
     );
 }
 
@@ -1215,6 +1308,10 @@ size_t ClientImpl::ShardByKey(const std::string& key, const CommandControl& cc)
 
 void ClientImpl::CheckShard(size_t shard, const CommandControl& cc) const { DoCheckShard(shard, cc.force_shard_idx); }
 
+bool ClientImpl::UseClientSideCache(const CommandControl& cc) const {
+    return client_side_cache_ && cc.client_side_caching.value_or(false);
+}
+
 template Request<ScanReplyTmpl<ScanTag::kSscan>> ClientImpl::MakeScanRequestWithKey(
     std::string key,
     size_t shard,
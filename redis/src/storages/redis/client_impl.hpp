@@ -24,12 +24,16 @@ class Sentinel;
 
 namespace storages::redis {
 
+class ClientSideCache;
 class TransactionImpl;
 
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class ClientImpl final : public Client, public std::enable_shared_from_this<ClientImpl> {
 public:
-    explicit ClientImpl(std::shared_ptr<impl::Sentinel> sentinel);
+    explicit ClientImpl(
+        std::shared_ptr<impl::Sentinel> sentinel,
+        std::shared_ptr<ClientSideCache> client_side_cache = nullptr
+    );
 
     void WaitConnectedOnce(RedisWaitConnected wait_connected) override;
 
@@ -448,23 +452,6 @@ private:
         size_t replies_to_skip = 0
     );
 
-    template <typename T, typename Func>
-    auto MakeRequestChunks(size_t max_chunk_size, std::vector<T>&& args, Func&& func) {
-        std::vector<impl::Request> requests;
-
-        auto chunk_size = static_cast<std::ptrdiff_t>(max_chunk_size);
-        // NOLINTNEXTLINE(readability-qualified-auto)
-        for (auto it = args.begin(); it < args.end(); it += chunk_size) {
-            chunk_size = std::min(chunk_size, args.end() - it);
-            std::vector<T> args_chunk;
-            args_chunk.reserve(chunk_size);
-            std::move(it, it + chunk_size, std::back_inserter(args_chunk));
-            requests.push_back(func(std::move(args_chunk)));
-        }
-
-        return requests;
-    }
-
     CommandControl GetCommandControl(const CommandControl& cc) const;
 
     size_t GetPublishShard(PubShard policy, const PublishSettings& settings);
@@ -473,7 +460,10 @@ private:
 
     void CheckShard(size_t shard, const CommandControl& cc) const;
 
+    bool UseClientSideCache(const CommandControl& cc) const;
+
     std::shared_ptr<impl::Sentinel> redis_client_;
+    std::shared_ptr<ClientSideCache> client_side_cache_;
 };
 
 }  // namespace storages::redis
@@ -0,0 +1,119 @@
+#include "client_side_cache.hpp"
+
+#include <algorithm>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+constexpr std::size_t kCacheWays = 16;
+
+std::size_t ValueSize(const ClientSideCache::Value& value) { return value ? value->size() : 0; }
+
+}  // namespace
+
+ClientSideCache::ClientSideCache(const ClientSideCacheSettings& settings)
+    : settings_(settings), entries_(kCacheWays, std::max<std::size_t>(settings.max_keys / kCacheWays, 1)) {}
+
+ClientSideCache::~ClientSideCache() = default;
+
+std::optional<ClientSideCache::Value> ClientSideCache::Get(const std::string& key) {
+    auto entry = GetEntry(key);
+    if (!entry || !entry->value) {
+        ++misses_;
+        return std::nullopt;
+    }
+    ++hits_;
+    return std::move(entry->value);
+}
+
+std::optional<ClientSideCache::Value> ClientSideCache::Hget(const std::string& key, const std::string& field) {
+    auto entry = GetEntry(key);
+    if (entry && entry->fields) {
+        const auto it = entry->fields->find(field);
+        if (it != entry->fields->end()) {
+            ++hits_;
+            return it->second;
+        }
+    }
+    ++misses_;
+    return std::nullopt;
+}
+
+ClientSideCache::Version ClientSideCache::GetVersion(const std::string& key) const { return GetStripe(key).load(); }
+
+void ClientSideCache::Put(const std::string& key, Value value, Version version) {
+    const auto size = key.size() + ValueSize(value);
+    if (size > settings_.max_entry_size) return;
+
+    Entry entry;
+    entry.value = std::move(value);
+    entry.size = size;
+    entry.expiration = Clock::now() + settings_.ttl;
+    PutEntry(key, std::move(entry), version);
+}
+
+void ClientSideCache::Hput(const std::string& key, const std::string& field, Value value, Version version) {
+    auto entry = GetEntry(key).value_or(Entry{});
+    if (!entry.fields) {
+        entry.value.reset();
+        entry.size = key.size();
+        entry.expiration = Clock::now() + settings_.ttl;
+    }
+
+    const auto size = entry.size + field.size() + ValueSize(value);
+    if (size > settings_.max_entry_size) return;
+
+    // Copies of the entry may be in use by the readers
+    auto fields = entry.fields ? std::make_shared<Fields>(*entry.fields) : std::make_shared<Fields>();
+    if (!fields->emplace(field, std::move(value)).second) return;
+    entry.fields = std::move(fields);
+    entry.size = size;
+    PutEntry(key, std::move(entry), version);
+}
+
+void ClientSideCache::Invalidate(const std::string& key) {
+    ++invalidations_;
+    if (key.empty()) {
+        for (auto& version : versions_) ++version;
+        entries_.Invalidate();
+        return;
+    }
+
+    ++GetStripe(key);
+    entries_.InvalidateByKey(key);
+}
+
+std::optional<ClientSideCache::Entry> ClientSideCache::GetEntry(const std::string& key) {
+    const auto now = Clock::now();
+    return entries_.Get(key, [now](const Entry& entry) { return now < entry.expiration; });
+}
+
+void ClientSideCache::PutEntry(const std::string& key, Entry&& entry, Version version) {
+    auto& stripe = GetStripe(key);
+    if (stripe.load() != version) return;
+    entries_.Put(key, std::move(entry));
+
+    // The key may have been invalidated after the check and before the entry
+    // was stored, then the invalidation could have missed the entry
+    if (stripe.load() != version) entries_.InvalidateByKey(key);
+}
+
+std::atomic<ClientSideCache::Version>& ClientSideCache::GetStripe(const std::string& key) const {
+    return versions_[std::hash<std::string>{}(key) % kVersionStripes];
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ClientSideCache& cache) {
+    writer["hits"] = cache.hits_;
+    writer["misses"] = cache.misses_;
+    writer["invalidations"] = cache.invalidations_;
+    writer["size"] = cache.entries_.GetSize();
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct ClientSideCacheSettings {
+    /// Maximum number of the cached keys
+    std::size_t max_keys{10000};
+    /// Values of the keys that take more bytes are not cached
+    std::size_t max_entry_size{4096};
+    /// Upper bound of the staleness of a value, in case an invalidation
+    /// message is lost or the value is read from a lagging replica
+    std::chrono::milliseconds ttl{10000};
+};
+
+/// @brief Bounded in-memory cache of GET and HGET replies.
+///
+/// The cache is invalidated by the names of the modified keys that are
+/// published in the `__redis__:invalidate` channel to the subscriber
+/// connections with the client tracking enabled, see
+/// ClientTrackingSettings. An empty key name invalidates the whole cache.
+///
+/// A reply is stored only if no invalidation of its key was received since
+/// the command was sent, so a reply that races with a modification of the key
+/// is never cached.
+class ClientSideCache final {
+public:
+    using Value = std::optional<std::string>;
+    using Version = std::uint64_t;
+
+    static constexpr std::string_view kInvalidationChannel = "__redis__:invalidate";
+
+    explicit ClientSideCache(const ClientSideCacheSettings& settings);
+    ~ClientSideCache();
+
+    ClientSideCache(const ClientSideCache&) = delete;
+    ClientSideCache& operator=(const ClientSideCache&) = delete;
+
+    /// Returns the cached reply of GET, std::nullopt if there is none
+    std::optional<Value> Get(const std::string& key);
+
+    /// Returns the cached reply of HGET, std::nullopt if there is none
+    std::optional<Value> Hget(const std::string& key, const std::string& field);
+
+    /// Must be called before the command is sent, the result is passed to
+    /// Put() or Hput() along with the reply
+    Version GetVersion(const std::string& key) const;
+
+    void Put(const std::string& key, Value value, Version version);
+    void Hput(const std::string& key, const std::string& field, Value value, Version version);
+
+    /// Invalidates the key, invalidates the whole cache if the key is empty
+    void Invalidate(const std::string& key);
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const ClientSideCache& cache);
+
+private:
+    using Fields = std::unordered_map<std::string, Value>;
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        // Reply of GET
+        std::optional<Value> value;
+        // Replies of HGET by the fields, shared by the copies of the entry
+        std::shared_ptr<const Fields> fields;
+        std::size_t size{0};
+        Clock::time_point expiration;
+    };
+
+    static constexpr std::size_t kVersionStripes = 256;
+
+    std::optional<Entry> GetEntry(const std::string& key);
+    void PutEntry(const std::string& key, Entry&& entry, Version version);
+    std::atomic<Version>& GetStripe(const std::string& key) const;
+
+    const ClientSideCacheSettings settings_;
+    cache::NWayLRU<std::string, Entry> entries_;
+    // Invalidations of the keys are counted by the stripes of the keys hashes
+    mutable std::array<std::atomic<Version>, kVersionStripes> versions_{};
+
+    utils::statistics::RateCounter hits_;
+    utils::statistics::RateCounter misses_;
+    utils::statistics::RateCounter invalidations_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
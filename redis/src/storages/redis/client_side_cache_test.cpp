@@ -0,0 +1,93 @@
+#include <storages/redis/client_side_cache.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::ClientSideCache;
+using storages::redis::ClientSideCacheSettings;
+
+ClientSideCacheSettings MakeSettings() {
+    ClientSideCacheSettings settings;
+    settings.max_keys = 100;
+    settings.max_entry_size = 64;
+    settings.ttl = std::chrono::hours{1};
+    return settings;
+}
+
+std::optional<ClientSideCache::Value> Cached(ClientSideCache::Value value) { return value; }
+
+}  // namespace
+
+UTEST(ClientSideCache, GetPut) {
+    ClientSideCache cache{MakeSettings()};
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+
+    cache.Put("key", "value", cache.GetVersion("key"));
+    EXPECT_EQ(cache.Get("key"), Cached("value"));
+
+    cache.Put("nil", std::nullopt, cache.GetVersion("nil"));
+    EXPECT_EQ(cache.Get("nil"), Cached(std::nullopt));
+}
+
+UTEST(ClientSideCache, HgetHput) {
+    ClientSideCache cache{MakeSettings()};
+    cache.Hput("hash", "a", "1", cache.GetVersion("hash"));
+    cache.Hput("hash", "b", std::nullopt, cache.GetVersion("hash"));
+
+    EXPECT_EQ(cache.Hget("hash", "a"), Cached("1"));
+    EXPECT_EQ(cache.Hget("hash", "b"), Cached(std::nullopt));
+    EXPECT_EQ(cache.Hget("hash", "c"), std::nullopt);
+    EXPECT_EQ(cache.Get("hash"), std::nullopt);
+}
+
+UTEST(ClientSideCache, Invalidate) {
+    ClientSideCache cache{MakeSettings()};
+    cache.Put("key", "value", cache.GetVersion("key"));
+    cache.Hput("hash", "a", "1", cache.GetVersion("hash"));
+
+    cache.Invalidate("key");
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+    EXPECT_EQ(cache.Hget("hash", "a"), Cached("1"));
+
+    cache.Invalidate("hash");
+    EXPECT_EQ(cache.Hget("hash", "a"), std::nullopt);
+}
+
+UTEST(ClientSideCache, InvalidateAll) {
+    ClientSideCache cache{MakeSettings()};
+    cache.Put("key1", "value", cache.GetVersion("key1"));
+    cache.Put("key2", "value", cache.GetVersion("key2"));
+
+    cache.Invalidate({});
+    EXPECT_EQ(cache.Get("key1"), std::nullopt);
+    EXPECT_EQ(cache.Get("key2"), std::nullopt);
+}
+
+UTEST(ClientSideCache, ReplyRacingWithInvalidation) {
+    ClientSideCache cache{MakeSettings()};
+    const auto version = cache.GetVersion("key");
+    cache.Invalidate("key");
+
+    cache.Put("key", "stale", version);
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+
+    cache.Put("key", "value", cache.GetVersion("key"));
+    EXPECT_EQ(cache.Get("key"), Cached("value"));
+}
+
+UTEST(ClientSideCache, Limits) {
+    auto settings = MakeSettings();
+    ClientSideCache cache{settings};
+    cache.Put("key", std::string(settings.max_entry_size, 'x'), cache.GetVersion("key"));
+    EXPECT_EQ(cache.Get("key"), std::nullopt);
+
+    settings.ttl = std::chrono::milliseconds{0};
+    ClientSideCache expiring_cache{settings};
+    expiring_cache.Put("key", "value", expiring_cache.GetVersion("key"));
+    EXPECT_EQ(expiring_cache.Get("key"), std::nullopt);
+}
+
+USERVER_NAMESPACE_END
@@ -123,6 +123,9 @@ CommandControl CommandControl::MergeWith(const CommandControl& b) const {
     if (b.force_server_id.has_value()) {
         res.force_server_id = b.force_server_id;
     }
+    if (b.client_side_caching.has_value()) {
+        res.client_side_caching = b.client_side_caching;
+    }
     if (b.retry_counter && b.retry_counter > res.retry_counter) {
         res.retry_counter = b.retry_counter;
     }
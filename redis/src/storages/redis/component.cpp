@@ -1,5 +1,6 @@
 #include <userver/storages/redis/component.hpp>
 
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
@@ -31,6 +32,7 @@
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
 #include "client_impl.hpp"
+#include "client_side_cache.hpp"
 #include "redis_secdist.hpp"
 #include "subscribe_client_impl.hpp"
 #include "userver/storages/redis/base.hpp"
@@ -65,6 +67,8 @@ struct RedisGroup {
     std::string config_name;
     std::string sharding_strategy;
     bool allow_reads_from_master{false};
+    std::optional<storages::redis::ClientSideCacheSettings> client_side_cache;
+    std::string invalidation_subscribe_group;
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisGroup>) {
@@ -73,6 +77,16 @@ RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisG
     config.config_name = value["config_name"].As<std::string>();
     config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
     config.allow_reads_from_master = value["allow_reads_from_master"].As<bool>(false);
+
+    const auto& cache = value["client_side_cache"];
+    if (!cache.IsMissing()) {
+        storages::redis::ClientSideCacheSettings settings;
+        settings.max_keys = cache["max_keys"].As<std::size_t>(settings.max_keys);
+        settings.max_entry_size = cache["max_entry_size"].As<std::size_t>(settings.max_entry_size);
+        settings.ttl = cache["ttl"].As<std::chrono::milliseconds>(settings.ttl);
+        config.client_side_cache = settings;
+        config.invalidation_subscribe_group = cache["invalidation_subscribe_group"].As<std::string>("");
+    }
     return config;
 }
 
@@ -81,6 +95,7 @@ struct SubscribeRedisGroup {
     std::string config_name;
     std::string sharding_strategy;
     bool allow_reads_from_master{false};
+    storages::redis::ClientTrackingSettings client_tracking;
 };
 
 SubscribeRedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<SubscribeRedisGroup>) {
@@ -89,6 +104,9 @@ SubscribeRedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::
     config.config_name = value["config_name"].As<std::string>();
     config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
     config.allow_reads_from_master = value["allow_reads_from_master"].As<bool>(false);
+    config.client_tracking.enabled = value["client_tracking"]["enabled"].As<bool>(false);
+    config.client_tracking.prefixes =
+        value["client_tracking"]["prefixes"].As<std::vector<std::string>>(std::vector<std::string>{});
     return config;
 }
 
@@ -217,7 +235,12 @@ void Redis::Connect(
         );
         if (sentinel) {
             sentinels_.emplace(redis_group.db, sentinel);
-            const auto& client = std::make_shared<storages::redis::ClientImpl>(sentinel);
+            std::shared_ptr<storages::redis::ClientSideCache> client_side_cache;
+            if (redis_group.client_side_cache) {
+                client_side_cache = std::make_shared<storages::redis::ClientSideCache>(*redis_group.client_side_cache);
+                client_side_caches_.emplace(redis_group.db, client_side_cache);
+            }
+            const auto& client = std::make_shared<storages::redis::ClientImpl>(sentinel, std::move(client_side_cache));
             clients_.emplace(redis_group.db, client);
         } else {
             LOG_WARNING() << "skip redis client for " << redis_group.db;
@@ -246,7 +269,8 @@ void Redis::Connect(
             redis_group.db,
             redis_group.sharding_strategy,
             cc,
-            testsuite_redis_control
+            testsuite_redis_control,
+            redis_group.client_tracking
         );
         if (sentinel)
             subscribe_clients_.emplace(
@@ -262,11 +286,32 @@ void Redis::Connect(
     for (auto& subscribe_client_it : subscribe_clients_) {
         subscribe_client_it.second->WaitConnectedOnce(redis_wait_connected_subscribe);
     }
+
+    for (const RedisGroup& redis_group : redis_groups) {
+        if (redis_group.invalidation_subscribe_group.empty()) continue;
+        const auto cache_it = client_side_caches_.find(redis_group.db);
+        if (cache_it == client_side_caches_.end()) continue;
+
+        const auto subscribe_client_it = subscribe_clients_.find(redis_group.invalidation_subscribe_group);
+        if (subscribe_client_it == subscribe_clients_.end()) {
+            throw std::runtime_error(fmt::format(
+                "Subscribe group '{}' for the invalidations of the client side cache of '{}' is not found",
+                redis_group.invalidation_subscribe_group,
+                redis_group.db
+            ));
+        }
+        invalidation_subscriptions_.push_back(subscribe_client_it->second->Subscribe(
+            std::string{storages::redis::ClientSideCache::kInvalidationChannel},
+            [cache = cache_it->second](const std::string&, const std::string& key) { cache->Invalidate(key); },
+            storages::redis::CommandControl{}
+        ));
+    }
 }
 
 Redis::~Redis() {
     statistics_holder_.Unregister();
     subscribe_statistics_holder_.Unregister();
+    invalidation_subscriptions_.clear();
     config_subscription_.Unsubscribe();
 }
 
@@ -275,6 +320,9 @@ void Redis::WriteStatistics(utils::statistics::Writer& writer) {
     for (const auto& [name, redis] : sentinels_) {
         writer.ValueWithLabels(redis->GetStatistics(*settings), {"redis_database", name});
     }
+    for (const auto& [name, cache] : client_side_caches_) {
+        writer["client_side_cache"].ValueWithLabels(*cache, {"redis_database", name});
+    }
     auto threads_writer = writer["ev_threads"]["cpu_load_percent"];
     threads_writer.ValueWithLabels(*thread_pools_->GetRedisThreadPool(), {});
     threads_writer.ValueWithLabels(thread_pools_->GetSentinelThreadPool(), {});
@@ -386,6 +434,31 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                client_side_cache:
+                    type: object
+                    description: |
+                        settings of the client side cache of GET and HGET replies, used by the commands
+                        with CommandControl::client_side_caching
+                    additionalProperties: false
+                    properties:
+                        max_keys:
+                            type: integer
+                            description: maximum number of the cached keys
+                            defaultDescription: 10000
+                            minimum: 1
+                        max_entry_size:
+                            type: integer
+                            description: values of the keys that take more bytes are not cached
+                            defaultDescription: 4096
+                        ttl:
+                            type: string
+                            description: maximum staleness of the cached values
+                            defaultDescription: 10s
+                        invalidation_subscribe_group:
+                            type: string
+                            description: |
+                                name of the subscribe group with the client tracking enabled, the cache is
+                                invalidated by the messages of its `__redis__:invalidate` channel
     metrics_level:
         type: string
         description: set metrics detail level
@@ -420,6 +493,24 @@ properties:
                     type: boolean
                     description: allows subscriptions to master instance to distribute load
                     defaultDescription: false
+                client_tracking:
+                    type: object
+                    description: |
+                        `CLIENT TRACKING` in the broadcasting mode on the subscriber connections,
+                        not supported for RedisCluster
+                    additionalProperties: false
+                    properties:
+                        enabled:
+                            type: boolean
+                            description: enables the client tracking
+                            defaultDescription: false
+                        prefixes:
+                            type: array
+                            description: prefixes of the tracked keys, all the keys are tracked if empty
+                            defaultDescription: '[]'
+                            items:
+                                type: string
+                                description: prefix of the keys
 )");
 }
 
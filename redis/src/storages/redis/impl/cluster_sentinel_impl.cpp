@@ -4,7 +4,6 @@
 
 #include <fmt/format.h>
 #include <boost/container_hash/hash.hpp>
-#include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/logging/log.hpp>
@@ -21,6 +20,7 @@
 #include <engine/ev/watcher/async_watcher.hpp>
 #include <engine/ev/watcher/periodic_watcher.hpp>
 #include <storages/redis/impl/cluster_topology.hpp>
+#include <storages/redis/impl/keyshard.hpp>
 #include <storages/redis/impl/redis_connection_holder.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 #include <storages/redis/impl/standalone_topology_holder.hpp>
@@ -69,13 +69,6 @@ struct NodeAddressesHasher {
 using NodesAddressesSet = std::unordered_set<NodeAddresses, NodeAddressesHasher>;
 using HostPort = std::string;
 
-size_t HashSlot(const std::string& key) {
-    size_t start = 0;
-    size_t len = 0;
-    GetRedisKey(key, &start, &len);
-    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
-}
-
 std::string ParseMovedShard(const std::string& err_string) {
     static const auto kUnknownShard = std::string("");
     size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
@@ -9,6 +9,9 @@ namespace storages::redis::impl {
 
 void GetRedisKey(const std::string& key, size_t* key_start, size_t* key_len);
 
+/// Hash slot of the key in RedisCluster
+size_t HashSlot(const std::string& key);
+
 class KeyShard {
 public:
     virtual ~KeyShard() = default;
@@ -22,6 +25,8 @@ public:
     KeyShardFactory(const std::string& type) : type_(type) {}
     std::unique_ptr<KeyShard> operator()(size_t nshards);
     bool IsClusterStrategy() const;
+    /// Nodes of the RedisCluster are discovered via CLUSTER SLOTS, unlike the standalone node
+    bool IsRedisClusterStrategy() const;
 };
 
 }  // namespace storages::redis::impl
@@ -185,6 +185,8 @@ private:
     void Authenticate();
     void SelectDatabase();
     void SendReadOnly();
+    void EnableClientTracking();
+    void SendClientTracking(std::int64_t client_id);
     void FreeCommands();
 
     static void LogSocketErrorReply(const CommandPtr& command, const ReplyPtr& reply);
@@ -241,6 +243,7 @@ private:
     std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
     const bool send_readonly_;
     const ConnectionSecurity connection_security_;
+    const ClientTrackingSettings client_tracking_;
     std::chrono::milliseconds ping_interval_{2000};
     std::chrono::milliseconds ping_timeout_{4000};
     std::chrono::milliseconds info_replication_interval_{2000};
@@ -338,6 +341,7 @@ Redis::RedisImpl::RedisImpl(
       thread_pool_(thread_pool),
       send_readonly_(redis_settings.send_readonly),
       connection_security_(redis_settings.connection_security),
+      client_tracking_(redis_settings.client_tracking),
       server_id_(ServerId::Generate()),
       retry_budget_(utils::RetryBudgetSettings{100, 0.1, false}) {
     SetCommandsBufferingSettings(CommandsBufferingSettings{});
@@ -1006,14 +1010,14 @@ void Redis::RedisImpl::SelectDatabase() {
     // To get rid of the redundant `SELECT 0` command
     // since 0 is the default database index, and it will be set automatically
     if (database_index_ == 0) {
-        SetState(RedisState::kConnected);
+        EnableClientTracking();
         return;
     }
 
     ProcessCommand(PrepareCommand(CmdArgs{"SELECT", database_index_}, [this](const CommandPtr&, ReplyPtr reply) {
         if (*reply && reply->data.IsStatus()) {
-            SetState(RedisState::kConnected);
             LOG_INFO() << log_extra_ << "Selected redis logical database with index " << database_index_;
+            EnableClientTracking();
             return;
         }
 
@@ -1038,6 +1042,61 @@ void Redis::RedisImpl::SelectDatabase() {
     }));
 }
 
+void Redis::RedisImpl::EnableClientTracking() {
+    if (!client_tracking_.enabled) {
+        SetState(RedisState::kConnected);
+        return;
+    }
+
+    // Invalidation messages are redirected to the connection itself, so they are received once it subscribes to the
+    // `__redis__:invalidate` channel
+    ProcessCommand(PrepareCommand(CmdArgs{"CLIENT", "ID"}, [this](const CommandPtr&, ReplyPtr reply) {
+        if (*reply && reply->data.IsInt()) {
+            SendClientTracking(reply->data.GetInt());
+            return;
+        }
+
+        if (*reply) {
+            LOG_LIMITED_ERROR() << log_extra_ << "CLIENT ID failed: response type=" << reply->data.GetTypeString()
+                                << " msg=" << reply->data.ToDebugString();
+        } else {
+            LOG_LIMITED_ERROR() << "CLIENT ID failed with status " << reply->status << " ("
+                                << reply->GetStatusString() << ") " << log_extra_;
+        }
+        Disconnect();
+    }));
+}
+
+void Redis::RedisImpl::SendClientTracking(std::int64_t client_id) {
+    std::vector<std::string> prefixes;
+    prefixes.reserve(client_tracking_.prefixes.size() * 2);
+    for (const auto& prefix : client_tracking_.prefixes) {
+        prefixes.emplace_back("PREFIX");
+        prefixes.push_back(prefix);
+    }
+
+    ProcessCommand(PrepareCommand(
+        CmdArgs{"CLIENT", "TRACKING", "ON", "REDIRECT", client_id, "BCAST", std::move(prefixes)},
+        [this](const CommandPtr&, ReplyPtr reply) {
+            if (*reply && reply->data.IsStatus()) {
+                LOG_INFO() << log_extra_ << "Enabled client tracking";
+                SetState(RedisState::kConnected);
+                return;
+            }
+
+            if (*reply) {
+                LOG_LIMITED_ERROR() << log_extra_
+                                    << "CLIENT TRACKING failed: response type=" << reply->data.GetTypeString()
+                                    << " msg=" << reply->data.ToDebugString();
+            } else {
+                LOG_LIMITED_ERROR() << "CLIENT TRACKING failed with status " << reply->status << " ("
+                                    << reply->GetStatusString() << ") " << log_extra_;
+            }
+            Disconnect();
+        }
+    ));
+}
+
 void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r, void* privdata) noexcept {
     auto* impl = static_cast<Redis::RedisImpl*>(c->data);
     UASSERT(impl != nullptr);
@@ -19,7 +19,7 @@ class RedisConnectionHolder final : public std::enable_shared_from_this<RedisCon
     class EmplaceEnabler;
 
 public:
-    static constexpr redis::RedisCreationSettings makeDefaultRedisCreationSettings() {
+    static redis::RedisCreationSettings makeDefaultRedisCreationSettings() {
         /// Here we allow read from replicas possibly stale data.
         /// This does not affect connections to masters
         return redis::RedisCreationSettings{ConnectionSecurity::kNone, true};
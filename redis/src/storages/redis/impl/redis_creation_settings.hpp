@@ -11,6 +11,7 @@ namespace storages::redis {
 struct RedisCreationSettings {
     ConnectionSecurity connection_security = ConnectionSecurity::kNone;
     bool send_readonly{false};
+    ClientTrackingSettings client_tracking{};
 };
 
 }  // namespace storages::redis
@@ -51,7 +51,18 @@ void OnSubscribeImpl(
     } else if (!strcasecmp(reply_array[0].GetString().c_str(), unsubscribe_type.data())) {
         unsubscribe_callback(reply->server_id, reply_array[1].GetString(), reply_array[2].GetInt());
     } else if (!strcasecmp(reply_array[0].GetString().c_str(), message_type.data())) {
-        message_callback(reply->server_id, reply_array[1].GetString(), reply_array[2].GetString());
+        const auto& message = reply_array[2];
+        if (message.IsArray()) {
+            // Invalidation messages of the client tracking carry an array of keys, each key is delivered separately
+            for (const auto& key : message.GetArray()) {
+                if (key.IsString()) message_callback(reply->server_id, reply_array[1].GetString(), key.GetString());
+            }
+        } else if (message.IsNil()) {
+            // Invalidation of all the keys (FLUSHALL) is delivered as an empty message
+            message_callback(reply->server_id, reply_array[1].GetString(), {});
+        } else {
+            message_callback(reply->server_id, reply_array[1].GetString(), message.GetString());
+        }
     }
 }
 
@@ -69,13 +80,15 @@ Sentinel::Sentinel(
     KeyShardFactory key_shard_factory,
     CommandControl command_control,
     const testsuite::RedisControl& testsuite_redis_control,
-    std::size_t database_index
+    std::size_t database_index,
+    ClientTrackingSettings client_tracking
 )
     : shard_group_name_(shard_group_name),
       thread_pools_(thread_pools),
       secdist_default_command_control_(command_control),
       testsuite_redis_control_(testsuite_redis_control),
-      is_in_cluster_mode_(key_shard_factory.IsClusterStrategy()) {
+      is_in_cluster_mode_(key_shard_factory.IsClusterStrategy()),
+      has_hash_slots_(key_shard_factory.IsRedisClusterStrategy()) {
     config_default_command_control_.Set(std::make_shared<CommandControl>(secdist_default_command_control_));
 
     if (!thread_pools_) {
@@ -88,14 +101,22 @@ Sentinel::Sentinel(
         !key_shard_factory.IsClusterStrategy() || database_index == 0,
         "Database index other than 0 now supported in cluster and standalone modes"
     );
+    UINVARIANT(
+        !key_shard_factory.IsRedisClusterStrategy() || !client_tracking.enabled,
+        "Client tracking is not supported in cluster mode"
+    );
     sentinel_thread_control_->RunInEvLoopBlocking([&]() {
         if (IsInClusterMode()) {
+            // In the standalone mode the connection is made to the node itself
+            auto node_conns = conns;
+            for (auto& conn : node_conns) conn.client_tracking = client_tracking;
+
             impl_ = std::make_unique<ClusterSentinelImpl>(
                 *sentinel_thread_control_,
                 thread_pools_->GetRedisThreadPool(),
                 *this,
                 shards,
-                conns,
+                node_conns,
                 std::move(shard_group_name),
                 client_name,
                 password,
@@ -116,7 +137,8 @@ Sentinel::Sentinel(
                 connection_security,
                 key_shard_factory(shards.size()),
                 dynamic_config_source,
-                database_index
+                database_index,
+                std::move(client_tracking)
             );
         }
     });
@@ -277,6 +299,10 @@ std::string Sentinel::CreateTmpKey(const std::string& key, std::string prefix) {
 
 size_t Sentinel::ShardByKey(const std::string& key) const { return impl_->ShardByKey(key); }
 
+size_t Sentinel::KeysGroupByKey(const std::string& key) const {
+    return has_hash_slots_ ? HashSlot(key) : ShardByKey(key);
+}
+
 size_t Sentinel::ShardsCount() const { return impl_->ShardsCount(); }
 
 void Sentinel::CheckShardIdx(size_t shard_idx) const { CheckShardIdx(shard_idx, ShardsCount()); }
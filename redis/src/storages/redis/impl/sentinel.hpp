@@ -70,7 +70,8 @@ public:
         KeyShardFactory key_shard_factory,
         CommandControl command_control,
         const testsuite::RedisControl& testsuite_redis_control,
-        std::size_t database_index
+        std::size_t database_index,
+        ClientTrackingSettings client_tracking = {}
     );
     virtual ~Sentinel();
 
@@ -110,6 +111,9 @@ public:
     static std::string CreateTmpKey(const std::string& key, std::string prefix = "tmp:");
 
     size_t ShardByKey(const std::string& key) const;
+    // Keys of a group may be used together in a multi-key command: the keys of
+    // a hash slot in RedisCluster, the keys of a shard otherwise
+    size_t KeysGroupByKey(const std::string& key) const;
     size_t ShardsCount() const;
     bool IsInClusterMode() const noexcept { return is_in_cluster_mode_; }
     void CheckShardIdx(size_t shard_idx) const;
@@ -208,6 +212,7 @@ private:
     utils::SwappingSmart<CommandControl> config_default_command_control_;
     testsuite::RedisControl testsuite_redis_control_;
     const bool is_in_cluster_mode_;
+    const bool has_hash_slots_;
 };
 
 }  // namespace storages::redis::impl
@@ -68,7 +68,8 @@ SentinelImpl::SentinelImpl(
     ConnectionSecurity connection_security,
     std::unique_ptr<KeyShard>&& key_shard,
     dynamic_config::Source dynamic_config_source,
-    std::size_t database_index
+    std::size_t database_index,
+    ClientTrackingSettings client_tracking
 )
     : sentinel_obj_(sentinel),
       ev_thread_(sentinel_thread_control),
@@ -81,7 +82,8 @@ SentinelImpl::SentinelImpl(
       check_interval_(ToEvDuration(kSentinelGetHostsCheckInterval)),
       key_shard_(std::move(key_shard)),
       dynamic_config_source_(dynamic_config_source),
-      database_index_(database_index) {
+      database_index_(database_index),
+      client_tracking_(std::move(client_tracking)) {
     // https://github.com/boostorg/signals2/issues/59
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
     UASSERT_MSG(key_shard_, "key_shard should be provided");
@@ -481,6 +483,7 @@ void SentinelImpl::ReadSentinels() {
                 if (shards_.find(shard_conn.Name()) != shards_.end()) {
                     shard_conn.SetConnectionSecurity(connection_security_);
                     shard_conn.SetDatabaseIndex(database_index_);
+                    shard_conn.SetClientTracking(client_tracking_);
                     shard_found[shards_[shard_conn.Name()]] = true;
                     watcher->host_port_to_shard[shard_conn.HostPort()] = shards_[shard_conn.Name()];
                     watcher->masters.push_back(std::move(shard_conn));
@@ -516,6 +519,7 @@ void SentinelImpl::ReadSentinels() {
                             shard_conn.SetReadOnly(true);
                             shard_conn.SetConnectionSecurity(connection_security_);
                             shard_conn.SetDatabaseIndex(database_index_);
+                            shard_conn.SetClientTracking(client_tracking_);
                             if (shards_.find(shard_conn.Name()) != shards_.end())
                                 watcher->host_port_to_shard[shard_conn.HostPort()] = shards_[shard_conn.Name()];
                             watcher->slaves.push_back(std::move(shard_conn));
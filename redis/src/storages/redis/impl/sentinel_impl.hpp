@@ -103,7 +103,8 @@ public:
         ConnectionSecurity connection_security,
         std::unique_ptr<KeyShard>&& key_shard,
         dynamic_config::Source dynamic_config_source,
-        std::size_t database_index
+        std::size_t database_index,
+        ClientTrackingSettings client_tracking
     );
     ~SentinelImpl() override;
 
@@ -220,6 +221,7 @@ private:
     dynamic_config::Source dynamic_config_source_;
     std::atomic<int> publish_shard_{0};
     const std::size_t database_index_{0};
+    const ClientTrackingSettings client_tracking_;
 };
 
 }  // namespace storages::redis::impl
@@ -43,6 +43,12 @@ void ConnectionInfoInt::SetConnectionSecurity(ConnectionSecurity value) { conn_i
 
 ConnectionSecurity ConnectionInfoInt::GetConnectionSecurity() const { return conn_info_.connection_security; }
 
+void ConnectionInfoInt::SetClientTracking(ClientTrackingSettings value) {
+    conn_info_.client_tracking = std::move(value);
+}
+
+const ClientTrackingSettings& ConnectionInfoInt::GetClientTracking() const { return conn_info_.client_tracking; }
+
 const std::string& ConnectionInfoInt::Fulltext() const { return fulltext_; }
 
 void ConnectionInfoInt::Connect(Redis& instance) const {
@@ -273,7 +279,8 @@ bool Shard::ProcessCreation(const std::shared_ptr<engine::ev::ThreadPool>& redis
     // https://github.com/boostorg/signals2/issues/59
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
     for (const auto& id : need_to_create) {
-        const auto redis_settings = RedisCreationSettings{id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly()};
+        const auto redis_settings = RedisCreationSettings{
+            id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly(), id.GetClientTracking()};
         ConnectionStatus entry{
             id,
             std::make_shared<Redis>(
@@ -37,6 +37,9 @@ public:
     void SetConnectionSecurity(ConnectionSecurity value);
     ConnectionSecurity GetConnectionSecurity() const;
 
+    void SetClientTracking(ClientTrackingSettings value);
+    const ClientTrackingSettings& GetClientTracking() const;
+
     const std::string& Fulltext() const;
 
     void Connect(Redis&) const;
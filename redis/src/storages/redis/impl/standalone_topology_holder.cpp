@@ -161,7 +161,7 @@ std::shared_ptr<RedisConnectionHolder> StandaloneTopologyHolder::CreateRedisInst
         buffering_settings_ptr->value_or(CommandsBufferingSettings{}),
         *replication_monitoring_settings_ptr,
         *retry_budget_settings_ptr,
-        redis::RedisCreationSettings{info.GetConnectionSecurity(), false}
+        redis::RedisCreationSettings{info.GetConnectionSecurity(), false, info.GetClientTracking()}
     );
 }
 
@@ -47,7 +47,8 @@ SubscribeSentinel::SubscribeSentinel(
     KeyShardFactory key_shard_factory,
     bool is_cluster_mode,
     CommandControl command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    ClientTrackingSettings client_tracking
 )
     : Sentinel(
           thread_pools,
@@ -61,8 +62,8 @@ SubscribeSentinel::SubscribeSentinel(
           std::move(key_shard_factory),
           command_control,
           testsuite_redis_control,
-          kSubscriptionDatabaseIndex
-
+          kSubscriptionDatabaseIndex,
+          std::move(client_tracking)
       ),
       storage_(CreateSubscriptionStorage(thread_pools, shards, is_cluster_mode)) {
     InitStorage();
@@ -81,7 +82,8 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
     const std::string& client_name,
     std::string sharding_strategy,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    ClientTrackingSettings client_tracking
 ) {
     const auto& password = settings.password;
     const auto& sentinel_password = settings.sentinel_password;
@@ -126,7 +128,8 @@ std::shared_ptr<SubscribeSentinel> SubscribeSentinel::Create(
         std::move(keysShardFactory),
         is_cluster_mode,
         command_control,
-        testsuite_redis_control
+        testsuite_redis_control,
+        std::move(client_tracking)
     );
     subscribe_sentinel->Start();
     return subscribe_sentinel;
@@ -27,7 +27,8 @@ public:
         KeyShardFactory key_shard_factory,
         bool is_cluster_mode,
         CommandControl command_control,
-        const testsuite::RedisControl& testsuite_redis_control
+        const testsuite::RedisControl& testsuite_redis_control,
+        ClientTrackingSettings client_tracking = {}
     );
     ~SubscribeSentinel() override;
 
@@ -39,7 +40,8 @@ public:
         const std::string& client_name,
         std::string sharding_strategy,
         const CommandControl& command_control,
-        const testsuite::RedisControl& testsuite_redis_control
+        const testsuite::RedisControl& testsuite_redis_control,
+        ClientTrackingSettings client_tracking = {}
     );
 
     SubscriptionToken Subscribe(
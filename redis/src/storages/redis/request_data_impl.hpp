@@ -1,13 +1,17 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <storages/redis/impl/request.hpp>
 #include <userver/storages/redis/base.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/exception.hpp>
 #include <userver/storages/redis/parse_reply.hpp>
 #include <userver/storages/redis/request_data_base.hpp>
 
@@ -66,12 +70,47 @@ private:
     impl::Request request_;
 };
 
+template <typename Result, typename ReplyType>
+class CachingRequestDataImpl final : public RequestDataBase<ReplyType> {
+public:
+    using OnReply = std::function<void(const ReplyType&)>;
+
+    CachingRequestDataImpl(impl::Request&& request, OnReply on_reply)
+        : request_(std::move(request)), on_reply_(std::move(on_reply)) {}
+
+    void Wait() override { impl::Wait(request_); }
+
+    ReplyType Get(const std::string& request_description) override {
+        auto result = impl::ParseReply<Result, ReplyType>(request_.Get(), request_description);
+        on_reply_(result);
+        return result;
+    }
+
+    ReplyPtr GetRaw() override { return request_.Get(); }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+        return request_.TryGetContextAccessor();
+    }
+
+private:
+    impl::Request request_;
+    OnReply on_reply_;
+};
+
+/// Combines the replies of a command that was split into several requests:
+/// the counters are summed up, the arrays are merged back into the order of
+/// the arguments of the command
 template <typename Result, typename ReplyType>
 class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
     using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
 
 public:
-    explicit AggregateRequestDataImpl(std::vector<RequestDataPtr>&& requests) : requests_(std::move(requests)) {}
+    /// positions[i][j] is the position of the j-th element of the reply of the
+    /// i-th request in the aggregated reply
+    AggregateRequestDataImpl(std::vector<RequestDataPtr>&& requests, std::vector<std::vector<size_t>>&& positions)
+        : requests_(std::move(requests)), positions_(std::move(positions)) {
+        UASSERT(requests_.size() == positions_.size());
+    }
 
     void Wait() override {
         for (auto& request : requests_) {
@@ -80,12 +119,35 @@ public:
     }
 
     ReplyType Get(const std::string& request_description) override {
-        std::vector<typename ReplyType::value_type> result;
-        for (auto& request : requests_) {
-            auto data = request->Get(request_description);
-            std::move(data.begin(), data.end(), std::back_inserter(result));
+        if constexpr (std::is_void_v<ReplyType>) {
+            for (auto& request : requests_) {
+                request->Get(request_description);
+            }
+        } else if constexpr (std::is_arithmetic_v<ReplyType>) {
+            ReplyType result{};
+            for (auto& request : requests_) {
+                result += request->Get(request_description);
+            }
+            return result;
+        } else {
+            size_t size = 0;
+            for (const auto& positions : positions_) size += positions.size();
+
+            ReplyType result(size);
+            for (size_t i = 0; i < requests_.size(); ++i) {
+                auto data = requests_[i]->Get(request_description);
+                if (data.size() != positions_[i].size()) {
+                    throw ParseReplyException(
+                        "Unexpected size of the reply of " + request_description + ": " + std::to_string(data.size()) +
+                        " instead of " + std::to_string(positions_[i].size())
+                    );
+                }
+                for (size_t j = 0; j < data.size(); ++j) {
+                    result[positions_[i][j]] = std::move(data[j]);
+                }
+            }
+            return result;
         }
-        return result;
     }
 
     ReplyPtr GetRaw() override {
@@ -100,6 +162,7 @@ public:
 
 private:
     std::vector<RequestDataPtr> requests_;
+    std::vector<std::vector<size_t>> positions_;
 };
 
 template <typename Result, typename ReplyType>
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <storages/redis/impl/request.hpp>
 
@@ -17,8 +18,17 @@ Request CreateRequest(impl::Request&& request) {
     );
 }
 
+/// The callback is called with the parsed reply when the result is retrieved
+template <typename Request, typename OnReply>
+Request CreateCachingRequest(impl::Request&& request, OnReply&& on_reply) {
+    return Request(std::make_unique<CachingRequestDataImpl<typename Request::Result, typename Request::Reply>>(
+        std::move(request), std::forward<OnReply>(on_reply)
+    ));
+}
+
+/// See AggregateRequestDataImpl for the meaning of the positions
 template <typename Request>
-Request CreateAggregateRequest(std::vector<impl::Request>&& requests) {
+Request CreateAggregateRequest(std::vector<impl::Request>&& requests, std::vector<std::vector<size_t>>&& positions) {
     using ThisRequestDataImpl = RequestDataImpl<typename Request::Result, typename Request::Reply>;
     using ThisAggregateRequestDataImpl = AggregateRequestDataImpl<typename Request::Result, typename Request::Reply>;
 
@@ -27,7 +37,7 @@ Request CreateAggregateRequest(std::vector<impl::Request>&& requests) {
     for (auto& request : requests) {
         req_data.push_back(std::make_unique<ThisRequestDataImpl>(std::move(request)));
     }
-    return Request(std::make_unique<ThisAggregateRequestDataImpl>(std::move(req_data)));
+    return Request(std::make_unique<ThisAggregateRequestDataImpl>(std::move(req_data), std::move(positions)));
 }
 
 template <typename Request>
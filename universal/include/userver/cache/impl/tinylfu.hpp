@@ -0,0 +1,459 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/unordered_set.hpp>
+
+#include <userver/cache/impl/lru.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/filter_bloom.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+enum class TinyLfuSegment : std::uint8_t {
+    kWindow,
+    kProbation,
+    kProtected,
+};
+
+template <typename U>
+struct TinyLfuEntry final {
+    template <typename... Args>
+    explicit TinyLfuEntry(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...) {}
+
+    U value;
+    TinyLfuSegment segment{TinyLfuSegment::kWindow};
+};
+
+/// W-TinyLFU cache: new items get into a small LRU window, items evicted from
+/// the window compete for a place in the main segmented LRU (probation and
+/// protected parts) by their estimated access frequency. All the items share
+/// a single hash map, moving between the parts only relinks the lists.
+///
+/// See "TinyLFU: A Highly Efficient Cache Admission Policy" by G. Einziger,
+/// R. Friedman and B. Manes.
+template <
+    typename T,
+    typename U,
+    typename Hash = std::hash<StringToStringView<T>>,
+    typename Equal = std::equal_to<StringToStringView<T>>>
+class TinyLfuBase final {
+public:
+    /// The effective capacity is at least 3: each part holds at least one item
+    explicit TinyLfuBase(std::size_t max_size, const Hash& hash, const Equal& equal);
+    ~TinyLfuBase() { Clear(); }
+
+    TinyLfuBase(TinyLfuBase&& other) noexcept;
+    TinyLfuBase& operator=(TinyLfuBase&& other) noexcept;
+
+    TinyLfuBase(const TinyLfuBase&) = delete;
+    TinyLfuBase& operator=(const TinyLfuBase&) = delete;
+
+    bool Put(const T& key, U value);
+
+    template <typename... Args>
+    U* Emplace(const T& key, Args&&... args);
+
+    void Erase(const T& key);
+
+    U* Get(const T& key) { return GetImpl(key); }
+
+    template <class Key>
+    U* GetTransparent(const Key& key) {
+        static_assert(std::is_same_v<T, std::string>, "Only std::string as T supported for transparent comparisons");
+        return GetImpl(std::string_view{key});
+    }
+
+    U* GetLeastUsedValue();
+
+    void SetMaxSize(std::size_t new_max_size);
+
+    void Clear() noexcept;
+
+    template <typename Function>
+    void VisitAll(Function&& func) const;
+
+    template <typename Function>
+    void VisitAll(Function&& func);
+
+    std::size_t GetSize() const;
+
+    std::size_t GetCapacity() const;
+
+    /// Estimated access frequency of the key, for tests
+    std::size_t GetFrequency(const T& key) const { return sketch_->Estimate(key); }
+
+private:
+    using Entry = TinyLfuEntry<U>;
+    using Node = LruNode<T, Entry>;
+    using List = boost::intrusive::list<Node, boost::intrusive::constant_time_size<true>>;
+
+    struct NodeHash : Hash {
+        NodeHash(const Hash& h) : Hash{h} {}
+
+        template <class NodeOrKey>
+        auto operator()(const NodeOrKey& x) const {
+            return Hash::operator()(impl::GetKey(x));
+        }
+    };
+
+    struct NodeEqual : Equal {
+        NodeEqual(const Equal& eq) : Equal{eq} {}
+
+        template <class NodeOrKey1, class NodeOrKey2>
+        auto operator()(const NodeOrKey1& x, const NodeOrKey2& y) const {
+            return Equal::operator()(impl::GetKey(x), impl::GetKey(y));
+        }
+    };
+
+    using Map = boost::intrusive::unordered_set<
+        Node,
+        boost::intrusive::constant_time_size<true>,
+        boost::intrusive::hash<NodeHash>,
+        boost::intrusive::equal<NodeEqual>>;
+
+    using BucketTraits = typename Map::bucket_traits;
+    using BucketType = typename Map::bucket_type;
+
+    // Transparent hashing of std::string keys is used if the Hash supports it
+    using SketchKey = std::conditional_t<
+        std::is_invocable_v<const Hash&, const StringToStringView<T>&>,
+        StringToStringView<T>,
+        T>;
+
+    // Two independent hashes for the sketch derived from the user provided one,
+    // that may be an identity function, e.g. std::hash<int>
+    template <std::uint64_t Salt>
+    struct SketchHashImpl : Hash {
+        explicit SketchHashImpl(const Hash& hash) : Hash{hash} {}
+
+        std::size_t operator()(const SketchKey& key) const {
+            std::size_t seed = Hash::operator()(key);
+            boost::hash_combine(seed, Salt);
+            return seed;
+        }
+    };
+
+    using SketchHash = SketchHashImpl<0>;
+    using SketchRehash = SketchHashImpl<0x9e3779b97f4a7c15>;
+
+    using Sketch = utils::FilterBloom<SketchKey, std::uint8_t, SketchHash, SketchRehash>;
+
+    static constexpr std::size_t kWindowPercent = 1;
+    static constexpr std::size_t kProtectedPercent = 80;
+    static constexpr std::size_t kSampleSizeFactor = 10;
+    static constexpr std::size_t kSketchCountersFactor = 8;
+
+    template <class Key>
+    U* GetImpl(const Key& key);
+
+    template <class Key>
+    void RecordAccess(const Key& key);
+
+    List& GetList(TinyLfuSegment segment) noexcept;
+    void MoveTo(Node& node, TinyLfuSegment segment) noexcept;
+    void OnHit(Node& node) noexcept;
+
+    U& Add(const T& key, U value);
+    U& Insert(std::unique_ptr<Node> node) noexcept;
+
+    // Moves the least recently used item of the full window into the main part,
+    // if the main part overflows evicts either the moved item or the least
+    // recently used item of the probation part, whichever is less frequent.
+    // Returns the evicted node.
+    std::unique_ptr<Node> MakeRoom();
+
+    std::unique_ptr<Node> Extract(Node& node) noexcept;
+
+    Hash hash_;
+    std::vector<BucketType> buckets_;
+    Map map_;
+    List window_;
+    List probation_;
+    List protected_;
+
+    std::size_t window_capacity_{0};
+    std::size_t protected_capacity_{0};
+    std::size_t main_capacity_{0};
+
+    std::unique_ptr<Sketch> sketch_;
+    std::size_t samples_{0};
+    std::size_t sample_size_{0};
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+TinyLfuBase<T, U, Hash, Equal>::TinyLfuBase(std::size_t max_size, const Hash& hash, const Equal& equal)
+    : hash_(hash), buckets_(1), map_(BucketTraits(buckets_.data(), buckets_.size()), hash, equal) {
+    UASSERT(max_size > 0);
+    SetMaxSize(max_size);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+TinyLfuBase<T, U, Hash, Equal>::TinyLfuBase(TinyLfuBase&& other) noexcept
+    : hash_(std::move(other.hash_)),
+      buckets_(std::move(other.buckets_)),
+      map_(std::move(other.map_)),
+      window_(std::move(other.window_)),
+      probation_(std::move(other.probation_)),
+      protected_(std::move(other.protected_)),
+      window_capacity_(other.window_capacity_),
+      protected_capacity_(other.protected_capacity_),
+      main_capacity_(other.main_capacity_),
+      sketch_(std::move(other.sketch_)),
+      samples_(other.samples_),
+      sample_size_(other.sample_size_) {
+    other.buckets_.clear();
+    other.map_.clear();
+    other.window_.clear();
+    other.probation_.clear();
+    other.protected_.clear();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+TinyLfuBase<T, U, Hash, Equal>& TinyLfuBase<T, U, Hash, Equal>::operator=(TinyLfuBase&& other) noexcept {
+    if (this != &other) Clear();
+
+    using std::swap;
+    swap(hash_, other.hash_);
+    swap(buckets_, other.buckets_);
+    swap(map_, other.map_);
+    swap(window_, other.window_);
+    swap(probation_, other.probation_);
+    swap(protected_, other.protected_);
+    swap(window_capacity_, other.window_capacity_);
+    swap(protected_capacity_, other.protected_capacity_);
+    swap(main_capacity_, other.main_capacity_);
+    swap(sketch_, other.sketch_);
+    swap(samples_, other.samples_);
+    swap(sample_size_, other.sample_size_);
+
+    return *this;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool TinyLfuBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+    auto* existing = GetImpl(key);
+    if (existing) {
+        *existing = std::move(value);
+        return false;
+    }
+
+    Add(key, std::move(value));
+    return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename... Args>
+U* TinyLfuBase<T, U, Hash, Equal>::Emplace(const T& key, Args&&... args) {
+    auto* existing = GetImpl(key);
+    if (existing) return existing;
+
+    if constexpr (std::is_move_assignable_v<U>) {
+        return &Add(key, U{std::forward<Args>(args)...});
+    } else {
+        auto node = std::make_unique<Node>(T{key}, std::in_place, std::forward<Args>(args)...);
+        MakeRoom();
+        return &Insert(std::move(node));
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Erase(const T& key) {
+    auto it = map_.find(key, map_.hash_function(), map_.key_eq());
+    if (it == map_.end()) return;
+    Extract(*it);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::GetLeastUsedValue() {
+    for (auto* list : {&probation_, &window_, &protected_}) {
+        if (!list->empty()) return &list->front().GetValue().value;
+    }
+    return nullptr;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+    UASSERT(new_max_size > 0);
+    const auto window_size = std::max<std::size_t>(1, new_max_size * kWindowPercent / 100);
+    const auto main_size = std::max<std::size_t>(2, new_max_size - std::min(new_max_size, window_size));
+    const auto protected_size = std::clamp<std::size_t>(main_size * kProtectedPercent / 100, 1, main_size - 1);
+    if (window_size + main_size == GetCapacity()) return;
+
+    window_capacity_ = window_size;
+    protected_capacity_ = protected_size;
+    main_capacity_ = main_size;
+
+    // Items that no longer fit into their parts get a second chance in the
+    // probation part
+    while (window_.size() > window_capacity_) MoveTo(window_.front(), TinyLfuSegment::kProbation);
+    while (protected_.size() > protected_capacity_) MoveTo(protected_.front(), TinyLfuSegment::kProbation);
+    while (probation_.size() + protected_.size() > main_capacity_) Extract(probation_.front());
+
+    std::vector<BucketType> new_buckets(GetCapacity());
+    map_.rehash(BucketTraits(new_buckets.data(), new_buckets.size()));
+    buckets_.swap(new_buckets);
+
+    sample_size_ = kSampleSizeFactor * GetCapacity();
+    sketch_ = std::make_unique<Sketch>(kSketchCountersFactor * GetCapacity(), SketchHash{hash_}, SketchRehash{hash_});
+    samples_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Clear() noexcept {
+    map_.clear();
+    for (auto* list : {&window_, &probation_, &protected_}) {
+        list->clear_and_dispose([](Node* node) { delete node; });
+    }
+    if (sketch_) sketch_->Clear();
+    samples_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+    for (const auto& node : map_) {
+        func(node.GetKey(), node.GetValue().value);
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) {
+    for (auto& node : map_) {
+        func(node.GetKey(), node.GetValue().value);
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetSize() const {
+    return map_.size();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetCapacity() const {
+    return window_capacity_ + main_capacity_;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <class Key>
+U* TinyLfuBase<T, U, Hash, Equal>::GetImpl(const Key& key) {
+    RecordAccess(key);
+
+    auto it = map_.find(key, map_.hash_function(), map_.key_eq());
+    if (it == map_.end()) return nullptr;
+    OnHit(*it);
+    return &it->GetValue().value;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <class Key>
+void TinyLfuBase<T, U, Hash, Equal>::RecordAccess(const Key& key) {
+    sketch_->Increment(key);
+
+    if (++samples_ >= sample_size_) {
+        sketch_->Halve();
+        samples_ /= 2;
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+typename TinyLfuBase<T, U, Hash, Equal>::List& TinyLfuBase<T, U, Hash, Equal>::GetList(TinyLfuSegment segment
+) noexcept {
+    switch (segment) {
+        case TinyLfuSegment::kWindow:
+            return window_;
+        case TinyLfuSegment::kProbation:
+            return probation_;
+        case TinyLfuSegment::kProtected:
+            return protected_;
+    }
+    UASSERT(false);
+    return window_;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::MoveTo(Node& node, TinyLfuSegment segment) noexcept {
+    auto& from = GetList(node.GetValue().segment);
+    auto& to = GetList(segment);
+    to.splice(to.end(), from, from.iterator_to(node));
+    node.GetValue().segment = segment;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::OnHit(Node& node) noexcept {
+    if (node.GetValue().segment != TinyLfuSegment::kProbation) {
+        MoveTo(node, node.GetValue().segment);
+        return;
+    }
+
+    MoveTo(node, TinyLfuSegment::kProtected);
+    if (protected_.size() > protected_capacity_) {
+        MoveTo(protected_.front(), TinyLfuSegment::kProbation);
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U& TinyLfuBase<T, U, Hash, Equal>::Add(const T& key, U value) {
+    // Reuse the node of the evicted item, if any
+    auto node = MakeRoom();
+    if (!node) {
+        return Insert(std::make_unique<Node>(T{key}, std::in_place, std::move(value)));
+    }
+
+    node->SetKey(key);
+    node->GetValue().value = std::move(value);
+    return Insert(std::move(node));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U& TinyLfuBase<T, U, Hash, Equal>::Insert(std::unique_ptr<Node> node) noexcept {
+    UASSERT(node);
+
+    node->GetValue().segment = TinyLfuSegment::kWindow;
+    auto [it, ok] = map_.insert(*node);  // noexcept
+    UASSERT(ok);
+    window_.push_back(*node);  // noexcept
+
+    return node.release()->GetValue().value;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::unique_ptr<typename TinyLfuBase<T, U, Hash, Equal>::Node> TinyLfuBase<T, U, Hash, Equal>::MakeRoom() {
+    if (window_.size() < window_capacity_) return {};
+
+    auto& candidate = window_.front();
+    MoveTo(candidate, TinyLfuSegment::kProbation);
+    if (probation_.size() + protected_.size() <= main_capacity_) return {};
+
+    // The protected part is smaller than the main part, so the probation part
+    // holds something besides the candidate
+    auto& victim = probation_.front();
+    UASSERT(&victim != &candidate);
+    if (sketch_->Estimate(candidate.GetKey()) > sketch_->Estimate(victim.GetKey())) {
+        return Extract(victim);
+    }
+    return Extract(candidate);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::unique_ptr<typename TinyLfuBase<T, U, Hash, Equal>::Node> TinyLfuBase<T, U, Hash, Equal>::Extract(Node& node
+) noexcept {
+    auto& list = GetList(node.GetValue().segment);
+    list.erase(list.iterator_to(node));
+    map_.erase(map_.iterator_to(node));
+    return std::unique_ptr<Node>(&node);
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,11 @@
 /// @file userver/cache/lru_map.hpp
 /// @brief @copybrief cache::LruMap
 
+#include <type_traits>
+
 #include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/tinylfu.hpp>
+#include <userver/cache/policy.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,11 +18,15 @@ namespace cache {
 ///
 /// LRU key value storage (LRU cache), thread safety matches Standard Library
 /// thread safety
+///
+/// The eviction policy may be changed to cache::CachePolicy::kTinyLFU via the
+/// `Policy` template parameter.
 template <
     typename T,
     typename U,
     typename Hash = std::hash<impl::StringToStringView<T>>,
-    typename Equal = std::equal_to<impl::StringToStringView<T>>>
+    typename Equal = std::equal_to<impl::StringToStringView<T>>,
+    CachePolicy Policy = CachePolicy::kLRU>
 class LruMap final {
 public:
     explicit LruMap(size_t max_size, const Hash& hash = Hash(), const Equal& equal = Equal())
@@ -93,7 +101,11 @@ public:
     std::size_t GetCapacity() const { return impl_.GetCapacity(); }
 
 private:
-    impl::LruBase<T, U, Hash, Equal> impl_;
+    std::conditional_t<
+        Policy == CachePolicy::kTinyLFU,
+        impl::TinyLfuBase<T, U, Hash, Equal>,
+        impl::LruBase<T, U, Hash, Equal>>
+        impl_;
 };
 
 }  // namespace cache
@@ -0,0 +1,30 @@
+#pragma once
+
+/// @file userver/cache/policy.hpp
+/// @brief @copybrief cache::CachePolicy
+
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Eviction policy of the in-memory caches
+enum class CachePolicy {
+    /// Evicts the least recently used item
+    kLRU,
+
+    /// W-TinyLFU: a small LRU window in front of a segmented LRU. An item
+    /// evicted from the window gets into the main part only if it is accessed
+    /// more frequently than the item that would be evicted instead. The
+    /// frequencies are estimated by an aging count-min sketch. Resists scans and
+    /// gives better hit rates than LRU for skewed (e.g. Zipfian) workloads.
+    kTinyLFU,
+};
+
+/// Number of the cache::CachePolicy values
+inline constexpr std::size_t kCachePoliciesCount = 2;
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -8,10 +10,41 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+/// Compression level that gives a reasonable speed/ratio tradeoff for
+/// compressing data on the fly
+inline constexpr int kDefaultCompressionLevel = 3;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a single zstd frame.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int compression_level = kDefaultCompressionLevel);
+
+/// @brief Compresses a sequence of chunks into a single zstd frame, every
+/// chunk is flushed so that the peer could decompress it without waiting for
+/// the next one.
+class StreamCompressor final {
+public:
+    explicit StreamCompressor(int compression_level = kDefaultCompressionLevel);
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// Compresses and flushes the chunk.
+    /// @throws CompressionError
+    std::string CompressChunk(std::string_view chunk);
+
+    /// Ends the frame, the compressor may not be used afterwards.
+    /// @throws CompressionError
+    std::string Finish();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
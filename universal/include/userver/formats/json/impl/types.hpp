@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 #include <type_traits>
 
 #include <userver/formats/common/type.hpp>
@@ -60,6 +61,11 @@ public:
     size_t Version() const;
     void BumpVersion();
 
+    /// Returns the member of the `object` from this tree or nullptr. Lookups in
+    /// large objects use a hash index that is built on the first lookup and is
+    /// shared by all the Values of the tree.
+    const impl::Value* FindMember(const impl::Value& object, std::string_view key) const;
+
 private:
     struct Data;
 
@@ -0,0 +1,140 @@
+#pragma once
+
+/// @file userver/formats/json/lazy_value.hpp
+/// @brief @copybrief formats::json::LazyValue
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+class LazyDocument;
+}  // namespace impl
+
+/// @ingroup userver_universal userver_formats
+///
+/// @brief Non-mutable JSON value that is parsed on demand.
+///
+/// The document is validated on construction in a single pass that does not
+/// build the DOM, it only remembers the positions of the objects and arrays.
+/// Navigation via operator[] skips the not interesting subtrees without
+/// parsing them, and only the values that are actually read via As() or
+/// Materialize() are converted to formats::json::Value.
+///
+/// Prefer formats::json::Value if most of the document is read anyway. Use
+/// LazyValue to read a few fields out of a large document, for example in
+/// server::handlers::HttpHandlerLazyJsonBase.
+///
+/// The document accepted by LazyValue is the same as for
+/// formats::json::FromString, including the depth limit and the rejection of
+/// duplicate keys.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/lazy_value_test.cpp  Sample formats::json::LazyValue usage
+///
+/// @note Paths in the exceptions thrown by the methods of the materialized
+/// Value are relative to the materialized value.
+class LazyValue final {
+public:
+    /// Creates a missing value
+    LazyValue() noexcept;
+
+    /// @brief Validates the document and indexes its structure
+    /// @throw ParseException if the document is not a valid JSON
+    explicit LazyValue(std::string doc);
+
+    LazyValue(const LazyValue&);
+    LazyValue(LazyValue&&) noexcept;
+    LazyValue& operator=(const LazyValue&);
+    LazyValue& operator=(LazyValue&&) noexcept;
+    ~LazyValue();
+
+    /// @brief Access member by key for read. Linear in the count of the members
+    /// of this object, the nested values are skipped without parsing.
+    /// @throw TypeMismatchException if not a missing value, an object or null.
+    LazyValue operator[](std::string_view key) const;
+
+    /// @brief Access array member by index for read.
+    /// @throw TypeMismatchException if not an array value.
+    /// @throw OutOfBoundsException if index is greater or equal than size.
+    LazyValue operator[](std::size_t index) const;
+
+    /// @brief Returns true if *this holds a `key`.
+    /// @throw TypeMismatchException if `*this` is not a map or null.
+    bool HasMember(std::string_view key) const;
+
+    /// @brief Returns the keys of the object in the document order.
+    /// @throw TypeMismatchException if not an object or null.
+    std::vector<std::string> GetMemberNames() const;
+
+    /// @brief Returns array size or object members count.
+    /// @throw TypeMismatchException if not an array or an object.
+    std::size_t GetSize() const;
+
+    bool IsMissing() const noexcept;
+    bool IsNull() const noexcept;
+    bool IsBool() const noexcept;
+    /// Returns true for any number, the same as formats::json::Value::IsDouble
+    bool IsDouble() const noexcept;
+    bool IsString() const noexcept;
+    bool IsArray() const noexcept;
+    bool IsObject() const noexcept;
+
+    /// @brief Returns full path to this value.
+    std::string GetPath() const;
+
+    /// @brief Returns the JSON text of the value as is in the document.
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    std::string_view GetRawJson() const;
+
+    /// @brief Parses the value and its subtree into formats::json::Value.
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    Value Materialize() const;
+
+    /// @brief Materializes the value and extracts it via
+    /// `Parse(const Value&, parse::To<T>)`
+    /// @throw MemberMissingException if `this->IsMissing()`
+    /// @throw Anything derived from std::exception.
+    template <typename T>
+    auto As() const {
+        return Materialize().As<T>();
+    }
+
+    /// @brief Returns value of *this converted to T or T(args) if
+    /// this->IsMissing() or this->IsNull().
+    template <typename T, typename First, typename... Rest>
+    auto As(First&& default_arg, Rest&&... more_default_args) const {
+        if (IsMissing() || IsNull()) {
+            // NOLINTNEXTLINE(google-readability-casting)
+            return decltype(As<T>())(std::forward<First>(default_arg), std::forward<Rest>(more_default_args)...);
+        }
+        return As<T>();
+    }
+
+private:
+    LazyValue(std::shared_ptr<const impl::LazyDocument> document, std::size_t begin, std::size_t end, std::string path);
+
+    void CheckNotMissing() const;
+    void CheckObjectOrNull() const;
+    char FirstChar() const noexcept;
+
+    std::shared_ptr<const impl::LazyDocument> document_;
+    // [begin_, end_) of the value text, begin_ == end_ for a missing value
+    std::size_t begin_{0};
+    std::size_t end_{0};
+    std::string path_;
+};
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
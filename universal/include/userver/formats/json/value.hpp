@@ -93,6 +93,9 @@ public:
     }
 
     /// @brief Access member by key for read.
+    ///
+    /// Lookups in large objects take O(1): a hash index of the object members
+    /// is built on the first access and is shared by all the copies of the Value.
     /// @throw TypeMismatchException if not a missing value, an object or null.
     Value operator[](std::string_view key) const;
     /// @brief Access array member by index for read.
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -45,7 +46,8 @@ public:
         UASSERT((std::is_same_v<std::invoke_result_t<Hash1, const T&>, std::invoke_result_t<Hash2, const T&>>));
     }
 
-    /// @brief Increments the smallest item counters
+    /// @brief Increments the smallest item counters, saturates at the max
+    /// value of the Counter
     void Increment(const T& item);
 
     /// @brief Returns the value of the smallest item counter
@@ -57,6 +59,9 @@ public:
     /// @brief Resets all counters
     void Clear();
 
+    /// @brief Divides all counters by two, ages the collected frequencies
+    void Halve();
+
 private:
     using HashedType = std::invoke_result_t<Hash1, const T&>;
 
@@ -106,11 +111,23 @@ template <typename T, typename Counter, typename Hash1, typename Hash2>
 void FilterBloom<T, Counter, Hash1, Hash2>::Increment(const T& item) {
     auto hash_value_1 = hasher_1_(item);
     auto hash_value_2 = hasher_2_(item);
-    Counter min_frequency = MinFrequency(hash_value_1, hash_value_2);
 
+    std::array<std::size_t, kHashFunctionsCount> indexes{};
+    std::optional<Counter> min_frequency;
     for (std::size_t step = 0; step < kHashFunctionsCount; ++step) {
-        auto& current_count = counters_[GetHash(hash_value_1, hash_value_2, Coefficient(step)) % counters_.size()];
-        if (current_count == min_frequency) {
+        indexes[step] = GetHash(hash_value_1, hash_value_2, Coefficient(step)) % counters_.size();
+        const auto current_count = counters_[indexes[step]];
+        if (!min_frequency.has_value() || min_frequency.value() > current_count) {
+            min_frequency = current_count;
+        }
+    }
+
+    // Saturate instead of wrapping around for small counters
+    if (min_frequency.value() == std::numeric_limits<Counter>::max()) return;
+
+    for (const auto index : indexes) {
+        auto& current_count = counters_[index];
+        if (current_count == min_frequency.value()) {
             current_count++;
         }
     }
@@ -135,6 +152,13 @@ void FilterBloom<T, Counter, Hash1, Hash2>::Clear() {
     }
 }
 
+template <typename T, typename Counter, typename Hash1, typename Hash2>
+void FilterBloom<T, Counter, Hash1, Hash2>::Halve() {
+    for (auto& counter : counters_) {
+        counter /= 2;
+    }
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
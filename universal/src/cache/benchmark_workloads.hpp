@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::bench {
+
+inline constexpr std::size_t kWorkloadKeysCount = 100'000;
+inline constexpr std::size_t kWorkloadRequestsCount = 100'000;
+
+// Keys in [0, keys_count) with the Zipfian distribution: the key `i` is
+// requested proportionally to 1 / (i + 1)^skew
+inline std::vector<unsigned> MakeZipfianWorkload(
+    std::size_t keys_count = kWorkloadKeysCount,
+    std::size_t requests_count = kWorkloadRequestsCount,
+    double skew = 0.99
+) {
+    std::vector<double> cdf(keys_count);
+    double sum = 0;
+    for (std::size_t i = 0; i < keys_count; ++i) {
+        sum += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+        cdf[i] = sum;
+    }
+
+    std::mt19937 engine{42};
+    std::uniform_real_distribution<double> distribution{0, sum};
+    std::vector<unsigned> workload;
+    workload.reserve(requests_count);
+    for (std::size_t i = 0; i < requests_count; ++i) {
+        const auto it = std::lower_bound(cdf.begin(), cdf.end(), distribution(engine));
+        workload.push_back(static_cast<unsigned>(std::min<std::size_t>(it - cdf.begin(), keys_count - 1)));
+    }
+    return workload;
+}
+
+// Zipfian workload interleaved with scans of keys that are requested only once,
+// e.g. a batch job walking over the whole keyspace
+inline std::vector<unsigned> MakeScanMixedWorkload(
+    std::size_t scan_length,
+    std::size_t scan_period,
+    std::size_t keys_count = kWorkloadKeysCount,
+    std::size_t requests_count = kWorkloadRequestsCount
+) {
+    const auto zipfian = MakeZipfianWorkload(keys_count, requests_count);
+    auto scan_key = static_cast<unsigned>(keys_count);
+
+    std::vector<unsigned> workload;
+    workload.reserve(requests_count + requests_count / scan_period * scan_length);
+    for (std::size_t i = 0; i < zipfian.size(); ++i) {
+        if (i % scan_period == 0) {
+            for (std::size_t j = 0; j < scan_length; ++j) {
+                workload.push_back(scan_key++);
+            }
+        }
+        workload.push_back(zipfian[i]);
+    }
+    return workload;
+}
+
+// Replays the workload as a read-through cache and reports the hit rate
+template <typename Cache>
+void ReplayWorkload(benchmark::State& state, Cache& cache, const std::vector<unsigned>& workload) {
+    std::size_t hits = 0;
+    std::size_t requests = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        for (const auto key : workload) {
+            if (cache.Get(key)) {
+                ++hits;
+            } else {
+                cache.Put(key, key);
+            }
+        }
+        requests += workload.size();
+    }
+    state.counters["hit_rate"] = static_cast<double>(hits) / static_cast<double>(requests ? requests : 1);
+    state.SetItemsProcessed(static_cast<std::int64_t>(requests));
+}
+
+}  // namespace cache::bench
+
+USERVER_NAMESPACE_END
@@ -1,7 +1,10 @@
 #include <benchmark/benchmark.h>
 
+#include <userver/cache/lru_map.hpp>
 #include <userver/cache/lru_set.hpp>
 
+#include <cache/benchmark_workloads.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -51,4 +54,22 @@ void LruPutOverflow(benchmark::State& state) {
 }
 BENCHMARK(LruPutOverflow);
 
+template <cache::CachePolicy Policy>
+void LruZipfian(benchmark::State& state) {
+    cache::LruMap<unsigned, unsigned, std::hash<unsigned>, std::equal_to<unsigned>, Policy> lru(kElementsCount);
+    cache::bench::ReplayWorkload(state, lru, cache::bench::MakeZipfianWorkload());
+}
+BENCHMARK_TEMPLATE(LruZipfian, cache::CachePolicy::kLRU);
+BENCHMARK_TEMPLATE(LruZipfian, cache::CachePolicy::kTinyLFU);
+
+template <cache::CachePolicy Policy>
+void LruScanMixed(benchmark::State& state) {
+    cache::LruMap<unsigned, unsigned, std::hash<unsigned>, std::equal_to<unsigned>, Policy> lru(kElementsCount);
+    cache::bench::ReplayWorkload(
+        state, lru, cache::bench::MakeScanMixedWorkload(state.range(0), 10 * kElementsCount)
+    );
+}
+BENCHMARK_TEMPLATE(LruScanMixed, cache::CachePolicy::kLRU)->Arg(kElementsCount)->Arg(10 * kElementsCount);
+BENCHMARK_TEMPLATE(LruScanMixed, cache::CachePolicy::kTinyLFU)->Arg(kElementsCount)->Arg(10 * kElementsCount);
+
 USERVER_NAMESPACE_END
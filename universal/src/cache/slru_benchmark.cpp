@@ -2,6 +2,8 @@
 
 #include <userver/cache/impl/slru.hpp>
 
+#include <cache/benchmark_workloads.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -81,4 +83,18 @@ void SlruPutOverflow(benchmark::State& state) {
 }
 BENCHMARK(SlruPutOverflow);
 
+void SlruZipfian(benchmark::State& state) {
+    Slru slru(kProbationPart, kProtectedPart);
+    cache::bench::ReplayWorkload(state, slru, cache::bench::MakeZipfianWorkload());
+}
+BENCHMARK(SlruZipfian);
+
+void SlruScanMixed(benchmark::State& state) {
+    Slru slru(kProbationPart, kProtectedPart);
+    cache::bench::ReplayWorkload(
+        state, slru, cache::bench::MakeScanMixedWorkload(state.range(0), 10 * kElementsCount)
+    );
+}
+BENCHMARK(SlruScanMixed)->Arg(kElementsCount)->Arg(10 * kElementsCount);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,126 @@
+#include <userver/cache/impl/tinylfu.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/cache/lru_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using TinyLfu = cache::impl::TinyLfuBase<std::size_t, std::size_t>;
+
+TinyLfu MakeCache(std::size_t size) { return TinyLfu{size, std::hash<std::size_t>{}, std::equal_to<std::size_t>{}}; }
+
+}  // namespace
+
+TEST(TinyLfuBase, PutGet) {
+    auto cache = MakeCache(100);
+    EXPECT_EQ(nullptr, cache.Get(1));
+
+    EXPECT_TRUE(cache.Put(1, 10));
+    EXPECT_FALSE(cache.Put(1, 11));
+    ASSERT_NE(nullptr, cache.Get(1));
+    EXPECT_EQ(11, *cache.Get(1));
+    EXPECT_EQ(1, cache.GetSize());
+
+    cache.Erase(1);
+    EXPECT_EQ(nullptr, cache.Get(1));
+    EXPECT_EQ(0, cache.GetSize());
+}
+
+TEST(TinyLfuBase, Capacity) {
+    auto cache = MakeCache(100);
+    EXPECT_EQ(100, cache.GetCapacity());
+
+    for (std::size_t i = 0; i < 1000; ++i) {
+        cache.Put(i, i);
+        EXPECT_LE(cache.GetSize(), cache.GetCapacity());
+    }
+    EXPECT_EQ(100, cache.GetSize());
+
+    cache.SetMaxSize(10);
+    EXPECT_EQ(10, cache.GetCapacity());
+    EXPECT_EQ(10, cache.GetSize());
+
+    cache.Clear();
+    EXPECT_EQ(0, cache.GetSize());
+}
+
+TEST(TinyLfuBase, SmallSize) {
+    auto cache = MakeCache(1);
+    EXPECT_EQ(3, cache.GetCapacity());
+
+    for (std::size_t i = 0; i < 10; ++i) {
+        cache.Put(i, i);
+    }
+    EXPECT_EQ(3, cache.GetSize());
+}
+
+TEST(TinyLfuBase, ScanResistance) {
+    constexpr std::size_t kHotItems = 60;
+    constexpr std::size_t kRounds = 100;
+    auto cache = MakeCache(100);
+    cache::LruMap<std::size_t, std::size_t> lru(100);
+
+    std::size_t hits = 0;
+    std::size_t lru_hits = 0;
+    std::size_t scan_item = 1000;
+    for (std::size_t i = 0; i < kRounds * kHotItems; ++i) {
+        const auto hot_item = i % kHotItems;
+        if (cache.Get(hot_item)) {
+            ++hits;
+        } else {
+            cache.Put(hot_item, hot_item);
+        }
+        if (lru.Get(hot_item)) {
+            ++lru_hits;
+        } else {
+            lru.Put(hot_item, hot_item);
+        }
+
+        // Items of the scan are used only once
+        if (!cache.Get(scan_item)) cache.Put(scan_item, scan_item);
+        if (!lru.Get(scan_item)) lru.Put(scan_item, scan_item);
+        ++scan_item;
+    }
+
+    EXPECT_EQ(0, lru_hits);
+    EXPECT_GT(hits, (kRounds - 10) * kHotItems);
+}
+
+TEST(TinyLfuBase, FrequencyAging) {
+    auto cache = MakeCache(10);
+    // Sample size is 10 times the capacity, the counters are halved after it
+    for (std::size_t i = 0; i < 100; ++i) {
+        cache.Get(1);
+    }
+    EXPECT_EQ(50, cache.GetFrequency(1));
+
+    for (std::size_t i = 0; i < 100; ++i) {
+        cache.Get(2);
+    }
+    EXPECT_LE(cache.GetFrequency(1), 13);
+}
+
+TEST(TinyLfuBase, LruMapTransparent) {
+    using Map = cache::LruMap<
+        std::string,
+        int,
+        std::hash<std::string_view>,
+        std::equal_to<std::string_view>,
+        cache::CachePolicy::kTinyLFU>;
+    Map cache(10);
+    cache.Put("a", 1);
+    ASSERT_NE(nullptr, cache.GetTransparent(std::string_view{"a"}));
+    EXPECT_EQ(1, *cache.GetTransparent(std::string_view{"a"}));
+
+    for (int i = 0; i < 100; ++i) {
+        cache.Put(std::to_string(i), i);
+    }
+    cache.VisitAll([](const std::string& key, int value) { EXPECT_EQ(key == "a" ? 1 : std::stoi(key), value); });
+}
+
+USERVER_NAMESPACE_END
@@ -80,5 +80,64 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+std::string Compress(std::string_view data, int compression_level) {
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const auto compressed_size =
+        ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), compression_level);
+    if (ZSTD_isError(compressed_size)) {
+        throw CompressionError(ZSTD_getErrorName(compressed_size));
+    }
+
+    compressed.resize(compressed_size);
+    return compressed;
+}
+
+struct StreamCompressor::Impl {
+    struct CCtxDeleter {
+        void operator()(ZSTD_CCtx* ptr) const noexcept { ZSTD_freeCCtx(ptr); }
+    };
+
+    std::unique_ptr<ZSTD_CCtx, CCtxDeleter> context{ZSTD_createCCtx()};
+
+    std::string Process(std::string_view input_data, ZSTD_EndDirective directive) {
+        std::string result;
+        ZSTD_inBuffer input{input_data.data(), input_data.size(), 0};
+        std::size_t remaining = 0;
+        do {
+            const auto old_size = result.size();
+            result.resize(old_size + ZSTD_CStreamOutSize());
+            ZSTD_outBuffer output{result.data() + old_size, result.size() - old_size, 0};
+            remaining = ZSTD_compressStream2(context.get(), &output, &input, directive);
+            if (ZSTD_isError(remaining)) {
+                throw CompressionError(ZSTD_getErrorName(remaining));
+            }
+            result.resize(old_size + output.pos);
+        } while (remaining != 0 || input.pos != input.size);
+
+        return result;
+    }
+};
+
+StreamCompressor::StreamCompressor(int compression_level) : impl_(std::make_unique<Impl>()) {
+    if (!impl_->context) {
+        throw std::runtime_error("Couldn't create ZSTD compression context");
+    }
+
+    const auto err_code = ZSTD_CCtx_setParameter(impl_->context.get(), ZSTD_c_compressionLevel, compression_level);
+    if (ZSTD_isError(err_code)) {
+        throw CompressionError(ZSTD_getErrorName(err_code));
+    }
+}
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&&) noexcept = default;
+
+StreamCompressor::~StreamCompressor() = default;
+
+std::string StreamCompressor::CompressChunk(std::string_view chunk) { return impl_->Process(chunk, ZSTD_e_flush); }
+
+std::string StreamCompressor::Finish() { return impl_->Process({}, ZSTD_e_end); }
+
 }  // namespace compression::zstd
 USERVER_NAMESPACE_END
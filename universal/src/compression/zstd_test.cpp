@@ -60,4 +60,30 @@ TEST(Zstd, TestOverflow) {
     );
 }
 
+TEST(Zstd, CompressRoundtrip) {
+    const std::string msg(16'000, 'a');
+
+    const auto compressed = compression::zstd::Compress(msg);
+    EXPECT_LT(compressed.size(), msg.size());
+    EXPECT_EQ(compression::zstd::Decompress(compressed, msg.size()), msg);
+}
+
+TEST(Zstd, StreamCompressorRoundtrip) {
+    compression::zstd::StreamCompressor compressor{1};
+
+    std::string compressed;
+    std::string expected;
+    for (int i = 0; i < 10; ++i) {
+        const auto chunk = "chunk #" + std::to_string(i) + ";";
+        expected += chunk;
+        // each chunk is flushed, so the output is never empty
+        const auto compressed_chunk = compressor.CompressChunk(chunk);
+        EXPECT_FALSE(compressed_chunk.empty());
+        compressed += compressed_chunk;
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()), expected);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,165 @@
+#include <formats/json/impl/member_index.hpp>
+
+#include <cstring>
+#include <functional>
+#include <limits>
+
+#include <rapidjson/document.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+std::size_t RoundUpToPowerOfTwo(std::size_t value) {
+    std::size_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+std::size_t HashKey(std::string_view key) noexcept { return std::hash<std::string_view>{}(key); }
+
+std::size_t HashObject(const Value* object) noexcept {
+    // rapidjson values are 16 or 24 bytes in size, drop the always-zero bits
+    return reinterpret_cast<std::uintptr_t>(object) >> 3;
+}
+
+const void* GetMembers(const Value& object) noexcept { return &*object.MemberBegin(); }
+
+}  // namespace
+
+MemberIndex::MemberIndex(const Value& object)
+    : members_(GetMembers(object)),
+      size_(object.MemberCount()),
+      // load factor of at most 0.5 keeps the probe sequences short
+      mask_(RoundUpToPowerOfTwo(size_ * 2) - 1),
+      slots_(std::make_unique<Slot[]>(mask_ + 1)) {
+    UASSERT(size_ < std::numeric_limits<std::uint32_t>::max());
+
+    std::uint32_t position = 0;
+    for (auto it = object.MemberBegin(); it != object.MemberEnd(); ++it) {
+        ++position;
+        const std::string_view key{it->name.GetString(), it->name.GetStringLength()};
+        const auto hash = HashKey(key);
+        auto i = hash & mask_;
+        while (slots_[i].position != 0) {
+            const auto& other = object.MemberBegin()[slots_[i].position - 1].name;
+            if (slots_[i].hash == hash && std::string_view{other.GetString(), other.GetStringLength()} == key) {
+                // rapidjson returns the first member for duplicate names
+                break;
+            }
+            i = (i + 1) & mask_;
+        }
+        if (slots_[i].position == 0) slots_[i] = Slot{hash, position};
+    }
+}
+
+bool MemberIndex::IsValidFor(const Value& object) const noexcept {
+    return object.MemberCount() == size_ && GetMembers(object) == members_;
+}
+
+const Value* MemberIndex::Find(const Value& object, std::string_view key) const {
+    UASSERT(IsValidFor(object));
+
+    const auto hash = HashKey(key);
+    for (auto i = hash & mask_; slots_[i].position != 0; i = (i + 1) & mask_) {
+        if (slots_[i].hash != hash) continue;
+
+        const auto& member = object.MemberBegin()[slots_[i].position - 1];
+        if (member.name.GetStringLength() == key.size() &&
+            std::memcmp(member.name.GetString(), key.data(), key.size()) == 0) {
+            return &member.value;
+        }
+    }
+    return nullptr;
+}
+
+class MemberIndexCache::Table final {
+public:
+    explicit Table(std::size_t capacity) : mask_(capacity - 1), slots_(std::make_unique<Slot[]>(capacity)) {}
+
+    std::size_t Capacity() const noexcept { return mask_ + 1; }
+
+    std::size_t Size() const noexcept { return size_; }
+
+    const MemberIndex* Find(const Value* object) const noexcept {
+        for (auto i = HashObject(object) & mask_;; i = (i + 1) & mask_) {
+            const auto* slot_object = slots_[i].object.load(std::memory_order_acquire);
+            if (slot_object == object) return slots_[i].index.load(std::memory_order_relaxed);
+            if (!slot_object) return nullptr;
+        }
+    }
+
+    // Must be called under the MemberIndexCache mutex
+    void Insert(const Value* object, const MemberIndex* index) noexcept {
+        UASSERT(size_ < Capacity());
+        auto i = HashObject(object) & mask_;
+        while (slots_[i].object.load(std::memory_order_relaxed)) i = (i + 1) & mask_;
+
+        slots_[i].index.store(index, std::memory_order_relaxed);
+        // publishes the index for the concurrent readers
+        slots_[i].object.store(object, std::memory_order_release);
+        ++size_;
+    }
+
+    void CopyTo(Table& other) const noexcept {
+        for (std::size_t i = 0; i < Capacity(); ++i) {
+            const auto* object = slots_[i].object.load(std::memory_order_relaxed);
+            if (object) other.Insert(object, slots_[i].index.load(std::memory_order_relaxed));
+        }
+    }
+
+private:
+    struct Slot {
+        std::atomic<const Value*> object{nullptr};
+        std::atomic<const MemberIndex*> index{nullptr};
+    };
+
+    const std::size_t mask_;
+    std::size_t size_{0};
+    std::unique_ptr<Slot[]> slots_;
+};
+
+MemberIndexCache::MemberIndexCache() = default;
+
+MemberIndexCache::~MemberIndexCache() = default;
+
+const MemberIndex* MemberIndexCache::GetOrBuild(const Value& object) {
+    UASSERT(object.IsObject());
+
+    const auto* table = table_.load(std::memory_order_acquire);
+    const MemberIndex* index = table ? table->Find(&object) : nullptr;
+
+    if (!index) {
+        // Concurrent builds of the same index are possible, the loser drops its copy
+        auto new_index = std::make_unique<const MemberIndex>(object);
+
+        const std::lock_guard lock{mutex_};
+        auto* current_table = table_.load(std::memory_order_relaxed);
+        index = current_table ? current_table->Find(&object) : nullptr;
+        if (!index) {
+            if (!current_table || (current_table->Size() + 1) * 2 > current_table->Capacity()) {
+                auto new_table = std::make_unique<Table>(current_table ? current_table->Capacity() * 2 : 16);
+                if (current_table) current_table->CopyTo(*new_table);
+                current_table = new_table.get();
+                tables_.push_back(std::move(new_table));
+            }
+
+            index = new_index.get();
+            indexes_.push_back(std::move(new_index));
+            current_table->Insert(&object, index);
+            table_.store(current_table, std::memory_order_release);
+        }
+    }
+
+    // An object that was indexed may be modified later by a ValueBuilder
+    // sharing the tree, never use a stale index
+    return index->IsValidFor(object) ? index : nullptr;
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Objects with fewer members are searched linearly, building the hash index
+/// for them does not pay off
+inline constexpr std::size_t kMemberIndexMinSize = 16;
+
+/// Hash index of the member names of a single object. Relies on the object
+/// not being modified after the index is built.
+class MemberIndex final {
+public:
+    explicit MemberIndex(const Value& object);
+
+    /// Checks that the members of the object were not reallocated
+    bool IsValidFor(const Value& object) const noexcept;
+
+    /// Returns the value of the member or nullptr
+    const Value* Find(const Value& object, std::string_view key) const;
+
+private:
+    struct Slot {
+        std::size_t hash{0};
+        // 1-based index of the member in the object, 0 for an empty slot
+        std::uint32_t position{0};
+    };
+
+    const void* members_;
+    std::size_t size_;
+    std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+};
+
+/// Lazily built indexes for the large objects of a single immutable json tree.
+/// Lookups of the already built indexes are lock-free.
+class MemberIndexCache final {
+public:
+    MemberIndexCache();
+    ~MemberIndexCache();
+
+    MemberIndexCache(const MemberIndexCache&) = delete;
+    MemberIndexCache& operator=(const MemberIndexCache&) = delete;
+
+    /// Returns nullptr if the object should be searched without the index
+    const MemberIndex* GetOrBuild(const Value& object);
+
+private:
+    class Table;
+
+    std::atomic<Table*> table_{nullptr};
+
+    std::mutex mutex_;
+    // Old tables are kept alive for the concurrent readers
+    std::vector<std::unique_ptr<Table>> tables_;
+    std::vector<std::unique_ptr<const MemberIndex>> indexes_;
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <formats/json/impl/types_impl.hpp>
 
+#include <memory>
+
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,6 +17,21 @@ VersionedValuePtr::Data::Data(Document&& doc) : Data(static_cast<Value&&>(doc))
     );
 }
 
+VersionedValuePtr::Data::~Data() { delete member_indexes.load(std::memory_order_relaxed); }
+
+MemberIndexCache& VersionedValuePtr::Data::GetMemberIndexes() {
+    auto* indexes = member_indexes.load(std::memory_order_acquire);
+    if (indexes) return *indexes;
+
+    auto new_indexes = std::make_unique<MemberIndexCache>();
+    if (member_indexes.compare_exchange_strong(
+            indexes, new_indexes.get(), std::memory_order_acq_rel, std::memory_order_acquire
+        )) {
+        return *new_indexes.release();
+    }
+    return *indexes;
+}
+
 VersionedValuePtr::VersionedValuePtr() noexcept = default;
 
 VersionedValuePtr::VersionedValuePtr(std::shared_ptr<Data>&& data) noexcept : data_(std::move(data)) {}
@@ -47,6 +64,18 @@ size_t VersionedValuePtr::Version() const { return data_ ? data_->version.load()
 
 void VersionedValuePtr::BumpVersion() { ++data_->version; }
 
+const Value* VersionedValuePtr::FindMember(const Value& object, std::string_view key) const {
+    UASSERT(object.IsObject());
+    if (data_ && object.MemberCount() >= kMemberIndexMinSize) {
+        if (const auto* index = data_->GetMemberIndexes().GetOrBuild(object)) {
+            return index->Find(object, key);
+        }
+    }
+
+    const auto it = object.FindMember(Value(::rapidjson::StringRef(key.data(), key.size())));
+    return it != object.MemberEnd() ? &it->value : nullptr;
+}
+
 }  // namespace formats::json::impl
 
 USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 
 #include <rapidjson/document.h>
 
+#include <formats/json/impl/member_index.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,7 +19,10 @@ struct VersionedValuePtr::Data {
     // https://github.com/Tencent/rapidjson/issues/387
     explicit Data(Document&&);
 
-    ~Data() = default;
+    ~Data();
+
+    // Created on the first lookup in a large object
+    MemberIndexCache& GetMemberIndexes();
 
     // native rapidjson value
     Value native;
@@ -26,6 +30,9 @@ struct VersionedValuePtr::Data {
     // version of internal rapidjson structures (member arrays)
     // used in ValueBuilder to avoid UAF, ignored in read-only Value
     std::atomic<size_t> version{0};
+
+    // hash indexes of the large objects, see MemberIndexCache
+    std::atomic<MemberIndexCache*> member_indexes{nullptr};
 };
 
 template <typename... Args>
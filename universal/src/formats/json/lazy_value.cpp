@@ -0,0 +1,631 @@
+#include <userver/formats/json/lazy_value.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <tuple>
+
+#include <fmt/format.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/reader.h>
+
+#include <formats/json/impl/exttypes.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+
+/// Text of the document and the positions of its objects and arrays
+class LazyDocument final {
+public:
+    struct Container {
+        // position of the opening bracket
+        std::size_t begin;
+        // position after the closing bracket
+        std::size_t end;
+    };
+
+    explicit LazyDocument(std::string&& json);
+
+    std::string_view GetJson() const noexcept { return json_; }
+
+    std::size_t GetContainerEnd(std::size_t begin) const {
+        const auto it = std::lower_bound(
+            containers_.begin(),
+            containers_.end(),
+            begin,
+            [](const Container& container, std::size_t position) { return container.begin < position; }
+        );
+        UASSERT(it != containers_.end() && it->begin == begin);
+        return it->end;
+    }
+
+private:
+    class Indexer;
+
+    std::string json_;
+    // sorted by `begin`
+    std::vector<Container> containers_;
+};
+
+namespace {
+
+bool IsWhitespace(char c) noexcept { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+bool IsScalarEnd(char c) noexcept { return c == ',' || c == '}' || c == ']' || IsWhitespace(c); }
+
+bool IsDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+bool IsHexDigit(char c) noexcept { return IsDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'); }
+
+std::string DecodeKey(std::string_view raw_key) {
+    if (raw_key.find('\\') == std::string_view::npos) return std::string{raw_key};
+    return FromString(fmt::format("\"{}\"", raw_key)).As<std::string>();
+}
+
+}  // namespace
+
+/// Validates the document the same way as formats::json::FromString does and
+/// remembers the positions of the containers. Does not build a DOM, does not
+/// copy the strings and does not convert the numbers, which makes it several
+/// times faster than the rapidjson parsing.
+class LazyDocument::Indexer final {
+public:
+    Indexer(std::string_view json, std::vector<Container>& containers) : json_(json), containers_(containers) {}
+
+    void Run() {
+        SkipWhitespace();
+        if (pos_ == json_.size()) Fail(::rapidjson::kParseErrorDocumentEmpty);
+
+        ParseValue(0);
+
+        SkipWhitespace();
+        if (pos_ != json_.size()) Fail(::rapidjson::kParseErrorDocumentRootNotSingular);
+    }
+
+private:
+    struct PathItem {
+        std::string_view key;
+        std::size_t index;
+        bool is_key;
+    };
+
+    [[noreturn]] void Fail(::rapidjson::ParseErrorCode code) const { Fail(code, pos_); }
+
+    [[noreturn]] void Fail(::rapidjson::ParseErrorCode code, std::size_t offset) const {
+        offset = std::min(offset, json_.size());
+        const auto line = 1 + std::count(json_.begin(), json_.begin() + offset, '\n');
+        const auto from_pos = json_.substr(0, offset).find_last_of('\n');
+        const auto column = offset > from_pos ? offset - from_pos : offset + 1;
+        throw ParseException(fmt::format(
+            "JSON parse error at line {} column {}: {}", line, column, ::rapidjson::GetParseError_En(code)
+        ));
+    }
+
+    char Peek() const noexcept { return pos_ < json_.size() ? json_[pos_] : '\0'; }
+
+    void SkipWhitespace() noexcept {
+        while (pos_ < json_.size() && IsWhitespace(json_[pos_])) ++pos_;
+    }
+
+    void CheckDepth(std::size_t depth) const {
+        // the same as the check of formats::json::FromString, that counts only
+        // the non-empty containers
+        if (depth >= kDepthParseLimit) {
+            throw ParseException("Exceeded maximum allowed JSON depth of: " + std::to_string(kDepthParseLimit));
+        }
+    }
+
+    // `depth` is the count of the containers that hold the value
+    void ParseValue(std::size_t depth) {
+        switch (Peek()) {
+            case '{':
+                ParseObject(depth + 1);
+                break;
+            case '[':
+                ParseArray(depth + 1);
+                break;
+            case '"':
+                ParseString();
+                break;
+            case 'n':
+                ParseLiteral("null");
+                break;
+            case 't':
+                ParseLiteral("true");
+                break;
+            case 'f':
+                ParseLiteral("false");
+                break;
+            default:
+                ParseNumber();
+        }
+    }
+
+    void ParseObject(std::size_t depth) {
+        const auto container_index = containers_.size();
+        containers_.push_back(Container{pos_, 0});
+        ++pos_;
+
+        SkipWhitespace();
+        if (Peek() == '}') {
+            containers_[container_index].end = ++pos_;
+            return;
+        }
+        CheckDepth(depth);
+
+        const auto keys_begin = keys_.size();
+        for (;;) {
+            if (Peek() != '"') Fail(::rapidjson::kParseErrorObjectMissName);
+            const auto raw_key = ParseString();
+            keys_.push_back(has_escapes_ ? escaped_keys_.emplace_back(DecodeKey(raw_key)) : raw_key);
+
+            SkipWhitespace();
+            if (Peek() != ':') Fail(::rapidjson::kParseErrorObjectMissColon);
+            ++pos_;
+            SkipWhitespace();
+
+            path_.push_back(PathItem{keys_.back(), 0, true});
+            ParseValue(depth);
+            path_.pop_back();
+
+            SkipWhitespace();
+            const auto c = Peek();
+            ++pos_;
+            if (c == '}') break;
+            if (c != ',') Fail(::rapidjson::kParseErrorObjectMissCommaOrCurlyBracket, pos_ - 1);
+            SkipWhitespace();
+        }
+
+        CheckKeyUniqueness(keys_begin);
+        keys_.resize(keys_begin);
+        containers_[container_index].end = pos_;
+    }
+
+    void ParseArray(std::size_t depth) {
+        const auto container_index = containers_.size();
+        containers_.push_back(Container{pos_, 0});
+        ++pos_;
+
+        SkipWhitespace();
+        if (Peek() == ']') {
+            containers_[container_index].end = ++pos_;
+            return;
+        }
+        CheckDepth(depth);
+
+        for (std::size_t index = 0;; ++index) {
+            path_.push_back(PathItem{{}, index, false});
+            ParseValue(depth);
+            path_.pop_back();
+
+            SkipWhitespace();
+            const auto c = Peek();
+            ++pos_;
+            if (c == ']') break;
+            if (c != ',') Fail(::rapidjson::kParseErrorArrayMissCommaOrSquareBracket, pos_ - 1);
+            SkipWhitespace();
+        }
+
+        containers_[container_index].end = pos_;
+    }
+
+    // Returns the raw string contents without quotes, sets has_escapes_
+    std::string_view ParseString() {
+        UASSERT(Peek() == '"');
+        const auto begin = ++pos_;
+        has_escapes_ = false;
+
+        for (;;) {
+            // the fast path for the usual characters
+            while (pos_ < json_.size()) {
+                const auto c = static_cast<unsigned char>(json_[pos_]);
+                if (c == '"' || c == '\\' || c < 0x20) break;
+                ++pos_;
+            }
+
+            const auto c = Peek();
+            if (c == '"') {
+                return json_.substr(begin, pos_++ - begin);
+            } else if (c == '\\') {
+                has_escapes_ = true;
+                ParseEscape();
+            } else if (c == '\0' && pos_ == json_.size()) {
+                Fail(::rapidjson::kParseErrorStringMissQuotationMark);
+            } else {
+                Fail(::rapidjson::kParseErrorStringInvalidEncoding);
+            }
+        }
+    }
+
+    void ParseEscape() {
+        const auto escape_begin = pos_++;
+        switch (Peek()) {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+                ++pos_;
+                return;
+            case 'u': {
+                ++pos_;
+                const auto codepoint = ParseHex4(escape_begin);
+                if (codepoint >= 0xD800 && codepoint <= 0xDFFF) {
+                    // high surrogate must be followed by a low one
+                    if (codepoint > 0xDBFF || json_.substr(pos_, 2) != "\\u") {
+                        Fail(::rapidjson::kParseErrorStringUnicodeSurrogateInvalid, escape_begin);
+                    }
+                    pos_ += 2;
+                    const auto low_codepoint = ParseHex4(escape_begin);
+                    if (low_codepoint < 0xDC00 || low_codepoint > 0xDFFF) {
+                        Fail(::rapidjson::kParseErrorStringUnicodeSurrogateInvalid, escape_begin);
+                    }
+                }
+                return;
+            }
+            default:
+                Fail(::rapidjson::kParseErrorStringEscapeInvalid, escape_begin);
+        }
+    }
+
+    unsigned ParseHex4(std::size_t escape_begin) {
+        if (pos_ + 4 > json_.size()) Fail(::rapidjson::kParseErrorStringUnicodeEscapeInvalidHex, escape_begin);
+
+        unsigned codepoint = 0;
+        for (std::size_t i = 0; i < 4; ++i, ++pos_) {
+            const auto c = json_[pos_];
+            if (!IsHexDigit(c)) Fail(::rapidjson::kParseErrorStringUnicodeEscapeInvalidHex, escape_begin);
+            codepoint = codepoint * 16 + (IsDigit(c) ? c - '0' : (c | 0x20) - 'a' + 10);
+        }
+        return codepoint;
+    }
+
+    void ParseLiteral(std::string_view literal) {
+        if (json_.substr(pos_, literal.size()) != literal) Fail(::rapidjson::kParseErrorValueInvalid);
+        pos_ += literal.size();
+    }
+
+    void ParseNumber() {
+        const auto begin = pos_;
+        if (Peek() == '-') ++pos_;
+
+        if (Peek() == '0') {
+            ++pos_;
+        } else if (IsDigit(Peek())) {
+            while (IsDigit(Peek())) ++pos_;
+        } else {
+            Fail(::rapidjson::kParseErrorValueInvalid, begin);
+        }
+
+        bool is_simple = true;
+        if (Peek() == '.') {
+            ++pos_;
+            if (!IsDigit(Peek())) Fail(::rapidjson::kParseErrorNumberMissFraction);
+            while (IsDigit(Peek())) ++pos_;
+        }
+        if (Peek() == 'e' || Peek() == 'E') {
+            is_simple = false;
+            ++pos_;
+            if (Peek() == '+' || Peek() == '-') ++pos_;
+            if (!IsDigit(Peek())) Fail(::rapidjson::kParseErrorNumberMissExponent);
+            while (IsDigit(Peek())) ++pos_;
+        }
+
+        // Only the numbers with exponents or with a lot of digits may not fit
+        // into double, leave the exact check to rapidjson
+        constexpr std::size_t kMaxSimpleNumberLength = 300;
+        if (!is_simple || pos_ - begin > kMaxSimpleNumberLength) {
+            const std::string number{json_.substr(begin, pos_ - begin)};
+            ::rapidjson::StringStream stream{number.c_str()};
+            ::rapidjson::BaseReaderHandler<> handler;
+            ::rapidjson::Reader reader;
+            const auto ok = reader.Parse<::rapidjson::kParseDefaultFlags>(stream, handler);
+            if (!ok) Fail(ok.Code(), begin + ok.Offset());
+        }
+    }
+
+    void CheckKeyUniqueness(std::size_t keys_begin) {
+        const auto begin = keys_.begin() + keys_begin;
+        std::sort(begin, keys_.end(), [](const auto& lhs, const auto& rhs) {
+            const auto lhs_size = lhs.size();
+            const auto rhs_size = rhs.size();
+            return std::tie(lhs_size, lhs) < std::tie(rhs_size, rhs);
+        });
+        const auto duplicate = std::adjacent_find(begin, keys_.end());
+        if (duplicate != keys_.end()) {
+            throw ParseException("Duplicate key: " + std::string{*duplicate} + " at " + GetPath());
+        }
+    }
+
+    std::string GetPath() const {
+        std::string path;
+        for (const auto& item : path_) {
+            if (item.is_key) {
+                common::AppendPath(path, item.key);
+            } else {
+                common::AppendPath(path, item.index);
+            }
+        }
+        return path.empty() ? std::string{common::kPathRoot} : path;
+    }
+
+    const std::string_view json_;
+    std::size_t pos_{0};
+    bool has_escapes_{false};
+
+    std::vector<Container>& containers_;
+    std::vector<PathItem> path_;
+    std::vector<std::string_view> keys_;
+    std::deque<std::string> escaped_keys_;
+};
+
+LazyDocument::LazyDocument(std::string&& json) : json_(std::move(json)) {
+    if (json_.empty()) {
+        throw ParseException("JSON document is empty");
+    }
+
+    Indexer{json_, containers_}.Run();
+}
+
+}  // namespace impl
+
+namespace {
+
+using Document = impl::LazyDocument;
+using impl::DecodeKey;
+
+std::size_t SkipWhitespace(std::string_view json, std::size_t pos) noexcept {
+    while (pos < json.size() && impl::IsWhitespace(json[pos])) ++pos;
+    return pos;
+}
+
+// `pos` points to the opening quote, returns the position after the closing one
+std::size_t SkipString(std::string_view json, std::size_t pos) noexcept {
+    UASSERT(json[pos] == '"');
+    for (++pos;; ++pos) {
+        pos = json.find_first_of("\"\\", pos);
+        UASSERT(pos != std::string_view::npos);
+        if (json[pos] == '"') return pos + 1;
+        ++pos;  // skip the escaped character
+    }
+}
+
+std::size_t SkipValue(const Document& document, std::size_t pos) {
+    const auto json = document.GetJson();
+    switch (json[pos]) {
+        case '{':
+        case '[':
+            return document.GetContainerEnd(pos);
+        case '"':
+            return SkipString(json, pos);
+        default:
+            while (pos < json.size() && !impl::IsScalarEnd(json[pos])) ++pos;
+            return pos;
+    }
+}
+
+// Calls `func(raw_key, value_begin, value_end)` for the members of the object
+// at `begin` until it returns true
+template <typename Func>
+void ForEachMember(const Document& document, std::size_t begin, Func&& func) {
+    const auto json = document.GetJson();
+    UASSERT(json[begin] == '{');
+
+    auto pos = SkipWhitespace(json, begin + 1);
+    if (json[pos] == '}') return;
+    for (;;) {
+        const auto key_end = SkipString(json, pos);
+        const auto raw_key = json.substr(pos + 1, key_end - pos - 2);
+        pos = SkipWhitespace(json, key_end);
+        UASSERT(json[pos] == ':');
+        const auto value_begin = SkipWhitespace(json, pos + 1);
+        const auto value_end = SkipValue(document, value_begin);
+        if (func(raw_key, value_begin, value_end)) return;
+
+        pos = SkipWhitespace(json, value_end);
+        if (json[pos] == '}') return;
+        UASSERT(json[pos] == ',');
+        pos = SkipWhitespace(json, pos + 1);
+    }
+}
+
+// Calls `func(value_begin, value_end)` for the elements of the array at `begin`
+// until it returns true
+template <typename Func>
+void ForEachElement(const Document& document, std::size_t begin, Func&& func) {
+    const auto json = document.GetJson();
+    UASSERT(json[begin] == '[');
+
+    auto pos = SkipWhitespace(json, begin + 1);
+    if (json[pos] == ']') return;
+    for (;;) {
+        const auto value_end = SkipValue(document, pos);
+        if (func(pos, value_end)) return;
+
+        pos = SkipWhitespace(json, value_end);
+        if (json[pos] == ']') return;
+        UASSERT(json[pos] == ',');
+        pos = SkipWhitespace(json, pos + 1);
+    }
+}
+
+bool IsKeyEqual(std::string_view raw_key, std::string_view key) {
+    if (raw_key.find('\\') == std::string_view::npos) return raw_key == key;
+    return DecodeKey(raw_key) == key;
+}
+
+int GetExtendedType(std::string_view raw_json) {
+    switch (raw_json.front()) {
+        case 'n':
+            return impl::nullValue;
+        case 't':
+        case 'f':
+            return impl::booleanValue;
+        case '"':
+            return impl::stringValue;
+        case '{':
+            return impl::objectValue;
+        case '[':
+            return impl::arrayValue;
+        default:
+            if (raw_json.find_first_of(".eE") != std::string_view::npos) return impl::realValue;
+            return raw_json.front() == '-' ? impl::intValue : impl::uintValue;
+    }
+}
+
+}  // namespace
+
+LazyValue::LazyValue() noexcept = default;
+
+LazyValue::LazyValue(std::string doc)
+    : document_(std::make_shared<const impl::LazyDocument>(std::move(doc))),
+      path_(common::kPathRoot) {
+    const auto json = document_->GetJson();
+    begin_ = SkipWhitespace(json, 0);
+    end_ = SkipValue(*document_, begin_);
+}
+
+LazyValue::LazyValue(
+    std::shared_ptr<const impl::LazyDocument> document,
+    std::size_t begin,
+    std::size_t end,
+    std::string path
+)
+    : document_(std::move(document)), begin_(begin), end_(end), path_(std::move(path)) {}
+
+LazyValue::LazyValue(const LazyValue&) = default;
+
+LazyValue::LazyValue(LazyValue&&) noexcept = default;
+
+LazyValue& LazyValue::operator=(const LazyValue&) = default;
+
+LazyValue& LazyValue::operator=(LazyValue&&) noexcept = default;
+
+LazyValue::~LazyValue() = default;
+
+LazyValue LazyValue::operator[](std::string_view key) const {
+    if (IsMissing()) return {document_, 0, 0, common::MakeChildPath(GetPath(), key)};
+
+    CheckObjectOrNull();
+    std::size_t value_begin = 0;
+    std::size_t value_end = 0;
+    if (IsObject()) {
+        ForEachMember(*document_, begin_, [&](std::string_view raw_key, std::size_t begin, std::size_t end) {
+            if (!IsKeyEqual(raw_key, key)) return false;
+            value_begin = begin;
+            value_end = end;
+            return true;
+        });
+    }
+    return {document_, value_begin, value_end, common::MakeChildPath(path_, key)};
+}
+
+LazyValue LazyValue::operator[](std::size_t index) const {
+    CheckNotMissing();
+    if (!IsArray()) {
+        throw TypeMismatchException(GetExtendedType(GetRawJson()), impl::arrayValue, path_);
+    }
+
+    std::size_t current = 0;
+    std::size_t value_begin = 0;
+    std::size_t value_end = 0;
+    ForEachElement(*document_, begin_, [&](std::size_t begin, std::size_t end) {
+        if (current++ != index) return false;
+        value_begin = begin;
+        value_end = end;
+        return true;
+    });
+    if (value_begin == value_end) {
+        throw OutOfBoundsException(index, current, path_);
+    }
+    return {document_, value_begin, value_end, common::MakeChildPath(path_, index)};
+}
+
+bool LazyValue::HasMember(std::string_view key) const { return !(*this)[key].IsMissing(); }
+
+std::vector<std::string> LazyValue::GetMemberNames() const {
+    CheckNotMissing();
+    CheckObjectOrNull();
+
+    std::vector<std::string> result;
+    if (IsObject()) {
+        ForEachMember(*document_, begin_, [&result](std::string_view raw_key, std::size_t, std::size_t) {
+            result.push_back(DecodeKey(raw_key));
+            return false;
+        });
+    }
+    return result;
+}
+
+std::size_t LazyValue::GetSize() const {
+    CheckNotMissing();
+
+    std::size_t size = 0;
+    if (IsObject()) {
+        ForEachMember(*document_, begin_, [&size](std::string_view, std::size_t, std::size_t) {
+            ++size;
+            return false;
+        });
+    } else if (IsArray()) {
+        ForEachElement(*document_, begin_, [&size](std::size_t, std::size_t) {
+            ++size;
+            return false;
+        });
+    } else {
+        throw TypeMismatchException(GetExtendedType(GetRawJson()), impl::arrayValue, path_);
+    }
+    return size;
+}
+
+bool LazyValue::IsMissing() const noexcept { return begin_ == end_; }
+
+bool LazyValue::IsNull() const noexcept { return FirstChar() == 'n'; }
+
+bool LazyValue::IsBool() const noexcept { return FirstChar() == 't' || FirstChar() == 'f'; }
+
+bool LazyValue::IsDouble() const noexcept {
+    const auto c = FirstChar();
+    return c == '-' || (c >= '0' && c <= '9');
+}
+
+bool LazyValue::IsString() const noexcept { return FirstChar() == '"'; }
+
+bool LazyValue::IsArray() const noexcept { return FirstChar() == '['; }
+
+bool LazyValue::IsObject() const noexcept { return FirstChar() == '{'; }
+
+std::string LazyValue::GetPath() const { return path_.empty() ? std::string{common::kPathRoot} : path_; }
+
+std::string_view LazyValue::GetRawJson() const {
+    CheckNotMissing();
+    return document_->GetJson().substr(begin_, end_ - begin_);
+}
+
+Value LazyValue::Materialize() const { return FromString(GetRawJson()); }
+
+void LazyValue::CheckNotMissing() const {
+    if (IsMissing()) {
+        throw MemberMissingException(GetPath());
+    }
+}
+
+void LazyValue::CheckObjectOrNull() const {
+    if (!IsNull() && !IsObject()) {
+        throw TypeMismatchException(GetExtendedType(GetRawJson()), impl::objectValue, path_);
+    }
+}
+
+char LazyValue::FirstChar() const noexcept { return IsMissing() ? '\0' : document_->GetJson()[begin_]; }
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// A large ingest request: a few top-level fields and a big payload
+std::string MakeLargeRequest(std::size_t items_count) {
+    formats::json::ValueBuilder items{formats::json::Type::kArray};
+    for (std::size_t i = 0; i < items_count; ++i) {
+        formats::json::ValueBuilder item;
+        item["id"] = i;
+        item["name"] = "item name " + std::to_string(i);
+        item["price"] = i * 1.5;
+        item["tags"].PushBack("some tag");
+        item["tags"].PushBack("other tag");
+        items.PushBack(std::move(item));
+    }
+
+    formats::json::ValueBuilder builder;
+    builder["request_id"] = "abcdef0123456789";
+    builder["items"] = std::move(items);
+    builder["source"] = "benchmark";
+    builder["version"] = 3;
+    return formats::json::ToString(builder.ExtractValue());
+}
+
+}  // namespace
+
+void json_read_fields_eager(benchmark::State& state) {
+    const auto request = MakeLargeRequest(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto json = formats::json::FromString(request);
+        benchmark::DoNotOptimize(json["request_id"].As<std::string>());
+        benchmark::DoNotOptimize(json["source"].As<std::string>());
+        benchmark::DoNotOptimize(json["version"].As<int>());
+    }
+    state.SetBytesProcessed(state.iterations() * request.size());
+}
+BENCHMARK(json_read_fields_eager)->RangeMultiplier(10)->Range(10, 10'000);
+
+void json_read_fields_lazy(benchmark::State& state) {
+    const auto request = MakeLargeRequest(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        const formats::json::LazyValue json{request};
+        benchmark::DoNotOptimize(json["request_id"].As<std::string>());
+        benchmark::DoNotOptimize(json["source"].As<std::string>());
+        benchmark::DoNotOptimize(json["version"].As<int>());
+    }
+    state.SetBytesProcessed(state.iterations() * request.size());
+}
+BENCHMARK(json_read_fields_lazy)->RangeMultiplier(10)->Range(10, 10'000);
+
+// Worst case for the lazy parsing: the whole document is read
+void json_read_all_lazy(benchmark::State& state) {
+    const auto request = MakeLargeRequest(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        const formats::json::LazyValue json{request};
+        benchmark::DoNotOptimize(json.Materialize());
+    }
+    state.SetBytesProcessed(state.iterations() * request.size());
+}
+BENCHMARK(json_read_all_lazy)->RangeMultiplier(10)->Range(10, 10'000);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kDoc = R"({
+    "id": 42,
+    "name": "some \"quoted\" name with } and ]",
+    "tags": ["a", "b", {"c": [1, 2, 3]}],
+    "nested": {"deeply": {"value": -1.5e3, "flag": true, "nothing": null}},
+    "esc\u0061ped key": "escaped",
+    "empty_object": {},
+    "empty_array": []
+})";
+
+}  // namespace
+
+TEST(FormatsJsonLazyValue, Sample) {
+    /// [Sample formats::json::LazyValue usage]
+    const formats::json::LazyValue json{std::string{kDoc}};
+
+    // Only the accessed values are parsed
+    EXPECT_EQ(json["id"].As<int>(), 42);
+    EXPECT_EQ(json["nested"]["deeply"]["value"].As<double>(), -1500.0);
+    EXPECT_EQ(json["tags"][2]["c"].As<std::vector<int>>(), (std::vector<int>{1, 2, 3}));
+
+    EXPECT_FALSE(json.HasMember("missing"));
+    EXPECT_EQ(json["missing"].As<int>(10), 10);
+    /// [Sample formats::json::LazyValue usage]
+}
+
+TEST(FormatsJsonLazyValue, Types) {
+    const formats::json::LazyValue json{std::string{kDoc}};
+
+    EXPECT_TRUE(json.IsObject());
+    EXPECT_TRUE(json["id"].IsDouble());
+    EXPECT_TRUE(json["name"].IsString());
+    EXPECT_TRUE(json["tags"].IsArray());
+    EXPECT_TRUE(json["nested"]["deeply"]["flag"].IsBool());
+    EXPECT_TRUE(json["nested"]["deeply"]["nothing"].IsNull());
+    EXPECT_TRUE(json["missing"].IsMissing());
+    EXPECT_FALSE(json["missing"].IsNull());
+    EXPECT_TRUE(json["missing"]["nested"].IsMissing());
+
+    EXPECT_EQ(json.GetSize(), 7);
+    EXPECT_EQ(json["tags"].GetSize(), 3);
+    EXPECT_EQ(json["empty_object"].GetSize(), 0);
+    EXPECT_EQ(json["empty_array"].GetSize(), 0);
+}
+
+TEST(FormatsJsonLazyValue, Strings) {
+    const formats::json::LazyValue json{std::string{kDoc}};
+
+    EXPECT_EQ(json["name"].As<std::string>(), "some \"quoted\" name with } and ]");
+    EXPECT_EQ(json["escaped key"].As<std::string>(), "escaped");
+    EXPECT_EQ(
+        json.GetMemberNames(),
+        (std::vector<std::string>{"id", "name", "tags", "nested", "escaped key", "empty_object", "empty_array"})
+    );
+}
+
+TEST(FormatsJsonLazyValue, SameAsValue) {
+    const formats::json::LazyValue lazy{std::string{kDoc}};
+    const auto json = formats::json::FromString(kDoc);
+
+    EXPECT_EQ(lazy.Materialize(), json);
+    EXPECT_EQ(lazy["nested"].Materialize(), json["nested"]);
+    EXPECT_EQ(lazy["tags"][2].Materialize(), json["tags"][2]);
+    EXPECT_EQ(lazy["nested"]["deeply"]["value"].GetRawJson(), "-1.5e3");
+}
+
+TEST(FormatsJsonLazyValue, Paths) {
+    const formats::json::LazyValue json{std::string{kDoc}};
+
+    EXPECT_EQ(json.GetPath(), "/");
+    EXPECT_EQ(json["tags"][2]["c"].GetPath(), "tags[2].c");
+    EXPECT_EQ(json["missing"]["nested"].GetPath(), "missing.nested");
+
+    try {
+        json["missing"].As<int>();
+        FAIL() << "MemberMissingException was not thrown";
+    } catch (const formats::json::MemberMissingException& e) {
+        EXPECT_EQ(e.GetPath(), "missing");
+    }
+}
+
+TEST(FormatsJsonLazyValue, Exceptions) {
+    const formats::json::LazyValue json{std::string{kDoc}};
+
+    EXPECT_THROW(json["id"]["key"], formats::json::TypeMismatchException);
+    EXPECT_THROW(json["id"][0], formats::json::TypeMismatchException);
+    EXPECT_THROW(json["tags"][3], formats::json::OutOfBoundsException);
+    EXPECT_THROW(json["tags"]["key"], formats::json::TypeMismatchException);
+    EXPECT_THROW(json["name"].As<int>(), formats::json::TypeMismatchException);
+    EXPECT_THROW(json["missing"].Materialize(), formats::json::MemberMissingException);
+}
+
+TEST(FormatsJsonLazyValue, Scalars) {
+    EXPECT_EQ(formats::json::LazyValue{" 42 "}.As<int>(), 42);
+    EXPECT_EQ(formats::json::LazyValue{"\"str\""}.As<std::string>(), "str");
+    EXPECT_TRUE(formats::json::LazyValue{"null"}.IsNull());
+    EXPECT_TRUE(formats::json::LazyValue{}.IsMissing());
+}
+
+TEST(FormatsJsonLazyValue, ParseErrors) {
+    using formats::json::LazyValue;
+    using formats::json::ParseException;
+
+    EXPECT_THROW(LazyValue{""}, ParseException);
+    EXPECT_THROW(LazyValue{"  "}, ParseException);
+    EXPECT_THROW(LazyValue{"{"}, ParseException);
+    EXPECT_THROW(LazyValue{R"({"a": 1,})"}, ParseException);
+    EXPECT_THROW(LazyValue{R"({"a": 1} {})"}, ParseException);
+    EXPECT_THROW(LazyValue{R"([1, 2)"}, ParseException);
+
+    try {
+        LazyValue{R"({"a": {"b": 1, "c": 2, "b": 3}})"};
+        FAIL() << "ParseException was not thrown";
+    } catch (const ParseException& e) {
+        EXPECT_STREQ(e.what(), "Duplicate key: b at a");
+    }
+    EXPECT_NO_THROW(LazyValue{R"([{"a": 1}, {"a": 2}])"});
+}
+
+TEST(FormatsJsonLazyValue, SameValidationAsFromString) {
+    const std::vector<std::string> docs = {
+        R"("\u0041\ud83d\ude00")",
+        R"("\ud83d")",
+        R"("\ude00")",
+        R"("\ud83d\u0041")",
+        R"("\u00g0")",
+        R"("\x")",
+        "\"\tunescaped tab\"",
+        R"("unterminated)",
+        R"(["\/\b\f\n\r\t\"\\"])",
+        "[0, -0, 1.5, -1.5e10, 1E+2, 1e-2]",
+        "01",
+        "-",
+        "1.",
+        ".5",
+        "1e",
+        "+1",
+        "1e400",
+        "-1e400",
+        "1" + std::string(400, '0'),
+        "[nul]",
+        "[true, false, null]",
+        "[True]",
+        R"({"a" 1})",
+        R"({1: 1})",
+        R"({"a": 1 "b": 2})",
+        "[1 2]",
+        "[,]",
+        " \n\r\t[ ] \n",
+        "[] \f",
+    };
+
+    for (const auto& doc : docs) {
+        bool eager_ok = true;
+        try {
+            formats::json::FromString(doc);
+        } catch (const formats::json::ParseException&) {
+            eager_ok = false;
+        }
+
+        if (eager_ok) {
+            EXPECT_NO_THROW(formats::json::LazyValue{doc}) << doc;
+        } else {
+            EXPECT_THROW(formats::json::LazyValue{doc}, formats::json::ParseException) << doc;
+        }
+    }
+}
+
+TEST(FormatsJsonLazyValue, DepthLimit) {
+    const auto make_nested = [](std::size_t depth) {
+        return std::string(depth, '[') + "1" + std::string(depth, ']');
+    };
+    const auto max_depth = formats::json::kDepthParseLimit - 1;
+
+    EXPECT_NO_THROW(formats::json::FromString(make_nested(max_depth)));
+    EXPECT_NO_THROW(formats::json::LazyValue{make_nested(max_depth)});
+
+    EXPECT_THROW(formats::json::FromString(make_nested(max_depth + 1)), formats::json::ParseException);
+    EXPECT_THROW(formats::json::LazyValue{make_nested(max_depth + 1)}, formats::json::ParseException);
+    EXPECT_THROW(formats::json::LazyValue{make_nested(100'000)}, formats::json::ParseException);
+}
+
+USERVER_NAMESPACE_END
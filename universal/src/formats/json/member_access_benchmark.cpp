@@ -1,4 +1,7 @@
+#include <cstdint>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -107,6 +110,47 @@ formats::json::ValueBuilder Build(size_t count) {
     return builder;
 }
 
+void json_object_member_access(benchmark::State& state) {
+    const auto size = state.range(0);
+    const auto json = Build(size).ExtractValue();
+
+    std::vector<std::string> keys;
+    for (std::int64_t i = 0; i < size; ++i) keys.push_back(std::to_string(i));
+
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(json[keys[i++ % keys.size()]]);
+    }
+}
+BENCHMARK(json_object_member_access)->Arg(10)->Arg(100)->Arg(1000);
+
+void json_object_has_member_missing(benchmark::State& state) {
+    const auto size = state.range(0);
+    const auto json = Build(size).ExtractValue();
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(json.HasMember("missing"));
+    }
+}
+BENCHMARK(json_object_has_member_missing)->Arg(10)->Arg(100)->Arg(1000);
+
+// A handler that reads a few dozens of fields from a large request
+void json_object_read_fields(benchmark::State& state) {
+    const auto size = state.range(0);
+    constexpr std::int64_t kFieldsCount = 50;
+
+    std::vector<std::string> keys;
+    for (std::int64_t i = 0; i < kFieldsCount; ++i) keys.push_back(std::to_string(i * size / kFieldsCount));
+
+    const auto json = formats::json::FromString(formats::json::ToString(Build(size).ExtractValue()));
+    for ([[maybe_unused]] auto _ : state) {
+        std::size_t sum = 0;
+        for (const auto& key : keys) sum += json[key].As<std::size_t>();
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(json_object_read_fields)->Arg(100)->Arg(1000);
+
 void json_object_append(benchmark::State& state) {
     const auto size = state.range(0);
     for ([[maybe_unused]] auto _ : state) {
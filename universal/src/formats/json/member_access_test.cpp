@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/inline.hpp>
@@ -119,4 +122,82 @@ TEST_F(FormatsJsonSpecificMemberAccess, OutOfBoundsExceptionAccessToAttributes)
     }
 }
 
+TEST(FormatsJsonLargeObject, MemberAccess) {
+    formats::json::ValueBuilder builder{formats::json::Type::kObject};
+    for (int i = 0; i < 1000; ++i) {
+        builder["key" + std::to_string(i)] = i;
+    }
+    const auto doc = builder.ExtractValue();
+
+    for (int round = 0; round < 2; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            const auto key = "key" + std::to_string(i);
+            ASSERT_TRUE(doc.HasMember(key));
+            EXPECT_EQ(doc[key].As<int>(), i);
+            EXPECT_EQ(doc[key].GetPath(), key);
+        }
+        EXPECT_FALSE(doc.HasMember("key1000"));
+        EXPECT_FALSE(doc.HasMember(""));
+        EXPECT_TRUE(doc["missing"].IsMissing());
+        EXPECT_EQ(doc["missing"]["nested"].GetPath(), "missing.nested");
+    }
+}
+
+TEST(FormatsJsonLargeObject, DuplicateKeys) {
+    formats::json::ValueBuilder builder{formats::json::Type::kObject};
+    builder.EmplaceNocheck("dup", 1);
+    for (int i = 0; i < 100; ++i) {
+        builder.EmplaceNocheck("key" + std::to_string(i), i);
+    }
+    builder.EmplaceNocheck("dup", 2);
+    const auto doc = builder.ExtractValue();
+
+    // same as for small objects, the first member wins
+    EXPECT_EQ(doc["dup"].As<int>(), 1);
+    EXPECT_EQ(doc["key99"].As<int>(), 99);
+}
+
+TEST(FormatsJsonLargeObject, ConcurrentAccess) {
+    formats::json::ValueBuilder builder{formats::json::Type::kArray};
+    for (int i = 0; i < 16; ++i) {
+        formats::json::ValueBuilder object{formats::json::Type::kObject};
+        for (int j = 0; j < 100; ++j) {
+            object[std::to_string(j)] = i * j;
+        }
+        builder.PushBack(std::move(object));
+    }
+    const auto doc = builder.ExtractValue();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&doc] {
+            for (int i = 0; i < 16; ++i) {
+                for (int j = 0; j < 100; ++j) {
+                    EXPECT_EQ(doc[i][std::to_string(j)].As<int>(), i * j);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+}
+
+TEST(FormatsJsonLargeObject, BuilderModifications) {
+    formats::json::ValueBuilder builder{formats::json::Type::kObject};
+    for (int i = 0; i < 100; ++i) {
+        builder[std::to_string(i)] = i;
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(builder.HasMember(std::to_string(i)));
+        builder.Remove(std::to_string(i));
+        builder[std::to_string(i + 100)] = i;
+        EXPECT_FALSE(builder.HasMember(std::to_string(i)));
+        EXPECT_TRUE(builder.HasMember(std::to_string(i + 100)));
+    }
+
+    const auto doc = builder.ExtractValue();
+    EXPECT_FALSE(doc.HasMember("0"));
+    EXPECT_EQ(doc["199"].As<int>(), 99);
+}
+
 USERVER_NAMESPACE_END
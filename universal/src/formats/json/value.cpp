@@ -133,9 +133,8 @@ Value Value::operator[](std::string_view key) const {
     if (!IsMissing()) {
         CheckObjectOrNull();
         if (IsObject()) {
-            auto it = GetNative().FindMember(impl::Value(::rapidjson::StringRef(key.data(), key.size())));
-            if (it != GetNative().MemberEnd()) {
-                return {EmplaceEnabler{}, holder_, root_ptr_for_path_, &it->value, depth_ + 1};
+            if (const auto* member = holder_.FindMember(GetNative(), key)) {
+                return {EmplaceEnabler{}, holder_, root_ptr_for_path_, member, depth_ + 1};
             }
         }
 
@@ -362,7 +361,7 @@ std::string Value::ConvertTo<std::string>() const {
 bool Value::HasMember(std::string_view key) const {
     if (IsMissing()) return false;
     CheckObjectOrNull();
-    return IsObject() && GetNative().HasMember(impl::Value(::rapidjson::StringRef(key.data(), key.size())));
+    return IsObject() && holder_.FindMember(GetNative(), key) != nullptr;
 }
 
 std::string Value::GetPath() const {
@@ -165,7 +165,12 @@ bool ValueBuilder::IsObject() const noexcept { return value_->IsObject(); }
 
 std::size_t ValueBuilder::GetSize() const { return value_->GetSize(); }
 
-bool ValueBuilder::HasMember(std::string_view key) const { return value_->HasMember(key); }
+bool ValueBuilder::HasMember(std::string_view key) const {
+    // The tree is being modified, so the member index of Value is not used
+    if (value_->IsMissing()) return false;
+    value_->CheckObjectOrNull();
+    return value_->IsObject() && value_->GetNative().HasMember(impl::MakeJsonStringViewValue(key));
+}
 
 std::string ValueBuilder::GetPath() const { return value_->GetPath(); }
 
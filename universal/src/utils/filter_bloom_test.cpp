@@ -92,4 +92,23 @@ TEST(FilterBloom, Clear) {
     EXPECT_EQ(false, filter.Has(2));
 }
 
+TEST(FilterBloom, Saturation) {
+    utils::FilterBloom<std::size_t, uint8_t> filter(1024);
+    for (std::size_t i = 0; i < 1000; ++i) {
+        filter.Increment(1);
+    }
+    EXPECT_EQ(255, filter.Estimate(1));
+}
+
+TEST(FilterBloom, Halve) {
+    utils::FilterBloom<std::size_t, uint8_t> filter(1024);
+    for (std::size_t i = 0; i < 7; ++i) {
+        filter.Increment(1);
+    }
+    filter.Increment(2);
+    filter.Halve();
+    EXPECT_EQ(3, filter.Estimate(1));
+    EXPECT_EQ(false, filter.Has(2));
+}
+
 USERVER_NAMESPACE_END